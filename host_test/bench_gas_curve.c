@@ -0,0 +1,72 @@
+// Время расчёта всех газов за цикл: табличный gas_curve_eval_all
+// против прежнего пути с powf на каждый газ. Заодно проверяется, что
+// оба пути дают одно и то же с точностью из gas_curve.h.
+//
+//   bench_gas_curve [циклов]
+#include "gas_curve.h"
+#include "test_util.h"
+#include <time.h>
+
+#define RATIOS 1024
+
+static double now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Как до таблиц: ppm = k * (Rs/Ro)^e с ограничением диапазона
+static void powf_all(float ratio, float* out)
+{
+    for (int g = 0; g < GAS_COUNT; g++) {
+        const gas_curve_t* c = &gas_curves[g];
+        float ppm = exp2f(c->log2_k) * powf(ratio, c->exponent);
+        if (!(ppm >= c->min_ppm)) {
+            ppm = c->min_ppm;
+        }
+        out[g] = ppm > c->max_ppm ? c->max_ppm : ppm;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int n = argc > 1 ? atoi(argv[1]) : 200000;
+
+    // Отношения Rs/Ro на логарифмической сетке 0.01..100
+    static float ratios[RATIOS];
+    for (int i = 0; i < RATIOS; i++) {
+        ratios[i] = powf(10.0f, -2.0f + 4.0f * i / (RATIOS - 1));
+        float a[GAS_COUNT], b[GAS_COUNT];
+        gas_curve_eval_all(ratios[i], a);
+        powf_all(ratios[i], b);
+        for (int g = 0; g < GAS_COUNT; g++) {
+            CHECK_NEAR(a[g], b[g], b[g] * 3e-4);
+        }
+    }
+
+    volatile float sink = 0.0f;
+    float out[GAS_COUNT];
+    double t0 = now_s();
+    for (int i = 0; i < n; i++) {
+        gas_curve_eval_all(ratios[i % RATIOS], out);
+        sink += out[i % GAS_COUNT];
+    }
+    double table = now_s() - t0;
+    t0 = now_s();
+    for (int i = 0; i < n; i++) {
+        powf_all(ratios[i % RATIOS], out);
+        sink += out[i % GAS_COUNT];
+    }
+    double pow_time = now_s() - t0;
+    (void)sink;
+
+    printf("%d циклов по %d газа: таблицы %.1f нс, powf %.1f нс, x%.1f\n",
+           n,
+           GAS_COUNT,
+           table / n * 1e9,
+           pow_time / n * 1e9,
+           pow_time / table);
+    printf("OK\n");
+    return 0;
+}
@@ -0,0 +1,120 @@
+// /get через настоящий get_handler: время ответа, когда версия
+// sensor_data меняется перед каждым запросом (ответ собирается
+// заново, как до кэша), и когда не меняется (ответ из кэша). Заодно
+// проверяется, что кэш отдаёт то же тело и ETag следует за версией,
+// а NaN и Inf выводятся как null.
+//
+//   bench_get [запросов]
+#include "sensor_data.h"
+#include "sim_httpd.h"
+#include "test_util.h"
+#include "webserver.h"
+#include <string.h>
+#include <time.h>
+
+static double now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void set_sensors(float t)
+{
+    pms5003_data_t pms = {.pm1_0 = 7, .pm2_5 = 12, .pm10 = 20};
+    sensor_data_set_dht(t, 48.5f, 1);
+    sensor_data_set_bmp(t + 1.5f, 745.3f, 1);
+    sensor_data_set_mq(1800, 1.45f, 2.1f, 612.0f, 3.2f, 1.1f, 0.4f);
+    sensor_data_set_pms5003(&pms);
+}
+
+// Тело без хвоста с возрастом выборок, он свой у каждого запроса
+static size_t fixed_len(const sim_httpd_req_t* r)
+{
+    const char* age = strstr(r->body, "\"age_ms\"");
+    CHECK(age != NULL);
+    return age - r->body;
+}
+
+// Время одного запроса /get, с; тело — в r
+static double get(sim_httpd_req_t* r, const char* inm)
+{
+    sim_httpd_req_init(r, NULL);
+    if (inm != NULL) {
+        sim_httpd_req_header(r, "If-None-Match", inm);
+    }
+    double t0 = now_s();
+    CHECK_INT(sim_httpd_get("/get", r), ESP_OK);
+    double dt = now_s() - t0;
+    CHECK(r->done);
+    CHECK_INT(r->errors, 0);
+    return dt;
+}
+
+int main(int argc, char** argv)
+{
+    int n = argc > 1 ? atoi(argv[1]) : 20000;
+    sensor_data_init();
+    start_webserver();
+    set_sensors(21.0f);
+
+    // Кэш: то же тело, что и при сборке; ETag меняется с версией
+    sim_httpd_req_t first, again, cond;
+    get(&first, NULL);
+    CHECK_INT(first.status, 200);
+    char etag[40];
+    snprintf(etag, sizeof(etag), "%s", sim_httpd_resp_header(&first, "ETag"));
+    get(&again, NULL);
+    CHECK_INT(fixed_len(&again), fixed_len(&first));
+    CHECK(memcmp(again.body, first.body, fixed_len(&first)) == 0);
+    CHECK(strcmp(sim_httpd_resp_header(&again, "ETag"), etag) == 0);
+    get(&cond, etag);
+    CHECK_INT(cond.status, 304);
+    CHECK_INT(cond.len, 0);
+    sim_httpd_req_free(&cond);
+
+    set_sensors(21.5f);
+    get(&cond, etag);
+    CHECK_INT(cond.status, 200);
+    CHECK(strcmp(sim_httpd_resp_header(&cond, "ETag"), etag) != 0);
+    CHECK(memcmp(cond.body, first.body, fixed_len(&first)) != 0);
+    sim_httpd_req_free(&cond);
+    sim_httpd_req_free(&again);
+    sim_httpd_req_free(&first);
+
+    // Не числа от датчиков выводятся как null: nan и inf не JSON
+    sensor_data_set_dht(NAN, INFINITY, 1);
+    sensor_data_set_bmp(NAN, INFINITY, 1);
+    sensor_data_set_mq(1800, NAN, INFINITY, NAN, 3.2f, 1.1f, 0.4f);
+    get(&cond, NULL);
+    CHECK_INT(cond.status, 200);
+    CHECK(strstr(cond.body, "nan") == NULL);
+    CHECK(strstr(cond.body, "inf") == NULL);
+    CHECK(strstr(cond.body, "\"humidity\":null,") != NULL);
+    CHECK(strstr(cond.body, "\"CO2\":null,") != NULL);
+    sim_httpd_req_free(&cond);
+
+    // Сборка на каждый запрос против ответа из кэша
+    double rebuild = 0.0, cached = 0.0;
+    sim_httpd_req_t r;
+    for (int i = 0; i < n; i++) {
+        set_sensors(20.0f + i % 7);
+        rebuild += get(&r, NULL);
+        sim_httpd_req_free(&r);
+    }
+    for (int i = 0; i < n; i++) {
+        cached += get(&r, NULL);
+        sim_httpd_req_free(&r);
+    }
+    printf("/get, %d запросов: сборка %.2f мкс (%.0f в с), "
+           "кэш %.2f мкс (%.0f в с), x%.1f\n",
+           n,
+           rebuild / n * 1e6,
+           n / rebuild,
+           cached / n * 1e6,
+           n / cached,
+           rebuild / cached);
+
+    printf("OK\n");
+    return 0;
+}
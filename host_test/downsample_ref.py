@@ -0,0 +1,175 @@
+"""Эталон прореживания для test_sample_downsample: корзины, MEAN,
+MINMAX и LTTB заново, всё в памяти и в точной арифметике.
+
+    python3 downsample_ref.py <путь к test_sample_downsample>
+
+Программа печатает вход и свой результат, эталон считает результат
+по тому же входу; сверяются точки целиком и по порядку."""
+
+import subprocess
+import sys
+from fractions import Fraction
+
+Record = list[int]  # time, temp, hum, press, co2, pm1_0, pm2_5, pm10, flags
+F_DHT, F_BMP, F_GAS, F_PMS = 1, 2, 4, 8
+
+# Поле: индекс в записи и биты, при которых оно валидно
+FIELDS = {
+    "temperature": (1, F_DHT | F_BMP),
+    "humidity": (2, F_DHT),
+    "pressure": (3, F_BMP),
+    "co2": (4, F_GAS),
+    "pm1_0": (5, F_PMS),
+    "pm2_5": (6, F_PMS),
+    "pm10": (7, F_PMS),
+}
+
+
+def rounded(total: int, n: int) -> int:
+    """Среднее с округлением половины от нуля; 0 при n = 0."""
+    if n == 0:
+        return 0
+    q = Fraction(total, n)
+    f = int(q)
+    if abs(q - f) >= Fraction(1, 2):
+        f += 1 if q > 0 else -1
+    return f
+
+
+def buckets(recs: list[Record], lo: int, hi: int,
+            points: int) -> list[list[Record]]:
+    """Непустые корзины окна [lo, hi] по порядку."""
+    span = hi - lo + 1
+    out: dict[int, list[Record]] = {}
+    for r in recs:
+        if lo <= r[0] <= hi:
+            b = min(points - 1, (r[0] - lo) * points // span)
+            out.setdefault(b, []).append(r)
+    return [out[b] for b in sorted(out)]
+
+
+def mean(bs: list[list[Record]]) -> list[Record]:
+    res = []
+    for rs in bs:
+        def avg(idx: int, bit: int) -> tuple[int, int]:
+            vals = [r[idx] for r in rs if r[8] & bit]
+            return rounded(sum(vals), len(vals)), len(vals)
+
+        temp, _ = avg(1, F_DHT | F_BMP)
+        hum, dht = avg(2, F_DHT)
+        press, bmp = avg(3, F_BMP)
+        co2, gas = avg(4, F_GAS)
+        pms = [avg(idx, F_PMS) for idx in (5, 6, 7)]
+        flags = ((F_DHT if dht else 0) | (F_BMP if bmp else 0)
+                 | (F_GAS if gas else 0) | (F_PMS if pms[0][1] else 0))
+        time = rounded(sum(r[0] for r in rs), len(rs))
+        res.append([time, temp, hum, press, co2,
+                    *(v for v, _ in pms), flags])
+    return res
+
+
+def minmax(bs: list[list[Record]], idx: int, bit: int) -> list[Record]:
+    """Первые по времени минимум и максимум, одна точка, если совпали."""
+    res = []
+    for rs in bs:
+        valid = [r for r in rs if r[8] & bit]
+        if not valid:
+            continue
+        lo = min(valid, key=lambda r: r[idx])
+        hi = max(valid, key=lambda r: r[idx])
+        res += [lo] if lo is hi else sorted([lo, hi], key=lambda r: r[0])
+    return res
+
+
+def lttb(bs: list[list[Record]], idx: int, bit: int) -> list[Record]:
+    bs = [v for v in ([r for r in rs if r[8] & bit] for rs in bs) if v]
+    if not bs:
+        return []
+    a = bs[0][0]
+    res = [a]
+    for i in range(1, len(bs)):
+        if i + 1 == len(bs):
+            res.append(bs[i][-1])
+            break
+        nxt = bs[i + 1]
+        cx = Fraction(sum(r[0] for r in nxt), len(nxt))
+        cy = Fraction(sum(r[idx] for r in nxt), len(nxt))
+        best, best_area = bs[i][0], Fraction(-1)
+        for p in bs[i]:
+            area = abs((p[0] - a[0]) * (cy - a[idx])
+                       - (cx - a[0]) * (p[idx] - a[idx]))
+            if area > best_area:
+                best, best_area = p, area
+        res.append(best)
+        a = best
+    return res
+
+
+# (режим, поле, точек, записей, зерно, окно от/до в секундах или None)
+CASES = [
+    ("mean", "temperature", 100, 3000, 1, None),
+    ("mean", "co2", 7, 500, 2, None),
+    ("mean", "pm2_5", 1, 300, 3, None),
+    ("mean", "humidity", 500, 200, 4, None),  # корзин больше записей
+    ("minmax", "temperature", 100, 3000, 5, None),
+    ("minmax", "pressure", 50, 2000, 6, (30000, 400000)),
+    ("minmax", "pm10", 1, 400, 7, None),
+    ("lttb", "temperature", 100, 3000, 8, None),
+    ("lttb", "humidity", 3, 1000, 9, None),
+    ("lttb", "co2", 2, 100, 10, None),
+    ("lttb", "pressure", 100, 3000, 14, None),
+    ("lttb", "pm1_0", 250, 5000, 11, (100000, 2000000)),
+    ("lttb", "pressure", 20, 0, 12, None),  # пустой архив
+    ("lttb", "temperature", 20, 100, 13, (10**8, 10**8 + 5)),  # позже архива
+]
+
+
+def parse(out: bytes) -> tuple[list[Record], list[Record], int, int]:
+    inp: list[Record] = []
+    got: list[Record] = []
+    lo = hi = 0
+    for line in out.decode().splitlines():
+        tag, *fields = line.split()
+        if tag == "C":
+            lo, hi = map(int, fields)
+        else:
+            (inp if tag == "I" else got).append(list(map(int, fields)))
+    return inp, got, lo, hi
+
+
+def main() -> int:
+    binary = sys.argv[1]
+    failed = 0
+    for mode, field, points, n, seed, window in CASES:
+        args = [binary, mode, field, str(points), str(n), str(seed)]
+        if window:
+            args += map(str, window)
+        run = subprocess.run(args, capture_output=True)
+        name = f"{mode} {field} points={points} n={n}"
+        if run.returncode != 0:
+            print(f"{name}: код {run.returncode}\n{run.stderr.decode()}")
+            return 1
+        inp, got, lo, hi = parse(run.stdout)
+        bs = buckets(inp, lo, hi, points)
+        idx, bit = FIELDS[field]
+        want = {
+            "mean": lambda: mean(bs),
+            "minmax": lambda: minmax(bs, idx, bit),
+            "lttb": lambda: lttb(bs, idx, bit),
+        }[mode]()
+        if got != want:
+            failed += 1
+            first = next((i for i, (g, w) in enumerate(zip(got, want))
+                          if g != w), min(len(got), len(want)))
+            print(f"{name}: точек {len(got)}, ожидалось {len(want)}, "
+                  f"первое расхождение — точка {first}")
+        else:
+            print(f"{name}: {len(got)} точек")
+    if failed:
+        return 1
+    print("OK")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
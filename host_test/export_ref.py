@@ -0,0 +1,224 @@
+"""Эталон /export для test_export: архив и формат ответа заново,
+без кода прошивки.
+
+    python3 export_ref.py <путь к test_export>
+
+Модель архива: кольцо из SECTORS секторов по PER_SECTOR записей,
+потеря — целыми секторами, выборка со временем не новее последней
+пропускается. Каждый сценарий — последовательность загрузок на одном
+образе флеша; ответы сверяются побайтно."""
+
+import struct
+import subprocess
+import sys
+import tempfile
+from pathlib import Path
+
+SECTORS = 4
+PER_SECTOR = (4096 - 8) // 19  # заголовок сектора, sample_record_t
+TIME0 = 1750000000
+STEP_S = 60
+T_MAX = 2**32 - 1
+
+CSV_HEADER = b"time,temperature,humidity,pressure,co2,pm1_0,pm2_5,pm10\n"
+F_DHT, F_BMP, F_GAS, F_PMS = 1, 2, 4, 8
+
+
+def record(i: int) -> dict:
+    """Выборка i после упаковки в фиксированную точку."""
+    return {
+        "t": TIME0 + STEP_S * i,
+        "temp": i % 400 - 50,
+        "hum": i * 7 % 1000,
+        "press": 7400 + i % 50,
+        "co2": 400 + i % 300,
+        "pm": (i % 17, i % 23, i % 31),
+        "flags": i % 16,
+    }
+
+
+def p10(v: int) -> str:
+    return f"{'-' if v < 0 else ''}{abs(v) // 10}.{abs(v) % 10}"
+
+
+def csv_row(r: dict) -> bytes:
+    f = r["flags"]
+    pms = [str(x) if f & F_PMS else "" for x in r["pm"]]
+    cols = [
+        str(r["t"]),
+        p10(r["temp"]) if f & (F_DHT | F_BMP) else "",
+        p10(r["hum"]) if f & F_DHT else "",
+        p10(r["press"]) if f & F_BMP else "",
+        str(r["co2"]) if f & F_GAS else "",
+        *pms,
+    ]
+    return (",".join(cols) + "\n").encode()
+
+
+def bin_row(r: dict) -> bytes:
+    return struct.pack(
+        "<IhHHHHHHB",
+        r["t"],
+        r["temp"],
+        r["hum"],
+        r["press"],
+        r["co2"],
+        *r["pm"],
+        r["flags"],
+    )
+
+
+class Store:
+    """Что лежит в архиве: номера выборок по позициям записи."""
+
+    def __init__(self) -> None:
+        self.items: list[int] = []
+        self.oldest_seq = 0
+
+    def head_seq(self) -> int:
+        return max(0, len(self.items) - 1) // PER_SECTOR
+
+    def append(self, first: int, count: int) -> None:
+        for i in range(first, first + count):
+            if self.items and record(i)["t"] <= record(self.items[-1])["t"]:
+                continue
+            self.items.append(i)
+            self.oldest_seq = max(self.oldest_seq,
+                                  self.head_seq() - SECTORS + 1)
+
+    def erase_slot(self, slot: int) -> None:
+        """Стёрт сектор кольца: пропадает самый старый, если он там."""
+        if self.items and self.oldest_seq % SECTORS == slot \
+                and self.oldest_seq < self.head_seq():
+            self.oldest_seq += 1
+
+    def kept(self) -> list[int]:
+        return self.items[self.oldest_seq * PER_SECTOR:]
+
+
+def u32(args: dict[str, str], key: str, default: int) -> int | None:
+    """Параметр-число: до 11 десятичных цифр без знака, не больше
+    2^32 - 1; None — запрос отклоняется."""
+    val = args.get(key)
+    if val is None:
+        return default
+    if not val.isascii() or not val.isdigit() or len(val) > 11:
+        return None
+    v = int(val)
+    return v if v <= 0xFFFFFFFF else None
+
+
+def export(store: Store, query: str) -> tuple[int, bytes, bytes]:
+    """Код ответа, Content-Disposition и тело для /export?query."""
+    args = dict(kv.split("=", 1) for kv in query.split("&") if kv)
+    fmt = args.get("format", "csv")
+    lo = u32(args, "from", 0)
+    hi = u32(args, "to", T_MAX)
+    step = u32(args, "step", 0)
+    if lo is None or hi is None or step is None:
+        return 400, b"", b""
+    if lo > hi or fmt not in ("csv", "bin"):
+        return 400, b"", b""
+
+    body = b"" if fmt == "bin" else CSV_HEADER
+    nxt = lo
+    for i in store.kept():
+        r = record(i)
+        if r["t"] < lo or r["t"] < nxt:
+            continue
+        if r["t"] > hi:
+            break
+        if step:
+            nxt = r["t"] + step
+        body += bin_row(r) if fmt == "bin" else csv_row(r)
+    disposition = f'attachment; filename="history.{fmt}"'.encode()
+    return 200, disposition, body
+
+
+def T(i: int) -> int:
+    return TIME0 + STEP_S * i
+
+
+# Загрузки: (стереть сектор или -1, первая выборка, число, запросы)
+SCENARIOS = {
+    "пустой архив": [
+        (-1, 0, 0, ["", "format=bin", "from=5&to=4", "format=xml",
+                    "from=abc", "from=-5", "from=+5", "from= 5",
+                    "to=4294967295", "to=4294967296", "to=99999999999",
+                    "step=000000000001", "from=1x"]),
+    ],
+    "перезагрузка посреди сектора": [
+        (-1, 0, 300, ["", "format=bin"]),
+        (-1, 0, 0, [f"from={T(100) - 30}&to={T(250)}",
+                    f"from={T(50)}&to={T(299)}&step=600&format=bin"]),
+        # Часы после загрузки отстают: выборки не пишутся
+        (-1, 100, 50, [f"from={T(290)}"]),
+        (-1, 300, 100, [f"from={T(210)}&to={T(220)}", "step=3600"]),
+    ],
+    "кольцо с затиранием": [
+        (-1, 0, 2300, ["", f"from={T(1000)}&to={T(1600)}&format=bin",
+                       f"from={T(1800) + 1}&to={T(2100)}&step=300"]),
+        (-1, 0, 0, ["", f"from={T(2000)}"]),
+        (-1, 2300, 700, ["", f"to={T(2200)}", f"from={T(2999)}",
+                         f"from={T(3000)}"]),
+    ],
+    "сбой питания при стирании сектора": [
+        (-1, 0, 1000, [""]),
+        # Самый старый сектор — 1 (номер 1 на месте 1)
+        (1, 0, 0, ["", f"from={T(100)}&to={T(500)}&format=bin"]),
+        (-1, 1000, 400, ["", f"from={T(1)}&to={T(700)}"]),
+    ],
+}
+
+
+def parse(out: bytes) -> list[tuple[int, bytes, bytes]]:
+    res = []
+    while out:
+        line, _ctype, disposition, out = out.split(b"\n", 3)
+        status, length = map(int, line.split())
+        res.append((status, disposition, out[:length]))
+        out = out[length:]
+    return res
+
+
+def main() -> int:
+    binary = sys.argv[1]
+    failed = 0
+    for name, boots in SCENARIOS.items():
+        store = Store()
+        with tempfile.TemporaryDirectory() as tmp:
+            image = str(Path(tmp) / "history.bin")
+            for erase, first, count, queries in boots:
+                if erase >= 0:
+                    store.erase_slot(erase)
+                store.append(first, count)
+                run = subprocess.run(
+                    [binary, image, str(erase), str(first), str(count),
+                     *queries],
+                    capture_output=True)
+                if run.returncode != 0:
+                    print(f"{name}: test_export завершился с кодом "
+                          f"{run.returncode}\n{run.stderr.decode()}")
+                    return 1
+                answers = parse(run.stdout)
+                if len(answers) != len(queries):
+                    print(f"{name}: ответов {len(answers)} из "
+                          f"{len(queries)}")
+                    return 1
+                for q, got in zip(queries, answers):
+                    status, disposition, body = export(store, q)
+                    if got[0] != status or (status == 200 and (
+                            got[1] != disposition or got[2] != body)):
+                        failed += 1
+                        print(f"{name}: /export?{q}: код {got[0]}, "
+                              f"{len(got[2])} байт; ожидалось {status}, "
+                              f"{len(body)} байт")
+        print(f"{name}: записей в архиве {len(store.kept())}")
+    if failed:
+        return 1
+    print("OK")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,377 @@
+// FreeRTOS поверх pthread для тестов на хосте: ровно то, что
+// используют модули прошивки. Приоритеты и привязка к ядрам
+// игнорируются, тик — 1 мс.
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+struct host_sem {
+    pthread_mutex_t mu;
+    pthread_cond_t cv;
+    unsigned count;
+    unsigned max;
+    bool heap;
+};
+
+struct host_queue {
+    pthread_mutex_t mu;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+    size_t item_size;
+    size_t len;
+    size_t head;
+    size_t count;
+    unsigned char* items;
+};
+
+struct host_task {
+    TaskFunction_t fn;
+    void* arg;
+    pthread_mutex_t mu;
+    pthread_cond_t cv;
+    uint32_t notify;
+};
+
+_Static_assert(
+        sizeof(struct host_sem) <= sizeof(((StaticSemaphore_t*)0)->data),
+        "StaticSemaphore_t мал для host_sem");
+
+static pthread_mutex_t s_critical;
+static pthread_once_t s_critical_once = PTHREAD_ONCE_INIT;
+static __thread struct host_task* s_self;
+
+static void critical_init(void)
+{
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&s_critical, &attr);
+    pthread_mutexattr_destroy(&attr);
+}
+
+void host_critical_enter(void)
+{
+    pthread_once(&s_critical_once, critical_init);
+    pthread_mutex_lock(&s_critical);
+}
+
+void host_critical_exit(void)
+{
+    pthread_mutex_unlock(&s_critical);
+}
+
+static void cond_init(pthread_cond_t* cv)
+{
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(cv, &attr);
+    pthread_condattr_destroy(&attr);
+}
+
+static struct timespec deadline_after(TickType_t ticks)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    ts.tv_sec += ticks / 1000;
+    ts.tv_nsec += (long)(ticks % 1000) * 1000000L;
+    if (ts.tv_nsec >= 1000000000L) {
+        ts.tv_sec++;
+        ts.tv_nsec -= 1000000000L;
+    }
+    return ts;
+}
+
+// Ждёт cv, пока ready() ложно; false — по таймауту
+static bool wait_until(
+        pthread_cond_t* cv,
+        pthread_mutex_t* mu,
+        TickType_t timeout,
+        bool (*ready)(void*),
+        void* ctx)
+{
+    struct timespec until = deadline_after(timeout);
+    while (!ready(ctx)) {
+        if (timeout == 0) {
+            return false;
+        }
+        if (timeout == portMAX_DELAY) {
+            pthread_cond_wait(cv, mu);
+        } else if (pthread_cond_timedwait(cv, mu, &until) == ETIMEDOUT) {
+            return ready(ctx);
+        }
+    }
+    return true;
+}
+
+// ---- Семафоры ----
+
+static SemaphoreHandle_t
+sem_init(struct host_sem* s, unsigned count, unsigned max, bool heap)
+{
+    pthread_mutex_init(&s->mu, NULL);
+    cond_init(&s->cv);
+    s->count = count;
+    s->max = max;
+    s->heap = heap;
+    return s;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return sem_init(malloc(sizeof(struct host_sem)), 1, 1, true);
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return sem_init(malloc(sizeof(struct host_sem)), 0, 1, true);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutexStatic(StaticSemaphore_t* buf)
+{
+    return sem_init((struct host_sem*)buf->data, 1, 1, false);
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t* buf)
+{
+    return sem_init((struct host_sem*)buf->data, 0, 1, false);
+}
+
+static bool sem_ready(void* ctx)
+{
+    return ((struct host_sem*)ctx)->count > 0;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t timeout)
+{
+    pthread_mutex_lock(&sem->mu);
+    bool ok = wait_until(&sem->cv, &sem->mu, timeout, sem_ready, sem);
+    if (ok) {
+        sem->count--;
+    }
+    pthread_mutex_unlock(&sem->mu);
+    return ok ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+    pthread_mutex_lock(&sem->mu);
+    bool ok = sem->count < sem->max;
+    if (ok) {
+        sem->count++;
+        pthread_cond_signal(&sem->cv);
+    }
+    pthread_mutex_unlock(&sem->mu);
+    return ok ? pdTRUE : pdFALSE;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem)
+{
+    pthread_cond_destroy(&sem->cv);
+    pthread_mutex_destroy(&sem->mu);
+    if (sem->heap) {
+        free(sem);
+    }
+}
+
+// ---- Очереди ----
+
+QueueHandle_t xQueueCreate(UBaseType_t len, UBaseType_t item_size)
+{
+    struct host_queue* q = calloc(1, sizeof(*q));
+    q->items = calloc(len, item_size);
+    q->len = len;
+    q->item_size = item_size;
+    pthread_mutex_init(&q->mu, NULL);
+    cond_init(&q->not_empty);
+    cond_init(&q->not_full);
+    return q;
+}
+
+static bool queue_has_space(void* ctx)
+{
+    struct host_queue* q = ctx;
+    return q->count < q->len;
+}
+
+static bool queue_has_item(void* ctx)
+{
+    return ((struct host_queue*)ctx)->count > 0;
+}
+
+BaseType_t xQueueSend(QueueHandle_t q, const void* item, TickType_t timeout)
+{
+    pthread_mutex_lock(&q->mu);
+    bool ok = wait_until(&q->not_full, &q->mu, timeout, queue_has_space, q);
+    if (ok) {
+        size_t tail = (q->head + q->count) % q->len;
+        memcpy(q->items + tail * q->item_size, item, q->item_size);
+        q->count++;
+        pthread_cond_signal(&q->not_empty);
+    }
+    pthread_mutex_unlock(&q->mu);
+    return ok ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t q, void* item, TickType_t timeout)
+{
+    pthread_mutex_lock(&q->mu);
+    bool ok = wait_until(&q->not_empty, &q->mu, timeout, queue_has_item, q);
+    if (ok) {
+        memcpy(item, q->items + q->head * q->item_size, q->item_size);
+        q->head = (q->head + 1) % q->len;
+        q->count--;
+        pthread_cond_signal(&q->not_full);
+    }
+    pthread_mutex_unlock(&q->mu);
+    return ok ? pdTRUE : pdFALSE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q)
+{
+    pthread_mutex_lock(&q->mu);
+    UBaseType_t n = (UBaseType_t)q->count;
+    pthread_mutex_unlock(&q->mu);
+    return n;
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t q)
+{
+    pthread_mutex_lock(&q->mu);
+    UBaseType_t n = (UBaseType_t)(q->len - q->count);
+    pthread_mutex_unlock(&q->mu);
+    return n;
+}
+
+void vQueueDelete(QueueHandle_t q)
+{
+    pthread_cond_destroy(&q->not_empty);
+    pthread_cond_destroy(&q->not_full);
+    pthread_mutex_destroy(&q->mu);
+    free(q->items);
+    free(q);
+}
+
+// ---- Задачи ----
+
+static struct host_task* task_new(TaskFunction_t fn, void* arg)
+{
+    struct host_task* t = calloc(1, sizeof(*t));
+    t->fn = fn;
+    t->arg = arg;
+    pthread_mutex_init(&t->mu, NULL);
+    cond_init(&t->cv);
+    return t;
+}
+
+static void* task_entry(void* p)
+{
+    s_self = p;
+    s_self->fn(s_self->arg);
+    return NULL;
+}
+
+BaseType_t xTaskCreatePinnedToCore(
+        TaskFunction_t fn,
+        const char* name,
+        uint32_t stack,
+        void* arg,
+        UBaseType_t prio,
+        TaskHandle_t* out,
+        BaseType_t core)
+{
+    struct host_task* t = task_new(fn, arg);
+    pthread_t th;
+    if (pthread_create(&th, NULL, task_entry, t) != 0) {
+        free(t);
+        return pdFAIL;
+    }
+    pthread_detach(th);
+    if (out != NULL) {
+        *out = t;
+    }
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(
+        TaskFunction_t fn,
+        const char* name,
+        uint32_t stack,
+        void* arg,
+        UBaseType_t prio,
+        TaskHandle_t* out)
+{
+    return xTaskCreatePinnedToCore(
+            fn, name, stack, arg, prio, out, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    if (task == NULL || task == s_self) {
+        pthread_exit(NULL);
+    }
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    struct timespec ts = {
+            .tv_sec = ticks / 1000,
+            .tv_nsec = (long)(ticks % 1000) * 1000000L,
+    };
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR) {
+    }
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (TickType_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    if (s_self == NULL) {
+        s_self = task_new(NULL, NULL); // основной поток теста
+    }
+    return s_self;
+}
+
+static bool notify_ready(void* ctx)
+{
+    return ((struct host_task*)ctx)->notify > 0;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t timeout)
+{
+    struct host_task* t = xTaskGetCurrentTaskHandle();
+    pthread_mutex_lock(&t->mu);
+    uint32_t v = 0;
+    if (wait_until(&t->cv, &t->mu, timeout, notify_ready, t)) {
+        v = t->notify;
+        t->notify = clear ? 0 : t->notify - 1;
+    }
+    pthread_mutex_unlock(&t->mu);
+    return v;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    pthread_mutex_lock(&task->mu);
+    task->notify++;
+    pthread_cond_signal(&task->cv);
+    pthread_mutex_unlock(&task->mu);
+    return pdPASS;
+}
+
+void taskYIELD(void)
+{
+    sched_yield();
+}
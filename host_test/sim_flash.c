@@ -0,0 +1,102 @@
+#include "sim_flash.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static esp_partition_t s_part;
+static uint8_t* s_data;
+
+static void check_range(const esp_partition_t* part, size_t off, size_t n)
+{
+    if (part != &s_part || s_data == NULL || off > s_part.size
+        || n > s_part.size - off) {
+        fprintf(stderr, "sim_flash: доступ вне раздела %zu+%zu\n", off, n);
+        abort();
+    }
+}
+
+void sim_flash_reset(const char* label, size_t sectors)
+{
+    free(s_data);
+    memset(&s_part, 0, sizeof(s_part));
+    s_part.type = ESP_PARTITION_TYPE_DATA;
+    s_part.subtype = ESP_PARTITION_SUBTYPE_ANY;
+    s_part.size = sectors * SIM_FLASH_SECTOR;
+    s_part.erase_size = SIM_FLASH_SECTOR;
+    snprintf(s_part.label, sizeof(s_part.label), "%s", label);
+    s_data = malloc(s_part.size);
+    memset(s_data, 0xff, s_part.size);
+}
+
+bool sim_flash_load(const char* path)
+{
+    FILE* f = fopen(path, "rb");
+    if (f == NULL) {
+        return false;
+    }
+    size_t n = fread(s_data, 1, s_part.size, f);
+    fclose(f);
+    return n == s_part.size;
+}
+
+bool sim_flash_save(const char* path)
+{
+    FILE* f = fopen(path, "wb");
+    if (f == NULL) {
+        return false;
+    }
+    size_t n = fwrite(s_data, 1, s_part.size, f);
+    return fclose(f) == 0 && n == s_part.size;
+}
+
+void sim_flash_erase_sector(size_t sector)
+{
+    check_range(&s_part, sector * SIM_FLASH_SECTOR, SIM_FLASH_SECTOR);
+    memset(s_data + sector * SIM_FLASH_SECTOR, 0xff, SIM_FLASH_SECTOR);
+}
+
+const esp_partition_t* esp_partition_find_first(
+        esp_partition_type_t type,
+        esp_partition_subtype_t subtype,
+        const char* label)
+{
+    if (s_data == NULL || type != s_part.type
+        || (label != NULL && strcmp(label, s_part.label) != 0)) {
+        return NULL;
+    }
+    return &s_part;
+}
+
+esp_err_t esp_partition_read(
+        const esp_partition_t* part, size_t offset, void* dst, size_t size)
+{
+    check_range(part, offset, size);
+    memcpy(dst, s_data + offset, size);
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_write(
+        const esp_partition_t* part,
+        size_t offset,
+        const void* src,
+        size_t size)
+{
+    check_range(part, offset, size);
+    const uint8_t* p = src;
+    for (size_t i = 0; i < size; i++) {
+        s_data[offset + i] &= p[i];
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_erase_range(
+        const esp_partition_t* part, size_t offset, size_t size)
+{
+    check_range(part, offset, size);
+    if (offset % SIM_FLASH_SECTOR != 0 || size % SIM_FLASH_SECTOR != 0) {
+        fprintf(stderr, "sim_flash: стирание не по сектору %zu\n", offset);
+        abort();
+    }
+    memset(s_data + offset, 0xff, size);
+    return ESP_OK;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "esp_partition.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+// -------------------------------------------------------
+//  Моделируемый раздел флеша для тестов на хосте
+//
+//  Один раздел данных в памяти процесса с правилами NOR-флеша:
+//  стирание ставит 0xFF, запись только сбрасывает биты (старое
+//  И новое). Стирание и запись вне раздела или стирание не по
+//  границе сектора — ошибка теста, а не молчаливая порча. Образ
+//  можно сохранить в файл и загрузить в следующем процессе, так
+//  моделируется перезагрузка.
+// -------------------------------------------------------
+
+#define SIM_FLASH_SECTOR 4096
+
+// Пустой (стёртый) раздел label из sectors секторов
+void sim_flash_reset(const char* label, size_t sectors);
+
+// Образ из файла; false — файла нет, раздел остаётся стёртым
+bool sim_flash_load(const char* path);
+bool sim_flash_save(const char* path);
+
+// Стирание сектора в обход модуля: сбой питания посреди записи
+void sim_flash_erase_sector(size_t sector);
@@ -0,0 +1,291 @@
+#include "sim_httpd.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+
+#define SIM_ROUTES_MAX 32
+
+static httpd_uri_t s_routes[SIM_ROUTES_MAX];
+static int s_route_count;
+static int s_server;
+
+static pthread_mutex_t s_httpd_task = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t s_mu = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t s_done = PTHREAD_COND_INITIALIZER;
+
+static sim_httpd_req_t* sim(httpd_req_t* req)
+{
+    return (sim_httpd_req_t*)req;
+}
+
+void sim_httpd_req_init(sim_httpd_req_t* r, const char* query)
+{
+    memset(r, 0, sizeof(*r));
+    r->query = query;
+}
+
+void sim_httpd_req_header(
+        sim_httpd_req_t* r, const char* name, const char* value)
+{
+    if (r->in_count < SIM_HTTPD_HDR_MAX) {
+        r->in_name[r->in_count] = name;
+        r->in_value[r->in_count] = value;
+        r->in_count++;
+    }
+}
+
+void sim_httpd_req_free(sim_httpd_req_t* r)
+{
+    free(r->body);
+    r->body = NULL;
+}
+
+const char* sim_httpd_resp_header(const sim_httpd_req_t* r, const char* name)
+{
+    for (int i = 0; i < r->hdr_count; i++) {
+        if (strcasecmp(r->name[i], name) == 0) {
+            return r->value[i];
+        }
+    }
+    return NULL;
+}
+
+esp_err_t httpd_start(httpd_handle_t* handle, const httpd_config_t* config)
+{
+    s_route_count = 0;
+    *handle = &s_server;
+    return ESP_OK;
+}
+
+esp_err_t
+httpd_register_uri_handler(httpd_handle_t handle, const httpd_uri_t* uri)
+{
+    if (s_route_count >= SIM_ROUTES_MAX) {
+        return ESP_ERR_NO_MEM;
+    }
+    s_routes[s_route_count++] = *uri;
+    return ESP_OK;
+}
+
+esp_err_t sim_httpd_get(const char* uri, sim_httpd_req_t* r)
+{
+    const httpd_uri_t* route = NULL;
+    for (int i = 0; i < s_route_count; i++) {
+        if (strcmp(s_routes[i].uri, uri) == 0) {
+            route = &s_routes[i];
+        }
+    }
+    if (route == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    r->req.handle = &s_server;
+    r->req.method = HTTP_GET;
+    r->req.uri = uri;
+    r->req.user_ctx = route->user_ctx;
+    pthread_mutex_lock(&s_httpd_task);
+    esp_err_t err = route->handler(&r->req);
+    pthread_mutex_unlock(&s_httpd_task);
+
+    // Асинхронный ответ заканчивает рабочая задача
+    pthread_mutex_lock(&s_mu);
+    r->handled = true;
+    while (r->req.aux != NULL) {
+        pthread_cond_wait(&s_done, &s_mu);
+    }
+    pthread_mutex_unlock(&s_mu);
+    return err;
+}
+
+bool sim_httpd_handled(sim_httpd_req_t* r)
+{
+    pthread_mutex_lock(&s_mu);
+    bool handled = r->handled;
+    pthread_mutex_unlock(&s_mu);
+    return handled;
+}
+
+esp_err_t httpd_req_async_handler_begin(httpd_req_t* req, httpd_req_t** out)
+{
+    pthread_mutex_lock(&s_mu);
+    req->aux = req;
+    pthread_mutex_unlock(&s_mu);
+    *out = req;
+    return ESP_OK;
+}
+
+esp_err_t httpd_req_async_handler_complete(httpd_req_t* req)
+{
+    pthread_mutex_lock(&s_mu);
+    req->aux = NULL;
+    pthread_cond_broadcast(&s_done);
+    pthread_mutex_unlock(&s_mu);
+    return ESP_OK;
+}
+
+esp_err_t httpd_req_get_url_query_str(httpd_req_t* req, char* buf, size_t len)
+{
+    const char* q = sim(req)->query;
+    if (q == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    snprintf(buf, len, "%s", q);
+    return strlen(q) >= len ? ESP_ERR_HTTPD_RESULT_TRUNC : ESP_OK;
+}
+
+// Как в IDF: значение копируется без декодирования, длинное — усекается
+esp_err_t httpd_query_key_value(
+        const char* qry, const char* key, char* val, size_t val_size)
+{
+    size_t key_len = strlen(key);
+    const char* p = qry;
+    while (p != NULL && *p != '\0') {
+        const char* end = strchr(p, '&');
+        size_t item_len = end ? (size_t)(end - p) : strlen(p);
+        if (item_len > key_len && p[key_len] == '='
+            && strncmp(p, key, key_len) == 0) {
+            size_t n = item_len - key_len - 1;
+            size_t copy = n < val_size - 1 ? n : val_size - 1;
+            memcpy(val, p + key_len + 1, copy);
+            val[copy] = '\0';
+            return n > copy ? ESP_ERR_HTTPD_RESULT_TRUNC : ESP_OK;
+        }
+        p = end ? end + 1 : NULL;
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t httpd_req_get_hdr_value_str(
+        httpd_req_t* req, const char* field, char* val, size_t val_size)
+{
+    sim_httpd_req_t* r = sim(req);
+    for (int i = 0; i < r->in_count; i++) {
+        if (strcasecmp(r->in_name[i], field) == 0) {
+            snprintf(val, val_size, "%s", r->in_value[i]);
+            return strlen(r->in_value[i]) >= val_size
+                           ? ESP_ERR_HTTPD_RESULT_TRUNC
+                           : ESP_OK;
+        }
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t httpd_resp_set_status(httpd_req_t* req, const char* status)
+{
+    sim(req)->set_status = status;
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_type(httpd_req_t* req, const char* type)
+{
+    sim(req)->set_type = type;
+    return ESP_OK;
+}
+
+esp_err_t
+httpd_resp_set_hdr(httpd_req_t* req, const char* field, const char* value)
+{
+    sim_httpd_req_t* r = sim(req);
+    if (r->set_count >= SIM_HTTPD_HDR_MAX) {
+        return ESP_ERR_NO_MEM;
+    }
+    r->set_name[r->set_count] = field;
+    r->set_value[r->set_count] = value;
+    r->set_count++;
+    return ESP_OK;
+}
+
+// Статус и заголовки уходят с первой отправкой
+static void send_head(sim_httpd_req_t* r)
+{
+    if (r->sent) {
+        return;
+    }
+    r->sent = true;
+    r->status = r->set_status ? atoi(r->set_status) : 200;
+    snprintf(r->type, sizeof(r->type), "%s",
+             r->set_type ? r->set_type : "text/html");
+    for (int i = 0; i < r->set_count; i++) {
+        snprintf(r->name[i], sizeof(r->name[i]), "%s", r->set_name[i]);
+        snprintf(r->value[i], sizeof(r->value[i]), "%s", r->set_value[i]);
+    }
+    r->hdr_count = r->set_count;
+}
+
+static void append(sim_httpd_req_t* r, const char* buf, size_t len)
+{
+    if (r->send_delay_ms > 0) {
+        struct timespec ts = {
+                .tv_sec = r->send_delay_ms / 1000,
+                .tv_nsec = r->send_delay_ms % 1000 * 1000000L,
+        };
+        nanosleep(&ts, NULL);
+    }
+    if (r->len + len + 1 > r->cap) {
+        r->cap = (r->len + len + 1) * 2;
+        r->body = realloc(r->body, r->cap);
+    }
+    memcpy(r->body + r->len, buf, len);
+    r->len += len;
+    r->body[r->len] = '\0';
+}
+
+esp_err_t httpd_resp_send(httpd_req_t* req, const char* buf, ssize_t len)
+{
+    sim_httpd_req_t* r = sim(req);
+    if (r->done || r->sent) {
+        r->errors++;
+        return ESP_FAIL;
+    }
+    if (len == HTTPD_RESP_USE_STRLEN) {
+        len = buf ? (ssize_t)strlen(buf) : 0;
+    }
+    send_head(r);
+    if (len > 0) {
+        append(r, buf, len);
+    }
+    r->done = true;
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_send_chunk(httpd_req_t* req, const char* buf, ssize_t len)
+{
+    sim_httpd_req_t* r = sim(req);
+    if (r->done) {
+        r->errors++;
+        return ESP_FAIL;
+    }
+    if (len == HTTPD_RESP_USE_STRLEN) {
+        len = buf ? (ssize_t)strlen(buf) : 0;
+    }
+    send_head(r);
+    if (buf == NULL || len == 0) {
+        r->done = true;
+        return ESP_OK;
+    }
+    append(r, buf, len);
+    r->chunks++;
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_send_err(
+        httpd_req_t* req, httpd_err_code_t error, const char* msg)
+{
+    static const char* const status[] = {
+            [HTTPD_400_BAD_REQUEST] = "400 Bad Request",
+            [HTTPD_404_NOT_FOUND] = "404 Not Found",
+            [HTTPD_500_INTERNAL_SERVER_ERROR] = "500 Internal Server Error",
+            [HTTPD_501_METHOD_NOT_IMPLEMENTED] = "501 Method Not Implemented",
+    };
+    sim_httpd_req_t* r = sim(req);
+    if (r->sent) {
+        r->errors++;
+        return ESP_FAIL;
+    }
+    r->set_status = status[error];
+    r->set_type = "text/html";
+    return httpd_resp_send(req, msg ? msg : "", HTTPD_RESP_USE_STRLEN);
+}
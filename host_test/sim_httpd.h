@@ -0,0 +1,72 @@
+#pragma once
+
+#include "esp_http_server.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+// -------------------------------------------------------
+//  Моделируемый esp_http_server для тестов на хосте
+//
+//  httpd_start и httpd_register_uri_handler заполняют таблицу
+//  маршрутов, sim_httpd_get вызывает обработчик, как задача httpd:
+//  из разных потоков обработчики выполняются строго по одному.
+//  Асинхронный запрос (httpd_req_async_handler_begin) — тот же
+//  объект; задачу httpd он отпускает сразу, а sim_httpd_get ждёт
+//  его завершения.
+//
+//  Ответ копится в памяти целиком. Статус, тип и заголовки, как в
+//  IDF, читаются по указателям в момент первой отправки: указатель
+//  на уже освобождённый буфер даст в ответе мусор.
+// -------------------------------------------------------
+
+#define SIM_HTTPD_HDR_MAX 8
+
+typedef struct {
+    httpd_req_t req; // первым: обработчик получает &sim->req
+
+    // Запрос
+    const char* query; // NULL — без query
+    const char* in_name[SIM_HTTPD_HDR_MAX];
+    const char* in_value[SIM_HTTPD_HDR_MAX];
+    int in_count;
+    unsigned send_delay_ms; // медленный клиент: пауза на каждую отправку
+
+    // Что обработчик задал до отправки
+    const char* set_status;
+    const char* set_type;
+    const char* set_name[SIM_HTTPD_HDR_MAX];
+    const char* set_value[SIM_HTTPD_HDR_MAX];
+    int set_count;
+
+    bool handled; // см. sim_httpd_handled
+
+    // Отправленный ответ
+    bool sent;  // статус и заголовки ушли
+    bool done;  // ответ закончен
+    int status; // код из строки статуса
+    char type[64];
+    char name[SIM_HTTPD_HDR_MAX][32];
+    char value[SIM_HTTPD_HDR_MAX][96];
+    int hdr_count;
+    char* body; // с нулём в конце; NULL — тела нет
+    size_t len;
+    size_t cap;
+    int chunks;
+    int errors; // отправка после конца ответа и т. п.
+} sim_httpd_req_t;
+
+void sim_httpd_req_init(sim_httpd_req_t* r, const char* query);
+void sim_httpd_req_header(
+        sim_httpd_req_t* r, const char* name, const char* value);
+void sim_httpd_req_free(sim_httpd_req_t* r);
+
+// Запрос к зарегистрированному маршруту; ошибка обработчика или
+// ESP_ERR_NOT_FOUND, если маршрута нет
+esp_err_t sim_httpd_get(const char* uri, sim_httpd_req_t* r);
+
+// Обработчик на задаче httpd вернулся: ответ отправлен или запрос
+// отдан в пул. Для запросов из другого потока.
+bool sim_httpd_handled(sim_httpd_req_t* r);
+
+// Значение отправленного заголовка ответа; NULL — не было
+const char* sim_httpd_resp_header(const sim_httpd_req_t* r, const char* name);
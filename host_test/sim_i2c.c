@@ -0,0 +1,241 @@
+#include "sim_i2c.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define SIM_MAX_TARGETS 8
+
+struct sim_i2c_bus {
+    int unused;
+};
+
+struct sim_i2c_dev {
+    uint8_t addr;
+    bool removed;
+};
+
+typedef struct {
+    uint8_t addr;
+    sim_i2c_xfer_fn fn;
+    void* ctx;
+    int fail_count;
+    esp_err_t fail_err;
+} sim_target_t;
+
+static pthread_mutex_t s_mu = PTHREAD_MUTEX_INITIALIZER;
+static struct sim_i2c_bus s_bus;
+static sim_target_t s_targets[SIM_MAX_TARGETS];
+static int s_target_count;
+static int s_open;
+static int s_resets;
+static int s_stale;
+static uint32_t s_delay_ms;
+static uint8_t s_trace[SIM_I2C_TRACE_MAX];
+static int s_trace_len;
+
+static void sim_sleep_ms(uint32_t ms)
+{
+    if (ms > 0) {
+        struct timespec ts = {
+                .tv_sec = ms / 1000,
+                .tv_nsec = (long)(ms % 1000) * 1000000L,
+        };
+        nanosleep(&ts, NULL);
+    }
+}
+
+void sim_i2c_reset(void)
+{
+    pthread_mutex_lock(&s_mu);
+    s_target_count = 0;
+    s_resets = 0;
+    s_stale = 0;
+    s_delay_ms = 0;
+    s_trace_len = 0;
+    pthread_mutex_unlock(&s_mu);
+}
+
+void sim_i2c_add_target(uint8_t addr, sim_i2c_xfer_fn fn, void* ctx)
+{
+    pthread_mutex_lock(&s_mu);
+    s_targets[s_target_count++] = (sim_target_t){
+            .addr = addr,
+            .fn = fn,
+            .ctx = ctx,
+    };
+    pthread_mutex_unlock(&s_mu);
+}
+
+static sim_target_t* find_target(uint8_t addr)
+{
+    for (int i = 0; i < s_target_count; i++) {
+        if (s_targets[i].addr == addr) {
+            return &s_targets[i];
+        }
+    }
+    return NULL;
+}
+
+void sim_i2c_fail(uint8_t addr, int count, esp_err_t err)
+{
+    pthread_mutex_lock(&s_mu);
+    sim_target_t* t = find_target(addr);
+    if (t != NULL) {
+        t->fail_count = count;
+        t->fail_err = err;
+    }
+    pthread_mutex_unlock(&s_mu);
+}
+
+void sim_i2c_set_delay_ms(uint32_t ms)
+{
+    pthread_mutex_lock(&s_mu);
+    s_delay_ms = ms;
+    pthread_mutex_unlock(&s_mu);
+}
+
+int sim_i2c_open_handles(void)
+{
+    pthread_mutex_lock(&s_mu);
+    int n = s_open;
+    pthread_mutex_unlock(&s_mu);
+    return n;
+}
+
+int sim_i2c_bus_resets(void)
+{
+    pthread_mutex_lock(&s_mu);
+    int n = s_resets;
+    pthread_mutex_unlock(&s_mu);
+    return n;
+}
+
+int sim_i2c_stale_uses(void)
+{
+    pthread_mutex_lock(&s_mu);
+    int n = s_stale;
+    pthread_mutex_unlock(&s_mu);
+    return n;
+}
+
+int sim_i2c_trace(uint8_t* out, int max)
+{
+    pthread_mutex_lock(&s_mu);
+    int n = s_trace_len < max ? s_trace_len : max;
+    for (int i = 0; i < n; i++) {
+        out[i] = s_trace[i];
+    }
+    pthread_mutex_unlock(&s_mu);
+    return n;
+}
+
+esp_err_t i2c_new_master_bus(
+        const i2c_master_bus_config_t* config, i2c_master_bus_handle_t* out)
+{
+    *out = &s_bus;
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_bus_add_device(
+        i2c_master_bus_handle_t bus,
+        const i2c_device_config_t* config,
+        i2c_master_dev_handle_t* out)
+{
+    struct sim_i2c_dev* dev = calloc(1, sizeof(*dev));
+    dev->addr = (uint8_t)config->device_address;
+    pthread_mutex_lock(&s_mu);
+    s_open++;
+    uint32_t delay_ms = s_delay_ms;
+    pthread_mutex_unlock(&s_mu);
+    sim_sleep_ms(delay_ms);
+    *out = dev;
+    return ESP_OK;
+}
+
+esp_err_t i2c_del_master_bus(i2c_master_bus_handle_t bus)
+{
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_bus_rm_device(i2c_master_dev_handle_t dev)
+{
+    pthread_mutex_lock(&s_mu);
+    esp_err_t err = ESP_ERR_INVALID_STATE;
+    if (!dev->removed) {
+        dev->removed = true;
+        s_open--;
+        err = ESP_OK;
+    }
+    pthread_mutex_unlock(&s_mu);
+    return err;
+}
+
+esp_err_t i2c_master_transmit_receive(
+        i2c_master_dev_handle_t dev,
+        const uint8_t* tx,
+        size_t tx_len,
+        uint8_t* rx,
+        size_t rx_len,
+        int timeout_ms)
+{
+    pthread_mutex_lock(&s_mu);
+    uint32_t delay_ms = s_delay_ms;
+    if (dev->removed) {
+        s_stale++;
+        pthread_mutex_unlock(&s_mu);
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (s_trace_len < SIM_I2C_TRACE_MAX) {
+        s_trace[s_trace_len++] = dev->addr;
+    }
+    sim_target_t* t = find_target(dev->addr);
+    esp_err_t err = ESP_FAIL; // нет ACK
+    sim_i2c_xfer_fn fn = NULL;
+    void* ctx = NULL;
+    if (t != NULL && t->fail_count > 0) {
+        t->fail_count--;
+        err = t->fail_err;
+    } else if (t != NULL) {
+        fn = t->fn;
+        ctx = t->ctx;
+    }
+    pthread_mutex_unlock(&s_mu);
+
+    sim_sleep_ms(delay_ms);
+    if (fn != NULL) {
+        err = fn(ctx, tx, tx_len, rx, rx_len);
+    }
+    return err;
+}
+
+esp_err_t i2c_master_transmit(
+        i2c_master_dev_handle_t dev,
+        const uint8_t* tx,
+        size_t tx_len,
+        int timeout_ms)
+{
+    return i2c_master_transmit_receive(dev, tx, tx_len, NULL, 0, timeout_ms);
+}
+
+esp_err_t i2c_master_probe(
+        i2c_master_bus_handle_t bus, uint16_t addr, int timeout_ms)
+{
+    pthread_mutex_lock(&s_mu);
+    sim_target_t* t = find_target((uint8_t)addr);
+    esp_err_t err = ESP_ERR_NOT_FOUND;
+    if (t != NULL && t->fail_count > 0) {
+        t->fail_count--;
+    } else if (t != NULL) {
+        err = ESP_OK;
+    }
+    pthread_mutex_unlock(&s_mu);
+    return err;
+}
+
+esp_err_t i2c_master_bus_reset(i2c_master_bus_handle_t bus)
+{
+    pthread_mutex_lock(&s_mu);
+    s_resets++;
+    pthread_mutex_unlock(&s_mu);
+    return ESP_OK;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "driver/i2c_master.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// -------------------------------------------------------
+//  Моделируемая шина I2C для тестов на хосте
+//
+//  Реализует API i2c_master из ESP-IDF. Устройства на шине — цели
+//  с функцией обмена по адресу. Можно заставить следующие n обменов
+//  с адресом завершиться ошибкой. Дескрипторы удалённых устройств не
+//  освобождаются: обращение через такой дескриптор считается, а не
+//  портит память.
+// -------------------------------------------------------
+
+// Запись tx, затем чтение rx (rx_len == 0 — только запись)
+typedef esp_err_t (*sim_i2c_xfer_fn)(
+        void* ctx,
+        const uint8_t* tx,
+        size_t tx_len,
+        uint8_t* rx,
+        size_t rx_len);
+
+#define SIM_I2C_TRACE_MAX 64
+
+void sim_i2c_reset(void);
+void sim_i2c_add_target(uint8_t addr, sim_i2c_xfer_fn fn, void* ctx);
+
+// Следующие count обменов с addr вернут err; probe тоже не ответит
+void sim_i2c_fail(uint8_t addr, int count, esp_err_t err);
+
+// Задержка каждого обмена и добавления устройства, чтобы транзакции
+// успели накопиться, а добавления — пересечься
+void sim_i2c_set_delay_ms(uint32_t ms);
+
+int sim_i2c_open_handles(void);
+int sim_i2c_bus_resets(void);
+int sim_i2c_stale_uses(void);
+
+// Адреса выполненных обменов по порядку; возвращает их число
+int sim_i2c_trace(uint8_t* out, int max);
@@ -0,0 +1,54 @@
+#pragma once
+
+// Заглушка ESP-IDF для тестов на хосте: API драйвера i2c_master из
+// IDF 5.x. Реализация — моделируемая шина host_test/sim_i2c.c.
+
+#include "esp_err.h"
+
+typedef struct sim_i2c_bus* i2c_master_bus_handle_t;
+typedef struct sim_i2c_dev* i2c_master_dev_handle_t;
+
+#define I2C_NUM_0 0
+#define I2C_CLK_SRC_DEFAULT 0
+#define I2C_ADDR_BIT_LEN_7 0
+
+typedef struct {
+    int i2c_port;
+    int sda_io_num;
+    int scl_io_num;
+    int clk_source;
+    int glitch_ignore_cnt;
+    struct {
+        uint32_t enable_internal_pullup : 1;
+    } flags;
+} i2c_master_bus_config_t;
+
+typedef struct {
+    int dev_addr_length;
+    uint16_t device_address;
+    uint32_t scl_speed_hz;
+} i2c_device_config_t;
+
+esp_err_t i2c_new_master_bus(
+        const i2c_master_bus_config_t* config, i2c_master_bus_handle_t* out);
+esp_err_t i2c_master_bus_add_device(
+        i2c_master_bus_handle_t bus,
+        const i2c_device_config_t* config,
+        i2c_master_dev_handle_t* out);
+esp_err_t i2c_master_bus_rm_device(i2c_master_dev_handle_t dev);
+esp_err_t i2c_del_master_bus(i2c_master_bus_handle_t bus);
+esp_err_t i2c_master_transmit(
+        i2c_master_dev_handle_t dev,
+        const uint8_t* tx,
+        size_t tx_len,
+        int timeout_ms);
+esp_err_t i2c_master_transmit_receive(
+        i2c_master_dev_handle_t dev,
+        const uint8_t* tx,
+        size_t tx_len,
+        uint8_t* rx,
+        size_t rx_len,
+        int timeout_ms);
+esp_err_t i2c_master_probe(
+        i2c_master_bus_handle_t bus, uint16_t addr, int timeout_ms);
+esp_err_t i2c_master_bus_reset(i2c_master_bus_handle_t bus);
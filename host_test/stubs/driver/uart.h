@@ -0,0 +1,5 @@
+#pragma once
+
+// Заглушка ESP-IDF для тестов на хосте: только для включения pms5003.h
+
+#include "esp_err.h"
@@ -0,0 +1,77 @@
+#pragma once
+
+// Заглушка ESP-IDF для тестов на хосте: API esp_http_server, которое
+// использует webserver.c. Запрос и ответ моделирует sim_httpd.c.
+
+#include "esp_err.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <sys/types.h>
+
+#define ESP_ERR_HTTPD_BASE 0xb000
+#define ESP_ERR_HTTPD_RESULT_TRUNC (ESP_ERR_HTTPD_BASE + 3)
+
+#define HTTPD_RESP_USE_STRLEN -1
+
+typedef void* httpd_handle_t;
+
+typedef enum {
+    HTTP_GET = 1,
+} httpd_method_t;
+
+typedef enum {
+    HTTPD_400_BAD_REQUEST,
+    HTTPD_404_NOT_FOUND,
+    HTTPD_500_INTERNAL_SERVER_ERROR,
+    HTTPD_501_METHOD_NOT_IMPLEMENTED,
+} httpd_err_code_t;
+
+typedef struct httpd_req {
+    httpd_handle_t handle;
+    int method;
+    const char* uri;
+    void* user_ctx;
+    void* aux; // состояние sim_httpd
+} httpd_req_t;
+
+typedef struct {
+    const char* uri;
+    httpd_method_t method;
+    esp_err_t (*handler)(httpd_req_t* req);
+    void* user_ctx;
+} httpd_uri_t;
+
+typedef struct {
+    size_t stack_size;
+    unsigned max_open_sockets;
+    unsigned max_uri_handlers;
+    bool lru_purge_enable;
+} httpd_config_t;
+
+#define HTTPD_DEFAULT_CONFIG()                                           \
+    {                                                                    \
+        .stack_size = 4096, .max_open_sockets = 7,                       \
+        .max_uri_handlers = 8, .lru_purge_enable = false,                \
+    }
+
+esp_err_t httpd_start(httpd_handle_t* handle, const httpd_config_t* config);
+esp_err_t
+httpd_register_uri_handler(httpd_handle_t handle, const httpd_uri_t* uri);
+
+esp_err_t httpd_req_get_url_query_str(httpd_req_t* req, char* buf, size_t len);
+esp_err_t httpd_query_key_value(
+        const char* qry, const char* key, char* val, size_t val_size);
+esp_err_t httpd_req_get_hdr_value_str(
+        httpd_req_t* req, const char* field, char* val, size_t val_size);
+
+esp_err_t httpd_resp_set_status(httpd_req_t* req, const char* status);
+esp_err_t httpd_resp_set_type(httpd_req_t* req, const char* type);
+esp_err_t
+httpd_resp_set_hdr(httpd_req_t* req, const char* field, const char* value);
+esp_err_t httpd_resp_send(httpd_req_t* req, const char* buf, ssize_t len);
+esp_err_t httpd_resp_send_chunk(httpd_req_t* req, const char* buf, ssize_t len);
+esp_err_t httpd_resp_send_err(
+        httpd_req_t* req, httpd_err_code_t error, const char* msg);
+
+esp_err_t httpd_req_async_handler_begin(httpd_req_t* req, httpd_req_t** out);
+esp_err_t httpd_req_async_handler_complete(httpd_req_t* req);
@@ -0,0 +1,21 @@
+#pragma once
+
+// Заглушка ESP-IDF для тестов на хосте: формат проверяется
+// компилятором, вывода нет
+
+#include "esp_err.h"
+#include <stdio.h>
+
+#define HOST_LOG(tag, fmt, ...)                                          \
+    do {                                                                 \
+        if (0) {                                                         \
+            printf(fmt, ##__VA_ARGS__);                                  \
+        }                                                                \
+        (void)(tag);                                                     \
+    } while (0)
+
+#define ESP_LOGE HOST_LOG
+#define ESP_LOGW HOST_LOG
+#define ESP_LOGI HOST_LOG
+#define ESP_LOGD HOST_LOG
+#define ESP_LOGV HOST_LOG
@@ -0,0 +1,11 @@
+#pragma once
+
+// Заглушка ESP-IDF для тестов на хосте: постоянное «случайное» число,
+// чтобы ответы не зависели от запуска
+
+#include <stdint.h>
+
+static inline uint32_t esp_random(void)
+{
+    return 0x5eed1234u;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+// FreeRTOS для тестов на хосте: задачи — потоки pthread, тик — 1 мс,
+// критические секции — один общий рекурсивный мьютекс
+// (host_test/freertos_posix.c)
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef uint32_t StackType_t;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define pdFAIL 0
+
+#define configTICK_RATE_HZ 1000
+#define configMAX_PRIORITIES 25
+#define configMAX_TASK_NAME_LEN 16
+#define configRUN_TIME_COUNTER_TYPE uint32_t
+#define portTICK_PERIOD_MS 1
+#define portMAX_DELAY 0xffffffffu
+#define portNUM_PROCESSORS 2
+#define tskNO_AFFINITY 0x7fffffff
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define pdTICKS_TO_MS(t) ((uint32_t)(t))
+
+#define BIT0 0x01
+#define BIT1 0x02
+#define BIT2 0x04
+#define BIT3 0x08
+
+typedef struct {
+    int unused;
+} portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED {0}
+
+void host_critical_enter(void);
+void host_critical_exit(void);
+
+#define portENTER_CRITICAL(mux) ((void)(mux), host_critical_enter())
+#define portEXIT_CRITICAL(mux) ((void)(mux), host_critical_exit())
+#define taskENTER_CRITICAL(mux) ((void)(mux), host_critical_enter())
+#define taskEXIT_CRITICAL(mux) ((void)(mux), host_critical_exit())
+
+// Место под объект ядра при статическом создании
+typedef struct {
+    long long align;
+    unsigned char data[248];
+} StaticSemaphore_t;
+typedef StaticSemaphore_t StaticQueue_t;
+typedef StaticSemaphore_t StaticTask_t;
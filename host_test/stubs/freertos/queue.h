@@ -0,0 +1,12 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct host_queue* QueueHandle_t;
+
+QueueHandle_t xQueueCreate(UBaseType_t len, UBaseType_t item_size);
+BaseType_t xQueueSend(QueueHandle_t q, const void* item, TickType_t timeout);
+BaseType_t xQueueReceive(QueueHandle_t q, void* item, TickType_t timeout);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q);
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t q);
+void vQueueDelete(QueueHandle_t q);
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct host_task* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+BaseType_t xTaskCreate(
+        TaskFunction_t fn,
+        const char* name,
+        uint32_t stack,
+        void* arg,
+        UBaseType_t prio,
+        TaskHandle_t* out);
+BaseType_t xTaskCreatePinnedToCore(
+        TaskFunction_t fn,
+        const char* name,
+        uint32_t stack,
+        void* arg,
+        UBaseType_t prio,
+        TaskHandle_t* out,
+        BaseType_t core);
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount(void);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t timeout);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void taskYIELD(void);
@@ -0,0 +1,10 @@
+#pragma once
+
+// Заглушка ESP-IDF для тестов на хосте
+
+typedef enum {
+    ADC_CHANNEL_0,
+    ADC_CHANNEL_1,
+    ADC_CHANNEL_2,
+    ADC_CHANNEL_3,
+} adc_channel_t;
@@ -0,0 +1,27 @@
+#pragma once
+
+// Заглушка ESP-IDF для тестов на хосте: объявления NVS, реализацию
+// даёт тест
+
+#include "esp_err.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define ESP_ERR_NVS_NOT_FOUND 0x1102
+
+typedef uint32_t nvs_handle_t;
+
+typedef enum {
+    NVS_READONLY,
+    NVS_READWRITE,
+} nvs_open_mode_t;
+
+esp_err_t nvs_open(const char* ns, nvs_open_mode_t mode, nvs_handle_t* out);
+void nvs_close(nvs_handle_t h);
+esp_err_t nvs_commit(nvs_handle_t h);
+esp_err_t nvs_get_blob(nvs_handle_t h, const char* key, void* v, size_t* len);
+esp_err_t
+nvs_set_blob(nvs_handle_t h, const char* key, const void* v, size_t len);
+esp_err_t nvs_get_u32(nvs_handle_t h, const char* key, uint32_t* out);
+esp_err_t nvs_set_u32(nvs_handle_t h, const char* key, uint32_t v);
+esp_err_t nvs_erase_key(nvs_handle_t h, const char* key);
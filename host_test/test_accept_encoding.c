@@ -0,0 +1,136 @@
+// Выбор варианта встроенной страницы по Accept-Encoding: q-значения,
+// "*", запрет identity, регистр и пробелы, усечённый заголовок, 406.
+// Запросы идут через маршрут "/" из настоящей таблицы web_assets.
+#include "sim_httpd.h"
+#include "test_util.h"
+#include "web_assets.h"
+#include "webserver.h"
+#include <string.h>
+
+static const web_asset_t* page(void)
+{
+    for (size_t i = 0; i < web_asset_count; i++) {
+        if (strcmp(web_assets[i].uri, "/") == 0) {
+            return &web_assets[i];
+        }
+    }
+    return NULL;
+}
+
+static const web_asset_variant_t* variant(const char* encoding)
+{
+    const web_asset_t* a = page();
+    for (size_t i = 0; i < a->variant_count; i++) {
+        if (strcmp(a->variants[i].encoding, encoding) == 0) {
+            return &a->variants[i];
+        }
+    }
+    return NULL;
+}
+
+// Ответ на accept (NULL — без заголовка): encoding или NULL — 406
+static void expect(const char* accept, const char* encoding)
+{
+    sim_httpd_req_t r;
+    sim_httpd_req_init(&r, NULL);
+    if (accept != NULL) {
+        sim_httpd_req_header(&r, "Accept-Encoding", accept);
+    }
+    CHECK_INT(sim_httpd_get("/", &r), ESP_OK);
+    CHECK(r.done);
+    CHECK(strcmp(sim_httpd_resp_header(&r, "Vary"), "Accept-Encoding") == 0);
+
+    if (encoding == NULL) {
+        if (r.status != 406) {
+            fprintf(stderr, "\"%s\": ожидался 406\n", accept);
+        }
+        CHECK_INT(r.status, 406);
+        CHECK_INT(r.len, 0);
+        sim_httpd_req_free(&r);
+        return;
+    }
+
+    const web_asset_variant_t* v = variant(encoding);
+    const char* got = sim_httpd_resp_header(&r, "Content-Encoding");
+    if (got == NULL) {
+        got = "identity";
+    }
+    if (strcmp(got, encoding) != 0) {
+        fprintf(stderr,
+                "\"%s\": %s, ожидался %s\n",
+                accept ? accept : "(нет)",
+                got,
+                encoding);
+    }
+    CHECK(strcmp(got, encoding) == 0);
+    CHECK_INT(r.status, 200);
+    CHECK(strcmp(sim_httpd_resp_header(&r, "ETag"), v->etag) == 0);
+    CHECK_INT(r.len, v->size);
+    CHECK(memcmp(r.body, v->data, v->size) == 0);
+    sim_httpd_req_free(&r);
+}
+
+static void test_negotiation(void)
+{
+    expect(NULL, "identity");
+    expect("gzip, deflate, br", "br"); // равные q — лучшее сжатие
+    expect("gzip, deflate", "gzip");
+    expect("br;q=0.5, gzip;q=0.8", "gzip");
+    expect("br;q=1.0, gzip", "br");
+    expect("BR", "br");
+    expect(" gzip ; q=0.9 ,br ;Q=0.7", "gzip");
+    expect("x-gzip, gzip;q=0.2", "gzip");
+    expect("gzip;q=0.001, identity", "identity");
+    expect("gzip;q=0.5;level=9, br;q=0", "gzip");
+    expect("deflate", "identity"); // identity не запрещён
+    expect("*", "br");
+    expect("br;q=0, *;q=0.1", "gzip");
+    expect("br;q=0, gzip;q=0, *", "identity");
+
+    // identity запрещён явно или через "*" — 406
+    expect("identity;q=0", NULL);
+    expect("*;q=0", NULL);
+    expect("gzip;q=0, br;q=0, identity;q=0", NULL);
+    expect("deflate, identity;q=0", NULL);
+
+    // Не поместившийся в буфер хвост заголовка отбрасывается
+    char long_accept[200];
+    memset(long_accept, 'a', sizeof(long_accept));
+    memcpy(long_accept, "gzip;q=0.3, ", 12);
+    strcpy(long_accept + sizeof(long_accept) - 5, ", br");
+    expect(long_accept, "gzip");
+}
+
+// Условный запрос: 304 только для ETag выбранного варианта
+static void test_not_modified(void)
+{
+    sim_httpd_req_t r;
+    sim_httpd_req_init(&r, NULL);
+    sim_httpd_req_header(&r, "Accept-Encoding", "gzip");
+    sim_httpd_req_header(&r, "If-None-Match", variant("gzip")->etag);
+    CHECK_INT(sim_httpd_get("/", &r), ESP_OK);
+    CHECK_INT(r.status, 304);
+    sim_httpd_req_free(&r);
+
+    sim_httpd_req_init(&r, NULL);
+    sim_httpd_req_header(&r, "Accept-Encoding", "br");
+    sim_httpd_req_header(&r, "If-None-Match", variant("gzip")->etag);
+    CHECK_INT(sim_httpd_get("/", &r), ESP_OK);
+    CHECK_INT(r.status, 200);
+    sim_httpd_req_free(&r);
+}
+
+int main(void)
+{
+    // Тест рассчитан на таблицу gzip_assets.py: br, gzip, identity
+    CHECK(page() != NULL);
+    CHECK_INT(page()->variant_count, 3);
+    CHECK(strcmp(page()->variants[0].encoding, "br") == 0);
+    CHECK(variant("gzip") != NULL && variant("identity") != NULL);
+
+    start_webserver();
+    test_negotiation();
+    test_not_modified();
+    printf("OK\n");
+    return 0;
+}
@@ -0,0 +1,319 @@
+// BMP280: компенсация против формул даташита в double, forced-режим
+// и ошибки инициализации на моделируемой шине. В прошивку попадает
+// один вариант компенсации давления (BMP280_PRESSURE_COMP_32BIT),
+// тест проверяет собранный: test_bmp280 — 32-битный, test_bmp280_64 —
+// 64-битный.
+// Исходник драйвера включён целиком ради static-функций компенсации.
+#include "../main/src/bmp280.c"
+#include "sim_i2c.h"
+#include "test_util.h"
+#include <time.h>
+
+#define SIM_ADDR BMP280_I2C_ADDR_SECONDARY
+
+// Пример из даташита BMP280, раздел 3.12
+static const bmp280_calib_data_t DATASHEET_CALIB = {
+        .dig_T1 = 27504,
+        .dig_T2 = 26435,
+        .dig_T3 = -1000,
+        .dig_P1 = 36477,
+        .dig_P2 = -10685,
+        .dig_P3 = 3024,
+        .dig_P4 = 2855,
+        .dig_P5 = 140,
+        .dig_P6 = -7,
+        .dig_P7 = 15500,
+        .dig_P8 = -14600,
+        .dig_P9 = 6000,
+};
+#define DATASHEET_ADC_T 519888
+#define DATASHEET_ADC_P 415148
+
+// ---- Модель датчика на шине ----
+
+typedef struct {
+    uint8_t regs[256];
+    int busy_reads;   // сколько чтений STATUS показывать «измеряет»
+    int busy_left;
+    int forced_starts;
+    uint8_t fail_reg; // обмены с этим регистром завершаются ошибкой
+    int fail_count;
+} sim_bmp280_t;
+
+static void put_u16(uint8_t* p, uint16_t v)
+{
+    p[0] = v & 0xFF;
+    p[1] = v >> 8;
+}
+
+static void sim_bmp280_init(sim_bmp280_t* s, const bmp280_calib_data_t* c)
+{
+    memset(s, 0, sizeof(*s));
+    s->regs[BMP280_REG_CHIP_ID] = BMP280_CHIP_ID;
+    const uint16_t words[12] = {
+            c->dig_T1,
+            (uint16_t)c->dig_T2,
+            (uint16_t)c->dig_T3,
+            c->dig_P1,
+            (uint16_t)c->dig_P2,
+            (uint16_t)c->dig_P3,
+            (uint16_t)c->dig_P4,
+            (uint16_t)c->dig_P5,
+            (uint16_t)c->dig_P6,
+            (uint16_t)c->dig_P7,
+            (uint16_t)c->dig_P8,
+            (uint16_t)c->dig_P9,
+    };
+    for (int i = 0; i < 12; i++) {
+        put_u16(&s->regs[BMP280_REG_DIG_T1 + 2 * i], words[i]);
+    }
+}
+
+static void sim_bmp280_set_adc(sim_bmp280_t* s, int32_t adc_t, int32_t adc_p)
+{
+    s->regs[BMP280_REG_PRESS_MSB] = (uint8_t)(adc_p >> 12);
+    s->regs[BMP280_REG_PRESS_LSB] = (uint8_t)(adc_p >> 4);
+    s->regs[BMP280_REG_PRESS_XLSB] = (uint8_t)(adc_p << 4);
+    s->regs[BMP280_REG_TEMP_MSB] = (uint8_t)(adc_t >> 12);
+    s->regs[BMP280_REG_TEMP_LSB] = (uint8_t)(adc_t >> 4);
+    s->regs[BMP280_REG_TEMP_XLSB] = (uint8_t)(adc_t << 4);
+}
+
+static esp_err_t sim_bmp280_xfer(
+        void* ctx,
+        const uint8_t* tx,
+        size_t tx_len,
+        uint8_t* rx,
+        size_t rx_len)
+{
+    sim_bmp280_t* s = ctx;
+    if (s->fail_count > 0 && tx[0] == s->fail_reg) {
+        s->fail_count--;
+        return ESP_ERR_TIMEOUT;
+    }
+    if (rx_len == 0) {
+        // Запись парами «регистр, значение»
+        for (size_t i = 0; i + 1 < tx_len; i += 2) {
+            uint8_t reg = tx[i], val = tx[i + 1];
+            if (reg == BMP280_REG_RESET && val == BMP280_RESET_VALUE) {
+                s->regs[BMP280_REG_CTRL_MEAS] = 0;
+                s->regs[BMP280_REG_CONFIG] = 0;
+                continue;
+            }
+            s->regs[reg] = val;
+            if (reg == BMP280_REG_CTRL_MEAS && (val & 3) == 1) {
+                s->forced_starts++;
+                s->busy_left = s->busy_reads;
+            }
+        }
+        return ESP_OK;
+    }
+
+    uint8_t reg = tx[0];
+    for (size_t i = 0; i < rx_len; i++) {
+        rx[i] = s->regs[(uint8_t)(reg + i)];
+    }
+    if (reg == BMP280_REG_STATUS) {
+        rx[0] = s->busy_left > 0 ? BMP280_STATUS_MEASURING : 0;
+        if (s->busy_left > 0 && --s->busy_left == 0) {
+            // Конец forced-измерения: датчик сам уходит в sleep
+            s->regs[BMP280_REG_CTRL_MEAS] &= ~3;
+        }
+    }
+    return ESP_OK;
+}
+
+static sim_bmp280_t s_sim;
+static float s_published_t, s_published_p;
+static uint8_t s_published_valid;
+
+void sensor_data_set_bmp(float temperature_bmp, float pressure, uint8_t valid)
+{
+    s_published_t = temperature_bmp;
+    s_published_p = pressure;
+    s_published_valid = valid;
+}
+
+// ---- Эталон: формулы с плавающей точкой из даташита, раздел 8.1 ----
+
+static void reference(
+        const bmp280_calib_data_t* c,
+        int32_t adc_t,
+        int32_t adc_p,
+        double* t_out,
+        double* p_out)
+{
+    double v1 = (adc_t / 16384.0 - c->dig_T1 / 1024.0) * c->dig_T2;
+    double dt = adc_t / 131072.0 - c->dig_T1 / 8192.0;
+    double v2 = dt * dt * c->dig_T3;
+    double t_fine = v1 + v2;
+    *t_out = t_fine / 5120.0;
+
+    v1 = t_fine / 2.0 - 64000.0;
+    v2 = v1 * v1 * c->dig_P6 / 32768.0;
+    v2 = v2 + v1 * c->dig_P5 * 2.0;
+    v2 = v2 / 4.0 + c->dig_P4 * 65536.0;
+    v1 = (c->dig_P3 * v1 * v1 / 524288.0 + c->dig_P2 * v1) / 524288.0;
+    v1 = (1.0 + v1 / 32768.0) * c->dig_P1;
+    double p = 1048576.0 - adc_p;
+    p = (p - v2 / 4096.0) * 6250.0 / v1;
+    v1 = c->dig_P9 * p * p / 2147483648.0;
+    v2 = p * c->dig_P8 / 32768.0;
+    *p_out = p + (v1 + v2 + c->dig_P7) / 16.0;
+}
+
+#if BMP280_PRESSURE_COMP_32BIT
+#define PRESS_BITS 32
+// 32-битный вариант теряет младшие биты: до 0.06 мм рт. ст.
+#define PRESS_MAX_ERR_PA 8.0
+
+static double press_pa(bmp280_dev_t* dev, int32_t adc_p)
+{
+    return bmp280_compensate_pressure32(dev, adc_p);
+}
+#else
+#define PRESS_BITS 64
+#define PRESS_MAX_ERR_PA 1.0
+
+static double press_pa(bmp280_dev_t* dev, int32_t adc_p)
+{
+    return bmp280_compensate_pressure64(dev, adc_p) / 256.0;
+}
+#endif
+
+static bmp280_dev_t calib_dev(const bmp280_calib_data_t* c)
+{
+    bmp280_dev_t dev = {0};
+    dev.calib_data = *c;
+    return dev;
+}
+
+static void test_datasheet_example(void)
+{
+    bmp280_dev_t dev = calib_dev(&DATASHEET_CALIB);
+    CHECK_INT(bmp280_compensate_temperature(&dev, DATASHEET_ADC_T), 2508);
+    CHECK_INT(dev.t_fine, 128422);
+#if BMP280_PRESSURE_COMP_32BIT
+    CHECK_INT(bmp280_compensate_pressure32(&dev, DATASHEET_ADC_P), 100656);
+#else
+    // В даташите 100653.27 Па (расчёт в double)
+    CHECK_NEAR(bmp280_compensate_pressure64(&dev, DATASHEET_ADC_P) / 256.0,
+               100653.27,
+               0.1);
+#endif
+}
+
+// Отклонение от double на сетке сырых значений
+static void test_integer_path_matches_reference(void)
+{
+    bmp280_dev_t dev = calib_dev(&DATASHEET_CALIB);
+    double worst_p = 0.0, worst_t = 0.0;
+    int n = 0;
+    for (int32_t adc_t = 400000; adc_t <= 640000; adc_t += 4000) {
+        for (int32_t adc_p = 200000; adc_p <= 660000; adc_p += 1500) {
+            double t_ref, p_ref;
+            reference(&DATASHEET_CALIB, adc_t, adc_p, &t_ref, &p_ref);
+            if (t_ref < -40.0 || t_ref > 85.0 || p_ref < 30000.0
+                || p_ref > 110000.0) {
+                continue; // вне рабочего диапазона датчика
+            }
+            int32_t t = bmp280_compensate_temperature(&dev, adc_t);
+            worst_t = fmax(worst_t, fabs(t / 100.0 - t_ref));
+            worst_p = fmax(worst_p, fabs(press_pa(&dev, adc_p) - p_ref));
+            n++;
+        }
+    }
+    printf("точек %d, отклонение: T %.3f °C, P%d %.2f Па\n",
+           n,
+           worst_t,
+           PRESS_BITS,
+           worst_p);
+    CHECK(n > 1000);
+    CHECK(worst_t <= 0.01);
+    CHECK(worst_p <= PRESS_MAX_ERR_PA);
+}
+
+// Только печать: на хосте оба варианта быстрые, выигрыш 32-битной
+// арифметики виден на Xtensa без 64-битного умножения
+static void bench_compensation(void)
+{
+    enum { N = 2000000 };
+    bmp280_dev_t dev = calib_dev(&DATASHEET_CALIB);
+    bmp280_compensate_temperature(&dev, DATASHEET_ADC_T);
+    volatile uint32_t sink = 0;
+    struct timespec a, b;
+    clock_gettime(CLOCK_MONOTONIC, &a);
+    for (int i = 0; i < N; i++) {
+        sink += (uint32_t)press_pa(&dev, DATASHEET_ADC_P + (i & 1023));
+    }
+    clock_gettime(CLOCK_MONOTONIC, &b);
+    (void)sink;
+    printf("компенсация давления, %d бит: %.1f нс\n",
+           PRESS_BITS,
+           ((b.tv_sec - a.tv_sec) * 1e9 + (b.tv_nsec - a.tv_nsec)) / N);
+}
+
+// Ошибка после подключения к шине освобождает дескриптор и слот:
+// повторные неудачные инициализации их не копят
+static void test_failed_init_releases_device(void)
+{
+    const uint8_t fail_regs[] = {
+            BMP280_REG_RESET,
+            BMP280_REG_DIG_T1,
+            BMP280_REG_CTRL_MEAS,
+    };
+    sim_bmp280_init(&s_sim, &DATASHEET_CALIB);
+    int open_before = sim_i2c_open_handles();
+    for (int round = 0; round < 2 * I2C_BUS_MAX_DEVICES; round++) {
+        s_sim.fail_reg = fail_regs[round % 3];
+        s_sim.fail_count = I2C_BUS_RETRIES + 1;
+        CHECK_INT(bmp280_driver_init(NULL), ESP_ERR_TIMEOUT);
+        CHECK(s_sensor.i2c_dev == NULL);
+        CHECK_INT(sim_i2c_open_handles(), open_before);
+    }
+}
+
+static void test_forced_measurement_on_bus(void)
+{
+    sim_bmp280_init(&s_sim, &DATASHEET_CALIB);
+    sim_bmp280_set_adc(&s_sim, DATASHEET_ADC_T, DATASHEET_ADC_P);
+    s_sim.busy_reads = 2;
+
+    CHECK_INT(bmp280_driver_init(NULL), ESP_OK);
+    CHECK_INT(s_sensor.i2c_addr, SIM_ADDR);
+    // После настройки датчик спит: T x1, P x4, режим sleep
+    CHECK_INT(s_sim.regs[BMP280_REG_CTRL_MEAS], (1 << 5) | (3 << 2));
+    CHECK(bmp280_measurement_time_us(&s_sensor.config)
+          <= BMP280_DRIVER_READ_DELAY_MS * 1000);
+
+    CHECK_INT(bmp280_driver_start(NULL), ESP_OK);
+    CHECK_INT(s_sim.forced_starts, 1);
+    CHECK_INT(bmp280_driver_read(NULL), ESP_OK);
+    CHECK_INT(s_published_valid, 1);
+    CHECK_NEAR(s_published_t, 25.08, 0.001);
+    CHECK_NEAR(s_published_p, 100653.27 / 100.0 * 0.750062, 0.05);
+    CHECK_INT(s_sim.regs[BMP280_REG_CTRL_MEAS] & 3, BMP280_SLEEP_MODE);
+
+    // Измерение не закончилось за BMP280_FORCED_POLL_MAX опросов
+    s_sim.busy_reads = BMP280_FORCED_POLL_MAX + 5;
+    CHECK_INT(bmp280_driver_start(NULL), ESP_OK);
+    CHECK_INT(bmp280_driver_read(NULL), ESP_ERR_TIMEOUT);
+    CHECK_INT(s_published_valid, 0);
+}
+
+int main(void)
+{
+    test_datasheet_example();
+    test_integer_path_matches_reference();
+    bench_compensation();
+
+    sim_i2c_reset();
+    sim_i2c_add_target(SIM_ADDR, sim_bmp280_xfer, &s_sim);
+    i2c_master_bus_config_t bus_cfg = {0};
+    CHECK_INT(i2c_bus_init(&bus_cfg), ESP_OK);
+    test_failed_init_releases_device();
+    test_forced_measurement_on_bus();
+
+    printf("OK\n");
+    return 0;
+}
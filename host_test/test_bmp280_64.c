@@ -0,0 +1,3 @@
+// test_bmp280 с эталонной 64-битной компенсацией давления
+#define BMP280_PRESSURE_COMP_32BIT 0
+#include "test_bmp280.c"
@@ -0,0 +1,120 @@
+// Производные величины против справочных значений: таблица индекса
+// жары NWS, точка росы и абсолютная влажность, барометрическая
+// формула, границы шкалы AQI US EPA.
+#include "derived_metrics.h"
+#include "test_util.h"
+
+static float f_to_c(float f)
+{
+    return (f - 32.0f) / 1.8f;
+}
+
+static void test_humidity(void)
+{
+    CHECK_NEAR(derived_dew_point(25.0f, 60.0f), 16.69, 0.05);
+    CHECK_NEAR(derived_dew_point(20.0f, 50.0f), 9.26, 0.05);
+    CHECK_NEAR(derived_dew_point(-10.0f, 80.0f), -12.9, 0.2);
+    CHECK_NEAR(derived_dew_point(30.0f, 100.0f), 30.0, 0.01);
+
+    CHECK_NEAR(derived_abs_humidity(20.0f, 50.0f), 8.65, 0.05);
+    CHECK_NEAR(derived_abs_humidity(30.0f, 80.0f), 24.3, 0.2);
+}
+
+// Таблица NWS (°F, %): значения с точностью таблицы, ±1 °F
+static void test_heat_index(void)
+{
+    static const struct {
+        float t_f, rh, hi_f;
+    } nws[] = {
+            {80, 40, 80},
+            {90, 70, 105},
+            {100, 50, 118},
+            {86, 90, 105},
+            {96, 40, 101},
+            {104, 40, 119},
+    };
+    for (size_t i = 0; i < sizeof(nws) / sizeof(nws[0]); i++) {
+        CHECK_NEAR(
+                derived_heat_index(f_to_c(nws[i].t_f), nws[i].rh),
+                f_to_c(nws[i].hi_f),
+                0.6);
+    }
+    // Вне таблицы (прохладно) индекс жары близок к температуре
+    CHECK_NEAR(derived_heat_index(20.0f, 50.0f), 19.6, 0.6);
+}
+
+static void test_sea_level_pressure(void)
+{
+    CHECK_NEAR(derived_sea_level_pressure(750.0f, 15.0f, 100.0f), 758.9, 0.3);
+    CHECK_NEAR(derived_sea_level_pressure(750.0f, 15.0f, 0.0f), 750.0, 0.001);
+}
+
+static void test_aqi(void)
+{
+    // Границы отрезков PM2.5 и концентрации внутри них
+    CHECK_INT(derived_aqi_pm25(0.0f), 0);
+    CHECK_INT(derived_aqi_pm25(12.0f), 50);
+    CHECK_INT(derived_aqi_pm25(12.1f), 51);
+    CHECK_INT(derived_aqi_pm25(35.0f), 99);
+    CHECK_INT(derived_aqi_pm25(35.45f), 100);
+    CHECK_INT(derived_aqi_pm25(55.0f), 149);
+    CHECK_INT(derived_aqi_pm25(150.0f), 200);
+    CHECK_INT(derived_aqi_pm25(600.0f), 500);
+
+    CHECK_INT(derived_aqi_pm10(54.0f), 50);
+    CHECK_INT(derived_aqi_pm10(100.0f), 73);
+
+    // Итоговый AQI — больший из двух индексов: при чистом PM2.5 и
+    // пыльном PM10 (стройка, сухая уборка) оценку задаёт PM10
+    derived_metrics_t d;
+    derived_init(&d);
+    CHECK(derived_update_aqi(&d, 5, 200));
+    CHECK_INT(derived_aqi_pm25(5.0f), 21);
+    CHECK_INT(d.aqi, derived_aqi_pm10(200.0f));
+    CHECK_INT(d.aqi, 123);
+    CHECK_INT(d.aqi_category, AQI_SENSITIVE);
+
+    CHECK_INT(derived_aqi_category(50), AQI_GOOD);
+    CHECK_INT(derived_aqi_category(51), AQI_MODERATE);
+    CHECK_INT(derived_aqi_category(150), AQI_SENSITIVE);
+    CHECK_INT(derived_aqi_category(201), AQI_VERY_UNHEALTHY);
+    CHECK_INT(derived_aqi_category(301), AQI_HAZARDOUS);
+
+    CHECK_INT(derived_air_level(800, 0, 0, 0), AIR_LEVEL_GOOD);
+    CHECK_INT(derived_air_level(801, 0, 0, 0), AIR_LEVEL_MODERATE);
+    CHECK_INT(derived_air_level(1600, 0, 0, 0), AIR_LEVEL_BAD);
+    CHECK_INT(derived_air_level(500, 10.0f, 0, 0), AIR_LEVEL_POOR);
+}
+
+// Пересчёт только при изменении входов
+static void test_update_on_change(void)
+{
+    derived_metrics_t d;
+    derived_init(&d);
+    CHECK_INT(d.aqi, DERIVED_AQI_NONE);
+
+    CHECK(derived_update_aqi(&d, 10, 20));
+    CHECK(!derived_update_aqi(&d, 10, 20));
+    CHECK(derived_update_aqi(&d, 40, 20));
+    CHECK_INT(d.aqi, derived_aqi_pm25(40.0f));
+
+    CHECK(derived_update_humidity(&d, 20.0f, 50.0f));
+    CHECK(!derived_update_humidity(&d, 20.0f, 50.0f));
+    CHECK(d.humidity_valid);
+    derived_invalidate_humidity(&d);
+    CHECK(derived_update_humidity(&d, 20.0f, 50.0f));
+
+    CHECK(derived_update_pressure(&d, 750.0f, 15.0f));
+    CHECK(!derived_update_pressure(&d, 750.0f, 15.0f));
+}
+
+int main(void)
+{
+    test_humidity();
+    test_heat_index();
+    test_sea_level_pressure();
+    test_aqi();
+    test_update_on_change();
+    printf("OK\n");
+    return 0;
+}
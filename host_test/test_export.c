@@ -0,0 +1,85 @@
+// Архив выборок и /export на моделируемом флеше: один запуск —
+// одна загрузка прошивки. Образ раздела хранится в файле между
+// запусками, ожидаемые ответы считает export_ref.py.
+//
+//   test_export <образ> <сектор|-1> <первая> <число> [query...]
+//
+// Перед загрузкой можно стереть сектор (питание пропало между
+// стиранием и заголовком). Затем в архив пишутся выборки с номерами
+// первая..первая+число-1, и для каждого query выполняется /export.
+// На каждый ответ в stdout:
+//
+//   <код> <длина тела>\n<Content-Type>\n<Content-Disposition>\n<тело>
+#include "sample_store.h"
+#include "sim_flash.h"
+#include "sim_httpd.h"
+#include "test_util.h"
+#include "webserver.h"
+#include <string.h>
+
+#define SECTORS 4
+#define TIME0 1750000000u
+#define STEP_S 60
+
+// Значения отстоят от границы округления, поэтому фиксированная
+// точка не зависит от погрешности float: temp_c10 = i % 400 - 50,
+// hum_p10 = i * 7 % 1000, press_p10 = 7400 + i % 50,
+// co2 = 400 + i % 300
+static sample_values_t synthetic(uint32_t i)
+{
+    return (sample_values_t){
+            .time_s = TIME0 + STEP_S * i,
+            .temperature = -5.0f + (i % 400) * 0.1f + 0.02f,
+            .humidity = (i * 7 % 1000) / 10.0f + 0.03f,
+            .pressure = 740.0f + (i % 50) / 10.0f + 0.04f,
+            .co2 = 400.0f + i % 300 + 0.2f,
+            .pm1_0 = i % 17,
+            .pm2_5 = i % 23,
+            .pm10 = i % 31,
+            .flags = i % 16,
+    };
+}
+
+static void put_header(const sim_httpd_req_t* r, const char* name)
+{
+    const char* v = sim_httpd_resp_header(r, name);
+    printf("%s\n", v ? v : "");
+}
+
+int main(int argc, char** argv)
+{
+    CHECK(argc >= 5);
+    const char* image = argv[1];
+    int erase = atoi(argv[2]);
+    uint32_t first = strtoul(argv[3], NULL, 10);
+    uint32_t count = strtoul(argv[4], NULL, 10);
+
+    sim_flash_reset(SAMPLE_STORE_PARTITION, SECTORS);
+    sim_flash_load(image);
+    if (erase >= 0) {
+        sim_flash_erase_sector(erase);
+    }
+    CHECK_INT(sample_store_init(), ESP_OK);
+    start_webserver();
+
+    for (uint32_t i = first; i < first + count; i++) {
+        sample_values_t v = synthetic(i);
+        CHECK_INT(sample_store_append(&v), ESP_OK);
+    }
+    CHECK(sim_flash_save(image));
+
+    for (int a = 5; a < argc; a++) {
+        sim_httpd_req_t r;
+        sim_httpd_req_init(&r, argv[a]);
+        sim_httpd_get("/export", &r);
+        CHECK(r.done);
+        CHECK_INT(r.errors, 0);
+
+        printf("%d %zu\n", r.status, r.len);
+        printf("%s\n", r.type);
+        put_header(&r, "Content-Disposition");
+        fwrite(r.body, 1, r.len, stdout);
+        sim_httpd_req_free(&r);
+    }
+    return 0;
+}
@@ -0,0 +1,85 @@
+// Табличные log2/exp2 кривых MQ-135 против powf в double
+#include "gas_curve.h"
+#include "test_util.h"
+
+// Точность из gas_curve.h: 0.02% на Rs/Ro в [0.01, 100]
+#define MAX_REL_ERR 2e-4
+
+static double reference_ppm(gas_id_t gas, double ratio)
+{
+    const gas_curve_t* c = &gas_curves[gas];
+    double ppm = exp2(c->log2_k) * pow(ratio, c->exponent);
+    if (ppm < c->min_ppm) {
+        return c->min_ppm;
+    }
+    return ppm > c->max_ppm ? c->max_ppm : ppm;
+}
+
+static void test_accuracy_sweep(void)
+{
+    double worst = 0.0;
+    // Логарифмическая сетка 0.01..100, 20000 точек
+    for (int i = 0; i <= 20000; i++) {
+        float ratio = (float)pow(10.0, -2.0 + 4.0 * i / 20000.0);
+        float all[GAS_COUNT];
+        gas_curve_eval_all(ratio, all);
+        for (int g = 0; g < GAS_COUNT; g++) {
+            double ref = reference_ppm(g, ratio);
+            float ppm = gas_curve_ppm(g, ratio);
+            CHECK(ppm == all[g]);
+            if (ref > 1e-3) {
+                double err = fabs(ppm - ref) / ref;
+                worst = err > worst ? err : worst;
+                CHECK(err <= MAX_REL_ERR);
+            } else {
+                CHECK_NEAR(ppm, ref, 1e-3);
+            }
+        }
+    }
+    printf("наибольшая относительная погрешность: %.2e\n", worst);
+}
+
+// Коэффициенты пересчитаны из прежней формулы CO2 в mq135.c
+static void test_co2_matches_legacy_formula(void)
+{
+    const float ratios[] = {1.0f, 2.0f, 3.6f, 5.0f, 8.0f};
+    for (size_t i = 0; i < sizeof(ratios) / sizeof(ratios[0]); i++) {
+        double legacy = 400.0 * pow(ratios[i] / 3.6, -2.769);
+        if (legacy > 5000.0) {
+            legacy = 5000.0;
+        }
+        CHECK_NEAR(gas_curve_ppm(GAS_CO2, ratios[i]), legacy, legacy * 3e-4);
+    }
+    CHECK_NEAR(gas_curve_ppm(GAS_CO2, 3.6f), 400.0, 0.1);
+}
+
+static void test_unusable_ratio_gives_min(void)
+{
+    const float bad[] = {0.0f, -1.0f, NAN, INFINITY, 1e-40f};
+    for (size_t i = 0; i < sizeof(bad) / sizeof(bad[0]); i++) {
+        float all[GAS_COUNT];
+        gas_curve_eval_all(bad[i], all);
+        for (int g = 0; g < GAS_COUNT; g++) {
+            CHECK(gas_curve_ppm(g, bad[i]) == gas_curves[g].min_ppm);
+            CHECK(all[g] == gas_curves[g].min_ppm);
+        }
+    }
+}
+
+static void test_clamped_to_range(void)
+{
+    for (int g = 0; g < GAS_COUNT; g++) {
+        CHECK(gas_curve_ppm(g, 1e-30f) == gas_curves[g].max_ppm);
+        CHECK(gas_curve_ppm(g, 1e30f) == gas_curves[g].min_ppm);
+    }
+}
+
+int main(void)
+{
+    test_accuracy_sweep();
+    test_co2_matches_legacy_formula();
+    test_unusable_ratio_gives_min();
+    test_clamped_to_range();
+    printf("OK\n");
+    return 0;
+}
@@ -0,0 +1,272 @@
+// Менеджер шины I2C на моделируемой шине: порядок пачки по
+// приоритету, повторы со сбросом шины, повторное использование слотов,
+// одновременное добавление и удаление устройства под нагрузкой из
+// других потоков.
+#include "i2c_bus.h"
+#include "sim_i2c.h"
+#include "test_util.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <time.h>
+
+static esp_err_t echo_xfer(
+        void* ctx,
+        const uint8_t* tx,
+        size_t tx_len,
+        uint8_t* rx,
+        size_t rx_len)
+{
+    for (size_t i = 0; i < rx_len; i++) {
+        rx[i] = tx[0] + (uint8_t)i;
+    }
+    return ESP_OK;
+}
+
+static void sleep_ms(long ms)
+{
+    struct timespec ts = {.tv_sec = ms / 1000, .tv_nsec = ms % 1000 * 1000000L};
+    nanosleep(&ts, NULL);
+}
+
+static i2c_bus_device_t* add(const char* name, uint8_t addr, int prio)
+{
+    i2c_bus_device_t* dev = NULL;
+    CHECK_INT(i2c_bus_add_device(name, addr, 100000, prio, &dev), ESP_OK);
+    CHECK(dev != NULL);
+    return dev;
+}
+
+static bool stats_of(const char* name, i2c_bus_dev_stats_t* out)
+{
+    for (int i = 0; i < i2c_bus_device_count(); i++) {
+        const char* n = i2c_bus_device_name(i);
+        if (n != NULL && strcmp(n, name) == 0) {
+            i2c_bus_get_stats(i, out);
+            return true;
+        }
+    }
+    return false;
+}
+
+static void* write_once(void* arg)
+{
+    uint8_t reg = 0x01;
+    CHECK_INT(i2c_bus_write(arg, &reg, 1), ESP_OK);
+    return NULL;
+}
+
+// Пока шина занята первой транзакцией, три других копятся в очереди
+// и выполняются пачкой: старший приоритет первым, равные — по очереди
+static void test_batch_order(void)
+{
+    i2c_bus_device_t* slow = add("slow", 0x10, I2C_BUS_PRIO_LOW);
+    i2c_bus_device_t* low = add("low", 0x11, I2C_BUS_PRIO_LOW);
+    i2c_bus_device_t* normal = add("normal", 0x20, I2C_BUS_PRIO_NORMAL);
+    i2c_bus_device_t* high = add("high", 0x30, I2C_BUS_PRIO_HIGH);
+    i2c_bus_device_t* order[] = {slow, low, normal, high};
+
+    sim_i2c_set_delay_ms(30);
+    pthread_t th[4];
+    for (int i = 0; i < 4; i++) {
+        pthread_create(&th[i], NULL, write_once, order[i]);
+        sleep_ms(5);
+    }
+    for (int i = 0; i < 4; i++) {
+        pthread_join(th[i], NULL);
+    }
+    sim_i2c_set_delay_ms(0);
+
+    uint8_t trace[SIM_I2C_TRACE_MAX];
+    CHECK_INT(sim_i2c_trace(trace, SIM_I2C_TRACE_MAX), 4);
+    CHECK_INT(trace[0], 0x10);
+    CHECK_INT(trace[1], 0x30);
+    CHECK_INT(trace[2], 0x20);
+    CHECK_INT(trace[3], 0x11);
+
+    for (int i = 0; i < 4; i++) {
+        CHECK_INT(i2c_bus_remove_device(order[i]), ESP_OK);
+    }
+}
+
+static void test_retry_and_stats(void)
+{
+    i2c_bus_device_t* dev = add("retry", 0x20, I2C_BUS_PRIO_NORMAL);
+    uint8_t reg = 0x05, rx[2] = {0};
+
+    // Один сбой: сброс шины и успешный повтор
+    sim_i2c_fail(0x20, 1, ESP_ERR_TIMEOUT);
+    CHECK_INT(i2c_bus_write_read(dev, &reg, 1, rx, 2), ESP_OK);
+    CHECK_INT(rx[1], 0x06);
+
+    // Сбоев больше, чем повторов: ошибка доходит до вызывающего
+    sim_i2c_fail(0x20, I2C_BUS_RETRIES + 1, ESP_ERR_TIMEOUT);
+    CHECK_INT(i2c_bus_write(dev, &reg, 1), ESP_ERR_TIMEOUT);
+
+    i2c_bus_dev_stats_t st;
+    CHECK(stats_of("retry", &st));
+    CHECK_INT(st.transactions, 2);
+    CHECK_INT(st.errors, 1);
+    CHECK_INT(st.timeouts, 2);
+    CHECK_INT(st.bus_resets, 1 + (I2C_BUS_RETRIES + 1));
+    CHECK_INT(sim_i2c_bus_resets(), 1 + (I2C_BUS_RETRIES + 1));
+
+    CHECK_INT(i2c_bus_remove_device(dev), ESP_OK);
+}
+
+// Удалённый слот снова занимается, его lock свободен, дескрипторы
+// драйвера не утекают
+static void test_slot_reuse(void)
+{
+    int open_before = sim_i2c_open_handles();
+    i2c_bus_device_t* devs[I2C_BUS_MAX_DEVICES];
+    for (int i = 0; i < I2C_BUS_MAX_DEVICES; i++) {
+        devs[i] = add("dev", 0x20, I2C_BUS_PRIO_NORMAL);
+    }
+    i2c_bus_device_t* extra = NULL;
+    CHECK_INT(
+            i2c_bus_add_device("extra", 0x20, 100000, 0, &extra),
+            ESP_ERR_NO_MEM);
+
+    uint8_t reg = 0x01;
+    for (int round = 0; round < 100; round++) {
+        i2c_bus_device_t* old = devs[round % I2C_BUS_MAX_DEVICES];
+        CHECK_INT(i2c_bus_remove_device(old), ESP_OK);
+        CHECK_INT(i2c_bus_remove_device(old), ESP_ERR_INVALID_ARG);
+        CHECK_INT(i2c_bus_write(old, &reg, 1), ESP_ERR_INVALID_ARG);
+
+        i2c_bus_device_t* dev = add("dev", 0x20, I2C_BUS_PRIO_NORMAL);
+        CHECK(dev == old);
+        CHECK_INT(i2c_bus_write(dev, &reg, 1), ESP_OK);
+        devs[round % I2C_BUS_MAX_DEVICES] = dev;
+    }
+    CHECK_INT(sim_i2c_open_handles(), open_before + I2C_BUS_MAX_DEVICES);
+
+    for (int i = 0; i < I2C_BUS_MAX_DEVICES; i++) {
+        CHECK_INT(i2c_bus_remove_device(devs[i]), ESP_OK);
+    }
+    CHECK_INT(sim_i2c_open_handles(), open_before);
+}
+
+static void* add_one(void* arg)
+{
+    i2c_bus_device_t** out = arg;
+    CHECK_INT(i2c_bus_add_device("race", 0x20, 100000, 0, out), ESP_OK);
+    return NULL;
+}
+
+// Одновременные добавления получают разные слоты: поиск свободного и
+// его захват не разделены
+static void test_concurrent_add(void)
+{
+    int open_before = sim_i2c_open_handles();
+    i2c_bus_device_t* devs[I2C_BUS_MAX_DEVICES] = {0};
+    pthread_t th[I2C_BUS_MAX_DEVICES];
+    sim_i2c_set_delay_ms(5);
+    for (int i = 0; i < I2C_BUS_MAX_DEVICES; i++) {
+        pthread_create(&th[i], NULL, add_one, &devs[i]);
+    }
+    for (int i = 0; i < I2C_BUS_MAX_DEVICES; i++) {
+        pthread_join(th[i], NULL);
+    }
+    sim_i2c_set_delay_ms(0);
+
+    for (int i = 0; i < I2C_BUS_MAX_DEVICES; i++) {
+        CHECK(devs[i] != NULL);
+        for (int j = 0; j < i; j++) {
+            CHECK(devs[i] != devs[j]);
+        }
+    }
+    CHECK_INT(sim_i2c_open_handles(), open_before + I2C_BUS_MAX_DEVICES);
+    for (int i = 0; i < I2C_BUS_MAX_DEVICES; i++) {
+        CHECK_INT(i2c_bus_remove_device(devs[i]), ESP_OK);
+    }
+    CHECK_INT(sim_i2c_open_handles(), open_before);
+}
+
+typedef struct {
+    i2c_bus_device_t* dev;
+    atomic_int ok;
+    atomic_int done;
+    esp_err_t last;
+} hammer_t;
+
+static void* hammer(void* arg)
+{
+    hammer_t* h = arg;
+    uint8_t reg = 0x01, rx[4];
+    esp_err_t err;
+    while ((err = i2c_bus_write_read(h->dev, &reg, 1, rx, sizeof(rx)))
+           == ESP_OK) {
+        atomic_fetch_add(&h->ok, 1);
+    }
+    h->last = err;
+    atomic_store(&h->done, 1);
+    return NULL;
+}
+
+// Удаление, пока другие потоки гоняют транзакции: транзакция в полёте
+// доходит до конца, ждущие lock получают ESP_ERR_INVALID_ARG, удалённый
+// дескриптор драйвера больше не используется, никто не зависает
+static void test_remove_under_load(void)
+{
+    enum { THREADS = 3 };
+    i2c_bus_device_t* dev = add("busy", 0x20, I2C_BUS_PRIO_NORMAL);
+    sim_i2c_set_delay_ms(2);
+
+    hammer_t h[THREADS];
+    pthread_t th[THREADS];
+    for (int i = 0; i < THREADS; i++) {
+        h[i] = (hammer_t){.dev = dev};
+        pthread_create(&th[i], NULL, hammer, &h[i]);
+    }
+    sleep_ms(50);
+    CHECK_INT(i2c_bus_remove_device(dev), ESP_OK);
+
+    for (int waited = 0; waited < 2000; waited += 10) {
+        int done = 0;
+        for (int i = 0; i < THREADS; i++) {
+            done += atomic_load(&h[i].done);
+        }
+        if (done == THREADS) {
+            break;
+        }
+        sleep_ms(10);
+    }
+    int ok = 0;
+    for (int i = 0; i < THREADS; i++) {
+        CHECK(atomic_load(&h[i].done)); // зависший поток — lock не отдан
+        pthread_join(th[i], NULL);
+        CHECK_INT(h[i].last, ESP_ERR_INVALID_ARG);
+        ok += atomic_load(&h[i].ok);
+    }
+    CHECK(ok > 0);
+    CHECK_INT(sim_i2c_stale_uses(), 0);
+    sim_i2c_set_delay_ms(0);
+
+    // Слот снова рабочий
+    i2c_bus_device_t* again = add("again", 0x20, I2C_BUS_PRIO_NORMAL);
+    uint8_t reg = 0x01;
+    CHECK_INT(i2c_bus_write(again, &reg, 1), ESP_OK);
+    CHECK_INT(i2c_bus_remove_device(again), ESP_OK);
+}
+
+int main(void)
+{
+    sim_i2c_reset();
+    const uint8_t targets[] = {0x10, 0x11, 0x20, 0x30};
+    for (size_t i = 0; i < sizeof(targets); i++) {
+        sim_i2c_add_target(targets[i], echo_xfer, NULL);
+    }
+    i2c_master_bus_config_t bus_cfg = {0};
+    CHECK_INT(i2c_bus_init(&bus_cfg), ESP_OK);
+
+    test_batch_order();
+    test_retry_and_stats();
+    test_slot_reuse();
+    test_concurrent_add();
+    test_remove_under_load();
+
+    printf("OK\n");
+    return 0;
+}
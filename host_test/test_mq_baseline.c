@@ -0,0 +1,121 @@
+// Базовая линия MQ-135 на синтетической записи с дрейфом за пять суток
+#include "mq135.h"
+#include "mq_baseline.h"
+#include "test_util.h"
+
+#define HOUR 3600
+#define SAMPLE_S 60
+
+// Rs в чистом воздухе медленно падает с 80 до 60 кОм за пять суток.
+// Днём с 8 до 20 часов воздух загрязнён, и Rs ниже на 40%.
+static float trace_rs(uint32_t t)
+{
+    float clean = 80.0f - 20.0f * (float)t / (5.0f * 24 * HOUR);
+    uint32_t hour = (t / HOUR) % 24;
+    return hour >= 8 && hour < 20 ? clean * 0.6f : clean;
+}
+
+static void test_tracks_slow_drift(void)
+{
+    mq_baseline_t b;
+    mq_baseline_init(&b, RO_VALUE, 0);
+    int updates = 0;
+    for (uint32_t t = 0; t <= 5 * 24 * HOUR; t += SAMPLE_S) {
+        bool changed = mq_baseline_update(&b, trace_rs(t), t);
+        if (changed) {
+            updates++;
+            CHECK(t >= MQ_BASELINE_MIN_BUCKETS * HOUR);
+        }
+    }
+    // Раз в час после первых шести часов
+    CHECK(updates >= 5 * 24 - MQ_BASELINE_MIN_BUCKETS - 1);
+    CHECK(updates <= 5 * 24);
+
+    // Цель — максимум Rs за сутки, то есть чистый воздух сутки назад
+    float expected = trace_rs(4 * 24 * HOUR) / RO_CLEAN_AIR_RATIO;
+    CHECK_NEAR(b.ro, expected, expected * 0.02f);
+}
+
+static void test_no_update_before_min_buckets(void)
+{
+    mq_baseline_t b;
+    mq_baseline_init(&b, RO_VALUE, 1000);
+    for (uint32_t t = 1000; t < 1000 + MQ_BASELINE_MIN_BUCKETS * HOUR;
+         t += SAMPLE_S) {
+        CHECK(!mq_baseline_update(&b, 200.0f, t));
+    }
+    CHECK(b.ro == RO_VALUE);
+}
+
+static void test_invalid_rs_ignored(void)
+{
+    mq_baseline_t b;
+    mq_baseline_init(&b, RO_VALUE, 0);
+    const float bad[] = {NAN, INFINITY, -5.0f, 0.0f};
+    for (uint32_t t = 0; t < 12 * HOUR; t += SAMPLE_S) {
+        mq_baseline_update(&b, bad[(t / SAMPLE_S) % 4], t);
+    }
+    CHECK(b.window_max == 0.0f);
+    CHECK(b.ro == RO_VALUE);
+}
+
+static void test_out_of_range_target_ignored(void)
+{
+    mq_baseline_t b;
+    mq_baseline_init(&b, RO_VALUE, 0);
+    // Обрыв цепи: Rs огромное, цель выше MQ_BASELINE_RO_MAX
+    float rs = MQ_BASELINE_RO_MAX * RO_CLEAN_AIR_RATIO * 2.0f;
+    for (uint32_t t = 0; t < 24 * HOUR; t += SAMPLE_S) {
+        CHECK(!mq_baseline_update(&b, rs, t));
+    }
+    CHECK(b.ro == RO_VALUE);
+}
+
+static void test_long_gap_clears_window(void)
+{
+    mq_baseline_t b;
+    mq_baseline_init(&b, RO_VALUE, 0);
+    for (uint32_t t = 0; t < 10 * HOUR; t += SAMPLE_S) {
+        mq_baseline_update(&b, 100.0f, t);
+    }
+    // Двое суток без отсчётов: все корзины устарели
+    uint32_t t = 10 * HOUR + 48 * HOUR;
+    mq_baseline_update(&b, 50.0f, t);
+    CHECK(b.window_max == 0.0f);
+    mq_baseline_update(&b, 50.0f, t + HOUR);
+    CHECK(b.window_max == 50.0f);
+}
+
+// После перерыва дольше окна Ro снова ждёт MQ_BASELINE_MIN_BUCKETS
+// часов данных, а не подстраивается по одному часу
+static void test_long_gap_requires_min_buckets(void)
+{
+    mq_baseline_t b;
+    mq_baseline_init(&b, RO_VALUE, 0);
+    uint32_t t = 0;
+    for (; t < 30 * HOUR; t += SAMPLE_S) {
+        mq_baseline_update(&b, trace_rs(t), t);
+    }
+    float ro = b.ro;
+
+    uint32_t resume = t + 3 * 24 * HOUR;
+    for (t = resume; t < resume + MQ_BASELINE_MIN_BUCKETS * HOUR;
+         t += SAMPLE_S) {
+        CHECK(!mq_baseline_update(&b, 200.0f, t));
+    }
+    CHECK(b.ro == ro);
+    CHECK(mq_baseline_update(&b, 200.0f, t));
+    CHECK_INT(b.filled, MQ_BASELINE_MIN_BUCKETS);
+}
+
+int main(void)
+{
+    test_tracks_slow_drift();
+    test_no_update_before_min_buckets();
+    test_invalid_rs_ignored();
+    test_out_of_range_target_ignored();
+    test_long_gap_clears_window();
+    test_long_gap_requires_min_buckets();
+    printf("OK\n");
+    return 0;
+}
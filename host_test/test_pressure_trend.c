@@ -0,0 +1,120 @@
+// Барическая тенденция на синтетических 6 ч: 3 ч ровно 760 мм рт. ст.
+// с шумом, затем падение 4 гПа за 3 ч. Инкрементальный наклон
+// сверяется с регрессией, пересчитанной по кольцу заново в double.
+#include "pressure_trend.h"
+#include "test_util.h"
+
+#define HPA_PER_MMHG 1.333224
+#define STEP_S 5
+#define FALL_FROM_S (3 * 3600)
+#define FALL_HPA_3H 4.0
+
+static uint32_t s_rng = 1;
+
+// Шум ±0.1 мм рт. ст.
+static float noise(void)
+{
+    s_rng = s_rng * 1103515245u + 12345u;
+    return ((int)((s_rng >> 16) % 100) - 50) / 500.0f;
+}
+
+static float pressure_at(uint32_t ts)
+{
+    float p = 760.0f + noise();
+    if (ts > FALL_FROM_S) {
+        p -= (ts - FALL_FROM_S) / 10800.0f * FALL_HPA_3H / HPA_PER_MMHG;
+    }
+    return p;
+}
+
+// Изменение за 3 ч по регрессии, посчитанной с нуля
+static double exact_delta_3h(const pressure_trend_t* t)
+{
+    double n = t->count, sk = 0, sy = 0, sky = 0, skk = 0;
+    for (int k = 0; k < t->count; k++) {
+        double y = t->ring[(t->head + k) % PRESSURE_TREND_BUCKETS];
+        sk += k;
+        sy += y;
+        sky += k * y;
+        skk += (double)k * k;
+    }
+    double slope = (n * sky - sk * sy) / (n * skk - sk * sk);
+    return slope * (PRESSURE_TREND_BUCKETS - 1) * HPA_PER_MMHG;
+}
+
+static void test_incremental_slope(void)
+{
+    pressure_trend_t t;
+    pressure_trend_init(&t);
+    int closed = 0, valid = 0;
+    double worst = 0.0;
+    for (uint32_t ts = 0; ts < 6 * 3600; ts += STEP_S) {
+        float p = pressure_at(ts);
+        if (!pressure_trend_add(&t, p, p, ts)) {
+            continue;
+        }
+        closed++;
+        if (!t.valid) {
+            CHECK(t.count < PRESSURE_TREND_MIN_BUCKETS);
+            continue;
+        }
+        valid++;
+        worst = fmax(worst, fabs(t.delta_3h_hpa - exact_delta_3h(&t)));
+
+        // Ровный участок — «устойчиво», прогноз из средней группы
+        if (ts < FALL_FROM_S) {
+            CHECK_INT(t.tendency, PRESSURE_STEADY);
+            CHECK(t.zambretti >= 10 && t.zambretti <= 19);
+        }
+    }
+    printf("корзин %d, с оценкой %d, расхождение с пересчётом %.5f гПа\n",
+           closed,
+           valid,
+           worst);
+    CHECK_INT(closed, 6 * 3600 / PRESSURE_TREND_BUCKET_S - 1);
+    CHECK(worst <= 0.005);
+
+    // Последние 3 ч целиком на падении
+    CHECK_NEAR(t.delta_3h_hpa, -FALL_HPA_3H, 0.2);
+    CHECK_INT(t.tendency, PRESSURE_FALLING_FAST);
+    CHECK(t.zambretti >= 1 && t.zambretti <= 9);
+
+    // Пропуск длиннее PRESSURE_TREND_MAX_GAP корзин сбрасывает историю
+    uint32_t after = 6 * 3600 + 3600;
+    pressure_trend_add(&t, 750.0f, 750.0f, after);
+    pressure_trend_add(&t, 750.0f, 750.0f, after + PRESSURE_TREND_BUCKET_S);
+    CHECK_INT(t.count, 1);
+    CHECK(!t.valid);
+    CHECK(!pressure_trend_add(&t, NAN, NAN, after + 2 * STEP_S));
+}
+
+static void test_classify_and_zambretti(void)
+{
+    CHECK_INT(pressure_trend_classify(0.0f), PRESSURE_STEADY);
+    CHECK_INT(pressure_trend_classify(1.59f), PRESSURE_STEADY);
+    CHECK_INT(pressure_trend_classify(1.6f), PRESSURE_RISING);
+    CHECK_INT(pressure_trend_classify(3.5f), PRESSURE_RISING_FAST);
+    CHECK_INT(pressure_trend_classify(-1.6f), PRESSURE_FALLING);
+    CHECK_INT(pressure_trend_classify(-3.5f), PRESSURE_FALLING_FAST);
+
+    // Формулы Замбретти: Z = 185 - 0.16P, 127 - 0.12P, 144 - 0.13P
+    CHECK_INT(pressure_trend_zambretti(1030.0f, PRESSURE_RISING), 20);
+    CHECK_INT(pressure_trend_zambretti(990.0f, PRESSURE_RISING), 27);
+    CHECK_INT(pressure_trend_zambretti(990.0f, PRESSURE_FALLING), 8);
+    CHECK_INT(pressure_trend_zambretti(1040.0f, PRESSURE_FALLING), 2);
+    CHECK_INT(pressure_trend_zambretti(1013.0f, PRESSURE_STEADY), 12);
+    // Вне 950..1050 гПа номер остаётся в своей группе
+    CHECK_INT(pressure_trend_zambretti(900.0f, PRESSURE_FALLING), 9);
+    CHECK_INT(pressure_trend_zambretti(1100.0f, PRESSURE_STEADY), 10);
+
+    CHECK_INT(pressure_trend_forecast_kind(1), FORECAST_FAIR);
+    CHECK(pressure_trend_forecast_text(12)[0] != '\0');
+}
+
+int main(void)
+{
+    test_incremental_slope();
+    test_classify_and_zambretti();
+    printf("OK\n");
+    return 0;
+}
@@ -0,0 +1,42 @@
+// Разбор "k1=v1&k2=v2": совпадение ключа целиком, пустое значение,
+// отсутствие ключа и значение, не помещающееся в буфер.
+#include "query.h"
+#include "test_util.h"
+#include <string.h>
+
+static void expect(const char* q, const char* key, const char* value)
+{
+    char val[8];
+    memset(val, 'x', sizeof(val));
+    CHECK_INT(query_value(q, key, val, sizeof(val)), ESP_OK);
+    CHECK(strcmp(val, value) == 0);
+}
+
+int main(void)
+{
+    expect("a=1&b=22&c=333", "a", "1");
+    expect("a=1&b=22&c=333", "b", "22");
+    expect("a=1&b=22&c=333", "c", "333");
+    expect("ab=1&a=2", "a", "2"); // префикс другого ключа — не он
+    expect("a=&b=1", "a", "");
+    expect("a=1&a=2", "a", "1");
+    expect("a=x=y", "a", "x=y");
+    expect("a=1234567", "a", "1234567"); // ровно по буферу
+
+    char val[8];
+    CHECK_INT(query_value("a=1&b=2", "c", val, sizeof(val)),
+              ESP_ERR_NOT_FOUND);
+    CHECK_INT(query_value("a&b=2", "a", val, sizeof(val)),
+              ESP_ERR_NOT_FOUND);
+    CHECK_INT(query_value("", "a", val, sizeof(val)), ESP_ERR_NOT_FOUND);
+    CHECK_INT(query_value(NULL, "a", val, sizeof(val)), ESP_ERR_NOT_FOUND);
+
+    // Не поместилось — ошибка, даже если дальше есть короткое значение
+    CHECK_INT(query_value("a=12345678&a=1", "a", val, sizeof(val)),
+              ESP_ERR_INVALID_ARG);
+    CHECK_INT(query_value("b=1&a=123456789", "a", val, sizeof(val)),
+              ESP_ERR_INVALID_ARG);
+
+    printf("OK\n");
+    return 0;
+}
@@ -0,0 +1,159 @@
+// Правила реле: гистерезис со счётчиками выборок, разбор запроса
+// правила (HTTP и MQTT) и сброс правила, метрика которого устарела.
+// Собирается с RULES_STALE_MS = 50 мс.
+#include "nvs.h"
+#include "relay.h"
+#include "rules.h"
+#include "test_util.h"
+#include <string.h>
+#include <time.h>
+
+static int s_relay;
+static int s_toggles;
+
+void relay_on(void)
+{
+    s_relay = 1;
+    s_toggles++;
+}
+
+void relay_off(void)
+{
+    s_relay = 0;
+    s_toggles++;
+}
+
+// NVS пустой, запись всегда успешна
+esp_err_t nvs_open(const char* ns, nvs_open_mode_t mode, nvs_handle_t* out)
+{
+    *out = 1;
+    return mode == NVS_READONLY ? ESP_ERR_NVS_NOT_FOUND : ESP_OK;
+}
+
+void nvs_close(nvs_handle_t h)
+{
+}
+
+esp_err_t nvs_commit(nvs_handle_t h)
+{
+    return ESP_OK;
+}
+
+esp_err_t nvs_get_blob(nvs_handle_t h, const char* key, void* v, size_t* len)
+{
+    return ESP_ERR_NVS_NOT_FOUND;
+}
+
+esp_err_t
+nvs_set_blob(nvs_handle_t h, const char* key, const void* v, size_t len)
+{
+    return ESP_OK;
+}
+
+static void sleep_ms(long ms)
+{
+    struct timespec ts = {.tv_sec = 0, .tv_nsec = ms * 1000000L};
+    nanosleep(&ts, NULL);
+}
+
+static void feed_all(stats_metric_t metric, const float* v, int n, char* out)
+{
+    for (int i = 0; i < n; i++) {
+        rules_feed(metric, v[i]);
+        out[i] = '0' + s_relay;
+    }
+    out[n] = '\0';
+}
+
+// Правило 0 по умолчанию: PM2.5 > 35 три раза подряд — вкл,
+// < 25 три раза подряд — выкл
+static void test_hysteresis(void)
+{
+    static const float seq[] = {
+            10, 40, 40, 30, 40, 40, 40, 30, 30, 20, 20, 30, 20, 20, 20, 10};
+    char relay[32];
+    feed_all(STATS_PM2_5, seq, 16, relay);
+    CHECK(strcmp(relay, "0000001111111100") == 0);
+    CHECK_INT(s_toggles, 2);
+}
+
+static void test_query(void)
+{
+    rule_t before, after;
+    CHECK_INT(rules_get(1, &before), ESP_OK);
+
+    // Нечисловой или неполный id не превращается в правило 0
+    const char* bad[] = {
+            "id=abc&enabled=0",
+            "id=&enabled=0",
+            "id=0x&enabled=0",
+            "id=-1&on=1",
+            "id=4&on=1",
+            "on=1",
+            "id=1&metric=bogus",
+            "id=1&on=700&off=800",
+            "id=1&n=0",
+            "mode=sometimes",
+            // Длинное значение — ошибка, а не отсутствующий ключ
+            "id=1&on=1000.000000000000001",
+            "id=1&enabled=000000000000000000",
+            "mode=auto0000000000000000",
+    };
+    for (size_t i = 0; i < sizeof(bad) / sizeof(bad[0]); i++) {
+        CHECK_INT(rules_apply_query(bad[i]), ESP_ERR_INVALID_ARG);
+    }
+    CHECK_INT(rules_get(1, &after), ESP_OK);
+    CHECK(memcmp(&before, &after, sizeof(before)) == 0);
+    rule_t r0;
+    CHECK_INT(rules_get(0, &r0), ESP_OK);
+    CHECK_INT(r0.enabled, 1);
+
+    CHECK_INT(
+            rules_apply_query("id=1&metric=CO2&on=1000&off=800&n=2&m=2"
+                              "&enabled=1"),
+            ESP_OK);
+    CHECK_INT(rules_get(1, &after), ESP_OK);
+    CHECK_INT(after.metric, STATS_CO2);
+    CHECK_NEAR(after.on_above, 1000.0, 0.0);
+    CHECK_INT(after.on_count, 2);
+    CHECK_INT(after.enabled, 1);
+
+    CHECK_INT(rules_apply_query("mode=off"), ESP_OK);
+    CHECK_INT(rules_get_mode(), RULES_MODE_OFF);
+    CHECK_INT(rules_apply_query("mode=auto"), ESP_OK);
+}
+
+// Замолчавший датчик не держит реле включённым
+static void test_stale_metric(void)
+{
+    static const float high[] = {1500, 1500};
+    char relay[4];
+    feed_all(STATS_CO2, high, 2, relay);
+    CHECK_INT(s_relay, 1);
+
+    // Другие метрики приходят, CO2 ещё свежий — реле держится
+    sleep_ms(RULES_STALE_MS / 2);
+    rules_feed(STATS_TEMP_DHT, 21.0f);
+    CHECK_INT(s_relay, 1);
+
+    // CO2 молчит дольше RULES_STALE_MS — правило сброшено
+    sleep_ms(RULES_STALE_MS);
+    rules_feed(STATS_TEMP_DHT, 21.0f);
+    CHECK_INT(s_relay, 0);
+
+    // Датчик вернулся: правило снова набирает счётчик
+    rules_feed(STATS_CO2, 1500);
+    CHECK_INT(s_relay, 0);
+    rules_feed(STATS_CO2, 1500);
+    CHECK_INT(s_relay, 1);
+}
+
+int main(void)
+{
+    rules_init();
+    test_hysteresis();
+    test_query();
+    test_stale_metric();
+    printf("OK\n");
+    return 0;
+}
@@ -0,0 +1,184 @@
+// Пакет выборок режима глубокого сна: упаковка в фиксированную точку,
+// затирание при переполнении, удаление выгруженного, выгрузка JSON
+// кусками ограниченного буфера и метки времени до SNTP.
+#include "sample_batch.h"
+#include "test_util.h"
+#include <string.h>
+
+static sample_values_t sample(uint32_t t, uint8_t flags)
+{
+    return (sample_values_t){
+            .time_s = t,
+            .temperature = 21.46f - t * 0.5f,
+            .humidity = 55.55f,
+            .pressure = 745.26f,
+            .co2 = 412.4f,
+            .pm1_0 = 3,
+            .pm2_5 = 7,
+            .pm10 = 11,
+            .flags = flags,
+    };
+}
+
+static void test_pack(void)
+{
+    CHECK_INT(sizeof(sample_record_t), 19);
+
+    sample_values_t v = sample(0, 0);
+    v.temperature = -5.04f;
+    sample_record_t r;
+    sample_pack(&r, &v);
+    CHECK_INT(r.temp_c10, -50);
+    CHECK_INT(r.hum_p10, 556);
+    CHECK_INT(r.press_p10, 7453);
+    CHECK_INT(r.co2_ppm, 412);
+
+    // Выход за диапазон упирается в границы, NaN становится нулём
+    v.temperature = NAN;
+    v.humidity = 130.0f;
+    v.pressure = -1.0f;
+    v.co2 = 1e6f;
+    sample_pack(&r, &v);
+    CHECK_INT(r.temp_c10, 0);
+    CHECK_INT(r.hum_p10, 1000);
+    CHECK_INT(r.press_p10, 0);
+    CHECK_INT(r.co2_ppm, 65535);
+}
+
+static void test_csv(void)
+{
+    sample_batch_t b;
+    sample_batch_reset(&b);
+    sample_values_t v = sample(1700000000, SAMPLE_F_BMP | SAMPLE_F_PMS);
+    v.temperature = -0.5f;
+    sample_batch_push(&b, &v);
+    v = sample(1700000300, SAMPLE_F_DHT | SAMPLE_F_GAS);
+    v.temperature = 23.04f;
+    sample_batch_push(&b, &v);
+
+    char line[96];
+    sample_encode_csv(sample_batch_at(&b, 0), line, sizeof(line));
+    CHECK(strcmp(line, "1700000000,-0.5,,745.3,,3,7,11\n") == 0);
+    sample_encode_csv(sample_batch_at(&b, 1), line, sizeof(line));
+    CHECK(strcmp(line, "1700000300,23.0,55.6,,412,,,\n") == 0);
+}
+
+static void test_wraparound_and_drop(void)
+{
+    static sample_batch_t b;
+    CHECK(!sample_batch_is_valid(&b)); // холодный старт: RTC-память нулевая
+    sample_batch_reset(&b);
+    CHECK(sample_batch_is_valid(&b));
+
+    const int total = SAMPLE_BATCH_CAPACITY + 4;
+    for (int i = 0; i < total; i++) {
+        sample_values_t v = sample(i, i % 2 ? 0x0F : SAMPLE_F_BMP);
+        sample_batch_push(&b, &v);
+    }
+    CHECK_INT(sample_batch_count(&b), SAMPLE_BATCH_CAPACITY);
+    CHECK_INT(b.dropped, 4);
+    for (size_t i = 0; i < SAMPLE_BATCH_CAPACITY; i++) {
+        CHECK_INT(sample_batch_at(&b, i)->time_s, i + 4);
+    }
+    CHECK(sample_batch_at(&b, SAMPLE_BATCH_CAPACITY) == NULL);
+
+    sample_batch_drop(&b, 90);
+    CHECK_INT(sample_batch_count(&b), SAMPLE_BATCH_CAPACITY - 90);
+    CHECK_INT(sample_batch_at(&b, 0)->time_s, 94);
+    sample_batch_drop(&b, 1000);
+    CHECK_INT(sample_batch_count(&b), 0);
+    CHECK(sample_batch_is_valid(&b));
+}
+
+// До SNTP метки — секунды от включения с SAMPLE_F_UPTIME; когда часы
+// известны, выгрузка переводит их в Unix-время
+static void test_unsynced_time(void)
+{
+    static sample_batch_t b;
+    sample_batch_reset(&b);
+    const uint32_t times[] = {100, 400, 1700000000, 900};
+    const uint8_t flags[] = {SAMPLE_F_UPTIME, SAMPLE_F_UPTIME | SAMPLE_F_BMP,
+                             SAMPLE_F_BMP, SAMPLE_F_UPTIME};
+    for (int i = 0; i < 4; i++) {
+        sample_values_t v = sample(times[i], flags[i]);
+        sample_batch_push(&b, &v);
+    }
+
+    char buf[256];
+    size_t n;
+    CHECK(sample_batch_encode_json(&b, 0, buf, sizeof(buf), &n) > 0);
+    CHECK_INT(n, 4);
+    const char* head = "[{\"up\":100},{\"up\":400,\"temp\":";
+    CHECK(strncmp(buf, head, strlen(head)) == 0);
+    CHECK(strstr(buf, "{\"t\":1700000000,") != NULL);
+
+    // Часы узнали на 1000-й секунде от включения
+    sample_batch_fix_time(&b, 1000, 1700000500);
+    CHECK_INT(sample_batch_at(&b, 0)->time_s, 1699999600);
+    CHECK_INT(sample_batch_at(&b, 1)->time_s, 1699999900);
+    CHECK_INT(sample_batch_at(&b, 1)->flags, SAMPLE_F_BMP);
+    CHECK_INT(sample_batch_at(&b, 2)->time_s, 1700000000);
+    CHECK_INT(sample_batch_at(&b, 3)->time_s, 1700000400);
+    for (int i = 0; i < 4; i++) {
+        CHECK(!(sample_batch_at(&b, i)->flags & SAMPLE_F_UPTIME));
+    }
+    CHECK(sample_batch_encode_json(&b, 0, buf, sizeof(buf), &n) > 0);
+    CHECK(strstr(buf, "\"up\"") == NULL);
+    head = "[{\"t\":1699999600},";
+    CHECK(strncmp(buf, head, strlen(head)) == 0);
+}
+
+// Выгрузка кусками: каждый кусок — законченный массив, записи идут
+// подряд без пропусков и повторов
+static void test_json_chunks(void)
+{
+    static sample_batch_t b;
+    sample_batch_reset(&b);
+    for (int i = 0; i < SAMPLE_BATCH_CAPACITY + 4; i++) {
+        sample_values_t v = sample(i, i % 2 ? 0x0F : SAMPLE_F_BMP);
+        sample_batch_push(&b, &v);
+    }
+
+    char buf[256];
+    size_t first = 0, chunks = 0, n;
+    while (first < sample_batch_count(&b)) {
+        size_t len = sample_batch_encode_json(&b, first, buf, sizeof(buf), &n);
+        CHECK(n > 0);
+        CHECK_INT(len, strlen(buf));
+        CHECK(len < sizeof(buf));
+        CHECK(buf[0] == '[' && buf[len - 1] == ']');
+
+        // Первая запись куска — именно first
+        char head[24];
+        snprintf(head, sizeof(head), "[{\"t\":%zu,", first + 4);
+        CHECK(strncmp(buf, head, strlen(head)) == 0);
+        if (first == 0) {
+            const char* expect = "[{\"t\":4,\"temp\":19.5,\"press\":745.3},"
+                                 "{\"t\":5,\"temp\":19.0,\"hum\":55.6,"
+                                 "\"press\":745.3,\"co2\":412,\"pm1_0\":3,"
+                                 "\"pm2_5\":7,\"pm10\":11}";
+            CHECK(strncmp(buf, expect, strlen(expect)) == 0);
+        }
+        first += n;
+        chunks++;
+    }
+    CHECK_INT(first, SAMPLE_BATCH_CAPACITY);
+    CHECK(chunks > 1);
+
+    // Буфер меньше одной записи: ничего не выгружается
+    char tiny[20];
+    CHECK_INT(sample_batch_encode_json(&b, 0, tiny, sizeof(tiny), &n), 0);
+    CHECK_INT(n, 0);
+    CHECK_INT(sample_batch_encode_json(&b, b.count, buf, sizeof(buf), &n), 0);
+}
+
+int main(void)
+{
+    test_pack();
+    test_csv();
+    test_wraparound_and_drop();
+    test_json_chunks();
+    test_unsynced_time();
+    printf("OK\n");
+    return 0;
+}
@@ -0,0 +1,150 @@
+// Прореживание архива на синтетических записях: случайное блуждание
+// с разрывами по времени и невалидными полями. Ожидаемый результат
+// считает downsample_ref.py, здесь — только вход и выход.
+//
+//   test_sample_downsample <режим> <поле> <точек> <записей> <зерно>
+//                          [<от> <до>]
+//
+// <от> и <до> — секунды от времени первой записи, по умолчанию весь
+// архив. В stdout строки "I <запись>" для входа, "C <от> <до>" для
+// окна и "O <запись>" для результата; поля записи — как в
+// sample_record_t, через пробел.
+#include "sample_downsample.h"
+#include "test_util.h"
+#include <string.h>
+
+#define TIME0 1700000000u
+#define STEP_S 60
+
+// Источник из массива; max запоминается, чтобы проверить порции
+typedef struct {
+    const sample_record_t* recs;
+    size_t n;
+    size_t pos;
+    size_t max_seen;
+} mem_src_t;
+
+static size_t mem_read(void* ctx, sample_record_t* out, size_t max)
+{
+    mem_src_t* s = ctx;
+    size_t k = 0;
+    if (max > s->max_seen) {
+        s->max_seen = max;
+    }
+    while (k < max && s->pos < s->n) {
+        out[k++] = s->recs[s->pos++];
+    }
+    return k;
+}
+
+static void put(char tag, const sample_record_t* r)
+{
+    printf("%c %u %d %u %u %u %u %u %u %u\n",
+           tag,
+           r->time_s,
+           r->temp_c10,
+           r->hum_p10,
+           r->press_p10,
+           r->co2_ppm,
+           r->pm1_0,
+           r->pm2_5,
+           r->pm10,
+           r->flags);
+}
+
+static bool emit_print(void* ctx, const sample_record_t* r)
+{
+    put('O', r);
+    ++*(size_t*)ctx;
+    return true;
+}
+
+// Приёмник, который прерывает прореживание после первой точки
+static bool emit_once(void* ctx, const sample_record_t* r)
+{
+    ++*(size_t*)ctx;
+    return false;
+}
+
+// Детерминированный генератор, не зависящий от libc
+static uint32_t next_rand(uint32_t* state)
+{
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 8;
+}
+
+static sample_record_t* synthetic(size_t n, uint32_t seed)
+{
+    sample_record_t* recs = calloc(n + 1, sizeof(*recs));
+    CHECK(recs != NULL);
+    uint32_t t = TIME0;
+    int temp = 200, press = 7500;
+    for (size_t i = 0; i < n; i++) {
+        // Каждая 20-я запись — после выключения на час и более
+        t += next_rand(&seed) % 20 == 0 ? 3600 + next_rand(&seed) % 20000
+                                        : STEP_S;
+        temp += (int)(next_rand(&seed) % 21) - 10;
+        // Давление меняется редко: у LTTB бывают равные площади
+        if (next_rand(&seed) % 30 == 0) {
+            press += next_rand(&seed) % 2 ? 1 : -1;
+        }
+        sample_record_t* r = &recs[i];
+        r->time_s = t;
+        r->temp_c10 = (int16_t)temp;
+        r->hum_p10 = next_rand(&seed) % 1000;
+        r->press_p10 = (uint16_t)press;
+        r->co2_ppm = 400 + next_rand(&seed) % 3000;
+        r->pm1_0 = next_rand(&seed) % 50;
+        r->pm2_5 = next_rand(&seed) % 120;
+        r->pm10 = next_rand(&seed) % 200;
+        r->flags = next_rand(&seed) % 10 == 0 ? next_rand(&seed) % 16 : 15;
+    }
+    return recs;
+}
+
+int main(int argc, char** argv)
+{
+    CHECK(argc == 6 || argc == 8);
+    sample_ds_config_t cfg = {0};
+    CHECK(sample_ds_mode_parse(argv[1], &cfg.mode));
+    CHECK(sample_field_parse(argv[2], &cfg.field));
+    cfg.points = strtoul(argv[3], NULL, 10);
+    size_t n = strtoul(argv[4], NULL, 10);
+    sample_record_t* recs = synthetic(n, strtoul(argv[5], NULL, 10));
+    for (size_t i = 0; i < n; i++) {
+        put('I', &recs[i]);
+    }
+
+    cfg.from_s = TIME0;
+    cfg.to_s = n ? recs[n - 1].time_s : TIME0;
+    if (argc == 8) {
+        cfg.from_s = TIME0 + strtoul(argv[6], NULL, 10);
+        cfg.to_s = TIME0 + strtoul(argv[7], NULL, 10);
+    }
+    printf("C %u %u\n", cfg.from_s, cfg.to_s);
+
+    mem_src_t src = {.recs = recs, .n = n};
+    mem_src_t lead = {.recs = recs, .n = n};
+    size_t out = 0;
+    cfg.read = mem_read;
+    cfg.src = &src;
+    cfg.lead = &lead;
+    cfg.emit = emit_print;
+    cfg.emit_ctx = &out;
+    CHECK(sample_downsample(&cfg));
+    // Источник читается порциями, а не целиком
+    CHECK(src.max_seen <= 16 && lead.max_seen <= 16);
+
+    // Отказ приёмника останавливает прореживание сразу
+    if (out > 0) {
+        size_t once = 0;
+        src = (mem_src_t){.recs = recs, .n = n};
+        lead = (mem_src_t){.recs = recs, .n = n};
+        cfg.emit = emit_once;
+        cfg.emit_ctx = &once;
+        CHECK(!sample_downsample(&cfg));
+        CHECK_INT(once, 1);
+    }
+    free(recs);
+    return 0;
+}
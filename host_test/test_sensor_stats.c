@@ -0,0 +1,204 @@
+// Потоковая статистика: среднее и дисперсия по Уэлфорду и слияние по
+// Чану против двухпроходного расчёта в double, включая n = 0 и n = 1,
+// и скользящее окно, собранное из подкорзин.
+// Исходник включён целиком ради static-аккумулятора.
+#include "../main/src/sensor_stats.c"
+#include "test_util.h"
+
+#define N_MAX 2000
+
+// Детерминированный генератор: результат не зависит от libc
+static uint32_t s_rng = 7;
+
+static float uniform(void)
+{
+    s_rng = s_rng * 1664525u + 1013904223u;
+    return ((s_rng >> 8) + 0.5f) / 16777216.0f;
+}
+
+typedef struct {
+    double mean;
+    double var; // выборочная, 0 при n < 2
+    float min;
+    float max;
+} ref_t;
+
+// Эталон: сначала среднее, затем сумма квадратов отклонений
+static ref_t two_pass(const float* x, int n)
+{
+    ref_t r = {0};
+    if (n == 0) {
+        return r;
+    }
+    double sum = 0.0;
+    r.min = r.max = x[0];
+    for (int i = 0; i < n; i++) {
+        sum += x[i];
+        r.min = fminf(r.min, x[i]);
+        r.max = fmaxf(r.max, x[i]);
+    }
+    r.mean = sum / n;
+    double ss = 0.0;
+    for (int i = 0; i < n; i++) {
+        ss += (x[i] - r.mean) * (x[i] - r.mean);
+    }
+    r.var = n > 1 ? ss / (n - 1) : 0.0;
+    return r;
+}
+
+static double acc_var(const stats_acc_t* a)
+{
+    return a->count > 1 ? a->m2 / (a->count - 1) : 0.0;
+}
+
+// Погрешность float: среднее — от масштаба значений, дисперсия —
+// относительная
+static void check_acc(const stats_acc_t* a, const float* x, int n)
+{
+    ref_t r = two_pass(x, n);
+    CHECK_INT(a->count, n);
+    if (n == 0) {
+        return;
+    }
+    double scale = fmax(fabs(r.mean), sqrt(r.var)) + 1.0;
+    CHECK_NEAR(a->mean, r.mean, scale * 1e-5);
+    CHECK_NEAR(acc_var(a), r.var, r.var * 2e-3 + 1e-6);
+    CHECK(a->min == r.min);
+    CHECK(a->max == r.max);
+}
+
+// Ряды: температура, давление (большое среднее, малый разброс —
+// трудный случай для наивной формулы), PM с выбросами, константа
+static void fill(float* x, int n, int kind)
+{
+    for (int i = 0; i < n; i++) {
+        float u = uniform();
+        switch (kind) {
+        case 0:
+            x[i] = 21.0f + 3.0f * sinf(i / 50.0f) + 0.2f * (u - 0.5f);
+            break;
+        case 1:
+            x[i] = 750.0f + 0.1f * (u - 0.5f);
+            break;
+        case 2:
+            x[i] = u < 0.05f ? 300.0f * u * 20.0f : 10.0f * u;
+            break;
+        default:
+            x[i] = 412.0f;
+            break;
+        }
+    }
+}
+
+static void test_welford(void)
+{
+    static float x[N_MAX];
+    const int sizes[] = {0, 1, 2, 3, 10, 500, N_MAX};
+    for (int kind = 0; kind < 4; kind++) {
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+            int n = sizes[s];
+            fill(x, n, kind);
+            stats_acc_t a = {0};
+            for (int i = 0; i < n; i++) {
+                acc_add(&a, x[i]);
+            }
+            check_acc(&a, x, n);
+            if (n == 1) {
+                CHECK(a.m2 == 0.0f);
+                CHECK(a.mean == x[0]);
+            }
+        }
+    }
+}
+
+// Слияние двух частей при каждом разрезе, включая пустые части
+static void test_chan_merge(void)
+{
+    static float x[300];
+    for (int kind = 0; kind < 4; kind++) {
+        int n = (int)(sizeof(x) / sizeof(x[0]));
+        fill(x, n, kind);
+        for (int cut = 0; cut <= n; cut += cut < 5 ? 1 : 37) {
+            stats_acc_t a = {0}, b = {0};
+            for (int i = 0; i < cut; i++) {
+                acc_add(&a, x[i]);
+            }
+            for (int i = cut; i < n; i++) {
+                acc_add(&b, x[i]);
+            }
+            acc_merge(&a, &b);
+            check_acc(&a, x, n);
+        }
+    }
+
+    // Пустые с обеих сторон и единичные части
+    stats_acc_t a = {0}, b = {0};
+    acc_merge(&a, &b);
+    CHECK_INT(a.count, 0);
+    float one[2] = {5.0f, -3.0f};
+    acc_add(&a, one[0]);
+    acc_add(&b, one[1]);
+    acc_merge(&a, &b);
+    check_acc(&a, one, 2);
+    CHECK_NEAR(acc_var(&a), 32.0, 1e-5);
+
+    // Цепочка слияний, как при сборке скользящего окна из подкорзин
+    static float y[12 * 25];
+    fill(y, 12 * 25, 0);
+    stats_acc_t total = {0};
+    for (int k = 0; k < 12; k++) {
+        stats_acc_t sub = {0};
+        for (int i = 0; i < 25; i++) {
+            acc_add(&sub, y[k * 25 + i]);
+        }
+        acc_merge(&total, &sub);
+    }
+    check_acc(&total, y, 12 * 25);
+}
+
+// Через публичный API: n = 0, n = 1 и скользящая минута из подкорзин
+static void test_api(void)
+{
+    sensor_stats_init();
+    sensor_stats_t st;
+    sensor_stats_get(STATS_CO2, STATS_WIN_1M, true, &st);
+    CHECK_INT(st.count, 0);
+
+    uint32_t t = now_s();
+    sensor_stats_add_at(STATS_PRESSURE, 745.5f, t);
+    sensor_stats_get(STATS_PRESSURE, STATS_WIN_1M, true, &st);
+    CHECK_INT(st.count, 1);
+    CHECK(st.mean == 745.5f && st.min == 745.5f && st.max == 745.5f);
+    CHECK(st.stddev == 0.0f);
+
+    // 41 отсчёт за 40 с: все в пределах шести подкорзин по 10 с, даже
+    // если до запроса часы перейдут границу подкорзины
+    float x[41];
+    fill(x, 41, 0);
+    sensor_stats_init();
+    t = now_s();
+    for (int i = 0; i < 41; i++) {
+        sensor_stats_add_at(STATS_TEMP_DHT, x[i], t - 40 + i);
+    }
+    sensor_stats_get(STATS_TEMP_DHT, STATS_WIN_1M, true, &st);
+    ref_t r = two_pass(x, 41);
+    CHECK_INT(st.count, 41);
+    CHECK_NEAR(st.mean, r.mean, 1e-4);
+    CHECK_NEAR(st.stddev, sqrt(r.var), sqrt(r.var) * 1e-3);
+    CHECK(st.min == r.min && st.max == r.max);
+
+    // Нечисловые значения не попадают в статистику
+    sensor_stats_add_at(STATS_TEMP_DHT, NAN, t);
+    sensor_stats_add_at(STATS_TEMP_DHT, INFINITY, t);
+    sensor_stats_get(STATS_TEMP_DHT, STATS_WIN_1M, true, &st);
+    CHECK_INT(st.count, 41);
+}
+
+int main(void)
+{
+    test_welford();
+    test_chan_merge();
+    test_api();
+    printf("OK\n");
+    return 0;
+}
@@ -0,0 +1,126 @@
+// Слияние температуры на синтетической записи: синусоида 20 ± 3 °C,
+// BMP280 теплее на 1.5 °C с медленным дрейфом, шум обоих датчиков,
+// выбросы, застрявший DHT22 и пропадание DHT22.
+#include "temp_fusion.h"
+#include "test_util.h"
+#include <stdint.h>
+
+#define STEPS 4000
+#define PERIOD_MS 5000u
+#define WARMUP 200 // отсчётов на сходимость Калмана
+
+#define STUCK_FROM 2000
+#define STUCK_TO 2300
+#define DROP_FROM 3000
+#define DROP_TO 3050
+
+// Детерминированный генератор: результат не зависит от libc
+static uint32_t s_rng = 1;
+
+static float uniform(void)
+{
+    s_rng = s_rng * 1664525u + 1013904223u;
+    return ((s_rng >> 8) + 0.5f) / 16777216.0f;
+}
+
+static float gauss(void)
+{
+    float u = uniform(), v = uniform();
+    return sqrtf(-2.0f * logf(u)) * cosf(6.2831853f * v);
+}
+
+static float truth(int k)
+{
+    return 20.0f + 3.0f * sinf(k / 600.0f);
+}
+
+// BMP280 опрашивается раз в 60 с: с пределом по умолчанию он
+// выпадает из слияния между отсчётами, с заданным — нет
+static void test_max_age(void)
+{
+    temp_fusion_t f;
+    temp_fusion_init(&f);
+    temp_fusion_update(&f, TEMP_SRC_BMP, 21.5f, true, 1000);
+    temp_fusion_update(&f, TEMP_SRC_DHT, 20.0f, true, 40000);
+    CHECK_NEAR(f.confidence, 0.5, 0.0);
+    CHECK_NEAR(f.value, 20.0, 1e-6);
+
+    temp_fusion_init(&f);
+    temp_fusion_set_max_age(&f, TEMP_SRC_BMP, 3 * 60000);
+    temp_fusion_update(&f, TEMP_SRC_BMP, 21.5f, true, 1000);
+    temp_fusion_update(&f, TEMP_SRC_DHT, 20.0f, true, 40000);
+    // Оба датчика: смещение BMP учтено, Калман ещё не сошёлся
+    CHECK_NEAR(f.confidence, 0.8, 1e-6);
+    CHECK_NEAR(f.value, 20.0, 1e-5);
+    temp_fusion_update(&f, TEMP_SRC_DHT, 20.0f, true, 1000 + 3 * 60000 + 1);
+    CHECK_NEAR(f.confidence, 0.5, 0.0);
+}
+
+int main(void)
+{
+    test_max_age();
+
+    temp_fusion_t f;
+    temp_fusion_init(&f);
+
+    double err_max = 0.0, err_sum = 0.0, stuck_err_max = 0.0;
+    int n = 0;
+    for (int k = 0; k < STEPS; k++) {
+        uint32_t t = PERIOD_MS * k + 1000;
+        float temp = truth(k);
+
+        // DHT22: шаг 0.1 °C; BMP280: +1.5 °C и дрейф 2e-5 °C/с
+        float dht = roundf((temp + 0.1f * gauss()) * 10.0f) / 10.0f;
+        float bmp = temp + 1.5f + 0.00002f * (t / 1000.0f) + 0.02f * gauss();
+        bool dht_valid = true;
+        if (k % 97 == 0) {
+            dht += 15.0f;
+        }
+        if (k >= STUCK_FROM && k < STUCK_TO) {
+            dht = 21.3f;
+        }
+        if (k >= DROP_FROM && k < DROP_TO) {
+            dht_valid = false;
+        }
+        if (k % 131 == 0) {
+            bmp -= 10.0f;
+        }
+
+        temp_fusion_update(&f, TEMP_SRC_DHT, dht, dht_valid, t);
+        temp_fusion_update(&f, TEMP_SRC_BMP, bmp, true, t + 20);
+
+        if (k < WARMUP) {
+            continue;
+        }
+        double e = fabs(f.value - temp);
+        err_max = fmax(err_max, e);
+        err_sum += e;
+        n++;
+        // Застрявший DHT уже опознан: слияние держится за BMP280
+        if (k >= STUCK_FROM + 2 * TEMP_FUSION_STUCK_N && k < STUCK_TO) {
+            stuck_err_max = fmax(stuck_err_max, e);
+        }
+    }
+
+    double err_mean = err_sum / n;
+    printf("ошибка: средняя %.3f °C, максимум %.3f °C, при застое %.3f °C\n",
+           err_mean,
+           err_max,
+           stuck_err_max);
+    printf("смещение %.3f °C, выбросов DHT %u, BMP %u\n",
+           f.offset,
+           (unsigned)f.src[TEMP_SRC_DHT].outliers,
+           (unsigned)f.src[TEMP_SRC_BMP].outliers);
+
+    CHECK(err_mean <= 0.08);
+    CHECK(err_max <= 0.6);
+    CHECK(stuck_err_max <= 0.3);
+    // Смещение BMP к концу записи: 1.5 + дрейф за 20000 с
+    CHECK_NEAR(f.offset, 1.5 + 0.00002 * (PERIOD_MS * STEPS / 1000.0), 0.15);
+    CHECK(f.src[TEMP_SRC_DHT].outliers >= STEPS / 97 - 2);
+    CHECK(f.src[TEMP_SRC_BMP].outliers >= STEPS / 131 - 2);
+    CHECK(f.confidence > 0.5f);
+
+    printf("OK\n");
+    return 0;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// -------------------------------------------------------
+//  Проверки для тестов на хосте
+//
+//  Первая неудачная проверка печатает место и значения и завершает
+//  тест с кодом 1, поэтому ctest видит падение сразу.
+// -------------------------------------------------------
+
+#define CHECK(cond)                                                      \
+    do {                                                                 \
+        if (!(cond)) {                                                   \
+            fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, #cond);   \
+            exit(1);                                                     \
+        }                                                                \
+    } while (0)
+
+#define CHECK_INT(actual, expected)                                      \
+    do {                                                                 \
+        long long a_ = (long long)(actual);                              \
+        long long e_ = (long long)(expected);                            \
+        if (a_ != e_) {                                                  \
+            fprintf(stderr,                                              \
+                    "%s:%d: %s = %lld, ожидалось %lld\n",                \
+                    __FILE__,                                            \
+                    __LINE__,                                            \
+                    #actual,                                             \
+                    a_,                                                  \
+                    e_);                                                 \
+            exit(1);                                                     \
+        }                                                                \
+    } while (0)
+
+#define CHECK_NEAR(actual, expected, tol)                                \
+    do {                                                                 \
+        double a_ = (double)(actual);                                    \
+        double e_ = (double)(expected);                                  \
+        if (!(fabs(a_ - e_) <= (double)(tol))) {                         \
+            fprintf(stderr,                                              \
+                    "%s:%d: %s = %.9g, ожидалось %.9g ± %g\n",           \
+                    __FILE__,                                            \
+                    __LINE__,                                            \
+                    #actual,                                             \
+                    a_,                                                  \
+                    e_,                                                  \
+                    (double)(tol));                                      \
+            exit(1);                                                     \
+        }                                                                \
+    } while (0)
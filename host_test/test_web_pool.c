@@ -0,0 +1,147 @@
+// Пул рабочих задач webserver.c на моделируемом httpd, где
+// обработчики, как на задаче httpd, идут строго по одному: /get не
+// ждёт медленные выгрузки /export, а сверх пула и очереди /export
+// получает 503 с Retry-After. Задержки — хоста, не устройства.
+#include "sample_store.h"
+#include "sensor_data.h"
+#include "sim_flash.h"
+#include "sim_httpd.h"
+#include "test_util.h"
+#include "webserver.h"
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+#define SLOW_MS 300 // столько отдаётся ответ медленному клиенту
+#define GETS 200
+
+static double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static void sleep_ms(long ms)
+{
+    struct timespec ts = {.tv_sec = ms / 1000, .tv_nsec = ms % 1000 * 1000000L};
+    nanosleep(&ts, NULL);
+}
+
+static int cmp_double(const void* a, const void* b)
+{
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+// p99 задержки /get, мс
+static double get_p99(void)
+{
+    static double lat[GETS];
+    for (int i = 0; i < GETS; i++) {
+        sim_httpd_req_t r;
+        sim_httpd_req_init(&r, NULL);
+        double t0 = now_ms();
+        CHECK_INT(sim_httpd_get("/get", &r), ESP_OK);
+        lat[i] = now_ms() - t0;
+        CHECK_INT(r.status, 200);
+        sim_httpd_req_free(&r);
+    }
+    qsort(lat, GETS, sizeof(lat[0]), cmp_double);
+    return lat[GETS * 99 / 100];
+}
+
+// Медленная выгрузка в своём потоке, как отдельный клиент
+typedef struct {
+    pthread_t thread;
+    sim_httpd_req_t r;
+} client_t;
+
+static void* export_client(void* arg)
+{
+    client_t* c = arg;
+    sim_httpd_get("/export", &c->r);
+    return NULL;
+}
+
+// Клиент запущен, когда его запрос уже отдан пулу или отвечен
+static void client_start(client_t* c)
+{
+    sim_httpd_req_init(&c->r, "format=csv");
+    c->r.send_delay_ms = SLOW_MS;
+    CHECK(pthread_create(&c->thread, NULL, export_client, c) == 0);
+    while (!sim_httpd_handled(&c->r)) {
+        sleep_ms(1);
+    }
+}
+
+static void client_join(client_t* c)
+{
+    pthread_join(c->thread, NULL);
+    CHECK(c->r.done);
+    sim_httpd_req_free(&c->r);
+}
+
+static void test_get_not_blocked(void)
+{
+    double idle = get_p99();
+
+    client_t clients[WEB_WORKERS];
+    double t0 = now_ms();
+    for (int i = 0; i < WEB_WORKERS; i++) {
+        client_start(&clients[i]);
+    }
+    double loaded = get_p99();
+    double busy = now_ms() - t0;
+    for (int i = 0; i < WEB_WORKERS; i++) {
+        client_join(&clients[i]);
+        CHECK_INT(clients[i].r.status, 200);
+    }
+    double total = now_ms() - t0;
+
+    printf("/get p99: без нагрузки %.3f мс, при %d выгрузках %.3f мс "
+           "(выгрузки %.0f мс)\n",
+           idle,
+           WEB_WORKERS,
+           loaded,
+           total);
+    // Все /get прошли, пока выгрузки ещё отдавались
+    CHECK(busy < SLOW_MS);
+    CHECK(loaded < SLOW_MS / 10);
+}
+
+static void test_queue_full(void)
+{
+    enum { ACCEPTED = WEB_WORKERS + WEB_WORK_QUEUE_LEN };
+    static client_t clients[ACCEPTED];
+    for (int i = 0; i < ACCEPTED; i++) {
+        client_start(&clients[i]);
+    }
+
+    sim_httpd_req_t r;
+    sim_httpd_req_init(&r, "format=csv");
+    CHECK_INT(sim_httpd_get("/export", &r), ESP_OK);
+    CHECK_INT(r.status, 503);
+    CHECK(strcmp(sim_httpd_resp_header(&r, "Retry-After"),
+                 WEB_RETRY_AFTER_S)
+          == 0);
+    sim_httpd_req_free(&r);
+
+    for (int i = 0; i < ACCEPTED; i++) {
+        client_join(&clients[i]);
+        CHECK_INT(clients[i].r.status, 200);
+    }
+}
+
+int main(void)
+{
+    sensor_data_init();
+    sim_flash_reset(SAMPLE_STORE_PARTITION, 4);
+    CHECK_INT(sample_store_init(), ESP_OK);
+    start_webserver();
+
+    test_get_not_blocked();
+    test_queue_full();
+    printf("OK\n");
+    return 0;
+}
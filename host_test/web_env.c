@@ -0,0 +1,80 @@
+// Окружение webserver.c для тестов на хосте: модули, которые
+// сервер только вызывает. Датчики, архив и прореживание берутся
+// настоящие, здесь — правила, настройки, счётчики, питание и
+// профиль задач с ответами-заглушками.
+#include "config.h"
+#include "metrics.h"
+#include "power.h"
+#include "rules.h"
+#include "task_profile.h"
+#include <stdio.h>
+
+void rules_feed(stats_metric_t metric, float value)
+{
+}
+
+void rules_set_mode(rules_mode_t mode)
+{
+}
+
+esp_err_t rules_apply_query(const char* query)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+int rules_format(char* buf, size_t len)
+{
+    return snprintf(buf, len, "{}");
+}
+
+esp_err_t config_apply_query(const char* query)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+int config_format(char* buf, size_t len)
+{
+    return snprintf(buf, len, "{}");
+}
+
+void metrics_inc(metric_id_t id)
+{
+}
+
+void metrics_timer_record(metrics_timer_t* t, uint32_t us, bool ok)
+{
+}
+
+void metrics_write(metrics_emit_fn emit, void* ctx)
+{
+}
+
+void metrics_write_timers(
+        metrics_emit_fn emit,
+        void* ctx,
+        const char* family,
+        const char* help,
+        const char* label,
+        metrics_timer_get_fn get,
+        int count)
+{
+}
+
+void power_lock_acquire(power_lock_t lock)
+{
+}
+
+void power_lock_release(power_lock_t lock)
+{
+}
+
+esp_err_t task_profile_sample(task_profile_t* out)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+int task_profile_format_task(
+        const task_profile_entry_t* t, char* buf, size_t len)
+{
+    return -1;
+}
@@ -1,3 +1,237 @@
+// Шаг графика по X: целые пиксели, чтобы прокрутка не размывала линии
+const CHART_STEP_PX = 2;
+// Сколько архива станции подгружать при открытии страницы
+const HISTORY_SPAN_S = 24 * 3600;
+// sample_record_t из sample_batch.h: 19 байт, little-endian
+const RECORD_SIZE = 19;
+const F_DHT = 1, F_BMP = 2, F_GAS = 4, F_PMS = 8;
+
+// Кольцевой буфер ряда с текущими минимумом и максимумом.
+// NaN — нет данных: разрыв линии, в диапазон не входит.
+class SeriesRing {
+  constructor(capacity) {
+    this.values = new Float32Array(capacity);
+    this.capacity = capacity;
+    this.clear();
+  }
+
+  clear() {
+    this.start = 0;
+    this.length = 0;
+    this.min = Infinity;
+    this.max = -Infinity;
+  }
+
+  at(i) {
+    return this.values[(this.start + i) % this.capacity];
+  }
+
+  // true — минимум или максимум изменился
+  push(v) {
+    v = Math.fround(v);
+    let evicted = NaN;
+    if (this.length < this.capacity) {
+      this.values[(this.start + this.length++) % this.capacity] = v;
+    } else {
+      evicted = this.values[this.start];
+      this.values[this.start] = v;
+      this.start = (this.start + 1) % this.capacity;
+    }
+    // Ушёл крайний элемент — пересчёт; бывает редко
+    if (evicted === this.min || evicted === this.max) return this.rescan();
+    if (v < this.min || v > this.max) {
+      this.min = Math.min(this.min, v);
+      this.max = Math.max(this.max, v);
+      return true;
+    }
+    return false;
+  }
+
+  rescan() {
+    let min = Infinity, max = -Infinity;
+    for (let i = 0; i < this.length; i++) {
+      const v = this.at(i);
+      if (v < min) min = v;
+      if (v > max) max = v;
+    }
+    const changed = min !== this.min || max !== this.max;
+    this.min = min;
+    this.max = max;
+    return changed;
+  }
+}
+
+// Линейный график с окном на ширину холста. Новая точка дорисовывает
+// один отрезок; когда окно заполнено, картинка сдвигается на шаг.
+// Шкала ряда берётся с запасом и перестраивается (с полной
+// перерисовкой), только когда данные вышли за неё или заняли меньше
+// половины. Сетка — фон холста в CSS, легенда — в заголовке блока.
+// Слева могут идти точки архива (шаг — сутки на ширину холста), за
+// ними живые (шаг — период опроса): шкала X у них разная, поэтому
+// граница отмечена вертикалью и линия через неё не проводится.
+class LineChart {
+  constructor(canvas, series) {
+    this.canvas = canvas;
+    this.ctx = canvas.getContext('2d');
+    this.width = canvas.width;
+    this.height = canvas.height;
+    this.series = series;
+    this.capacity = Math.floor(this.width / CHART_STEP_PX) + 1;
+    this.rings = series.map(() => new SeriesRing(this.capacity));
+    this.scales = series.map(() => ({ lo: 0, hi: 1 }));
+    this.history = 0; // сколько первых точек из архива
+    this.addLegend();
+    this.redraw();
+  }
+
+  addLegend() {
+    const head = this.canvas.closest('.chart-block')?.querySelector('.chart-head');
+    if (!head) return;
+    const legend = document.createElement('div');
+    legend.className = 'chart-legend';
+    this.series.forEach(s => {
+      const item = document.createElement('span');
+      item.textContent = s.label;
+      item.style.color = s.color;
+      legend.appendChild(item);
+    });
+    head.appendChild(legend);
+  }
+
+  get length() {
+    return this.rings[0].length;
+  }
+
+  x(i) {
+    return i * CHART_STEP_PX;
+  }
+
+  y(k, v) {
+    const s = this.scales[k];
+    return this.height - (v - s.lo) / (s.hi - s.lo) * this.height;
+  }
+
+  // true — шкалу пришлось перестроить
+  fit(k) {
+    const ring = this.rings[k], s = this.scales[k];
+    if (ring.min > ring.max) return false;
+    const range = ring.max - ring.min;
+    const pad = range * 0.1 || Math.abs(ring.max) * 0.05 || 1;
+    const inside = ring.min >= s.lo && ring.max <= s.hi;
+    if (inside && s.hi - s.lo <= 2 * (range + 2 * pad)) return false;
+    s.lo = ring.min - pad;
+    s.hi = ring.max + pad;
+    return true;
+  }
+
+  // Все точки в буфере — из архива, дальше пойдут живые
+  markHistory() {
+    this.history = this.length;
+  }
+
+  // values — объект по ключам рядов; draw = false — только в буфер
+  push(values, draw = true) {
+    const full = this.length === this.capacity;
+    if (full && this.history > 0) this.history--;
+    let rescale = false;
+    this.series.forEach((s, k) => {
+      const v = values[s.key];
+      this.rings[k].push(v == null ? NaN : v);
+      if (this.fit(k)) rescale = true;
+    });
+    if (!draw) return;
+    if (rescale || this.length < 3) {
+      this.redraw();
+      return;
+    }
+    const c = this.ctx;
+    if (full) {
+      c.globalCompositeOperation = 'copy';
+      c.drawImage(this.canvas, -CHART_STEP_PX, 0);
+      c.globalCompositeOperation = 'source-over';
+    }
+    this.drawSegment(this.length - 2);
+  }
+
+  drawSegment(i) {
+    if (i + 1 === this.history) return;
+    const c = this.ctx;
+    c.lineWidth = 2;
+    c.lineCap = 'round';
+    this.rings.forEach((ring, k) => {
+      const a = ring.at(i), b = ring.at(i + 1);
+      if (Number.isNaN(a) || Number.isNaN(b)) return;
+      c.strokeStyle = this.series[k].color;
+      c.beginPath();
+      c.moveTo(this.x(i), this.y(k, a));
+      c.lineTo(this.x(i + 1), this.y(k, b));
+      c.stroke();
+    });
+  }
+
+  redraw() {
+    const c = this.ctx;
+    c.clearRect(0, 0, this.width, this.height);
+    if (this.length < 2) {
+      c.font = '14px sans-serif';
+      c.fillStyle = '#9aa5b1';
+      c.textAlign = 'center';
+      c.fillText('Накопление данных…', this.width / 2, this.height / 2);
+      c.textAlign = 'left';
+      return;
+    }
+    c.lineWidth = 2;
+    c.lineJoin = 'round';
+    this.rings.forEach((ring, k) => {
+      c.strokeStyle = this.series[k].color;
+      c.beginPath();
+      let gap = true;
+      for (let i = 0; i < ring.length; i++) {
+        const v = ring.at(i);
+        if (i === this.history) gap = true;
+        if (Number.isNaN(v)) {
+          gap = true;
+          continue;
+        }
+        if (gap) c.moveTo(this.x(i), this.y(k, v));
+        else c.lineTo(this.x(i), this.y(k, v));
+        gap = false;
+      }
+      c.stroke();
+    });
+    this.drawHistoryMark();
+  }
+
+  // Вертикаль между архивом и живыми точками; при сдвиге картинки
+  // уезжает вместе с ней
+  drawHistoryMark() {
+    if (this.history === 0) return;
+    const c = this.ctx;
+    const x = this.x(this.history) - CHART_STEP_PX / 2;
+    c.save();
+    c.strokeStyle = '#9aa5b1';
+    c.lineWidth = 1;
+    c.setLineDash([4, 4]);
+    c.beginPath();
+    c.moveTo(x, 0);
+    c.lineTo(x, this.height);
+    c.stroke();
+    c.font = '11px sans-serif';
+    c.fillStyle = '#9aa5b1';
+    c.textAlign = 'right';
+    c.fillText(`архив ${HISTORY_SPAN_S / 3600} ч`, x - 4, 12);
+    c.textAlign = 'left';
+    c.fillText('сейчас', x + 4, 12);
+    c.restore();
+  }
+
+  clear() {
+    this.rings.forEach(r => r.clear());
+    this.history = 0;
+    this.redraw();
+  }
+}
+
 class SensorMonitor {
   constructor() {
     this.updateInterval = null;
@@ -13,13 +247,6 @@ class SensorMonitor {
     this.gasChart = null;
     this.dustChart = null;
 
-    this.history = {
-      timestamps: [], temperature: [], humidity: [],
-      pressure: [], co2: [], co: [], lpg: [], nh3: [],
-      pm1_0: [], pm2_5: [], pm10: []
-    };
-    this.maxHistoryPoints = 20;
-
     this.initialize();
   }
 
@@ -27,8 +254,8 @@ class SensorMonitor {
     const start = () => {
       this.setupCharts();
       this.setupEventListeners();
-      this.startPolling();
       this.startUptimeCounter();
+      this.loadHistory().finally(() => this.startPolling());
     };
     if (document.readyState === 'loading') {
       document.addEventListener('DOMContentLoaded', start);
@@ -60,71 +287,58 @@ class SensorMonitor {
   }
 
   makeLineChart(canvas, series) {
-    const ctx = canvas.getContext('2d');
-    return {
-      ctx, width: canvas.width, height: canvas.height, series,
-      draw(history) {
-        const c = this.ctx;
-        c.clearRect(0, 0, this.width, this.height);
-        if (!history || history.timestamps.length < 2) {
-          c.font = '14px sans-serif';
-          c.fillStyle = '#9aa5b1';
-          c.textAlign = 'center';
-          c.fillText('Накопление данных…', this.width / 2, this.height / 2);
-          c.textAlign = 'left';
-          return;
-        }
-        c.strokeStyle = '#eef0f3';
-        c.lineWidth = 1;
-        for (let i = 0; i <= 5; i++) {
-          const x = i * this.width / 5, y = i * this.height / 5;
-          c.beginPath(); c.moveTo(x, 0); c.lineTo(x, this.height); c.stroke();
-          c.beginPath(); c.moveTo(0, y); c.lineTo(this.width, y); c.stroke();
-        }
-        this.series.forEach((s, i) => {
-          const values = history[s.key];
-          if (!values || values.length < 2) return;
-          const max = Math.max(...values), min = Math.min(...values), range = max - min || 1;
-          c.strokeStyle = s.color;
-          c.lineWidth = 2;
-          c.beginPath();
-          values.forEach((v, idx) => {
-            const x = idx * this.width / (values.length - 1);
-            const y = this.height - ((v - min) / range * this.height * 0.8) - this.height * 0.1;
-            idx === 0 ? c.moveTo(x, y) : c.lineTo(x, y);
-          });
-          c.stroke();
-          c.fillStyle = s.color;
-          c.font = '12px sans-serif';
-          c.fillText(s.label, 10, 18 + i * 16);
-        });
-      }
-    };
+    return new LineChart(canvas, series);
   }
 
-  addToHistory(data, timestamp) {
-    const h = this.history;
-    h.timestamps.push(timestamp);
-    h.temperature.push(data.temperature || 0);
-    h.humidity.push(data.humidity || 0);
-    h.pressure.push(data.pressure || 0);
-    h.co2.push(data.CO2 || 0);
-    h.co.push(data.CO || 0);
-    h.lpg.push(data.LPG || 0);
-    h.nh3.push(data.NH3 || 0);
-    h.pm1_0.push(data.pm1_0 ?? 0);
-    h.pm2_5.push(data.pm2_5 ?? 0);
-    h.pm10.push(data.pm10 ?? 0);
-    if (h.timestamps.length > this.maxHistoryPoints) {
-      Object.values(h).forEach(arr => arr.shift());
-    }
-    this.updateCharts();
+  get charts() {
+    return [this.tempHumChart, this.gasChart, this.dustChart].filter(c => c);
+  }
+
+  addToHistory(data) {
+    const num = v => (v == null || v === -999 ? NaN : Number(v));
+    const values = {
+      temperature: num(data.temperature), humidity: num(data.humidity),
+      pressure: num(data.pressure), co2: num(data.CO2), co: num(data.CO),
+      lpg: num(data.LPG), nh3: num(data.NH3),
+      pm1_0: num(data.pm1_0), pm2_5: num(data.pm2_5), pm10: num(data.pm10)
+    };
+    this.charts.forEach(c => c.push(values));
   }
 
-  updateCharts() {
-    if (this.tempHumChart) this.tempHumChart.draw(this.history);
-    if (this.gasChart) this.gasChart.draw(this.history);
-    if (this.dustChart) this.dustChart.draw(this.history);
+  // Архив станции за HISTORY_SPAN_S, прореженный до ширины графика.
+  // CO, LPG и NH3 в архив не пишутся — у них только живые точки.
+  async loadHistory() {
+    const charts = this.charts;
+    if (!charts.length) return;
+    const from = Math.floor(Date.now() / 1000) - HISTORY_SPAN_S;
+    const points = Math.max(...charts.map(c => c.capacity));
+    try {
+      const response = await fetch(`/history?format=bin&points=${points}&from=${from}`);
+      if (!response.ok) throw new Error(`HTTP ${response.status}`);
+      const view = new DataView(await response.arrayBuffer());
+      const count = Math.floor(view.byteLength / RECORD_SIZE);
+      for (let i = 0; i < count; i++) {
+        const o = i * RECORD_SIZE;
+        const flags = view.getUint8(o + 18);
+        const p10 = (ok, v) => (ok ? v / 10 : NaN);
+        const pms = flags & F_PMS;
+        const values = {
+          temperature: p10(flags & (F_DHT | F_BMP), view.getInt16(o + 4, true)),
+          humidity: p10(flags & F_DHT, view.getUint16(o + 6, true)),
+          pressure: p10(flags & F_BMP, view.getUint16(o + 8, true)),
+          co2: flags & F_GAS ? view.getUint16(o + 10, true) : NaN,
+          pm1_0: pms ? view.getUint16(o + 12, true) : NaN,
+          pm2_5: pms ? view.getUint16(o + 14, true) : NaN,
+          pm10: pms ? view.getUint16(o + 16, true) : NaN
+        };
+        charts.forEach(c => c.push(values, false));
+      }
+      if (count) charts.forEach(c => c.markHistory());
+      charts.forEach(c => c.redraw());
+      if (count) this.addLogEntry(`История: ${count} точек за ${HISTORY_SPAN_S / 3600} ч`);
+    } catch (error) {
+      this.addLogEntry('История недоступна');
+    }
   }
 
   startPolling() {
@@ -175,7 +389,7 @@ class SensorMonitor {
       const data = await response.json();
       this.updateDisplay(data);
       this.updateCount++;
-      this.addToHistory(data, new Date().toLocaleTimeString());
+      this.addToHistory(data);
       this.setConnectionStatus(true, 'Подключено');
       this.setText('totalUpdates', this.updateCount);
     } catch (error) {
@@ -193,6 +407,7 @@ class SensorMonitor {
     this.updateValue('nh3', data.NH3);
     this.updateAirLevel(data);
     this.updateDust(data);
+    this.updateDerived(data);
     this.setText('lastUpdate', new Date().toLocaleTimeString());
     this.updateSensorStatus(data);
   }
@@ -265,56 +480,67 @@ class SensorMonitor {
       qual.style.color = color;
     }
 
-    const aqi = this.calcAQI(data.pm2_5);
+    // AQI считает станция (US EPA, максимум по PM2.5 и PM10)
     const aqiEl = document.getElementById('aqiValue');
     const aqiLbl = document.getElementById('aqiLabel');
-    if (aqiEl && has) {
-      aqiEl.textContent = aqi;
-      const [lbl, col] =
-        aqi <= 50 ? ['хорошо', '#16a34a'] :
-        aqi <= 100 ? ['умеренно', '#d97706'] :
-        aqi <= 150 ? ['чувствительным', '#e67e22'] :
-        aqi <= 200 ? ['нездоровый', '#dc2626'] :
-                     ['опасный', '#7c3aed'];
+    if (aqiEl && data.aqi != null) {
+      aqiEl.textContent = data.aqi;
+      const [lbl, col] = [
+        ['хорошо', '#16a34a'],
+        ['умеренно', '#d97706'],
+        ['чувствительным', '#e67e22'],
+        ['нездоровый', '#dc2626'],
+        ['очень нездоровый', '#9333ea'],
+        ['опасный', '#7c3aed'],
+      ][data.aqi_category] || ['--', '#6b7280'];
       aqiEl.style.color = col;
       if (aqiLbl) { aqiLbl.textContent = lbl; aqiLbl.style.color = col; }
     }
   }
 
+  updateDerived(data) {
+    const fmt = (v, unit) => (v != null ? `${Number(v).toFixed(1)} ${unit}` : '--');
+    this.setText('heatIndex', `ощущается ${fmt(data.heat_index, '°C')}`);
+    this.setText('dewPoint',
+      `точка росы ${fmt(data.dew_point, '°C')} · ${fmt(data.abs_humidity, 'г/м³')}`);
+    this.setText('pressureSea', `на уровне моря ${fmt(data.pressure_sea, 'мм')}`);
+
+    // Тенденция за 3 ч (гПа) и прогноз Замбретти считает станция
+    if (data.pressure_trend == null) {
+      this.setText('pressureTrend', 'тенденция: накопление данных');
+    } else {
+      const arrow = ['⇊', '↓', '→', '↑', '⇈'][data.tendency + 2] || '';
+      const delta = Number(data.pressure_trend);
+      const sign = delta > 0 ? '+' : '';
+      this.setText('pressureTrend',
+        `${arrow} ${sign}${delta.toFixed(1)} гПа/3ч · ${data.forecast_text}`);
+    }
+  }
+
 
   updateAirLevel(data) {
     const el = document.getElementById('airLevel');
     const box = document.getElementById('airSummary');
     if (!el) return;
-    const co2 = data.CO2;
-    if (co2 === undefined || co2 === null) {
+    // Уровень по CO2 и газам считает станция
+    const level = [
+      ['хорошо', '#16a34a'],
+      ['умеренно', '#d97706'],
+      ['плохо', '#ea580c'],
+      ['очень плохо', '#dc2626'],
+    ][data.air_level];
+    if (!level) {
       el.textContent = '--';
       el.style.color = '#6b7280';
       if (box) box.style.borderLeftColor = '#6b7280';
       return;
     }
-    let label, color;
-    if (co2 <= 800) { label = 'хорошо'; color = '#16a34a'; }
-    else if (co2 <= 1000) { label = 'умеренно'; color = '#d97706'; }
-    else if (co2 <= 1500) { label = 'плохо'; color = '#ea580c'; }
-    else { label = 'очень плохо'; color = '#dc2626'; }
-    if (((data.CO ?? 0) > 9 || (data.LPG ?? 0) > 500 || (data.NH3 ?? 0) > 25) && color !== '#dc2626') {
-      label = 'плохо'; color = '#ea580c';
-    }
+    const [label, color] = level;
     el.textContent = label;
     el.style.color = color;
     if (box) box.style.borderLeftColor = color;
   }
 
-  calcAQI(pm25) {
-    if (pm25 == null) return '--';
-    const bp = [[0,12,0,50],[12.1,35.4,51,100],[35.5,55.4,101,150],[55.5,150.4,151,200],[150.5,250.4,201,300]];
-    for (const [cLo,cHi,iLo,iHi] of bp)
-      if (pm25 >= cLo && pm25 <= cHi)
-        return Math.round(((iHi-iLo)/(cHi-cLo))*(pm25-cLo)+iLo);
-    return pm25 > 250 ? 301 : 0;
-  }
-
   setBar(id, value, max) {
     const el = document.getElementById(id);
     if (!el || value == null) return;
@@ -345,8 +571,7 @@ class SensorMonitor {
 
     const clear = document.getElementById('clearBtn');
     if (clear) clear.addEventListener('click', () => {
-      Object.keys(this.history).forEach(k => this.history[k] = []);
-      this.updateCharts();
+      this.charts.forEach(c => c.clear());
       this.addLogEntry('Графики очищены');
     });
 
@@ -1,13 +1,183 @@
+"""Встроенные веб-файлы: data/ -> src/web_assets.c.
+
+    cd main && python3 gzip_assets.py
+
+Зависимость — пакет brotli (pip install brotli или
+pip install -r requirements.txt). Без него варианты только gzip и
+identity, а браузер получит ответ крупнее."""
+
 import gzip
 import hashlib
+import re
+import sys
 from pathlib import Path
 
+try:
+    import brotli
+except ImportError:
+    brotli = None
+
+# Встраивать CSS и JS в страницу: один запрос вместо трёх
+INLINE = True
+
+CACHE_PAGE = "no-cache"  # страница перепроверяется по ETag
+CACHE_STATIC = "public, max-age=31536000, immutable"  # ссылки с ?hash=
+
+OUT_C = "src/web_assets.c"
+
+
+def minify_css(text: str) -> str:
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"\s+", " ", text)
+    text = re.sub(r"\s*([{};:,>])\s*", r"\1", text)
+    text = text.replace(";}", "}")
+    return text.strip()
+
+
+# Пробел рядом с этими символами не нужен; между двумя знаками + и -
+# оставляется, чтобы "a - -b" не склеилось в "a--b"
+JS_PUNCT = set("{}()[];,:=<>?&|!*/%+-.")
+
+
+def minify_js(text: str) -> str:
+    """Убирает комментарии и лишние пробелы. Строки и шаблоны
+    остаются как есть. Литералы регулярных выражений не
+    распознаются — в script.js их нет. Переводы строк убираются
+    только там, где автоматическая вставка ';' не сработает."""
+    strings = []
+    code = []
+    i, n = 0, len(text)
+    while i < n:
+        c = text[i]
+        if c in "'\"`":
+            j = i + 1
+            while j < n and text[j] != c:
+                j += 2 if text[j] == "\\" else 1
+            strings.append(text[i : j + 1])
+            code.append(f"\0{len(strings) - 1}\0")
+            i = j + 1
+        elif text.startswith("//", i):
+            i = text.find("\n", i)
+            i = n if i < 0 else i
+        elif text.startswith("/*", i):
+            i = text.index("*/", i) + 2
+            code.append(" ")
+        else:
+            code.append(c)
+            i += 1
+
+    lines = [re.sub(r"[ \t]+", " ", line).strip() for line in "".join(code).split("\n")]
+    text = "\n".join(line for line in lines if line)
+
+    out = []
+    for k, c in enumerate(text):
+        if c == " ":
+            prev, nxt = out[-1] if out else "", text[k + 1] if k + 1 < len(text) else ""
+            if (prev in JS_PUNCT or nxt in JS_PUNCT) and not (
+                prev in "+-" and nxt in "+-"
+            ):
+                continue
+        elif c == "\n":
+            prev, nxt = out[-1] if out else "", text[k + 1] if k + 1 < len(text) else ""
+            if prev in "{;,([" or nxt in ")]}.":
+                continue
+        out.append(c)
+    text = "".join(out)
+
+    return re.sub(r"\0(\d+)\0", lambda m: strings[int(m.group(1))], text)
+
+
+def minify_html(text: str) -> str:
+    lines = (line.strip() for line in text.split("\n"))
+    return "\n".join(line for line in lines if line)
+
+
+def variants(data: bytes):
+    """(Content-Encoding, байты) от лучшего сжатия к худшему.
+    identity — для клиентов без распаковки."""
+    out = []
+    if brotli is not None:
+        out.append(("br", brotli.compress(data, quality=11)))
+    out.append(("gzip", gzip.compress(data, compresslevel=9, mtime=0)))
+    out.append(("identity", data))
+    return out
+
 
-def gzip_file(src: Path, dst: Path):
-    data = src.read_bytes()
-    with gzip.open(dst, "wb", compresslevel=9) as f:
-        f.write(data)
-    print(f"  Сжат: {src.name} -> {dst.name}")
+# Типичные клиенты и кодировки, которые они принимают
+CLIENTS = [
+    ("браузер (br, gzip)", ("br", "gzip", "identity")),
+    ("старый клиент (gzip)", ("gzip", "identity")),
+    ("curl, скрипты", ("identity",)),
+]
+
+
+def report(assets):
+    print("\nФлеш по вариантам:")
+    total = 0
+    for enc in ("br", "gzip", "identity"):
+        size = sum(len(d) for a in assets for e, d in a[3] if e == enc)
+        if size:
+            print(f"  {enc:<9} {size:>7} байт")
+            total += size
+    print(f"  {'всего':<9} {total:>7} байт")
+
+    print("\nПередача страницы по типам клиентов:")
+    for name, accepts in CLIENTS:
+        size = 0
+        for a in assets:
+            # Как asset_pick в webserver.c: первый подходящий по порядку
+            size += next(len(d) for e, d in a[3] if e in accepts)
+        print(f"  {name:<22} {size:>7} байт")
+
+
+def c_name(uri: str) -> str:
+    name = uri.strip("/").replace(".", "_") or "page_html"
+    return re.sub(r"\W", "_", name)
+
+
+def c_bytes(data: bytes) -> str:
+    rows = []
+    for i in range(0, len(data), 16):
+        rows.append("        " + ", ".join(f"0x{b:02x}" for b in data[i : i + 16]) + ",")
+    return "\n".join(rows)
+
+
+def write_c(path: Path, assets):
+    out = [
+        "// Сгенерировано gzip_assets.py из data/ — не редактировать",
+        '#include "web_assets.h"',
+        "",
+    ]
+    for uri, mime, cache, encoded in assets:
+        name = c_name(uri)
+        for enc, data in encoded:
+            out.append(f"static const uint8_t s_{name}_{enc}[] = {{")
+            out.append(c_bytes(data))
+            out.append("};")
+            out.append("")
+        out.append(f"static const web_asset_variant_t s_{name}[] = {{")
+        for enc, data in encoded:
+            etag = hashlib.sha1(data).hexdigest()[:16]
+            out.append(
+                f'        {{"{enc}", "\\"{etag}\\"", s_{name}_{enc}, '
+                f"sizeof(s_{name}_{enc})}},"
+            )
+        out.append("};")
+        out.append("")
+
+    out.append("const web_asset_t web_assets[] = {")
+    for uri, mime, cache, encoded in assets:
+        name = c_name(uri)
+        out.append(
+            f'        {{"{uri}", "{mime}", "{cache}", s_{name}, '
+            f"sizeof(s_{name}) / sizeof(s_{name}[0])}},"
+        )
+    out.append("};")
+    out.append("")
+    out.append(
+        "const size_t web_asset_count = sizeof(web_assets) / sizeof(web_assets[0]);"
+    )
+    path.write_text("\n".join(out) + "\n", encoding="utf-8")
 
 
 def main():
@@ -16,76 +186,86 @@ def main():
 
     if not data_dir.exists():
         print(f"Ошибка: Директория не найдена: {data_dir}")
-        print("Текущая структура проекта:")
-        for item in root.iterdir():
-            print(f"  {item.name}/" if item.is_dir() else f"  {item.name}")
-        return
+        sys.exit(1)
 
     tpl_html = data_dir / "page.template.html"
     out_html = data_dir / "page.html"
     css_file = data_dir / "style.css"
     js_file = data_dir / "script.js"
 
-    required_files = [tpl_html, css_file, js_file]
-    missing_files = []
-    
-    for file in required_files:
-        if not file.exists():
-            missing_files.append(file)
-    
+    missing_files = [f for f in (tpl_html, css_file, js_file) if not f.exists()]
     if missing_files:
         print("Ошибка: Отсутствуют файлы:")
         for file in missing_files:
             print(f"  - {file.name}")
-        print("\nСодержимое папки data:")
-        for item in data_dir.iterdir():
-            print(f"  {item.name}")
-        return
-
-    css_hash = hashlib.sha1(css_file.read_bytes()).hexdigest()[:8]
-    js_hash = hashlib.sha1(js_file.read_bytes()).hexdigest()[:8]
-    
-    print("Чтение шаблона...")
-    html = tpl_html.read_text(encoding="utf-8")
-    html = html.replace("__STYLE_HASH__", css_hash)
-    html = html.replace("__SCRIPT_HASH__", js_hash)
-
-    html = html.replace("__CHART_HASH__", "")
-    
+        sys.exit(1)
+
+    if brotli is None:
+        print("Внимание: модуль brotli не найден, только gzip "
+              "(pip install -r requirements.txt)")
+
+    tpl = tpl_html.read_text(encoding="utf-8")
+    css_src = css_file.read_text(encoding="utf-8")
+    js_src = js_file.read_text(encoding="utf-8")
+
+    css = minify_css(css_src)
+    js = minify_js(js_src)
+    print(f"CSS: {len(css_src.encode())} -> {len(css.encode())} байт")
+    print(f"JS:  {len(js_src.encode())} -> {len(js.encode())} байт")
+
+    css_hash = hashlib.sha1(css.encode()).hexdigest()[:8]
+    js_hash = hashlib.sha1(js.encode()).hexdigest()[:8]
+
+    # Сначала сама страница, чтобы не трогать строки встроенного JS
+    page = minify_html(tpl)
+    if INLINE:
+        html = re.sub(
+            r'<link rel="stylesheet" href="/style\.css\?hash=__STYLE_HASH__">',
+            lambda m: f"<style>{css}</style>",
+            page,
+        )
+        html = re.sub(
+            r'<script src="/script\.js\?hash=__SCRIPT_HASH__"></script>',
+            lambda m: f"<script>{js}</script>",
+            html,
+        )
+    else:
+        html = page.replace("__STYLE_HASH__", css_hash)
+        html = html.replace("__SCRIPT_HASH__", js_hash)
     out_html.write_text(html, encoding="utf-8")
     print(f"✓ Сгенерирован: page.html (css={css_hash}, js={js_hash})")
 
-    print("\nСжатие файлов:")
-    
-    files_to_compress = [
-        (out_html, "page.html.gz"),
-        (css_file, "style.css.gz"),
-        (js_file, "script.js.gz")
+    files = [("/", "text/html; charset=utf-8", CACHE_PAGE, html)]
+    if not INLINE:
+        files.append(("/style.css", "text/css; charset=utf-8", CACHE_STATIC, css))
+        files.append(
+            ("/script.js", "application/javascript; charset=utf-8", CACHE_STATIC, js)
+        )
+
+    assets = []
+    for uri, mime, cache, text in files:
+        encoded = variants(text.encode("utf-8"))
+        assets.append((uri, mime, cache, encoded))
+        sizes = ", ".join(f"{enc} {len(data)}" for enc, data in encoded)
+        print(f"  {uri}: {sizes} байт")
+
+    write_c(root / OUT_C, assets)
+    print(f"✓ Сгенерирован: {OUT_C}")
+
+    # Прежняя схема: три файла без минификации, только gzip
+    old = [
+        tpl.replace("__STYLE_HASH__", "").replace("__SCRIPT_HASH__", ""),
+        css_src,
+        js_src,
     ]
+    old_bytes = sum(len(gzip.compress(t.encode(), 9, mtime=0)) for t in old)
+    new_bytes = sum(len(a[3][0][1]) for a in assets)
+    print("\nЗагрузка страницы:")
+    print(f"  было:  {old_bytes} байт, {len(old)} запроса")
+    print(f"  стало: {new_bytes} байт, {len(assets)} запрос(а)")
 
-    for src_file, gz_name in files_to_compress:
-        gzip_file(src_file, data_dir / gz_name)
-  
-    print("\n" + "="*50)
-    print("Для CMakeLists.txt добавьте эти файлы в EMBED_FILES:")
-    
-    gz_files = [f[1] for f in files_to_compress]
-    for gz_file in gz_files:
-        print(f'    "data/{gz_file}"')
-    
-    print("\nДля webserver.c добавьте обработчики:")
-    for src_file, gz_name in files_to_compress:
-        name = src_file.name
-        var_name = name.replace(".", "_")
-        print(f'  // Для {name}:')
-        print(f'  extern const uint8_t _binary_{var_name}_gz_start[];')
-        print(f'  extern const uint8_t _binary_{var_name}_gz_end[];')
-        print(f'  // URI: /{name}')
-        print()
-    
-    print("="*50)
-    print("✓ Все файлы успешно обработаны!")
+    report(assets)
 
 
 if __name__ == "__main__":
-    main()
\ No newline at end of file
+    main()
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "dht22.h"
+#include "mq135.h"
+#include "pms5003.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// -------------------------------------------------------
+//  Режим пакетного сбора с глубоким сном
+//
+//  Каждое пробуждение: одна выборка всех датчиков, запись в пакет
+//  в RTC-памяти, deep sleep до следующего момента сетки. WiFi и MQTT
+//  поднимаются только каждые upload_every выборок, чтобы отправить
+//  накопленное. Прогрев учитывается по времени с подачи питания:
+//  MQ-135 (нагреватель не выключается) — от холодного старта,
+//  PMS5003 — от включения через SET в этом пробуждении.
+// -------------------------------------------------------
+
+#define BATCH_UPLOAD_CHUNK 1024 // байт JSON на одно сообщение MQTT
+#define BATCH_NET_TIMEOUT_MS 15000
+#define BATCH_PUBACK_TIMEOUT_MS 10000
+
+typedef struct {
+    uint32_t sample_interval_s;
+    uint16_t upload_every; // выгрузка каждые N выборок
+    uint16_t pms_every;    // PMS5003 каждые N выборок, 0 — не опрашивать
+    mq_params_data_t* mq;
+    dht_params_data_t* dht;
+    pms_params_data_t* pms;
+    // Подключение к сети с ожиданием IP; false — не удалось
+    bool (*network_up)(uint32_t timeout_ms);
+    void (*network_down)(void);
+} batch_mode_config_t;
+
+// Не возвращается: заканчивается уходом в deep sleep
+void batch_mode_run(const batch_mode_config_t* cfg);
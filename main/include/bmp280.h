@@ -1,6 +1,6 @@
 #pragma once
 
-#include "driver/i2c.h"
+#include "i2c_bus.h"
 #include "esp_err.h"
 #include "esp_log.h"
 
@@ -8,7 +8,20 @@
 #define BMP280_I2C_ADDR_PRIMARY 0x45
 #define BMP280_I2C_ADDR_SECONDARY 0x76
 #define BMP280_I2C_ADDR_THIRD 0x77
-#define BMP280_I2C_TIMEOUT_MS 1000
+#define BMP280_I2C_SPEED_HZ 400000 // Fast-mode
+
+// 1 — компенсация давления в 32-битной арифметике (точность 1 Па),
+// 0 — эталонная 64-битная из даташита (точность 1/256 Па)
+#ifndef BMP280_PRESSURE_COMP_32BIT
+#define BMP280_PRESSURE_COMP_32BIT 1
+#endif
+
+#define BMP280_STATUS_MEASURING (1 << 3)
+#define BMP280_STATUS_IM_UPDATE (1 << 0)
+#define BMP280_FORCED_POLL_MAX 10 // опросов STATUS после расчётного времени
+
+// Время преобразования для профиля драйвера (T x1, P x4): 13.3 мс
+#define BMP280_DRIVER_READ_DELAY_MS 14
 
 // ID чипов
 #define BMP280_CHIP_ID 0x58
@@ -44,11 +57,6 @@
 // Значения
 #define BMP280_RESET_VALUE 0xB6
 
-typedef struct {
-    uint8_t port;
-    uint8_t task_delay_s;
-} bmp_params_data_t;
-
 // Режимы работы
 typedef enum {
     BMP280_SLEEP_MODE = 0,
@@ -101,20 +109,31 @@ typedef struct {
 
 // Основная структура устройства
 typedef struct {
-    i2c_port_t i2c_port;
+    i2c_bus_device_t* i2c_dev;
     uint8_t i2c_addr;
     bmp280_calib_data_t calib_data;
     bmp280_config_t config;
     int32_t t_fine;
 } bmp280_dev_t;
 
-esp_err_t bmp280_init(bmp280_dev_t* dev, i2c_port_t i2c_port, uint8_t i2c_addr);
+esp_err_t bmp280_init(bmp280_dev_t* dev, uint8_t i2c_addr);
 esp_err_t bmp280_set_config(bmp280_dev_t* dev, const bmp280_config_t* config);
 esp_err_t
 bmp280_read_data(bmp280_dev_t* dev, float* temperature, float* pressure);
 esp_err_t bmp280_soft_reset(bmp280_dev_t* dev);
 esp_err_t bmp280_get_chip_id(bmp280_dev_t* dev, uint8_t* chip_id);
 esp_err_t bmp280_sleep(bmp280_dev_t* dev);
+uint32_t bmp280_measurement_time_us(const bmp280_config_t* config);
+esp_err_t bmp280_start_forced(bmp280_dev_t* dev);
+esp_err_t
+bmp280_read_forced(bmp280_dev_t* dev, float* temperature, float* pressure);
+esp_err_t
+bmp280_measure_forced(bmp280_dev_t* dev, float* temperature, float* pressure);
 esp_err_t bmp280_is_measuring(bmp280_dev_t* dev, bool* measuring);
 esp_err_t bmp280_is_updating(bmp280_dev_t* dev, bool* copying);
-void bmp280_task(void* bmp_params);
+
+// Драйвер для sensor_sched: start запускает forced-измерение,
+// read забирает результат через BMP280_DRIVER_READ_DELAY_MS
+esp_err_t bmp280_driver_init(void* ctx);
+esp_err_t bmp280_driver_start(void* ctx);
+esp_err_t bmp280_driver_read(void* ctx);
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "esp_err.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// -------------------------------------------------------
+//  Настройки периодов опроса, публикации и дисплея
+//
+//  Реестр параметров с умолчанием и допустимым диапазоном. Значения
+//  хранятся в NVS по ключу с именем параметра и переживают
+//  перезагрузку; значение вне диапазона при загрузке заменяется
+//  умолчанием. Менять можно через /config и MQTT home/config/set
+//  строкой вида "mqtt_period_ms=60000&dht_period_ms=2000": сначала
+//  проверяются все ключи, потом применяются.
+//
+//  Потребитель подписывается на параметр и получает новое значение
+//  сразу после записи, без перезагрузки. Слушатель у параметра один
+//  и вызывается в задаче, которая меняла настройку, поэтому он
+//  не должен блокировать: обычно он будит задачу-потребителя.
+// -------------------------------------------------------
+
+#define CONFIG_NVS_NAMESPACE "config"
+
+typedef enum {
+    CONFIG_MQ_PERIOD_MS = 0,
+    CONFIG_DHT_PERIOD_MS,
+    CONFIG_BMP_PERIOD_MS,
+    CONFIG_PMS_PERIOD_MS,
+    CONFIG_HISTORY_PERIOD_MS,
+    CONFIG_MQTT_PERIOD_MS,
+    CONFIG_DISPLAY_PERIOD_MS,
+    CONFIG_COUNT
+} config_id_t;
+
+typedef struct {
+    const char* name; // ключ в query и NVS, до 15 символов
+    uint32_t def;
+    uint32_t min;
+    uint32_t max;
+} config_param_t;
+
+typedef void (*config_listener_t)(config_id_t id, uint32_t value, void* ctx);
+
+// Загрузка из NVS; до неё config_get отдаёт умолчания
+void config_init(void);
+
+const config_param_t* config_param(config_id_t id);
+uint32_t config_get(config_id_t id);
+
+// ESP_ERR_INVALID_ARG — значение вне диапазона
+esp_err_t config_set(config_id_t id, uint32_t value);
+
+void config_set_listener(config_id_t id, config_listener_t fn, void* ctx);
+
+// Слушатель для задач, ждущих в ulTaskNotifyTake: ctx — TaskHandle_t
+void config_notify_task(config_id_t id, uint32_t value, void* ctx);
+
+// Общая для HTTP (query) и MQTT (payload); незнакомые ключи
+// пропускаются, ESP_ERR_NOT_FOUND — нет ни одного знакомого,
+// ESP_ERR_INVALID_ARG — значение не число, вне диапазона или длиннее
+// любого допустимого
+esp_err_t config_apply_query(const char* query);
+
+// {"mq_period_ms":{"value":..,"min":..,"max":..,"default":..},..};
+// как snprintf
+int config_format(char* buf, size_t len);
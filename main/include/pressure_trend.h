@@ -0,0 +1,77 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// -------------------------------------------------------
+//  Барическая тенденция и прогноз Замбретти
+//
+//  Отсчёты давления (каждые 5 с) усредняются в 5-минутные корзины,
+//  последние 36 корзин (3 ч) лежат в кольце. По кольцу ведутся суммы
+//  для линейной регрессии. Сдвиг окна обновляет их за O(1), раз
+//  за оборот кольца суммы пересчитываются заново (сброс накопленной
+//  ошибки float). Значения хранятся относительно опорного давления,
+//  чтобы суммы оставались малыми.
+//
+//  Классы тенденции — по изменению за 3 ч (Met Office): ±1.6 гПа
+//  (граница «устойчиво» для Замбретти) и ±3.5 гПа («быстро»).
+// -------------------------------------------------------
+
+#define PRESSURE_TREND_BUCKET_S 300
+#define PRESSURE_TREND_BUCKETS 36    // 3 ч
+#define PRESSURE_TREND_MIN_BUCKETS 12 // 1 ч данных до первой оценки
+#define PRESSURE_TREND_MAX_GAP 6      // пропуск длиннее — сброс истории
+#define PRESSURE_TREND_STEADY_HPA 1.6f
+#define PRESSURE_TREND_FAST_HPA 3.5f
+
+typedef enum {
+    PRESSURE_FALLING_FAST = -2,
+    PRESSURE_FALLING = -1,
+    PRESSURE_STEADY = 0,
+    PRESSURE_RISING = 1,
+    PRESSURE_RISING_FAST = 2,
+} pressure_tendency_t;
+
+typedef enum {
+    FORECAST_FAIR = 0,
+    FORECAST_CHANGEABLE,
+    FORECAST_RAIN,
+    FORECAST_STORM,
+} forecast_kind_t;
+
+typedef struct {
+    // Текущая корзина
+    float bucket_sum;
+    uint16_t bucket_n;
+    uint32_t bucket_index;
+
+    // Кольцо средних по корзинам, относительно ref
+    float ring[PRESSURE_TREND_BUCKETS];
+    uint8_t head; // позиция самой старой
+    uint8_t count;
+    uint8_t since_rebuild;
+    float ref;
+
+    // Суммы регрессии по позициям k = 0..count-1 (старая — 0)
+    float sum_y;
+    float sum_ky;
+
+    // Результат
+    bool valid;
+    float delta_3h_hpa; // изменение за 3 ч по наклону регрессии
+    pressure_tendency_t tendency;
+    uint8_t zambretti; // 1..32, 0 — нет данных
+} pressure_trend_t;
+
+void pressure_trend_init(pressure_trend_t* t);
+
+// p_mmhg — давление на станции, sea_mmhg — приведённое к уровню моря
+// (для прогноза). true — закрыта корзина и пересчитан результат.
+bool pressure_trend_add(
+        pressure_trend_t* t, float p_mmhg, float sea_mmhg, uint32_t now_s);
+
+pressure_tendency_t pressure_trend_classify(float delta_3h_hpa);
+// Формулы Замбретти для давления на уровне моря 950..1050 гПа
+uint8_t pressure_trend_zambretti(float sea_level_hpa, pressure_tendency_t tend);
+forecast_kind_t pressure_trend_forecast_kind(uint8_t zambretti);
+const char* pressure_trend_forecast_text(uint8_t zambretti);
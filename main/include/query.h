@@ -0,0 +1,15 @@
+#pragma once
+
+#include "esp_err.h"
+#include <stddef.h>
+
+// -------------------------------------------------------
+//  Разбор строк вида "k1=v1&k2=v2"
+//
+//  Общий для query HTTP и payload MQTT. Значения не
+//  раскодируются (%XX остаются как есть).
+// -------------------------------------------------------
+
+// Значение ключа key в out (len байт с нулём). ESP_ERR_NOT_FOUND —
+// ключа нет, ESP_ERR_INVALID_ARG — значение не помещается в out
+esp_err_t query_value(const char* q, const char* key, char* out, size_t len);
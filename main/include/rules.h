@@ -0,0 +1,75 @@
+#pragma once
+
+#include "esp_err.h"
+#include "sensor_stats.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// -------------------------------------------------------
+//  Правила управления реле (вентилятор)
+//
+//  Правило: «включить, если метрика выше on_above on_count выборок
+//  подряд; выключить, если ниже off_below off_count выборок подряд».
+//  Между порогами — гистерезис, состояние не меняется. Реле включено,
+//  пока активно хоть одно правило.
+//
+//  Правила проверяются на каждой записи в sensor_data, а не по
+//  таймеру, поэтому реле реагирует в пределах одного периода опроса.
+//  Проверка — O(RULES_MAX) под спинлоком без ожиданий, NVS и логи —
+//  вне него. Ручной режим (on/off) отключает правила до возврата
+//  в auto. Правила хранятся в NVS, режим после перезагрузки — auto.
+//
+//  Активное правило, метрика которого не поступала дольше
+//  RULES_STALE_MS, сбрасывается: реле не остаётся включённым по
+//  последнему значению замолчавшего датчика. Проверка идёт на записи
+//  любой метрики; пока молчат все датчики, реле не переключается.
+// -------------------------------------------------------
+
+#define RULES_MAX 4
+#define RULES_COUNT_MAX 60
+#ifndef RULES_STALE_MS
+#define RULES_STALE_MS 120000
+#endif
+#define RULES_NVS_NAMESPACE "rules"
+#define RULES_NVS_KEY "rules"
+
+typedef enum {
+    RULES_MODE_AUTO = 0,
+    RULES_MODE_ON,
+    RULES_MODE_OFF,
+} rules_mode_t;
+
+typedef struct {
+    uint8_t metric; // stats_metric_t
+    uint8_t enabled;
+    uint8_t on_count;
+    uint8_t off_count;
+    float on_above;
+    float off_below;
+} rule_t;
+
+void rules_init(void);
+
+// Вызывается писателями датчиков, не блокирует
+void rules_feed(stats_metric_t metric, float value);
+
+esp_err_t rules_get(int index, rule_t* out);
+esp_err_t rules_set(int index, const rule_t* rule);
+
+// Порог включения первого правила по метрике; гистерезис сохраняется
+esp_err_t rules_set_threshold(stats_metric_t metric, float on_above);
+
+void rules_set_mode(rules_mode_t mode);
+rules_mode_t rules_get_mode(void);
+bool rules_relay_is_on(void);
+
+// Строка вида "mode=auto" или "id=0&metric=pm2_5&on=35&off=25&n=3&m=3
+// &enabled=1"; отсутствующие ключи сохраняют текущие значения.
+// Общая для HTTP (query) и MQTT (payload).
+esp_err_t rules_apply_query(const char* query);
+
+const char* rules_mode_name(rules_mode_t mode);
+
+// {"mode":..,"relay":..,"rules":[..]}; как snprintf
+int rules_format(char* buf, size_t len);
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// -------------------------------------------------------
+//  Пакет выборок для режима глубокого сна
+//
+//  Кольцевой буфер компактных записей. Он живёт в RTC slow memory
+//  и переживает deep sleep. При переполнении затирается самая старая
+//  запись. Модуль не зависит от ESP-IDF и собирается на хосте.
+// -------------------------------------------------------
+
+#define SAMPLE_BATCH_CAPACITY 96 // 8 ч при выборке раз в 5 мин
+#define SAMPLE_BATCH_MAGIC 0x53424154u
+
+// Биты валидности в sample_record_t.flags
+#define SAMPLE_F_DHT (1u << 0)
+#define SAMPLE_F_BMP (1u << 1)
+#define SAMPLE_F_GAS (1u << 2)
+#define SAMPLE_F_PMS (1u << 3)
+// Часы не синхронизированы: time_s — секунды от холодного старта
+#define SAMPLE_F_UPTIME (1u << 4)
+
+// 19 байт на выборку; величины в фиксированной точке
+typedef struct __attribute__((packed)) {
+    uint32_t time_s;     // Unix-время или, с SAMPLE_F_UPTIME, от включения
+    int16_t temp_c10;    // °C × 10
+    uint16_t hum_p10;    // % × 10
+    uint16_t press_p10;  // мм рт. ст. × 10
+    uint16_t co2_ppm;
+    uint16_t pm1_0;
+    uint16_t pm2_5;
+    uint16_t pm10;
+    uint8_t flags;
+} sample_record_t;
+
+typedef struct {
+    uint32_t time_s;
+    float temperature;
+    float humidity;
+    float pressure; // мм рт. ст.
+    float co2;
+    uint16_t pm1_0;
+    uint16_t pm2_5;
+    uint16_t pm10;
+    uint8_t flags;
+} sample_values_t;
+
+typedef struct {
+    uint32_t magic;
+    uint16_t head;  // индекс самой старой записи
+    uint16_t count;
+    uint32_t dropped; // затёрто при переполнении
+    sample_record_t records[SAMPLE_BATCH_CAPACITY];
+} sample_batch_t;
+
+void sample_batch_reset(sample_batch_t* b);
+// false — содержимое не инициализировано (холодный старт)
+bool sample_batch_is_valid(const sample_batch_t* b);
+
+void sample_pack(sample_record_t* out, const sample_values_t* in);
+void sample_unpack(sample_values_t* out, const sample_record_t* in);
+
+void sample_batch_push(sample_batch_t* b, const sample_values_t* v);
+size_t sample_batch_count(const sample_batch_t* b);
+// i = 0 — самая старая запись
+const sample_record_t* sample_batch_at(const sample_batch_t* b, size_t i);
+// Удаляет n самых старых записей (после успешной выгрузки)
+void sample_batch_drop(sample_batch_t* b, size_t n);
+// Переводит метки SAMPLE_F_UPTIME в Unix-время, когда часы стали
+// известны: uptime_s и wall_s — один и тот же момент
+void sample_batch_fix_time(
+        sample_batch_t* b, uint32_t uptime_s, uint32_t wall_s);
+
+// Строка CSV на запись с '\n' в конце; поля без валидных данных
+// пустые. Значения печатаются из фиксированной точки без float,
+// поэтому вывод побайтно воспроизводим. Как snprintf.
+#define SAMPLE_CSV_HEADER \
+    "time,temperature,humidity,pressure,co2,pm1_0,pm2_5,pm10\n"
+int sample_encode_csv(const sample_record_t* r, char* buf, size_t len);
+
+// JSON-массив записей начиная с first, сколько поместится в buf.
+// Время записи — "t" (Unix) или "up" (секунды от включения, если
+// часы так и не синхронизировались).
+// Возвращает длину строки (0 — не поместилась ни одна запись),
+// в *encoded — число записей в строке.
+size_t sample_batch_encode_json(
+        const sample_batch_t* b,
+        size_t first,
+        char* buf,
+        size_t buf_len,
+        size_t* encoded);
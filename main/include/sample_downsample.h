@@ -0,0 +1,76 @@
+#pragma once
+
+#include "sample_batch.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// -------------------------------------------------------
+//  Прореживание архива для графиков
+//
+//  Диапазон [from_s, to_s] делится на points равных по времени
+//  корзин: у архива бывают разрывы, когда станция выключена, и
+//  корзины по числу записей растянули бы их. Записи читаются из
+//  источника по возрастанию времени небольшими порциями, память
+//  не зависит от их числа. Пустые корзины пропускаются.
+//
+//  MEAN   — запись со средними в корзине. Поле усредняется по
+//           записям, где оно валидно; флаг — если валидно хоть раз.
+//  MINMAX — записи с минимумом и максимумом поля field, по времени.
+//  LTTB   — Largest-Triangle-Three-Buckets по полю field: из
+//           корзины берётся запись, дающая наибольший треугольник
+//           с выбранной в прошлой корзине и средним следующей
+//           непустой. Первая валидная запись и последняя в
+//           последней корзине сохраняются. Нужен второй источник
+//           lead с того же места: он идёт на корзину впереди.
+//
+//  MINMAX и LTTB возвращают исходные записи целиком, записи с
+//  невалидным field пропускаются. Модуль собирается на хосте.
+// -------------------------------------------------------
+
+typedef enum {
+    SAMPLE_DS_MEAN,
+    SAMPLE_DS_MINMAX,
+    SAMPLE_DS_LTTB,
+} sample_ds_mode_t;
+
+// Поля как в SAMPLE_CSV_HEADER
+typedef enum {
+    SAMPLE_FIELD_TEMPERATURE,
+    SAMPLE_FIELD_HUMIDITY,
+    SAMPLE_FIELD_PRESSURE,
+    SAMPLE_FIELD_CO2,
+    SAMPLE_FIELD_PM1_0,
+    SAMPLE_FIELD_PM2_5,
+    SAMPLE_FIELD_PM10,
+    SAMPLE_FIELD_COUNT
+} sample_field_t;
+
+// До max записей по возрастанию времени; 0 — записи кончились
+typedef size_t (*sample_read_fn)(void* ctx, sample_record_t* out, size_t max);
+// Очередная точка результата; false — прервать
+typedef bool (*sample_emit_fn)(void* ctx, const sample_record_t* r);
+
+typedef struct {
+    sample_ds_mode_t mode;
+    sample_field_t field; // для MINMAX и LTTB
+    uint32_t from_s;
+    uint32_t to_s;
+    uint32_t points;
+    sample_read_fn read;
+    void* src;
+    void* lead; // только LTTB: независимый источник с того же места
+    sample_emit_fn emit;
+    void* emit_ctx;
+} sample_ds_config_t;
+
+// false — прервано приёмником
+bool sample_downsample(const sample_ds_config_t* cfg);
+
+// Значение поля в единицах записи; false — поле не валидно
+bool sample_field_value(
+        const sample_record_t* r, sample_field_t field, int32_t* out);
+
+// Разбор имён для query; false — имя неизвестно
+bool sample_field_parse(const char* name, sample_field_t* out);
+bool sample_ds_mode_parse(const char* name, sample_ds_mode_t* out);
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "esp_err.h"
+#include "sample_batch.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// -------------------------------------------------------
+//  Архив выборок во флеше
+//
+//  Раздел SAMPLE_STORE_PARTITION — кольцо секторов по 4 КиБ.
+//  В начале сектора заголовок с номером, дальше записи
+//  sample_record_t подряд. Сектор с номером seq лежит на месте
+//  seq % число секторов, поэтому после перезагрузки голова
+//  находится по максимальному номеру. Когда кольцо заполнено,
+//  стирается сектор с самыми старыми записями.
+//
+//  В архив попадают только выборки с синхронизированными часами,
+//  время в нём не убывает: диапазон ищется двоичным поиском.
+//  Чтение идёт итератором небольшими порциями под мьютексом,
+//  поэтому выгрузка любого диапазона не требует памяти сверх
+//  буфера вызывающего.
+// -------------------------------------------------------
+
+#define SAMPLE_STORE_PARTITION "history"
+#define SAMPLE_STORE_PERIOD_MS 60000
+#define SAMPLE_STORE_MAGIC 0x54534948u // "HIST"
+
+// Позиция в архиве: номер сектора и запись в нём
+typedef struct {
+    uint32_t seq;
+    uint32_t idx;
+} sample_store_iter_t;
+
+typedef struct {
+    uint32_t count;    // записей в архиве
+    uint32_t capacity; // записей в разделе
+    uint32_t oldest_s; // 0 — архив пуст
+    uint32_t newest_s;
+} sample_store_info_t;
+
+esp_err_t sample_store_init(void);
+bool sample_store_ready(void);
+
+// Запись текущих значений; без часов выборка пропускается
+esp_err_t sample_store_append(const sample_values_t* v);
+
+// Итератор на первую запись со временем не раньше from_s
+void sample_store_seek(sample_store_iter_t* it, uint32_t from_s);
+// До max записей с позиции итератора; 0 — записи кончились.
+// Если кольцо успело затереть позицию, чтение продолжается
+// с самой старой записи.
+size_t sample_store_read(
+        sample_store_iter_t* it, sample_record_t* out, size_t max);
+
+void sample_store_get_info(sample_store_info_t* out);
+
+// Драйвер для sensor_sched: снимок sensor_data в архив
+esp_err_t sample_store_driver_init(void* ctx);
+esp_err_t sample_store_driver_read(void* ctx);
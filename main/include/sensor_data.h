@@ -1,11 +1,40 @@
 #pragma once
 
+#include "derived_metrics.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/semphr.h"
 #include "pms5003.h"
+#include "pressure_trend.h"
+#include "temp_fusion.h"
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
+// Предельный возраст данных по умолчанию: после него группа считается
+// невалидной, пока датчик не пришлёт новую выборку
+#define SENSOR_DHT_MAX_AGE_MS 30000
+#define SENSOR_BMP_MAX_AGE_MS 30000
+#define SENSOR_MQ_MAX_AGE_MS 30000
+#define SENSOR_PMS_MAX_AGE_MS 60000
+// При редком опросе предел — столько периодов датчика
+#define SENSOR_MAX_AGE_PERIODS 3
+
+// Раньше этого момента часы считаются не синхронизированными
+#define SENSOR_WALL_CLOCK_MIN_S 1704067200 // 2024-01-01
+
+typedef enum {
+    SENSOR_DHT = 0,
+    SENSOR_BMP,
+    SENSOR_MQ,
+    SENSOR_PMS,
+    SENSOR_GROUP_COUNT
+} sensor_group_t;
+
+typedef struct {
+    int64_t mono_us; // esp_timer, 0 — выборок не было
+    int64_t wall_s;  // UNIX-время, 0 — часы ещё не синхронизированы
+} sensor_stamp_t;
+
 typedef struct {
     // DHT22
     float temperature_dht;
@@ -32,11 +61,55 @@ typedef struct {
     uint16_t pm10;
     uint8_t pms_valid;
 
+    // Растёт при каждой записи любого датчика (кэш ответа /get)
+    uint32_t generation;
+
+    // Момент последней успешной выборки по группам
+    sensor_stamp_t stamp[SENSOR_GROUP_COUNT];
+    uint32_t max_age_ms[SENSOR_GROUP_COUNT];
+
+    // Слияние температуры, пересчитывается в сеттерах DHT и BMP
+    temp_fusion_t fusion;
+
+    // Производные величины, пересчитываются при изменении входов
+    derived_metrics_t derived;
+
+    // Барическая тенденция, обновляется в сеттере BMP
+    pressure_trend_t trend;
+
     SemaphoreHandle_t mutex;
 } sensor_data_t;
 
 void sensor_data_init(void);
+// Температура после слияния DHT22 и BMP280 (кэш, без пересчёта)
 float sensor_data_get_temp_avg(void);
+void sensor_data_get_temp_fused(float* temperature, float* confidence);
+
+void sensor_data_get_derived(derived_metrics_t* out);
+void sensor_data_get_trend(pressure_trend_t* out);
+
+// Свежесть: геттеры групп сбрасывают valid, если возраст выборки
+// больше max_age. Возраст в мс, -1 — выборок ещё не было.
+void sensor_data_get_stamp(sensor_group_t group, sensor_stamp_t* out);
+int64_t sensor_data_age_ms(sensor_group_t group);
+bool sensor_data_is_fresh(sensor_group_t group);
+void sensor_data_set_max_age(sensor_group_t group, uint32_t max_age_ms);
+// Новый период опроса группы: предел возраста (и для слияния
+// температуры) — SENSOR_MAX_AGE_PERIODS периодов, не меньше умолчаний
+void sensor_data_set_period(sensor_group_t group, uint32_t period_ms);
+const char* sensor_data_group_name(sensor_group_t group);
+
+// Версия данных: растёт при каждой записи датчика. В fresh_mask —
+// биты свежих групп (1 << sensor_group_t): вид ответа меняется и при
+// устаревании данных, когда новых записей нет
+uint32_t sensor_data_get_generation(uint8_t* fresh_mask);
+
+// "age_ms":{"dht":..,..},"ts":{"dht":..,..}; null — нет данных
+// или часов; как snprintf. _ages и _times — каждая часть отдельно:
+// "ts" меняется только вместе с версией, "age_ms" — постоянно
+int sensor_data_format_stamps(char* buf, size_t len);
+int sensor_data_format_ages(char* buf, size_t len);
+int sensor_data_format_times(char* buf, size_t len);
 
 // DHT22
 void sensor_data_set_dht(float temperature_dht, float humidity, uint8_t valid);
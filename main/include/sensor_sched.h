@@ -0,0 +1,54 @@
+#pragma once
+
+#include "esp_err.h"
+#include "metrics.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// -------------------------------------------------------
+//  Планировщик опроса датчиков
+//
+//  Все датчики обслуживает одна задача по очереди событий,
+//  упорядоченной по времени. Моменты выборки выровнены по сетке
+//  периодов от общего начала отсчёта, поэтому датчики с периодами
+//  5 с и 10 с снимаются в одни и те же моменты. Драйвер с start
+//  запускается заранее на read_delay_ms, чтобы чтение пришлось
+//  ровно на момент выборки. Блокирующие чтения уходят в рабочую
+//  задачу, чтобы не задерживать остальных.
+//
+//  Между событиями задача спит в ожидании уведомления, и при tickless
+//  idle система может уйти в light sleep; уведомление приходит только
+//  при смене периода. Раз в SENSOR_SCHED_STATS_LOG_S в лог пишется
+//  опоздание пробуждений относительно плана: в нём и выход из сна, и
+//  ожидание задач с высшим приоритетом, по отдельности не измеряются.
+// -------------------------------------------------------
+
+#define SENSOR_SCHED_MAX_DRIVERS 8
+#define SENSOR_SCHED_TASK_STACK 3072
+#define SENSOR_SCHED_WORKER_STACK 4096
+#define SENSOR_SCHED_TASK_PRIO 5
+#define SENSOR_SCHED_COALESCE_MS 5 // окно объединения пробуждений
+#define SENSOR_SCHED_STATS_LOG_S 300
+
+typedef struct {
+    const char* name;
+    esp_err_t (*init)(void* ctx);  // при ошибке повторяется каждый период
+    esp_err_t (*start)(void* ctx); // запуск измерения, может быть NULL
+    esp_err_t (*read)(void* ctx);  // чтение и запись в sensor_data
+    uint32_t period_ms;
+    uint32_t read_delay_ms; // от start до read
+    uint32_t warmup_ms;     // первая выборка не раньше
+    bool blocking;          // read выполняется в рабочей задаче
+    void* ctx;
+} sensor_driver_t;
+
+esp_err_t sensor_sched_start(sensor_driver_t* drivers, size_t count);
+
+// Новый период датчика с индексом в drivers; применяется задачей
+// планировщика сразу. Не блокирует, можно звать из любой задачи.
+esp_err_t sensor_sched_set_period(size_t index, uint32_t period_ms);
+
+// Таймер чтений датчика для /metrics; false — слот пуст
+bool sensor_sched_get_timer(
+        int index, const char** name, const metrics_timer_t** timer);
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// -------------------------------------------------------
+//  Потоковая статистика по метрикам датчиков
+//
+//  На каждую метрику и окно (1 мин, 15 мин, 1 ч) хранится:
+//   - окно по сетке: текущее и последнее завершённое;
+//   - скользящее окно из кольца подкорзин (6×10 с, 15×1 мин,
+//     12×5 мин), покрывает от (N-1)/N до полной длины окна.
+//  В каждом аккумуляторе: число отсчётов, среднее и M2 по Уэлфорду,
+//  минимум, максимум. Добавление — O(1), память фиксированная
+//  (~8.6 КБ на 11 метрик). Скользящее окно собирается при запросе
+//  слиянием подкорзин (формула Чана).
+// -------------------------------------------------------
+
+typedef enum {
+    STATS_TEMP_DHT = 0,
+    STATS_HUMIDITY,
+    STATS_TEMP_BMP,
+    STATS_PRESSURE,
+    STATS_CO2,
+    STATS_CO,
+    STATS_NH3,
+    STATS_LPG,
+    STATS_PM1_0,
+    STATS_PM2_5,
+    STATS_PM10,
+    STATS_METRIC_COUNT
+} stats_metric_t;
+
+typedef enum {
+    STATS_WIN_1M = 0,
+    STATS_WIN_15M,
+    STATS_WIN_1H,
+    STATS_WIN_COUNT
+} stats_window_t;
+
+typedef struct {
+    uint32_t count;
+    float mean;
+    float stddev; // выборочное, 0 при count < 2
+    float min;
+    float max;
+} sensor_stats_t;
+
+void sensor_stats_init(void);
+void sensor_stats_add(stats_metric_t metric, float value);
+void sensor_stats_add_at(stats_metric_t metric, float value, uint32_t now_s);
+
+// sliding = false — последнее завершённое окно по сетке
+void sensor_stats_get(
+        stats_metric_t metric,
+        stats_window_t window,
+        bool sliding,
+        sensor_stats_t* out);
+
+const char* sensor_stats_metric_name(stats_metric_t metric);
+const char* sensor_stats_window_name(stats_window_t window);
+
+// {"n":..,"mean":..,"sd":..,"min":..,"max":..}; как snprintf
+int sensor_stats_format(const sensor_stats_t* st, char* buf, size_t len);
+
+// "<метрика>":{"1m":{"tumbling":{..},"sliding":{..}},"15m":..,"1h":..}
+int sensor_stats_format_metric(stats_metric_t metric, char* buf, size_t len);
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// -------------------------------------------------------
+//  Профиль задач: загрузка CPU и запас стека
+//
+//  По run-time stats FreeRTOS (счётчик esp_timer) считается доля
+//  процессорного времени каждой задачи за окно с предыдущего снимка
+//  (от суммарной мощности обоих ядер), простой каждого ядра по его
+//  IDLE-задаче и минимальный за всё время запас стека. Снимок берут
+//  /debug/tasks и периодический лог. Нужны
+//  CONFIG_FREERTOS_USE_TRACE_FACILITY,
+//  CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS и
+//  CONFIG_FREERTOS_VTASKLIST_INCLUDE_COREID; без них снимок
+//  возвращает ESP_ERR_NOT_SUPPORTED.
+// -------------------------------------------------------
+
+#define TASK_PROFILE_MAX_TASKS 32
+#define TASK_PROFILE_LOG_S 300
+#define TASK_PROFILE_TASK_STACK 3072
+#define TASK_PROFILE_TASK_PRIO 1
+
+typedef struct {
+    char name[configMAX_TASK_NAME_LEN];
+    uint32_t number; // xTaskNumber, различает одноимённые задачи
+    uint8_t prio;
+    int8_t core;         // -1 — без привязки к ядру
+    float cpu_pct;       // за окно, от обоих ядер
+    uint32_t stack_free; // минимум свободного стека с запуска, байт
+} task_profile_entry_t;
+
+typedef struct {
+    uint32_t window_ms;
+    float idle_pct[portNUM_PROCESSORS];
+    size_t count;
+    task_profile_entry_t tasks[TASK_PROFILE_MAX_TASKS];
+} task_profile_t;
+
+esp_err_t task_profile_sample(task_profile_t* out);
+
+// {"name":..,"number":..,"prio":..,"core":..,"cpu":..,"stack_free":..};
+// как snprintf
+int task_profile_format_task(
+        const task_profile_entry_t* t, char* buf, size_t len);
+
+// Периодическая строка в лог: простой ядер, самые загруженные задачи
+// и задача с наименьшим запасом стека
+esp_err_t task_profile_start_log(void);
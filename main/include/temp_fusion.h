@@ -0,0 +1,74 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// -------------------------------------------------------
+//  Слияние температуры DHT22 и BMP280
+//
+//  1. Фильтр Хампеля на каждый датчик: медиана и MAD по последним
+//     TEMP_FUSION_WIN отсчётам, выброс заменяется медианой.
+//  2. Калман на два состояния (смещение и дрейф BMP280 относительно
+//     DHT22) по разности очищенных значений. Так учитывается
+//     самонагрев BMP280 на плате.
+//  3. Взвешенное по оценке шума среднее DHT и скорректированного BMP.
+//     Застрявший или устаревший датчик исключается.
+//  Уверенность 0..1 зависит от согласия датчиков и сходимости Калмана.
+//
+//  Модуль без блокировок и без ESP-IDF; вызывающий сериализует доступ.
+// -------------------------------------------------------
+
+#define TEMP_FUSION_WIN 7
+#define TEMP_FUSION_HAMPEL_K 3.0f
+#define TEMP_FUSION_MIN_THR_C 0.3f  // порог выброса не уже этого
+#define TEMP_FUSION_MAX_AGE_MS 15000 // по умолчанию: старше — не участвует
+#define TEMP_FUSION_HOLD_N 12     // Калман не обновляется при застое
+#define TEMP_FUSION_STUCK_N 24    // одинаковых отсчётов подряд, пока
+#define TEMP_FUSION_STUCK_DELTA_C 0.5f // второй ушёл дальше этого
+
+typedef enum {
+    TEMP_SRC_DHT = 0,
+    TEMP_SRC_BMP,
+    TEMP_SRC_COUNT
+} temp_src_t;
+
+typedef struct {
+    float window[TEMP_FUSION_WIN]; // сырые отсчёты
+    uint8_t head;
+    uint8_t filled;
+    float clean;    // после фильтра Хампеля
+    float noise;    // оценка дисперсии шума, °C²
+    float last_raw;
+    float ref_other; // оценка второго датчика в начале «застоя»
+    uint16_t unchanged;
+    uint32_t last_ms;
+    uint32_t max_age_ms; // старше — датчик не участвует
+    uint32_t outliers;
+    bool last_outlier;
+    bool valid;
+} temp_src_state_t;
+
+typedef struct {
+    temp_src_state_t src[TEMP_SRC_COUNT];
+    // Калман: смещение BMP-DHT (°C) и его дрейф (°C/с)
+    float offset;
+    float drift;
+    float p[2][2];
+    uint32_t kf_ms;
+    bool kf_started;
+    // Кэш результата
+    float value;
+    float confidence;
+} temp_fusion_t;
+
+void temp_fusion_init(temp_fusion_t* f);
+void temp_fusion_update(
+        temp_fusion_t* f,
+        temp_src_t src,
+        float value,
+        bool valid,
+        uint32_t now_ms);
+// Предел возраста отсчёта датчика; при редком опросе — на несколько
+// периодов, иначе датчик выпадает из слияния между отсчётами
+void temp_fusion_set_max_age(
+        temp_fusion_t* f, temp_src_t src, uint32_t max_age_ms);
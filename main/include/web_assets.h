@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// -------------------------------------------------------
+//  Встроенные веб-файлы
+//
+//  Таблицу web_assets и данные генерирует gzip_assets.py в
+//  src/web_assets.c: по маршруту на файл, у каждого варианты
+//  с разным Content-Encoding от лучшего сжатия к худшему.
+//  ETag свой у каждого варианта — это разные представления.
+// -------------------------------------------------------
+
+typedef struct {
+    const char* encoding; // значение Content-Encoding
+    const char* etag;     // в кавычках, готов для заголовка
+    const uint8_t* data;
+    size_t size;
+} web_asset_variant_t;
+
+typedef struct {
+    const char* uri;
+    const char* mime;
+    const char* cache_control;
+    const web_asset_variant_t* variants;
+    size_t variant_count;
+} web_asset_t;
+
+extern const web_asset_t web_assets[];
+extern const size_t web_asset_count;
@@ -1,2 +1,11 @@
 #pragma once
-void start_webserver(void);
\ No newline at end of file
+
+// Пул рабочих задач для долгих ответов (/export, /history, /metrics,
+// /stats). Когда очередь полна, запрос получает 503 с Retry-After.
+#define WEB_WORKERS 2
+#define WEB_WORK_QUEUE_LEN 4
+#define WEB_WORKER_STACK 6144
+#define WEB_WORKER_PRIO 4 // ниже httpd: /get не ждёт выгрузку
+#define WEB_RETRY_AFTER_S "2"
+
+void start_webserver(void);
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// -------------------------------------------------------
+//  Подключение к домашней сети
+//
+//  После получения IP BSSID и канал точки доступа сохраняются в
+//  NVS. При следующем старте STA идёт прямо на них: драйвер слушает
+//  один канал вместо сканирования всех. Первая попытка после обрыва
+//  тоже идёт по кэшу и сразу; если она не удалась, сразу же
+//  выполняется обычное сканирование по SSID. Аренду DHCP хранит сам
+//  lwIP (CONFIG_LWIP_DHCP_RESTORE_LAST_IP): клиент запрашивает
+//  прошлый адрес без DISCOVER.
+//
+//  Дальнейшие повторы — с экспоненциальной задержкой от
+//  WIFI_RETRY_MIN_MS до WIFI_RETRY_MAX_MS и случайным разбросом в
+//  половину задержки: пропавшая точка доступа не крутит connect
+//  впустую, а станции после общего сбоя питания не приходят к
+//  роутеру одновременно.
+//
+//  Готовность сети — бит WIFI_CONNECTED_BIT в группе событий: MQTT
+//  и туннель ждут его, а не опрашивают. При первом IP в лог пишется
+//  разбивка времени от старта приложения: запуск WiFi, ассоциация,
+//  DHCP.
+// -------------------------------------------------------
+
+#define WIFI_CONNECTED_BIT BIT0
+#define WIFI_RETRY_MIN_MS 500
+#define WIFI_RETRY_MAX_MS 60000
+#define WIFI_NVS_NAMESPACE "wifi"
+
+typedef struct {
+    const char* sta_ssid;
+    const char* sta_password;
+    const char* ap_ssid;     // NULL — только STA, без точки доступа
+    const char* ap_password; // "" — открытая точка доступа
+    uint8_t ap_channel;
+    uint8_t ap_max_conn;
+    bool power_save; // modem sleep
+} wifi_manager_config_t;
+
+// Моменты первого подключения от старта приложения, мкс; 0 — ещё нет
+typedef struct {
+    int64_t start_us; // esp_wifi_start
+    int64_t assoc_us; // ассоциация с точкой доступа
+    int64_t ip_us;    // получен IP
+    bool cached;      // подключение по сохранённым BSSID и каналу
+} wifi_manager_timing_t;
+
+void wifi_manager_start(const wifi_manager_config_t* cfg);
+
+// Отключение без повторов (пакетный режим перед сном)
+void wifi_manager_stop(void);
+
+// Ждёт WIFI_CONNECTED_BIT; false — по таймауту или до start
+bool wifi_manager_wait_connected(TickType_t timeout);
+
+void wifi_manager_get_timing(wifi_manager_timing_t* out);
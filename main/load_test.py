@@ -0,0 +1,123 @@
+"""Задержка /get на станции без выгрузок и во время параллельных
+/export — проверка пула рабочих задач webserver.c на устройстве.
+
+    python3 load_test.py http://192.168.4.1 --exports 3 --duration 60
+
+Критерий: p99 /get с выгрузками не больше p99 без них плюс
+--p99-margin мс; иначе код выхода 1. Замеров на устройстве ещё нет,
+поэтому критерий пока не подтверждён. На хосте то же свойство (/get
+не ждёт медленные /export, очередь переполняется в 503) проверяет
+host_test/test_web_pool.c, но без сети и без железа."""
+
+import argparse
+import sys
+import threading
+import time
+import urllib.error
+import urllib.request
+
+
+def percentile(values, p):
+    if not values:
+        return float("nan")
+    values = sorted(values)
+    k = min(len(values) - 1, int(round(p / 100 * (len(values) - 1))))
+    return values[k]
+
+
+def poll_get(base: str, duration: float, interval: float):
+    """Задержки /get в мс и число ошибок за duration секунд."""
+    latencies, errors = [], 0
+    end = time.monotonic() + duration
+    while time.monotonic() < end:
+        start = time.monotonic()
+        try:
+            with urllib.request.urlopen(base + "/get", timeout=10) as resp:
+                resp.read()
+            latencies.append((time.monotonic() - start) * 1000)
+        except (urllib.error.URLError, OSError):
+            errors += 1
+        time.sleep(max(0.0, interval - (time.monotonic() - start)))
+    return latencies, errors
+
+
+def export_loop(base: str, query: str, stop: threading.Event, stats: dict):
+    """Качает /export по кругу, пока не выставлен stop."""
+    while not stop.is_set():
+        try:
+            with urllib.request.urlopen(base + "/export?" + query, timeout=60) as resp:
+                while not stop.is_set() and resp.read(4096):
+                    pass
+            stats["done"] += 1
+        except urllib.error.HTTPError as e:
+            stats["busy" if e.code == 503 else "errors"] += 1
+            time.sleep(float(e.headers.get("Retry-After", "1")))
+        except (urllib.error.URLError, OSError):
+            stats["errors"] += 1
+            time.sleep(1)
+
+
+def report(name: str, latencies, errors):
+    print(
+        f"  {name:<16} n={len(latencies):<5} "
+        f"p50={percentile(latencies, 50):7.1f} мс  "
+        f"p95={percentile(latencies, 95):7.1f} мс  "
+        f"p99={percentile(latencies, 99):7.1f} мс  ошибок={errors}"
+    )
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Задержка /get без выгрузок и во время параллельных /export"
+    )
+    parser.add_argument("base", help="адрес станции, например http://192.168.4.1")
+    parser.add_argument("--exports", type=int, default=3, help="параллельных выгрузок")
+    parser.add_argument("--duration", type=float, default=30, help="секунд на фазу")
+    parser.add_argument("--interval", type=float, default=0.2, help="период /get, с")
+    parser.add_argument("--query", default="format=csv", help="параметры /export")
+    parser.add_argument(
+        "--p99-margin", type=float, default=50, help="допуск p99 /get, мс"
+    )
+    args = parser.parse_args()
+    base = args.base.rstrip("/")
+
+    print(f"Фаза 1: только /get, {args.duration:.0f} с")
+    idle = poll_get(base, args.duration, args.interval)
+
+    print(f"Фаза 2: /get и {args.exports} выгрузки /export?{args.query}")
+    stop = threading.Event()
+    stats = {"done": 0, "busy": 0, "errors": 0}
+    threads = [
+        threading.Thread(
+            target=export_loop, args=(base, args.query, stop, stats), daemon=True
+        )
+        for _ in range(args.exports)
+    ]
+    for t in threads:
+        t.start()
+    loaded = poll_get(base, args.duration, args.interval)
+    stop.set()
+    for t in threads:
+        t.join(timeout=5)
+
+    print("\nЗадержка /get:")
+    report("без нагрузки", *idle)
+    report("с выгрузками", *loaded)
+    print(
+        f"\n/export: завершено {stats['done']}, 503 {stats['busy']}, "
+        f"ошибок {stats['errors']}"
+    )
+
+    # Без выгрузок, дошедших до конца, сравнивать не с чем
+    p99_idle = percentile(idle[0], 99)
+    p99_loaded = percentile(loaded[0], 99)
+    ok = stats["done"] > 0 and p99_loaded <= p99_idle + args.p99_margin
+    print(
+        f"\np99 /get: {p99_loaded:.1f} мс при {p99_idle:.1f} мс без нагрузки, "
+        f"допуск {args.p99_margin:.0f} мс — {'OK' if ok else 'НЕ ВЫПОЛНЕН'}"
+    )
+    return 0 if ok else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -1,39 +1,59 @@
 #include "adc.h"
+#include "batch_mode.h"
 #include "bmp280.h"
+#include "config.h"
 #include "dht22.h"
 #include "display.h"
 #include "driver/gpio.h"
 #include "esp_event.h"
 #include "esp_log.h"
 #include "esp_netif.h"
+#include "esp_netif_sntp.h"
 #include "esp_system.h"
-#include "esp_wifi.h"
 #include "freertos/FreeRTOS.h"
-#include "freertos/event_groups.h"
 #include "hal/adc_types.h"
+#include "i2c_bus.h"
 #include "mq135.h"
 #include "mqtt_manager.h"
 #include "nvs_flash.h"
 #include "pms5003.h"
+#include "power.h"
 #include "relay.h"
+#include "rules.h"
+#include "sample_store.h"
 #include "sensor_data.h"
+#include "sensor_sched.h"
+#include "task_profile.h"
 #include "tunnel.h"
 #include "webserver.h"
+#include "wifi_manager.h"
 #include <stdint.h>
-#include <string.h>
 
 static const char* TAG = "MAIN";
 
 #define DHT22_GPIO GPIO_NUM_4
 #define PMS5003_TX_GPIO 16
 #define PMS5003_RX_GPIO 17
+#define PMS5003_SET_GPIO 25 // -1, если SET не подключён
 #define RELAY_GPIO GPIO_NUM_27
 #define ADC_CHANNEL ADC_CHANNEL_0
 #define I2C_MASTER_SCL_IO 22
 #define I2C_MASTER_SDA_IO 21
-#define I2C_MASTER_FREQ_HZ 100000
 #define I2C_MASTER_PORT I2C_NUM_0
 
+// RUN_MODE_CONTINUOUS — постоянная работа с веб-интерфейсом и дисплеем;
+// RUN_MODE_BATCH — deep sleep между выборками, выгрузка пакетами
+#define RUN_MODE_CONTINUOUS 0
+#define RUN_MODE_BATCH 1
+#define RUN_MODE RUN_MODE_CONTINUOUS
+
+#define BATCH_SAMPLE_INTERVAL_S 300
+#define BATCH_UPLOAD_EVERY 12 // раз в час
+#define BATCH_PMS_EVERY 3     // PMS5003 раз в 15 мин: 30 с прогрева
+
+// POWER_MODE_PERFORMANCE / POWER_MODE_DFS / POWER_MODE_LIGHT_SLEEP
+#define POWER_MODE POWER_MODE_LIGHT_SLEEP
+
 #define WIFI_STA_SSID "TP-Link_D2CD"
 #define WIFI_STA_PASSWORD "61629400"
 
@@ -42,113 +62,152 @@ static const char* TAG = "MAIN";
 #define WIFI_AP_CHANNEL 1
 #define WIFI_AP_MAX_CONN 4
 
-#define WIFI_CONNECTED_BIT BIT0
-static EventGroupHandle_t s_wifi_event_group;
-static bool s_tunnel_started = false;
+#define SNTP_SERVER "pool.ntp.org"
+
+static bool s_sntp_started = false;
+
+static const wifi_manager_config_t s_wifi_config = {
+        .sta_ssid = WIFI_STA_SSID,
+        .sta_password = WIFI_STA_PASSWORD,
+        .ap_ssid = WIFI_AP_SSID,
+        .ap_password = WIFI_AP_PASSWORD,
+        .ap_channel = WIFI_AP_CHANNEL,
+        .ap_max_conn = WIFI_AP_MAX_CONN,
+        .power_save = POWER_MODE != POWER_MODE_PERFORMANCE,
+};
 
-static void
-wifi_event_handler(void* arg, esp_event_base_t base, int32_t id, void* data)
+static void time_sync_cb(struct timeval* tv)
 {
-    if (base == WIFI_EVENT && id == WIFI_EVENT_STA_START) {
-        esp_wifi_connect();
-    } else if (base == WIFI_EVENT && id == WIFI_EVENT_STA_DISCONNECTED) {
-        wifi_event_sta_disconnected_t* event
-                = (wifi_event_sta_disconnected_t*)data;
-        ESP_LOGW(
-                TAG,
-                "WiFi (STA) отключён, причина: %d. Повтор...",
-                event->reason);
-        xEventGroupClearBits(s_wifi_event_group, WIFI_CONNECTED_BIT);
-        esp_wifi_connect();
-    } else if (base == WIFI_EVENT && id == WIFI_EVENT_AP_STACONNECTED) {
-        wifi_event_ap_staconnected_t* e = (wifi_event_ap_staconnected_t*)data;
-        ESP_LOGI(
-                TAG,
-                "К локальной точке доступа подключился клиент "
-                "%02x:%02x:%02x:%02x:%02x:%02x",
-                e->mac[0],
-                e->mac[1],
-                e->mac[2],
-                e->mac[3],
-                e->mac[4],
-                e->mac[5]);
-    } else if (base == IP_EVENT && id == IP_EVENT_STA_GOT_IP) {
-        ip_event_got_ip_t* e = (ip_event_got_ip_t*)data;
-        ESP_LOGI(
-                TAG,
-                "Подключено к роутеру, IP: " IPSTR,
-                IP2STR(&e->ip_info.ip));
-        xEventGroupSetBits(s_wifi_event_group, WIFI_CONNECTED_BIT);
-        if (!s_tunnel_started) {
-            tunnel_init();
-            s_tunnel_started = true;
-        }
-    }
+    ESP_LOGI(
+            TAG,
+            "Время синхронизировано по SNTP: %lld",
+            (long long)tv->tv_sec);
 }
 
-static void wifi_init_apsta(void)
+// Часы нужны для меток времени выборок; в deep sleep RTC их сохраняет
+static void time_sync_on_ip(
+        void* arg, esp_event_base_t base, int32_t id, void* data)
 {
-    s_wifi_event_group = xEventGroupCreate();
+    if (s_sntp_started) {
+        return;
+    }
+    esp_sntp_config_t cfg = ESP_NETIF_SNTP_DEFAULT_CONFIG(SNTP_SERVER);
+    cfg.sync_cb = time_sync_cb;
+    if (esp_netif_sntp_init(&cfg) == ESP_OK) {
+        s_sntp_started = true;
+    }
+}
 
-    esp_netif_create_default_wifi_sta();
-    esp_netif_create_default_wifi_ap();
+static mq_params_data_t s_mq_params = {.channel = ADC_CHANNEL};
+static dht_params_data_t s_dht_params = {.gpio = DHT22_GPIO};
+static pms_params_data_t s_pms_params = {
+        .tx_gpio = PMS5003_TX_GPIO,
+        .rx_gpio = PMS5003_RX_GPIO,
+        .set_gpio = PMS5003_SET_GPIO,
+};
 
-    wifi_init_config_t cfg = WIFI_INIT_CONFIG_DEFAULT();
-    ESP_ERROR_CHECK(esp_wifi_init(&cfg));
+// Датчики с общим периодом снимаются в одни и те же моменты сетки.
+// Период задаётся в config, параметр — в s_driver_config.
+static sensor_driver_t s_drivers[] = {
+        {
+                .name = "mq135",
+                .init = mq135_driver_init,
+                .read = mq135_driver_read,
+                .blocking = true,
+                .ctx = &s_mq_params,
+        },
+        {
+                .name = "dht22",
+                .init = dht22_driver_init,
+                .read = dht22_driver_read,
+                .warmup_ms = DHT22_WARMUP_MS,
+                .blocking = true,
+                .ctx = &s_dht_params,
+        },
+        {
+                .name = "bmp280",
+                .init = bmp280_driver_init,
+                .start = bmp280_driver_start,
+                .read = bmp280_driver_read,
+                .read_delay_ms = BMP280_DRIVER_READ_DELAY_MS,
+        },
+        {
+                .name = "pms5003",
+                .init = pms5003_driver_init,
+                .read = pms5003_driver_read,
+                .warmup_ms = PMS5003_WARMUP_MS,
+                .blocking = true,
+                .ctx = &s_pms_params,
+        },
+        {
+                // Снимок в архив; стирание сектора флеша блокирует
+                .name = "history",
+                .init = sample_store_driver_init,
+                .read = sample_store_driver_read,
+                .warmup_ms = PMS5003_WARMUP_MS,
+                .blocking = true,
+        },
+};
 
-    ESP_ERROR_CHECK(esp_event_handler_register(
-            WIFI_EVENT, ESP_EVENT_ANY_ID, &wifi_event_handler, NULL));
-    ESP_ERROR_CHECK(esp_event_handler_register(
-            IP_EVENT, IP_EVENT_STA_GOT_IP, &wifi_event_handler, NULL));
-
-    wifi_config_t sta_config = {
-      .sta =
-          {
-              .ssid = WIFI_STA_SSID,
-              .password = WIFI_STA_PASSWORD,
-          },
-  };
-
-    wifi_config_t ap_config = {
-      .ap =
-          {
-              .ssid = WIFI_AP_SSID,
-              .ssid_len = strlen(WIFI_AP_SSID),
-              .channel = WIFI_AP_CHANNEL,
-              .password = WIFI_AP_PASSWORD,
-              .max_connection = WIFI_AP_MAX_CONN,
-              .authmode = WIFI_AUTH_WPA2_PSK,
-          },
-  };
-
-    if (strlen(WIFI_AP_PASSWORD) == 0) {
-        ap_config.ap.authmode = WIFI_AUTH_OPEN;
-    }
+#define DRIVER_COUNT (sizeof(s_drivers) / sizeof(s_drivers[0]))
 
-    ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_APSTA));
-    ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_AP, &ap_config));
-    ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_STA, &sta_config));
-    ESP_ERROR_CHECK(esp_wifi_start());
+// По порядку s_drivers: настройка периода и группа данных, чей
+// предел возраста следует за периодом (SENSOR_GROUP_COUNT — нет)
+static const struct {
+    config_id_t period;
+    sensor_group_t group;
+} s_driver_config[] = {
+        {CONFIG_MQ_PERIOD_MS, SENSOR_MQ},
+        {CONFIG_DHT_PERIOD_MS, SENSOR_DHT},
+        {CONFIG_BMP_PERIOD_MS, SENSOR_BMP},
+        {CONFIG_PMS_PERIOD_MS, SENSOR_PMS},
+        {CONFIG_HISTORY_PERIOD_MS, SENSOR_GROUP_COUNT},
+};
+_Static_assert(
+        sizeof(s_driver_config) / sizeof(s_driver_config[0]) == DRIVER_COUNT,
+        "s_driver_config не совпадает с s_drivers");
 
-    ESP_LOGI(
-            TAG,
-            "Локальная точка доступа \"%s\" запущена (http://192.168.4.1)",
-            WIFI_AP_SSID);
-    ESP_LOGI(TAG, "Идёт подключение к домашней сети \"%s\"...", WIFI_STA_SSID);
+// ctx — индекс драйвера
+static void driver_period_changed(config_id_t id, uint32_t value, void* ctx)
+{
+    size_t i = (size_t)(uintptr_t)ctx;
+    sensor_sched_set_period(i, value);
+    sensor_data_set_period(s_driver_config[i].group, value);
+}
+
+static void drivers_apply_config(void)
+{
+    for (size_t i = 0; i < DRIVER_COUNT; i++) {
+        s_drivers[i].period_ms = config_get(s_driver_config[i].period);
+        sensor_data_set_period(
+                s_driver_config[i].group, s_drivers[i].period_ms);
+        config_set_listener(
+                s_driver_config[i].period,
+                driver_period_changed,
+                (void*)(uintptr_t)i);
+    }
+}
+
+// Для пакетного режима: только STA, без точки доступа и туннеля
+static bool wifi_connect_sta(uint32_t timeout_ms)
+{
+    wifi_manager_config_t cfg = s_wifi_config;
+    cfg.ap_ssid = NULL;
+    wifi_manager_start(&cfg);
+    return wifi_manager_wait_connected(pdMS_TO_TICKS(timeout_ms));
 }
 
 static void i2c_master_init(void)
 {
-    i2c_config_t conf = {
-            .mode = I2C_MODE_MASTER,
+    i2c_master_bus_config_t conf = {
+            .i2c_port = I2C_MASTER_PORT,
             .sda_io_num = I2C_MASTER_SDA_IO,
             .scl_io_num = I2C_MASTER_SCL_IO,
-            .sda_pullup_en = GPIO_PULLUP_ENABLE,
-            .scl_pullup_en = GPIO_PULLUP_ENABLE,
-            .master.clk_speed = I2C_MASTER_FREQ_HZ,
+            .clk_source = I2C_CLK_SRC_DEFAULT,
+            .glitch_ignore_cnt = 7,
+            .flags.enable_internal_pullup = true,
     };
-    ESP_ERROR_CHECK(i2c_param_config(I2C_MASTER_PORT, &conf));
-    ESP_ERROR_CHECK(i2c_driver_install(I2C_MASTER_PORT, conf.mode, 0, 0, 0));
+    ESP_ERROR_CHECK(i2c_bus_init(&conf));
 }
 
 void app_main(void)
@@ -162,8 +221,12 @@ void app_main(void)
         ESP_ERROR_CHECK(nvs_flash_init());
     }
 
+    ESP_ERROR_CHECK(power_init(POWER_MODE));
+
     ESP_ERROR_CHECK(esp_netif_init());
     ESP_ERROR_CHECK(esp_event_loop_create_default());
+    ESP_ERROR_CHECK(esp_event_handler_register(
+            IP_EVENT, IP_EVENT_STA_GOT_IP, &time_sync_on_ip, NULL));
 
     init_relay(RELAY_GPIO);
     i2c_master_init();
@@ -172,33 +235,42 @@ void app_main(void)
     sensor_data_init();
     adc_init(ADC_CHANNEL);
 
-    mq_params_data_t mq_params = {.channel = ADC_CHANNEL, .task_delay_s = 5};
-    dht_params_data_t dht_params = {.gpio = DHT22_GPIO, .task_delay_s = 5};
-    bmp_params_data_t bmp_params = {.port = I2C_MASTER_PORT, .task_delay_s = 5};
-    pms_params_data_t pms_params = {
-            .tx_gpio = PMS5003_TX_GPIO,
-            .rx_gpio = PMS5003_RX_GPIO,
-            .task_delay_s = 10,
-    };
+    if (RUN_MODE == RUN_MODE_BATCH) {
+        batch_mode_config_t batch = {
+                .sample_interval_s = BATCH_SAMPLE_INTERVAL_S,
+                .upload_every = BATCH_UPLOAD_EVERY,
+                .pms_every = BATCH_PMS_EVERY,
+                .mq = &s_mq_params,
+                .dht = &s_dht_params,
+                .pms = &s_pms_params,
+                .network_up = wifi_connect_sta,
+                .network_down = wifi_manager_stop,
+        };
+        batch_mode_run(&batch);
+    }
+
+    rules_init();
+    config_init();
+    drivers_apply_config();
+
+    ESP_ERROR_CHECK(sensor_sched_start(s_drivers, DRIVER_COUNT));
 
-    xTaskCreatePinnedToCore(
-            mq_sensor_task, "mq_sensor_task", 4096, &mq_params, 5, NULL, 0);
-    xTaskCreatePinnedToCore(
-            dht22_task, "dht22_task", 4096, &dht_params, 5, NULL, 1);
-    xTaskCreatePinnedToCore(
-            bmp280_task, "bmp280_task", 4096, &bmp_params, 5, NULL, 0);
     xTaskCreatePinnedToCore(
             display_task, "display_task", 4096, NULL, 4, NULL, 0);
-    xTaskCreatePinnedToCore(
-            pms5003_task, "pms5003_task", 4096, &pms_params, 5, NULL, 0);
     xTaskCreatePinnedToCore(
             mqtt_publish_task, "mqtt_pub", 4096, NULL, 3, NULL, 0);
 
-    wifi_init_apsta();
+    wifi_manager_start(&s_wifi_config);
 
+    task_profile_start_log();
     start_webserver();
 
+    // Клиент MQTT стартует с готовой сетью: попытка до IP ушла бы
+    // в reconnect_timeout_ms и отложила первую публикацию. Потоки
+    // туннеля сами ждут сеть перед каждым подключением.
+    wifi_manager_wait_connected(portMAX_DELAY);
     mqtt_manager_init();
+    tunnel_init();
 
     while (1) {
         vTaskDelay(portMAX_DELAY);
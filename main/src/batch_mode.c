@@ -0,0 +1,210 @@
+#include "batch_mode.h"
+#include "bmp280.h"
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_sleep.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "mqtt_manager.h"
+#include "sample_batch.h"
+#include "sensor_data.h"
+#include <time.h>
+
+static const char* TAG = "BATCH";
+
+// Переживает deep sleep, обнуляется при подаче питания
+static RTC_DATA_ATTR sample_batch_t s_batch;
+static RTC_DATA_ATTR uint64_t s_powered_us; // с холодного старта до сна
+static RTC_DATA_ATTR uint32_t s_sample_no;
+static RTC_DATA_ATTR uint16_t s_since_upload;
+
+static uint64_t powered_us(void)
+{
+    return s_powered_us + (uint64_t)esp_timer_get_time();
+}
+
+static uint32_t powered_s(void)
+{
+    return (uint32_t)(powered_us() / 1000000ULL);
+}
+
+// Unix-время; 0 — SNTP ещё не синхронизировал часы
+static uint32_t wall_s(void)
+{
+    time_t now = time(NULL);
+    return now >= SENSOR_WALL_CLOCK_MIN_S ? (uint32_t)now : 0;
+}
+
+// Ждёт, пока с момента since_us (по esp_timer) пройдёт delay_ms
+static void wait_since(int64_t since_us, uint32_t delay_ms)
+{
+    int64_t left_us = since_us + (int64_t)delay_ms * 1000
+                    - esp_timer_get_time();
+    if (left_us > 0) {
+        vTaskDelay(pdMS_TO_TICKS((left_us + 999) / 1000) + 1);
+    }
+}
+
+static void batch_sample(const batch_mode_config_t* cfg, bool with_pms)
+{
+    int64_t pms_on_us = esp_timer_get_time();
+    if (with_pms) {
+        pms5003_set_active(cfg->pms, true);
+    }
+
+    if (bmp280_driver_init(NULL) == ESP_OK
+        && bmp280_driver_start(NULL) == ESP_OK) {
+        vTaskDelay(pdMS_TO_TICKS(BMP280_DRIVER_READ_DELAY_MS) + 1);
+        bmp280_driver_read(NULL);
+    }
+
+    if (powered_us() < DHT22_WARMUP_MS * 1000ULL) {
+        wait_since(-(int64_t)s_powered_us, DHT22_WARMUP_MS);
+    }
+    if (dht22_driver_init(cfg->dht) == ESP_OK) {
+        dht22_driver_read(cfg->dht);
+    }
+
+    bool gas_ready = powered_us() >= MQ_WARMUP_S * 1000000ULL;
+    mq135_set_uptime_offset((uint32_t)(s_powered_us / 1000000ULL));
+    if (gas_ready && mq135_driver_init(cfg->mq) == ESP_OK) {
+        mq135_driver_read(cfg->mq);
+    }
+
+    if (with_pms) {
+        // Без SET датчик включён постоянно, прогрев — от холодного старта
+        if (cfg->pms->set_gpio >= 0) {
+            wait_since(pms_on_us, PMS5003_WARMUP_MS);
+        } else {
+            wait_since(-(int64_t)s_powered_us, PMS5003_WARMUP_MS);
+        }
+        if (pms5003_driver_init(cfg->pms) != ESP_OK
+            || pms5003_driver_read(cfg->pms) != ESP_OK) {
+            ESP_LOGW(TAG, "PMS5003 не ответил");
+        }
+        pms5003_set_active(cfg->pms, false);
+    }
+
+    // До SNTP метка — секунды от холодного старта, в Unix-время её
+    // переведёт выгрузка, когда часы станут известны
+    sample_values_t v = {.time_s = wall_s()};
+    uint8_t time_flag = 0;
+    if (v.time_s == 0) {
+        v.time_s = powered_s();
+        time_flag = SAMPLE_F_UPTIME;
+    }
+    float t_bmp;
+    uint8_t dht_valid, bmp_valid, pms_valid = 0;
+    sensor_data_get_dht(&v.temperature, &v.humidity, &dht_valid);
+    sensor_data_get_bmp(&t_bmp, &v.pressure, &bmp_valid);
+    v.temperature = sensor_data_get_temp_avg();
+    if (with_pms) {
+        sensor_data_get_pms5003(&v.pm1_0, &v.pm2_5, &v.pm10, &pms_valid);
+    }
+    if (gas_ready) {
+        float lpg, co, nh3;
+        sensor_data_get_mq(&v.co2, &lpg, &co, &nh3);
+    }
+
+    v.flags = (dht_valid ? SAMPLE_F_DHT : 0) | (bmp_valid ? SAMPLE_F_BMP : 0)
+            | (gas_ready ? SAMPLE_F_GAS : 0) | (pms_valid ? SAMPLE_F_PMS : 0)
+            | time_flag;
+
+    sample_batch_push(&s_batch, &v);
+    ESP_LOGI(
+            TAG,
+            "Выборка #%lu, флаги 0x%02x, в пакете %u",
+            (unsigned long)s_sample_no,
+            v.flags,
+            (unsigned)sample_batch_count(&s_batch));
+}
+
+static void batch_upload(const batch_mode_config_t* cfg)
+{
+    if (!cfg->network_up(BATCH_NET_TIMEOUT_MS)) {
+        ESP_LOGW(TAG, "Сеть недоступна, выгрузка отложена");
+        cfg->network_down();
+        return;
+    }
+
+    mqtt_manager_init();
+    int64_t start_us = esp_timer_get_time();
+    while (!mqtt_manager_is_connected()) {
+        if (esp_timer_get_time() - start_us > BATCH_NET_TIMEOUT_MS * 1000LL) {
+            ESP_LOGW(TAG, "Брокер недоступен, выгрузка отложена");
+            mqtt_manager_stop();
+            cfg->network_down();
+            return;
+        }
+        vTaskDelay(pdMS_TO_TICKS(100));
+    }
+
+    uint32_t wall = wall_s();
+    if (wall != 0) {
+        sample_batch_fix_time(&s_batch, powered_s(), wall);
+    }
+
+    static char buf[BATCH_UPLOAD_CHUNK];
+    size_t sent = 0, total = sample_batch_count(&s_batch);
+    while (sent < total) {
+        size_t n = 0;
+        size_t len = sample_batch_encode_json(
+                &s_batch, sent, buf, sizeof(buf), &n);
+        if (len == 0 || mqtt_publish_batch(buf, len) != ESP_OK) {
+            break;
+        }
+        sent += n;
+    }
+
+    // Удаляем из буфера только то, на что брокер ответил PUBACK
+    if (sent > 0 && mqtt_manager_wait_published(BATCH_PUBACK_TIMEOUT_MS)) {
+        sample_batch_drop(&s_batch, sent);
+        s_since_upload = 0;
+        ESP_LOGI(TAG, "Выгружено выборок: %u", (unsigned)sent);
+    } else {
+        ESP_LOGW(TAG, "Выгрузка не подтверждена, повтор в следующий раз");
+    }
+
+    mqtt_manager_stop();
+    cfg->network_down();
+}
+
+void batch_mode_run(const batch_mode_config_t* cfg)
+{
+    if (esp_reset_reason() != ESP_RST_DEEPSLEEP
+        || !sample_batch_is_valid(&s_batch)) {
+        ESP_LOGI(TAG, "Холодный старт, пакет очищен");
+        sample_batch_reset(&s_batch);
+        s_powered_us = 0;
+        s_sample_no = 0;
+        s_since_upload = 0;
+    }
+
+    bool with_pms = cfg->pms != NULL && cfg->pms_every > 0
+                 && s_sample_no % cfg->pms_every == 0;
+    batch_sample(cfg, with_pms);
+    s_sample_no++;
+    s_since_upload++;
+
+    if (s_since_upload >= cfg->upload_every) {
+        batch_upload(cfg);
+    }
+
+    // Следующее пробуждение — по сетке от холодного старта, чтобы
+    // время бодрствования не сдвигало моменты выборки
+    uint64_t interval_us = (uint64_t)cfg->sample_interval_s * 1000000ULL;
+    uint64_t now_us = powered_us();
+    uint64_t sleep_us = interval_us - now_us % interval_us;
+
+    s_powered_us = now_us + sleep_us;
+    ESP_LOGI(
+            TAG,
+            "Бодрствование %lu мс, сон %lu с",
+            (unsigned long)(esp_timer_get_time() / 1000),
+            (unsigned long)(sleep_us / 1000000));
+
+    esp_sleep_enable_timer_wakeup(sleep_us);
+    esp_deep_sleep_start();
+}
@@ -6,6 +6,7 @@
 #include <string.h>
 
 static const char* TAG = "BMP280";
+static bmp280_dev_t s_sensor;
 
 static esp_err_t
 bmp280_read_reg(bmp280_dev_t* dev, uint8_t reg_addr, uint8_t* data, size_t len);
@@ -13,7 +14,11 @@ static esp_err_t
 bmp280_write_reg(bmp280_dev_t* dev, uint8_t reg_addr, uint8_t data);
 static esp_err_t bmp280_read_calibration_data(bmp280_dev_t* dev);
 static int32_t bmp280_compensate_temperature(bmp280_dev_t* dev, int32_t adc_T);
-static uint32_t bmp280_compensate_pressure(bmp280_dev_t* dev, int32_t adc_P);
+#if BMP280_PRESSURE_COMP_32BIT
+static uint32_t bmp280_compensate_pressure32(bmp280_dev_t* dev, int32_t adc_P);
+#else
+static uint32_t bmp280_compensate_pressure64(bmp280_dev_t* dev, int32_t adc_P);
+#endif
 
 static esp_err_t
 bmp280_read_reg(bmp280_dev_t* dev, uint8_t reg_addr, uint8_t* data, size_t len)
@@ -22,53 +27,70 @@ bmp280_read_reg(bmp280_dev_t* dev, uint8_t reg_addr, uint8_t* data, size_t len)
         return ESP_ERR_INVALID_ARG;
     }
 
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+    return i2c_bus_write_read(dev->i2c_dev, &reg_addr, 1, data, len);
+}
 
-    i2c_master_start(cmd);
-    i2c_master_write_byte(cmd, (dev->i2c_addr << 1) | I2C_MASTER_WRITE, true);
-    i2c_master_write_byte(cmd, reg_addr, true);
+static esp_err_t
+bmp280_write_reg(bmp280_dev_t* dev, uint8_t reg_addr, uint8_t data)
+{
+    uint8_t buf[2] = {reg_addr, data};
 
-    if (len > 1) {
-        i2c_master_start(cmd);
-        i2c_master_write_byte(
-                cmd, (dev->i2c_addr << 1) | I2C_MASTER_READ, true);
+    return i2c_bus_write(dev->i2c_dev, buf, sizeof(buf));
+}
 
-        if (len > 1) {
-            i2c_master_read(cmd, data, len - 1, I2C_MASTER_ACK);
-        }
-        i2c_master_read_byte(cmd, data + len - 1, I2C_MASTER_NACK);
-    } else {
-        i2c_master_start(cmd);
-        i2c_master_write_byte(
-                cmd, (dev->i2c_addr << 1) | I2C_MASTER_READ, true);
-        i2c_master_read_byte(cmd, data, I2C_MASTER_NACK);
+static esp_err_t bmp280_attach(bmp280_dev_t* dev, uint8_t i2c_addr)
+{
+    esp_err_t err = i2c_bus_probe(i2c_addr);
+    if (err != ESP_OK) {
+        return err;
     }
 
-    i2c_master_stop(cmd);
+    err = i2c_bus_add_device(
+            "bmp280",
+            i2c_addr,
+            BMP280_I2C_SPEED_HZ,
+            I2C_BUS_PRIO_NORMAL,
+            &dev->i2c_dev);
+    if (err != ESP_OK) {
+        return err;
+    }
 
-    esp_err_t ret = i2c_master_cmd_begin(
-            dev->i2c_port, cmd, BMP280_I2C_TIMEOUT_MS / portTICK_PERIOD_MS);
-    i2c_cmd_link_delete(cmd);
+    dev->i2c_addr = i2c_addr;
+    return ESP_OK;
+}
 
-    return ret;
+static void bmp280_detach(bmp280_dev_t* dev)
+{
+    if (dev->i2c_dev != NULL) {
+        i2c_bus_remove_device(dev->i2c_dev);
+        dev->i2c_dev = NULL;
+    }
 }
 
-static esp_err_t
-bmp280_write_reg(bmp280_dev_t* dev, uint8_t reg_addr, uint8_t data)
+static esp_err_t bmp280_probe(bmp280_dev_t* dev, uint8_t i2c_addr)
 {
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+    uint8_t chip_id;
 
-    i2c_master_start(cmd);
-    i2c_master_write_byte(cmd, (dev->i2c_addr << 1) | I2C_MASTER_WRITE, true);
-    i2c_master_write_byte(cmd, reg_addr, true);
-    i2c_master_write_byte(cmd, data, true);
-    i2c_master_stop(cmd);
+    esp_err_t err = bmp280_attach(dev, i2c_addr);
+    if (err != ESP_OK) {
+        return err;
+    }
 
-    esp_err_t ret = i2c_master_cmd_begin(
-            dev->i2c_port, cmd, BMP280_I2C_TIMEOUT_MS / portTICK_PERIOD_MS);
-    i2c_cmd_link_delete(cmd);
+    err = bmp280_get_chip_id(dev, &chip_id);
+    if (err == ESP_OK && chip_id != BMP280_CHIP_ID) {
+        ESP_LOGE(
+                TAG,
+                "Invalid chip ID at 0x%02X: 0x%02X (expected 0x%02X)",
+                i2c_addr,
+                chip_id,
+                BMP280_CHIP_ID);
+        err = ESP_ERR_NOT_SUPPORTED;
+    }
 
-    return ret;
+    if (err != ESP_OK) {
+        bmp280_detach(dev);
+    }
+    return err;
 }
 
 static esp_err_t bmp280_read_calibration_data(bmp280_dev_t* dev)
@@ -120,7 +142,43 @@ static int32_t bmp280_compensate_temperature(bmp280_dev_t* dev, int32_t adc_T)
     return T;
 }
 
-static uint32_t bmp280_compensate_pressure(bmp280_dev_t* dev, int32_t adc_P)
+#if BMP280_PRESSURE_COMP_32BIT
+// Вариант из даташита без 64-битной арифметики, результат в целых Па
+static uint32_t bmp280_compensate_pressure32(bmp280_dev_t* dev, int32_t adc_P)
+{
+    const bmp280_calib_data_t* c = &dev->calib_data;
+    int32_t var1, var2;
+    uint32_t p;
+
+    var1 = (dev->t_fine >> 1) - (int32_t)64000;
+    var2 = (((var1 >> 2) * (var1 >> 2)) >> 11) * (int32_t)c->dig_P6;
+    var2 = var2 + ((var1 * (int32_t)c->dig_P5) << 1);
+    var2 = (var2 >> 2) + ((int32_t)c->dig_P4 << 16);
+    var1 = ((((int32_t)c->dig_P3 * (((var1 >> 2) * (var1 >> 2)) >> 13)) >> 3)
+            + (((int32_t)c->dig_P2 * var1) >> 1))
+            >> 18;
+    var1 = ((32768 + var1) * (int32_t)c->dig_P1) >> 15;
+
+    if (var1 == 0) {
+        return 0;
+    }
+
+    p = ((uint32_t)((int32_t)1048576 - adc_P) - (uint32_t)(var2 >> 12)) * 3125;
+    if (p < 0x80000000) {
+        p = (p << 1) / (uint32_t)var1;
+    } else {
+        p = (p / (uint32_t)var1) * 2;
+    }
+
+    var1 = ((int32_t)c->dig_P9 * (int32_t)(((p >> 3) * (p >> 3)) >> 13)) >> 12;
+    var2 = ((int32_t)(p >> 2) * (int32_t)c->dig_P8) >> 13;
+    p = (uint32_t)((int32_t)p + ((var1 + var2 + c->dig_P7) >> 4));
+
+    return p;
+}
+#else
+// Результат в Па в формате Q24.8
+static uint32_t bmp280_compensate_pressure64(bmp280_dev_t* dev, int32_t adc_P)
 {
     int64_t var1, var2, p;
 
@@ -146,18 +204,17 @@ static uint32_t bmp280_compensate_pressure(bmp280_dev_t* dev, int32_t adc_P)
 
     return (uint32_t)p;
 }
+#endif
 
-esp_err_t bmp280_init(bmp280_dev_t* dev, i2c_port_t i2c_port, uint8_t i2c_addr)
+esp_err_t bmp280_init(bmp280_dev_t* dev, uint8_t i2c_addr)
 {
     esp_err_t err;
-    uint8_t chip_id;
 
     if (dev == NULL) {
         return ESP_ERR_INVALID_ARG;
     }
 
     memset(dev, 0, sizeof(bmp280_dev_t));
-    dev->i2c_port = i2c_port;
     dev->t_fine = 0;
 
     if (i2c_addr == 0) {
@@ -166,14 +223,9 @@ esp_err_t bmp280_init(bmp280_dev_t* dev, i2c_port_t i2c_port, uint8_t i2c_addr)
         bool found = false;
 
         for (int i = 0; i < 2; i++) {
-            dev->i2c_addr = addresses[i];
-
-            err = bmp280_get_chip_id(dev, &chip_id);
-            if (err == ESP_OK) {
-                if (chip_id == BMP280_CHIP_ID) {
-                    found = true;
-                    break;
-                }
+            if (bmp280_probe(dev, addresses[i]) == ESP_OK) {
+                found = true;
+                break;
             }
         }
 
@@ -182,29 +234,23 @@ esp_err_t bmp280_init(bmp280_dev_t* dev, i2c_port_t i2c_port, uint8_t i2c_addr)
             return ESP_ERR_NOT_FOUND;
         }
     } else {
-        dev->i2c_addr = i2c_addr;
-
-        err = bmp280_get_chip_id(dev, &chip_id);
+        err = bmp280_probe(dev, i2c_addr);
+        if (err == ESP_ERR_NOT_SUPPORTED) {
+            return err;
+        }
         if (err != ESP_OK) {
             ESP_LOGE(TAG, "No device at address 0x%02X", i2c_addr);
             return ESP_ERR_NOT_FOUND;
         }
     }
 
-    if (chip_id != BMP280_CHIP_ID) {
-        ESP_LOGE(
-                TAG,
-                "Invalid chip ID: 0x%02X (expected 0x%02X)",
-                chip_id,
-                BMP280_CHIP_ID);
-        return ESP_ERR_NOT_SUPPORTED;
-    }
-
     ESP_LOGI(TAG, "Found BMP280 at 0x%02X", dev->i2c_addr);
 
+    // Дальше устройство уже занимает слот шины: при ошибке освобождаем
     err = bmp280_soft_reset(dev);
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "Failed to reset device");
+        bmp280_detach(dev);
         return err;
     }
 
@@ -213,6 +259,7 @@ esp_err_t bmp280_init(bmp280_dev_t* dev, i2c_port_t i2c_port, uint8_t i2c_addr)
     err = bmp280_read_calibration_data(dev);
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "Failed to read calibration data");
+        bmp280_detach(dev);
         return err;
     }
 
@@ -235,7 +282,12 @@ esp_err_t bmp280_set_config(bmp280_dev_t* dev, const bmp280_config_t* config)
 
     memcpy(&dev->config, config, sizeof(bmp280_config_t));
 
-    ctrl_meas = (config->osrs_t << 5) | (config->osrs_p << 2) | config->mode;
+    // В forced-режиме измерение запускает bmp280_measure_forced,
+    // до этого датчик спит, и запись CONFIG не игнорируется
+    bmp280_mode_t mode = config->mode == BMP280_FORCED_MODE
+            ? BMP280_SLEEP_MODE
+            : config->mode;
+    ctrl_meas = (config->osrs_t << 5) | (config->osrs_p << 2) | mode;
     err = bmp280_write_reg(dev, BMP280_REG_CTRL_MEAS, ctrl_meas);
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "Failed to write CTRL_MEAS register");
@@ -275,14 +327,18 @@ bmp280_read_data(bmp280_dev_t* dev, float* temperature, float* pressure)
                       | ((uint32_t)data[5] >> 4));
 
     int32_t comp_temp = bmp280_compensate_temperature(dev, adc_T);
+#if BMP280_PRESSURE_COMP_32BIT
+    float comp_press = (float)bmp280_compensate_pressure32(dev, adc_P);
+#else
+    float comp_press = bmp280_compensate_pressure64(dev, adc_P) / 256.0f;
+#endif
 
     if (temperature != NULL) {
         *temperature = comp_temp / 100.0f;
     }
 
     if (pressure != NULL) {
-        uint32_t comp_press = bmp280_compensate_pressure(dev, adc_P);
-        *pressure = comp_press / 256.0f; // Результат в Па
+        *pressure = comp_press; // Результат в Па
     }
 
     return ESP_OK;
@@ -324,6 +380,78 @@ esp_err_t bmp280_sleep(bmp280_dev_t* dev)
     return bmp280_write_reg(dev, BMP280_REG_CTRL_MEAS, ctrl_meas);
 }
 
+static uint32_t bmp280_os_factor(bmp280_oversampling_t os)
+{
+    return os == BMP280_OS_SKIPPED ? 0 : 1u << (os - 1);
+}
+
+uint32_t bmp280_measurement_time_us(const bmp280_config_t* config)
+{
+    // Даташит, 3.8.1: t_max = 1.25 + 2.3 * T_os + (2.3 * P_os + 0.575) мс
+    uint32_t t_us = 1250 + 2300 * bmp280_os_factor(config->osrs_t);
+    if (config->osrs_p != BMP280_OS_SKIPPED) {
+        t_us += 2300 * bmp280_os_factor(config->osrs_p) + 575;
+    }
+    return t_us;
+}
+
+esp_err_t bmp280_start_forced(bmp280_dev_t* dev)
+{
+    if (dev == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uint8_t ctrl_meas = (dev->config.osrs_t << 5) | (dev->config.osrs_p << 2)
+            | BMP280_FORCED_MODE;
+    esp_err_t err = bmp280_write_reg(dev, BMP280_REG_CTRL_MEAS, ctrl_meas);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to start forced measurement");
+    }
+    return err;
+}
+
+esp_err_t
+bmp280_read_forced(bmp280_dev_t* dev, float* temperature, float* pressure)
+{
+    if (dev == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    bool measuring = true;
+    esp_err_t err = ESP_OK;
+    for (int i = 0; i < BMP280_FORCED_POLL_MAX; i++) {
+        err = bmp280_is_measuring(dev, &measuring);
+        if (err != ESP_OK || !measuring) {
+            break;
+        }
+        vTaskDelay(1);
+    }
+    if (err != ESP_OK) {
+        return err;
+    }
+    if (measuring) {
+        ESP_LOGW(TAG, "Forced measurement did not finish in time");
+        return ESP_ERR_TIMEOUT;
+    }
+
+    // После измерения датчик сам возвращается в sleep
+    return bmp280_read_data(dev, temperature, pressure);
+}
+
+esp_err_t
+bmp280_measure_forced(bmp280_dev_t* dev, float* temperature, float* pressure)
+{
+    esp_err_t err = bmp280_start_forced(dev);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    uint32_t wait_ms = (bmp280_measurement_time_us(&dev->config) + 999) / 1000;
+    vTaskDelay(pdMS_TO_TICKS(wait_ms) + 1);
+
+    return bmp280_read_forced(dev, temperature, pressure);
+}
+
 esp_err_t bmp280_is_measuring(bmp280_dev_t* dev, bool* measuring)
 {
     if (dev == NULL || measuring == NULL) {
@@ -336,7 +464,7 @@ esp_err_t bmp280_is_measuring(bmp280_dev_t* dev, bool* measuring)
         return err;
     }
 
-    *measuring = (status & (1 << 3)) != 0;
+    *measuring = (status & BMP280_STATUS_MEASURING) != 0;
     return ESP_OK;
 }
 
@@ -352,51 +480,57 @@ esp_err_t bmp280_is_updating(bmp280_dev_t* dev, bool* copying)
         return err;
     }
 
-    *copying = (status & 1) != 0;
+    *copying = (status & BMP280_STATUS_IM_UPDATE) != 0;
     return ESP_OK;
 }
 
-void bmp280_task(void* bmp_params)
+esp_err_t bmp280_driver_init(void* ctx)
 {
-    bmp_params_data_t* params = (bmp_params_data_t*)bmp_params;
-    ESP_LOGI(TAG, "Запуск DHT22 на GPIO%d", params->port);
+    ESP_LOGI(TAG, "Запуск BMP280 на шине I2C (%d Гц)", BMP280_I2C_SPEED_HZ);
 
-    bmp280_dev_t sensor;
-    esp_err_t err = bmp280_init(&sensor, params->port, 0);
+    esp_err_t err = bmp280_init(&s_sensor, 0);
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "Failed to initialize sensor");
-        vTaskDelay(pdMS_TO_TICKS(2000));
-        // return;
+        return err;
     }
 
-    ESP_LOGI(TAG, "BMP280 initialized successfully");
-
+    // Профиль Bosch для метеостанции: одиночные измерения по запросу,
+    // между ними датчик спит
     bmp280_config_t config = {
-            .osrs_t = BMP280_OS_2X,
-            .osrs_p = BMP280_OS_16X,
-            .filter = BMP280_FILTER_16,
-            .mode = BMP280_NORMAL_MODE,
+            .osrs_t = BMP280_OS_1X,
+            .osrs_p = BMP280_OS_4X,
+            .filter = BMP280_FILTER_OFF,
+            .mode = BMP280_FORCED_MODE,
     };
 
-    err = bmp280_set_config(&sensor, &config);
+    err = bmp280_set_config(&s_sensor, &config);
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "Failed to configure sensor");
-        vTaskDelay(pdMS_TO_TICKS(2000));
-        // return;
+        bmp280_detach(&s_sensor);
+        return err;
     }
 
-    ESP_LOGI(TAG, "Sensor configured, starting measurements...");
+    ESP_LOGI(
+            TAG,
+            "BMP280 initialized, conversion time %lu us",
+            (unsigned long)bmp280_measurement_time_us(&config));
+    return ESP_OK;
+}
 
-    while (1) {
-        float temperature, pressure;
+esp_err_t bmp280_driver_start(void* ctx)
+{
+    return bmp280_start_forced(&s_sensor);
+}
 
-        err = bmp280_read_data(&sensor, &temperature, &pressure);
+esp_err_t bmp280_driver_read(void* ctx)
+{
+    float temperature = 0.0f, pressure = 0.0f;
 
-        float pressure_hPa = pressure / 100.0f;
-        float pressure_mmHg = pressure_hPa * 0.750062;
+    esp_err_t err = bmp280_read_forced(&s_sensor, &temperature, &pressure);
 
-        sensor_data_set_bmp(temperature, pressure_mmHg, err == ESP_OK ? 1 : 0);
+    float pressure_hPa = pressure / 100.0f;
+    float pressure_mmHg = pressure_hPa * 0.750062;
 
-        vTaskDelay(pdMS_TO_TICKS(params->task_delay_s * 1000));
-    }
+    sensor_data_set_bmp(temperature, pressure_mmHg, err == ESP_OK ? 1 : 0);
+    return err;
 }
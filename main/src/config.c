@@ -0,0 +1,215 @@
+#include "config.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "nvs.h"
+#include "query.h"
+#include "sample_store.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char* TAG = "CONFIG";
+
+static const config_param_t s_params[CONFIG_COUNT] = {
+        [CONFIG_MQ_PERIOD_MS] = {"mq_period_ms", 5000, 1000, 600000},
+        // DHT22 отвечает не чаще раза в 2 с
+        [CONFIG_DHT_PERIOD_MS] = {"dht_period_ms", 5000, 2000, 600000},
+        [CONFIG_BMP_PERIOD_MS] = {"bmp_period_ms", 5000, 1000, 600000},
+        [CONFIG_PMS_PERIOD_MS] = {"pms_period_ms", 10000, 1000, 600000},
+        // Запись во флеш: чаще раза в 10 с кольцо быстро изнашивается
+        [CONFIG_HISTORY_PERIOD_MS] = {"hist_period_ms",
+                                      SAMPLE_STORE_PERIOD_MS,
+                                      10000,
+                                      3600000},
+        [CONFIG_MQTT_PERIOD_MS] = {"mqtt_period_ms", 300000, 5000, 86400000},
+        [CONFIG_DISPLAY_PERIOD_MS] = {"disp_period_ms", 5000, 1000, 60000},
+};
+
+typedef struct {
+    config_listener_t fn;
+    void* ctx;
+} config_listener_slot_t;
+
+// 0 — умолчание: ноль вне диапазона любого параметра
+static uint32_t s_values[CONFIG_COUNT];
+static config_listener_slot_t s_listeners[CONFIG_COUNT];
+static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static bool config_in_range(config_id_t id, uint32_t value)
+{
+    return value >= s_params[id].min && value <= s_params[id].max;
+}
+
+// Вызывается под s_mux
+static uint32_t config_value(config_id_t id)
+{
+    return s_values[id] ? s_values[id] : s_params[id].def;
+}
+
+void config_init(void)
+{
+    nvs_handle_t nvs;
+    if (nvs_open(CONFIG_NVS_NAMESPACE, NVS_READONLY, &nvs) != ESP_OK) {
+        ESP_LOGI(TAG, "Сохранённых настроек нет, используются умолчания");
+        return;
+    }
+    for (int i = 0; i < CONFIG_COUNT; i++) {
+        uint32_t v;
+        if (nvs_get_u32(nvs, s_params[i].name, &v) != ESP_OK) {
+            continue;
+        }
+        if (!config_in_range(i, v)) {
+            ESP_LOGW(
+                    TAG,
+                    "%s=%lu вне диапазона, используется %lu",
+                    s_params[i].name,
+                    (unsigned long)v,
+                    (unsigned long)s_params[i].def);
+            continue;
+        }
+        portENTER_CRITICAL(&s_mux);
+        s_values[i] = v;
+        portEXIT_CRITICAL(&s_mux);
+        ESP_LOGI(TAG, "%s=%lu", s_params[i].name, (unsigned long)v);
+    }
+    nvs_close(nvs);
+}
+
+const config_param_t* config_param(config_id_t id)
+{
+    return id < CONFIG_COUNT ? &s_params[id] : NULL;
+}
+
+uint32_t config_get(config_id_t id)
+{
+    if (id >= CONFIG_COUNT) {
+        return 0;
+    }
+    portENTER_CRITICAL(&s_mux);
+    uint32_t v = config_value(id);
+    portEXIT_CRITICAL(&s_mux);
+    return v;
+}
+
+static esp_err_t config_save(config_id_t id, uint32_t value)
+{
+    nvs_handle_t nvs;
+    esp_err_t err = nvs_open(CONFIG_NVS_NAMESPACE, NVS_READWRITE, &nvs);
+    if (err == ESP_OK) {
+        err = nvs_set_u32(nvs, s_params[id].name, value);
+        if (err == ESP_OK) {
+            err = nvs_commit(nvs);
+        }
+        nvs_close(nvs);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGW(
+                TAG,
+                "Не удалось сохранить %s: %s",
+                s_params[id].name,
+                esp_err_to_name(err));
+    }
+    return err;
+}
+
+esp_err_t config_set(config_id_t id, uint32_t value)
+{
+    if (id >= CONFIG_COUNT || !config_in_range(id, value)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    portENTER_CRITICAL(&s_mux);
+    bool changed = config_value(id) != value;
+    s_values[id] = value;
+    config_listener_slot_t l = s_listeners[id];
+    portEXIT_CRITICAL(&s_mux);
+
+    if (!changed) {
+        return ESP_OK;
+    }
+    ESP_LOGI(TAG, "%s=%lu", s_params[id].name, (unsigned long)value);
+    if (l.fn != NULL) {
+        l.fn(id, value, l.ctx);
+    }
+    // Новое значение уже действует, даже если NVS не записалась
+    return config_save(id, value);
+}
+
+void config_set_listener(config_id_t id, config_listener_t fn, void* ctx)
+{
+    if (id >= CONFIG_COUNT) {
+        return;
+    }
+    portENTER_CRITICAL(&s_mux);
+    s_listeners[id] = (config_listener_slot_t){.fn = fn, .ctx = ctx};
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void config_notify_task(config_id_t id, uint32_t value, void* ctx)
+{
+    xTaskNotifyGive((TaskHandle_t)ctx);
+}
+
+esp_err_t config_apply_query(const char* query)
+{
+    uint32_t values[CONFIG_COUNT];
+    bool present[CONFIG_COUNT];
+    bool any = false;
+    char val[12];
+
+    for (int i = 0; i < CONFIG_COUNT; i++) {
+        esp_err_t err =
+                query_value(query, s_params[i].name, val, sizeof(val));
+        if (err == ESP_ERR_INVALID_ARG) {
+            return err;
+        }
+        present[i] = err == ESP_OK;
+        if (!present[i]) {
+            continue;
+        }
+        char* end;
+        unsigned long v = strtoul(val, &end, 10);
+        if (end == val || *end != '\0' || !config_in_range(i, v)) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        values[i] = (uint32_t)v;
+        any = true;
+    }
+    if (!any) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    esp_err_t err = ESP_OK;
+    for (int i = 0; i < CONFIG_COUNT; i++) {
+        if (present[i]) {
+            esp_err_t e = config_set(i, values[i]);
+            if (err == ESP_OK) {
+                err = e;
+            }
+        }
+    }
+    return err;
+}
+
+int config_format(char* buf, size_t len)
+{
+    int n = snprintf(buf, len, "{");
+    for (int i = 0; i < CONFIG_COUNT && n >= 0 && (size_t)n < len; i++) {
+        n += snprintf(
+                buf + n,
+                len - n,
+                "%s\"%s\":{\"value\":%lu,\"min\":%lu,\"max\":%lu,"
+                "\"default\":%lu}",
+                i ? "," : "",
+                s_params[i].name,
+                (unsigned long)config_get(i),
+                (unsigned long)s_params[i].min,
+                (unsigned long)s_params[i].max,
+                (unsigned long)s_params[i].def);
+    }
+    if (n >= 0 && (size_t)n < len) {
+        n += snprintf(buf + n, len - n, "}");
+    }
+    return n;
+}
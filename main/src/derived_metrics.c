@@ -0,0 +1,250 @@
+#include "derived_metrics.h"
+#include <math.h>
+#include <string.h>
+
+#define MAGNUS_A 17.62f
+#define MAGNUS_B 243.12f
+#define MMHG_PER_HPA 0.750062f
+
+typedef struct {
+    float c_lo;
+    float c_hi;
+    int16_t i_lo;
+    int16_t i_hi;
+} aqi_breakpoint_t;
+
+// US EPA (2012), PM2.5 в мкг/м³ с точностью 0.1
+static const aqi_breakpoint_t s_pm25_bp[] = {
+        {0.0f, 12.0f, 0, 50},
+        {12.1f, 35.4f, 51, 100},
+        {35.5f, 55.4f, 101, 150},
+        {55.5f, 150.4f, 151, 200},
+        {150.5f, 250.4f, 201, 300},
+        {250.5f, 350.4f, 301, 400},
+        {350.5f, 500.4f, 401, 500},
+};
+
+// PM10 в мкг/м³, целые
+static const aqi_breakpoint_t s_pm10_bp[] = {
+        {0, 54, 0, 50},
+        {55, 154, 51, 100},
+        {155, 254, 101, 150},
+        {255, 354, 151, 200},
+        {355, 424, 201, 300},
+        {425, 504, 301, 400},
+        {505, 604, 401, 500},
+};
+
+static const char* const s_aqi_labels[] = {
+        "хорошо",
+        "умеренно",
+        "чувствительным",
+        "нездоровый",
+        "очень нездоровый",
+        "опасный",
+};
+
+static const char* const s_air_labels[] = {
+        "хорошо",
+        "умеренно",
+        "плохо",
+        "очень плохо",
+};
+
+static float magnus_gamma(float t_c, float rh)
+{
+    return logf(rh / 100.0f) + MAGNUS_A * t_c / (MAGNUS_B + t_c);
+}
+
+float derived_dew_point(float t_c, float rh)
+{
+    if (rh <= 0.0f) {
+        return NAN;
+    }
+    float g = magnus_gamma(t_c, rh);
+    return MAGNUS_B * g / (MAGNUS_A - g);
+}
+
+float derived_abs_humidity(float t_c, float rh)
+{
+    // Давление пара по Магнусу (гПа) и уравнение состояния
+    float e = 6.112f * expf(MAGNUS_A * t_c / (MAGNUS_B + t_c)) * rh / 100.0f;
+    return 216.7f * e / (273.15f + t_c);
+}
+
+float derived_heat_index(float t_c, float rh)
+{
+    float t = t_c * 1.8f + 32.0f;
+
+    // Простая формула Стедмана; регрессия Ротфуза — от 80 °F
+    float hi = 0.5f * (t + 61.0f + (t - 68.0f) * 1.2f + rh * 0.094f);
+    if ((hi + t) / 2.0f >= 80.0f) {
+        hi = -42.379f + 2.04901523f * t + 10.14333127f * rh
+           - 0.22475541f * t * rh - 0.00683783f * t * t
+           - 0.05481717f * rh * rh + 0.00122874f * t * t * rh
+           + 0.00085282f * t * rh * rh - 0.00000199f * t * t * rh * rh;
+        if (rh < 13.0f && t >= 80.0f && t <= 112.0f) {
+            hi -= (13.0f - rh) / 4.0f
+                * sqrtf((17.0f - fabsf(t - 95.0f)) / 17.0f);
+        } else if (rh > 85.0f && t >= 80.0f && t <= 87.0f) {
+            hi += (rh - 85.0f) / 10.0f * (87.0f - t) / 5.0f;
+        }
+    }
+    return (hi - 32.0f) / 1.8f;
+}
+
+float derived_sea_level_pressure(float p_mmhg, float t_c, float altitude_m)
+{
+    float k = 0.0065f * altitude_m;
+    return p_mmhg * powf(1.0f - k / (t_c + k + 273.15f), -5.257f);
+}
+
+static int aqi_lookup(const aqi_breakpoint_t* bp, int n, float c)
+{
+    if (c < 0.0f) {
+        return DERIVED_AQI_NONE;
+    }
+    for (int i = 0; i < n; i++) {
+        if (c >= bp[i].c_lo && c <= bp[i].c_hi) {
+            return (int)lroundf(
+                    (bp[i].i_hi - bp[i].i_lo) / (bp[i].c_hi - bp[i].c_lo)
+                            * (c - bp[i].c_lo)
+                    + bp[i].i_lo);
+        }
+    }
+    return c > bp[n - 1].c_hi ? bp[n - 1].i_hi : DERIVED_AQI_NONE;
+}
+
+int derived_aqi_pm25(float pm2_5)
+{
+    // EPA: концентрация усекается до 0.1 мкг/м³
+    float c = floorf(pm2_5 * 10.0f) / 10.0f;
+    return aqi_lookup(
+            s_pm25_bp, sizeof(s_pm25_bp) / sizeof(s_pm25_bp[0]), c);
+}
+
+int derived_aqi_pm10(float pm10)
+{
+    return aqi_lookup(
+            s_pm10_bp, sizeof(s_pm10_bp) / sizeof(s_pm10_bp[0]), floorf(pm10));
+}
+
+aqi_category_t derived_aqi_category(int aqi)
+{
+    if (aqi <= 50) {
+        return AQI_GOOD;
+    }
+    if (aqi <= 100) {
+        return AQI_MODERATE;
+    }
+    if (aqi <= 150) {
+        return AQI_SENSITIVE;
+    }
+    if (aqi <= 200) {
+        return AQI_UNHEALTHY;
+    }
+    if (aqi <= 300) {
+        return AQI_VERY_UNHEALTHY;
+    }
+    return AQI_HAZARDOUS;
+}
+
+air_level_t derived_air_level(float co2, float co, float lpg, float nh3)
+{
+    air_level_t level = co2 <= 800    ? AIR_LEVEL_GOOD
+                      : co2 <= 1000   ? AIR_LEVEL_MODERATE
+                      : co2 <= 1500   ? AIR_LEVEL_POOR
+                                      : AIR_LEVEL_BAD;
+    if ((co > 9.0f || lpg > 500.0f || nh3 > 25.0f) && level < AIR_LEVEL_POOR) {
+        level = AIR_LEVEL_POOR;
+    }
+    return level;
+}
+
+void derived_init(derived_metrics_t* d)
+{
+    memset(d, 0, sizeof(*d));
+    d->aqi = DERIVED_AQI_NONE;
+    d->in_t = d->in_rh = d->in_p = d->in_tp = NAN;
+    for (int i = 0; i < 4; i++) {
+        d->in_gas[i] = NAN;
+    }
+}
+
+bool derived_update_humidity(derived_metrics_t* d, float t_c, float rh)
+{
+    if (d->humidity_valid && t_c == d->in_t && rh == d->in_rh) {
+        return false;
+    }
+    d->in_t = t_c;
+    d->in_rh = rh;
+    d->dew_point = derived_dew_point(t_c, rh);
+    d->abs_humidity = derived_abs_humidity(t_c, rh);
+    d->heat_index = derived_heat_index(t_c, rh);
+    d->humidity_valid = isfinite(d->dew_point) ? 1 : 0;
+    return true;
+}
+
+bool derived_update_pressure(derived_metrics_t* d, float p_mmhg, float t_c)
+{
+    if (d->pressure_valid && p_mmhg == d->in_p && t_c == d->in_tp) {
+        return false;
+    }
+    d->in_p = p_mmhg;
+    d->in_tp = t_c;
+    d->sea_level_pressure = derived_sea_level_pressure(
+            p_mmhg, t_c, DERIVED_STATION_ALTITUDE_M);
+    d->pressure_valid = 1;
+    return true;
+}
+
+bool derived_update_aqi(derived_metrics_t* d, uint16_t pm2_5, uint16_t pm10)
+{
+    if (d->aqi != DERIVED_AQI_NONE && pm2_5 == d->in_pm2_5
+        && pm10 == d->in_pm10) {
+        return false;
+    }
+    d->in_pm2_5 = pm2_5;
+    d->in_pm10 = pm10;
+
+    int a25 = derived_aqi_pm25(pm2_5);
+    int a10 = derived_aqi_pm10(pm10);
+    d->aqi = (int16_t)(a25 > a10 ? a25 : a10);
+    d->aqi_category = derived_aqi_category(d->aqi);
+    return true;
+}
+
+bool derived_update_air_level(
+        derived_metrics_t* d, float co2, float co, float lpg, float nh3)
+{
+    if (co2 == d->in_gas[0] && co == d->in_gas[1] && lpg == d->in_gas[2]
+        && nh3 == d->in_gas[3]) {
+        return false;
+    }
+    d->in_gas[0] = co2;
+    d->in_gas[1] = co;
+    d->in_gas[2] = lpg;
+    d->in_gas[3] = nh3;
+    d->air_level = derived_air_level(co2, co, lpg, nh3);
+    return true;
+}
+
+void derived_invalidate_humidity(derived_metrics_t* d)
+{
+    d->humidity_valid = 0;
+}
+
+void derived_invalidate_pressure(derived_metrics_t* d)
+{
+    d->pressure_valid = 0;
+}
+
+const char* derived_aqi_label(aqi_category_t cat)
+{
+    return cat <= AQI_HAZARDOUS ? s_aqi_labels[cat] : "";
+}
+
+const char* derived_air_level_label(air_level_t level)
+{
+    return level <= AIR_LEVEL_BAD ? s_air_labels[level] : "";
+}
@@ -4,11 +4,14 @@
 #include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "metrics.h"
+#include "power.h"
 #include "sensor_data.h"
 #include <string.h>
 
 static const char* TAG = "DHT22";
 static portMUX_TYPE dht_mux = portMUX_INITIALIZER_UNLOCKED;
+static dht22_t s_dht;
 
 static uint8_t dht22_read(dht22_t* dht)
 {
@@ -70,45 +73,56 @@ static uint8_t dht22_read(dht22_t* dht)
     return DHT_OK;
 }
 
-void dht22_task(void* dht_params)
+esp_err_t dht22_driver_init(void* ctx)
 {
-    dht_params_data_t* params = (dht_params_data_t*)dht_params;
+    dht_params_data_t* params = (dht_params_data_t*)ctx;
     ESP_LOGI(TAG, "Запуск DHT22 на GPIO%d", params->gpio);
 
-    dht22_t dht = {.gpio = params->gpio, .last_read_time = 0};
-    gpio_reset_pin(dht.gpio);
-    gpio_set_pull_mode(dht.gpio, GPIO_PULLUP_ONLY);
-    vTaskDelay(pdMS_TO_TICKS(2500));
-
-    while (1) {
-        uint8_t result = DHT_TIMEOUT;
+    s_dht = (dht22_t){.gpio = params->gpio, .last_read_time = 0};
+    gpio_reset_pin(s_dht.gpio);
+    gpio_set_pull_mode(s_dht.gpio, GPIO_PULLUP_ONLY);
+    return ESP_OK;
+}
 
-        for (int attempt = 0; attempt < 3; attempt++) {
-            dht.last_read_time = 0;
-            result = dht22_read(&dht);
-            if (result == DHT_OK)
-                break;
-            vTaskDelay(pdMS_TO_TICKS(50));
-        }
+esp_err_t dht22_driver_read(void* ctx)
+{
+    uint8_t result = DHT_TIMEOUT;
+
+    power_lock_acquire(POWER_LOCK_DHT);
+    for (int attempt = 0; attempt < 3; attempt++) {
+        s_dht.last_read_time = 0;
+        result = dht22_read(&s_dht);
+        if (result == DHT_OK)
+            break;
+        metrics_inc(
+                result == DHT_CHECKSUM_FAIL ? METRIC_DHT_CHECKSUM_ERRORS
+                                            : METRIC_DHT_TIMEOUTS);
+        vTaskDelay(pdMS_TO_TICKS(50));
+    }
+    power_lock_release(POWER_LOCK_DHT);
 
-        if (result == DHT_OK) {
-            float humidity = dht.data[0] + dht.data[1] / 10.0f;
-            float temperature = dht.data[2] + dht.data[3] / 10.0f;
-
-            ESP_LOGW(TAG, "RAW: %02X %02X %02X %02X %02X",
-                     dht.data[0], dht.data[1], dht.data[2],
-                     dht.data[3], dht.data[4]);
-
-            if (humidity >= 0.0f && humidity <= 100.0f
-                && temperature >= -40.0f && temperature <= 80.0f) {
-                ESP_LOGI(TAG, "T=%.1f H=%.1f", temperature, humidity);
-                sensor_data_set_dht(temperature, humidity, 1);
-            } else {
-                ESP_LOGW(TAG, "Вне диапазона: t=%.1f h=%.1f",
-                         temperature, humidity);
-            }
-        }
+    if (result != DHT_OK) {
+        return result == DHT_CHECKSUM_FAIL ? ESP_ERR_INVALID_CRC
+                                           : ESP_ERR_TIMEOUT;
+    }
 
-        vTaskDelay(pdMS_TO_TICKS(2500));
+    float humidity = s_dht.data[0] + s_dht.data[1] / 10.0f;
+    float temperature = s_dht.data[2] + s_dht.data[3] / 10.0f;
+
+    ESP_LOGW(TAG, "RAW: %02X %02X %02X %02X %02X",
+             s_dht.data[0], s_dht.data[1], s_dht.data[2],
+             s_dht.data[3], s_dht.data[4]);
+
+    if (humidity >= 0.0f && humidity <= 100.0f
+        && temperature >= -40.0f && temperature <= 80.0f) {
+        ESP_LOGI(TAG, "T=%.1f H=%.1f", temperature, humidity);
+        sensor_data_set_dht(temperature, humidity, 1);
+    } else {
+        ESP_LOGW(TAG, "Вне диапазона: t=%.1f h=%.1f",
+                 temperature, humidity);
+        metrics_inc(METRIC_DHT_RANGE_ERRORS);
+        return ESP_ERR_INVALID_RESPONSE;
     }
+
+    return ESP_OK;
 }
\ No newline at end of file
@@ -1,10 +1,12 @@
 #include "display.h"
+#include "config.h"
 #include "dht22.h"
 #include "esp_log.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "mq135.h"
 #include "pms5003.h"
+#include "power.h"
 #include "sensor_data.h"
 #include "st7735.h"
 #include <stdio.h>
@@ -39,6 +41,72 @@ static void draw_cell(int16_t col, int16_t row, const char* label,
     st7735_draw_string(x + VALUE_X, y, value, value_color, ST7735_BLACK, 1);
 }
 
+#define ICON 10
+
+// Стрелка тенденции давления в квадрате ICON×ICON
+static void draw_trend_icon(int16_t x, int16_t y, pressure_tendency_t tend)
+{
+    uint16_t color = tend == PRESSURE_FALLING_FAST ? ST7735_RED
+            : tend == PRESSURE_RISING_FAST         ? ST7735_GREEN
+                                                   : ST7735_WHITE;
+    int16_t cx = x + ICON / 2;
+
+    st7735_fill_rect(x, y, ICON, ICON, ST7735_BLACK);
+    if (tend == PRESSURE_STEADY) {
+        st7735_fill_rect(x + 1, y + 4, ICON - 4, 2, color);
+        for (int16_t i = 0; i < 4; i++) {
+            st7735_fill_rect(x + ICON - 4 + i, y + 1 + i, 1, 8 - 2 * i, color);
+        }
+        return;
+    }
+
+    // Наконечник из отрезков и стержень
+    bool up = tend > PRESSURE_STEADY;
+    for (int16_t i = 0; i < 5; i++) {
+        int16_t row = up ? y + i : y + ICON - 1 - i;
+        st7735_draw_hline(cx - i, row, 2 * i + 1, color);
+    }
+    st7735_fill_rect(cx - 1, up ? y + 5 : y, 3, ICON - 5, color);
+}
+
+static void draw_cloud(int16_t x, int16_t y, uint16_t color)
+{
+    st7735_fill_rect(x + 3, y, 4, 2, color);
+    st7735_fill_rect(x + 1, y + 2, 8, 2, color);
+    st7735_fill_rect(x, y + 4, ICON, 2, color);
+}
+
+// Значок прогноза: солнце, облако с солнцем, дождь, гроза
+static void draw_forecast_icon(int16_t x, int16_t y, forecast_kind_t kind)
+{
+    static const uint8_t sun[] = {4, 6, 8, 8, 8, 8, 6, 4};
+
+    st7735_fill_rect(x, y, ICON, ICON, ST7735_BLACK);
+    switch (kind) {
+    case FORECAST_FAIR:
+        for (int16_t i = 0; i < 8; i++) {
+            st7735_draw_hline(
+                    x + 1 + (8 - sun[i]) / 2, y + 1 + i, sun[i], ST7735_YELLOW);
+        }
+        break;
+    case FORECAST_CHANGEABLE:
+        st7735_fill_rect(x + 5, y, 4, 4, ST7735_YELLOW);
+        draw_cloud(x, y + 3, ST7735_WHITE);
+        break;
+    case FORECAST_RAIN:
+        draw_cloud(x, y, ST7735_GRAY);
+        for (int16_t i = 0; i < 3; i++) {
+            st7735_fill_rect(x + 1 + 3 * i, y + 7, 1, 3, ST7735_CYAN);
+        }
+        break;
+    case FORECAST_STORM:
+        draw_cloud(x, y, ST7735_DARKGRAY);
+        st7735_fill_rect(x + 5, y + 6, 2, 2, ST7735_YELLOW);
+        st7735_fill_rect(x + 3, y + 8, 2, 2, ST7735_YELLOW);
+        break;
+    }
+}
+
 static void update_values(void)
 {
     char buf[16];
@@ -113,6 +181,69 @@ static void update_values(void)
         draw_cell(1, 4, "PM10", "..", ST7735_GRAY);
     }
 
+    derived_metrics_t derived;
+    sensor_data_get_derived(&derived);
+
+    if (dht_valid && derived.humidity_valid) {
+        snprintf(buf, sizeof(buf), "%.1fC", derived.dew_point);
+        draw_cell(0, 5, "DEW", buf, ST7735_WHITE);
+        uint16_t hi_color = derived.heat_index > 32 ? ST7735_RED
+                : derived.heat_index > 27           ? ST7735_YELLOW
+                                                    : ST7735_WHITE;
+        snprintf(buf, sizeof(buf), "%.1fC", derived.heat_index);
+        draw_cell(0, 6, "FEEL", buf, hi_color);
+    } else {
+        draw_cell(0, 5, "DEW", "--", ST7735_GRAY);
+        draw_cell(0, 6, "FEEL", "--", ST7735_GRAY);
+    }
+
+    if (pms_valid && derived.aqi != DERIVED_AQI_NONE) {
+        uint16_t aqi_color = derived.aqi_category >= AQI_UNHEALTHY
+                ? ST7735_RED
+                : derived.aqi_category >= AQI_MODERATE ? ST7735_YELLOW
+                                                       : ST7735_WHITE;
+        snprintf(buf, sizeof(buf), "%d", derived.aqi);
+        draw_cell(1, 5, "AQI", buf, aqi_color);
+    } else {
+        draw_cell(1, 5, "AQI", "..", ST7735_GRAY);
+    }
+
+    if (bmp_valid && derived.pressure_valid) {
+        snprintf(buf, sizeof(buf), "%.0fmm", derived.sea_level_pressure);
+        draw_cell(1, 6, "SEA", buf, ST7735_WHITE);
+    } else {
+        draw_cell(1, 6, "SEA", "ERR", ST7735_RED);
+    }
+
+    pressure_trend_t trend;
+    sensor_data_get_trend(&trend);
+
+    if (trend.valid) {
+        int16_t y = HEADER_H + 2 + 7 * ROW_H;
+        snprintf(buf, sizeof(buf), "%+.1f", trend.delta_3h_hpa);
+        draw_cell(0, 7, "TRND", "", ST7735_WHITE);
+        draw_trend_icon(VALUE_X, y, trend.tendency);
+        st7735_draw_string(
+                VALUE_X + ICON + 2, y, buf, ST7735_WHITE, ST7735_BLACK, 1);
+
+        snprintf(buf, sizeof(buf), "%u", trend.zambretti);
+        draw_cell(1, 7, "FCST", "", ST7735_WHITE);
+        draw_forecast_icon(
+                COL_W + VALUE_X,
+                y,
+                pressure_trend_forecast_kind(trend.zambretti));
+        st7735_draw_string(
+                COL_W + VALUE_X + ICON + 2,
+                y,
+                buf,
+                ST7735_WHITE,
+                ST7735_BLACK,
+                1);
+    } else {
+        draw_cell(0, 7, "TRND", "..", ST7735_GRAY);
+        draw_cell(1, 7, "FCST", "..", ST7735_GRAY);
+    }
+
     ESP_LOGI(TAG, "========== СЕНСОРНЫЕ ДАННЫЕ ==========");
     ESP_LOGI(TAG, "Температура (итог): %.1f C", temperature);
     if (dht_valid) {
@@ -142,9 +273,17 @@ void display_task(void* pvParameter)
     st7735_fill_screen(ST7735_BLACK);
     draw_header();
     ESP_LOGI(TAG, "Дисплей готов");
+    config_set_listener(
+            CONFIG_DISPLAY_PERIOD_MS,
+            config_notify_task,
+            xTaskGetCurrentTaskHandle());
 
     while (1) {
+        // Кадр уходит десятками SPI-транзакций, держим APB весь кадр
+        power_lock_acquire(POWER_LOCK_DISPLAY);
         update_values();
-        vTaskDelay(pdMS_TO_TICKS(5000));
+        power_lock_release(POWER_LOCK_DISPLAY);
+        ulTaskNotifyTake(
+                pdTRUE, pdMS_TO_TICKS(config_get(CONFIG_DISPLAY_PERIOD_MS)));
     }
 }
\ No newline at end of file
@@ -0,0 +1,149 @@
+#include "gas_curve.h"
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#define GAS_TABLE_BITS 6
+#define GAS_TABLE_SIZE (1 << GAS_TABLE_BITS)
+
+// Коэффициенты пересчитаны из прежних формул mq135.c:
+//   CO2: 400 * (r / 3.6)^-2.769    -> log2_k = log2(400) + 2.769 * log2(3.6)
+//   CO/NH3/LPG: (r / b)^(1 / a)    -> log2_k = -log2(b) / a, e = 1 / a
+const gas_curve_t gas_curves[GAS_COUNT] = {
+        [GAS_CO2] = {13.760959624f, -2.769000000f, 0.0f, 5000.0f},
+        [GAS_CO] = {10.112472026f, -4.364620387f, 0.0f, 1000.0f},
+        [GAS_NH3] = {6.643851444f, -2.429425198f, 0.0f, 300.0f},
+        [GAS_LPG] = {5.257666234f, -3.309176346f, 0.0f, 1000.0f},
+};
+
+// log2(1 + i / 64), i = 0..64
+static const float s_log2_table[GAS_TABLE_SIZE + 1] = {
+        0.000000000f, 0.022367813f, 0.044394119f, 0.066089190f,
+        0.087462841f, 0.108524457f, 0.129283017f, 0.149747120f,
+        0.169925001f, 0.189824559f, 0.209453366f, 0.228818690f,
+        0.247927513f, 0.266786541f, 0.285402219f, 0.303780748f,
+        0.321928095f, 0.339850003f, 0.357552005f, 0.375039431f,
+        0.392317423f, 0.409390936f, 0.426264755f, 0.442943496f,
+        0.459431619f, 0.475733431f, 0.491853096f, 0.507794640f,
+        0.523561956f, 0.539158811f, 0.554588852f, 0.569855608f,
+        0.584962501f, 0.599912842f, 0.614709844f, 0.629356620f,
+        0.643856190f, 0.658211483f, 0.672425342f, 0.686500527f,
+        0.700439718f, 0.714245518f, 0.727920455f, 0.741466986f,
+        0.754887502f, 0.768184325f, 0.781359714f, 0.794415866f,
+        0.807354922f, 0.820178962f, 0.832890014f, 0.845490051f,
+        0.857980995f, 0.870364720f, 0.882643049f, 0.894817763f,
+        0.906890596f, 0.918863237f, 0.930737338f, 0.942514505f,
+        0.954196310f, 0.965784285f, 0.977279923f, 0.988684687f,
+        1.000000000f,
+};
+
+// 2^(i / 64), i = 0..64
+static const float s_exp2_table[GAS_TABLE_SIZE + 1] = {
+        1.000000000f, 1.010889286f, 1.021897149f, 1.033024879f,
+        1.044273782f, 1.055645178f, 1.067140401f, 1.078760798f,
+        1.090507733f, 1.102382583f, 1.114386743f, 1.126521619f,
+        1.138788635f, 1.151189230f, 1.163724859f, 1.176396992f,
+        1.189207115f, 1.202156731f, 1.215247360f, 1.228480536f,
+        1.241857812f, 1.255380757f, 1.269050957f, 1.282870016f,
+        1.296839555f, 1.310961212f, 1.325236643f, 1.339667524f,
+        1.354255547f, 1.369002423f, 1.383909882f, 1.398979673f,
+        1.414213562f, 1.429613338f, 1.445180807f, 1.460917794f,
+        1.476826146f, 1.492907728f, 1.509164428f, 1.525598151f,
+        1.542210825f, 1.559004400f, 1.575980845f, 1.593142151f,
+        1.610490332f, 1.628027422f, 1.645755478f, 1.663676580f,
+        1.681792831f, 1.700106354f, 1.718619298f, 1.737333835f,
+        1.756252160f, 1.775376493f, 1.794709075f, 1.814252176f,
+        1.834008086f, 1.853979125f, 1.874167634f, 1.894575982f,
+        1.915206561f, 1.936061793f, 1.957144124f, 1.978456026f,
+        2.000000000f,
+};
+
+static inline uint32_t float_bits(float v)
+{
+    uint32_t u;
+    memcpy(&u, &v, sizeof(u));
+    return u;
+}
+
+static inline float bits_float(uint32_t u)
+{
+    float v;
+    memcpy(&v, &u, sizeof(v));
+    return v;
+}
+
+// x должен быть нормализованным положительным числом
+static float fast_log2f(float x)
+{
+    uint32_t u = float_bits(x);
+    int32_t e = (int32_t)(u >> 23) - 127;
+    uint32_t mant = u & 0x7FFFFF;
+    uint32_t idx = mant >> (23 - GAS_TABLE_BITS);
+    float frac = (float)(mant & ((1u << (23 - GAS_TABLE_BITS)) - 1))
+            * (1.0f / (float)(1u << (23 - GAS_TABLE_BITS)));
+    float lo = s_log2_table[idx];
+    return (float)e + lo + (s_log2_table[idx + 1] - lo) * frac;
+}
+
+// y должен лежать в [-126, 127]
+static float fast_exp2f(float y)
+{
+    float fl = floorf(y);
+    float f = (y - fl) * GAS_TABLE_SIZE;
+    int32_t idx = (int32_t)f;
+    if (idx >= GAS_TABLE_SIZE) {
+        idx = GAS_TABLE_SIZE - 1;
+    }
+    float lo = s_exp2_table[idx];
+    float m = lo + (s_exp2_table[idx + 1] - lo) * (f - (float)idx);
+    // m в [1, 2): прибавляем целую часть прямо к экспоненте
+    return bits_float(float_bits(m) + ((uint32_t)(int32_t)fl << 23));
+}
+
+static float curve_from_log2(const gas_curve_t* c, float log2_ratio)
+{
+    float y = c->log2_k + c->exponent * log2_ratio;
+    if (y < -126.0f) {
+        return c->min_ppm;
+    }
+    if (y > 126.0f) {
+        return c->max_ppm;
+    }
+    float ppm = fast_exp2f(y);
+    if (ppm < c->min_ppm)
+        return c->min_ppm;
+    if (ppm > c->max_ppm)
+        return c->max_ppm;
+    return ppm;
+}
+
+// Для r <= 0, NaN, Inf и денормалов прежний powf давал NaN/Inf/0,
+// что после ограничения сводилось к нижней границе диапазона
+static int ratio_is_usable(float ratio)
+{
+    return isfinite(ratio) && ratio >= 1.17549435e-38f;
+}
+
+float gas_curve_ppm(gas_id_t gas, float ratio)
+{
+    const gas_curve_t* c = &gas_curves[gas];
+    if (!ratio_is_usable(ratio)) {
+        return c->min_ppm;
+    }
+    return curve_from_log2(c, fast_log2f(ratio));
+}
+
+void gas_curve_eval_all(float ratio, float* out)
+{
+    if (!ratio_is_usable(ratio)) {
+        for (int i = 0; i < GAS_COUNT; i++) {
+            out[i] = gas_curves[i].min_ppm;
+        }
+        return;
+    }
+
+    float log2_ratio = fast_log2f(ratio);
+    for (int i = 0; i < GAS_COUNT; i++) {
+        out[i] = curve_from_log2(&gas_curves[i], log2_ratio);
+    }
+}
@@ -0,0 +1,378 @@
+#include "i2c_bus.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include <string.h>
+
+static const char* TAG = "I2C_BUS";
+
+#define STATS_LOG_PERIOD_US (I2C_BUS_STATS_LOG_S * 1000000LL)
+
+struct i2c_bus_device {
+    const char* name;
+    i2c_master_dev_handle_t handle;
+    uint8_t addr;
+    uint8_t prio;
+    bool used;
+    // Одна транзакция устройства в полёте: lock держит вызывающий,
+    // done отдаёт задача шины
+    SemaphoreHandle_t lock;
+    SemaphoreHandle_t done;
+    StaticSemaphore_t lock_buf;
+    StaticSemaphore_t done_buf;
+    esp_err_t result;
+    i2c_bus_dev_stats_t stats;
+};
+
+typedef struct {
+    i2c_bus_device_t* dev;
+    const uint8_t* tx;
+    size_t tx_len;
+    uint8_t* rx;
+    size_t rx_len;
+    uint32_t seq;
+} i2c_bus_txn_t;
+
+static i2c_master_bus_handle_t s_bus = NULL;
+static QueueHandle_t s_queue = NULL;
+static i2c_bus_device_t s_devices[I2C_BUS_MAX_DEVICES];
+// Захват слота: поиск свободного и used = true под одним замком
+static SemaphoreHandle_t s_devices_lock = NULL;
+static StaticSemaphore_t s_devices_lock_buf;
+static portMUX_TYPE s_stats_mux = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t s_seq = 0;
+
+static esp_err_t i2c_bus_transfer(const i2c_bus_txn_t* txn)
+{
+    if (txn->rx_len == 0) {
+        return i2c_master_transmit(
+                txn->dev->handle, txn->tx, txn->tx_len, I2C_BUS_TIMEOUT_MS);
+    }
+    return i2c_master_transmit_receive(
+            txn->dev->handle,
+            txn->tx,
+            txn->tx_len,
+            txn->rx,
+            txn->rx_len,
+            I2C_BUS_TIMEOUT_MS);
+}
+
+static void i2c_bus_execute(const i2c_bus_txn_t* txn)
+{
+    i2c_bus_device_t* dev = txn->dev;
+    uint32_t resets = 0;
+    bool timed_out = false;
+
+    int64_t start_us = esp_timer_get_time();
+    esp_err_t err = ESP_FAIL;
+    for (int attempt = 0; attempt <= I2C_BUS_RETRIES; attempt++) {
+        err = i2c_bus_transfer(txn);
+        if (err == ESP_OK || err == ESP_ERR_INVALID_ARG) {
+            break;
+        }
+        timed_out |= err == ESP_ERR_TIMEOUT;
+
+        ESP_LOGW(
+                TAG,
+                "%s: ошибка %s, сброс шины",
+                dev->name,
+                esp_err_to_name(err));
+        resets++;
+        if (i2c_master_bus_reset(s_bus) != ESP_OK) {
+            break;
+        }
+    }
+    uint32_t elapsed_us = (uint32_t)(esp_timer_get_time() - start_us);
+
+    portENTER_CRITICAL(&s_stats_mux);
+    dev->stats.transactions++;
+    dev->stats.last_us = elapsed_us;
+    dev->stats.total_us += elapsed_us;
+    if (elapsed_us > dev->stats.max_us) {
+        dev->stats.max_us = elapsed_us;
+    }
+    dev->stats.bus_resets += resets;
+    if (err != ESP_OK) {
+        dev->stats.errors++;
+    }
+    if (timed_out) {
+        dev->stats.timeouts++;
+    }
+    portEXIT_CRITICAL(&s_stats_mux);
+
+    dev->result = err;
+    xSemaphoreGive(dev->done);
+}
+
+// Старший приоритет первым, внутри приоритета — в порядке постановки
+static bool i2c_bus_before(const i2c_bus_txn_t* a, const i2c_bus_txn_t* b)
+{
+    if (a->dev->prio != b->dev->prio) {
+        return a->dev->prio > b->dev->prio;
+    }
+    return (int32_t)(a->seq - b->seq) < 0;
+}
+
+static void i2c_bus_log_stats(void)
+{
+    for (int i = 0; i < I2C_BUS_MAX_DEVICES; i++) {
+        if (!s_devices[i].used) {
+            continue;
+        }
+        i2c_bus_dev_stats_t st;
+        i2c_bus_get_stats(i, &st);
+        if (st.transactions == 0) {
+            continue;
+        }
+        ESP_LOGI(
+                TAG,
+                "%s: %lu транзакций, среднее %lu мкс, макс %lu мкс, "
+                "ошибок %lu, таймаутов %lu, сбросов %lu",
+                s_devices[i].name,
+                (unsigned long)st.transactions,
+                (unsigned long)(st.total_us / st.transactions),
+                (unsigned long)st.max_us,
+                (unsigned long)st.errors,
+                (unsigned long)st.timeouts,
+                (unsigned long)st.bus_resets);
+    }
+}
+
+static void i2c_bus_task(void* arg)
+{
+    i2c_bus_txn_t batch[I2C_BUS_BATCH_MAX];
+    int64_t next_log_us = esp_timer_get_time() + STATS_LOG_PERIOD_US;
+
+    while (1) {
+        TickType_t wait = pdMS_TO_TICKS(I2C_BUS_STATS_LOG_S * 1000);
+        if (xQueueReceive(s_queue, &batch[0], wait) == pdTRUE) {
+            // Забираем всё, что уже накопилось, и сортируем вставками
+            int n = 1;
+            while (n < I2C_BUS_BATCH_MAX
+                   && xQueueReceive(s_queue, &batch[n], 0) == pdTRUE) {
+                i2c_bus_txn_t t = batch[n];
+                int j = n;
+                while (j > 0 && i2c_bus_before(&t, &batch[j - 1])) {
+                    batch[j] = batch[j - 1];
+                    j--;
+                }
+                batch[j] = t;
+                n++;
+            }
+
+            for (int i = 0; i < n; i++) {
+                i2c_bus_execute(&batch[i]);
+            }
+        }
+
+        if (esp_timer_get_time() >= next_log_us) {
+            i2c_bus_log_stats();
+            next_log_us = esp_timer_get_time() + STATS_LOG_PERIOD_US;
+        }
+    }
+}
+
+esp_err_t i2c_bus_init(const i2c_master_bus_config_t* config)
+{
+    if (s_bus != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (s_devices_lock == NULL) {
+        s_devices_lock = xSemaphoreCreateMutexStatic(&s_devices_lock_buf);
+    }
+
+    esp_err_t err = i2c_new_master_bus(config, &s_bus);
+    if (err != ESP_OK) {
+        s_bus = NULL;
+        return err;
+    }
+
+    // При ошибке ниже шина удаляется: s_bus != NULL значит «готова»,
+    // и повторный i2c_bus_init должен быть возможен
+    s_queue = xQueueCreate(I2C_BUS_QUEUE_LEN, sizeof(i2c_bus_txn_t));
+    if (s_queue == NULL) {
+        i2c_del_master_bus(s_bus);
+        s_bus = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+
+    if (xTaskCreatePinnedToCore(
+                i2c_bus_task,
+                "i2c_bus",
+                I2C_BUS_TASK_STACK,
+                NULL,
+                I2C_BUS_TASK_PRIO,
+                NULL,
+                0)
+        != pdPASS) {
+        vQueueDelete(s_queue);
+        s_queue = NULL;
+        i2c_del_master_bus(s_bus);
+        s_bus = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_bus_probe(uint8_t addr)
+{
+    if (s_bus == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    return i2c_master_probe(s_bus, addr, I2C_BUS_TIMEOUT_MS);
+}
+
+esp_err_t i2c_bus_add_device(
+        const char* name,
+        uint8_t addr,
+        uint32_t scl_speed_hz,
+        i2c_bus_prio_t prio,
+        i2c_bus_device_t** out_dev)
+{
+    if (s_bus == NULL || out_dev == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Без замка два потока находят один свободный слот и оба создают
+    // его семафоры; замок держится до used = true
+    xSemaphoreTake(s_devices_lock, portMAX_DELAY);
+    i2c_bus_device_t* dev = NULL;
+    for (int i = 0; i < I2C_BUS_MAX_DEVICES; i++) {
+        if (!s_devices[i].used) {
+            dev = &s_devices[i];
+            break;
+        }
+    }
+    if (dev == NULL) {
+        xSemaphoreGive(s_devices_lock);
+        return ESP_ERR_NO_MEM;
+    }
+
+    i2c_device_config_t dev_cfg = {
+            .dev_addr_length = I2C_ADDR_BIT_LEN_7,
+            .device_address = addr,
+            .scl_speed_hz = scl_speed_hz,
+    };
+
+    // Семафоры слота создаются один раз и переживают удаление
+    // устройства: lock ещё может ждать вызывающий со старым указателем
+    if (dev->lock == NULL) {
+        dev->lock = xSemaphoreCreateMutexStatic(&dev->lock_buf);
+        dev->done = xSemaphoreCreateBinaryStatic(&dev->done_buf);
+    }
+
+    xSemaphoreTake(dev->lock, portMAX_DELAY);
+    esp_err_t err = i2c_master_bus_add_device(s_bus, &dev_cfg, &dev->handle);
+    if (err == ESP_OK) {
+        dev->name = name;
+        dev->addr = addr;
+        dev->prio = prio;
+        dev->result = ESP_OK;
+        portENTER_CRITICAL(&s_stats_mux);
+        memset(&dev->stats, 0, sizeof(dev->stats));
+        portEXIT_CRITICAL(&s_stats_mux);
+        dev->used = true;
+        *out_dev = dev;
+    }
+    xSemaphoreGive(dev->lock);
+    xSemaphoreGive(s_devices_lock);
+    return err;
+}
+
+esp_err_t i2c_bus_remove_device(i2c_bus_device_t* dev)
+{
+    if (dev == NULL || !dev->used) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    // lock дожидается транзакции в полёте; ждущие его после удаления
+    // увидят used == false и получат ESP_ERR_INVALID_ARG
+    xSemaphoreTake(dev->lock, portMAX_DELAY);
+    esp_err_t err = ESP_ERR_INVALID_ARG;
+    if (dev->used) {
+        err = i2c_master_bus_rm_device(dev->handle);
+        dev->handle = NULL;
+        dev->used = false;
+    }
+    xSemaphoreGive(dev->lock);
+    return err;
+}
+
+esp_err_t i2c_bus_write_read(
+        i2c_bus_device_t* dev,
+        const uint8_t* tx,
+        size_t tx_len,
+        uint8_t* rx,
+        size_t rx_len)
+{
+    if (dev == NULL || !dev->used || tx == NULL || tx_len == 0
+        || (rx_len > 0 && rx == NULL)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    xSemaphoreTake(dev->lock, portMAX_DELAY);
+    if (!dev->used) {
+        // Устройство удалили, пока ждали lock
+        xSemaphoreGive(dev->lock);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    i2c_bus_txn_t txn = {
+            .dev = dev,
+            .tx = tx,
+            .tx_len = tx_len,
+            .rx = rx,
+            .rx_len = rx_len,
+    };
+    portENTER_CRITICAL(&s_stats_mux);
+    txn.seq = s_seq++;
+    portEXIT_CRITICAL(&s_stats_mux);
+
+    esp_err_t err;
+    if (xQueueSend(s_queue, &txn, pdMS_TO_TICKS(I2C_BUS_TIMEOUT_MS * 10))
+        != pdTRUE) {
+        err = ESP_ERR_TIMEOUT;
+    } else {
+        // Задача шины всегда завершает транзакцию за ограниченное время,
+        // а буферы живут на стеке вызывающего — ждём без таймаута
+        xSemaphoreTake(dev->done, portMAX_DELAY);
+        err = dev->result;
+    }
+
+    xSemaphoreGive(dev->lock);
+    return err;
+}
+
+esp_err_t i2c_bus_write(i2c_bus_device_t* dev, const uint8_t* tx, size_t len)
+{
+    return i2c_bus_write_read(dev, tx, len, NULL, 0);
+}
+
+int i2c_bus_device_count(void)
+{
+    return I2C_BUS_MAX_DEVICES;
+}
+
+const char* i2c_bus_device_name(int index)
+{
+    if (index < 0 || index >= I2C_BUS_MAX_DEVICES || !s_devices[index].used) {
+        return NULL;
+    }
+    return s_devices[index].name;
+}
+
+void i2c_bus_get_stats(int index, i2c_bus_dev_stats_t* out)
+{
+    memset(out, 0, sizeof(*out));
+    if (index < 0 || index >= I2C_BUS_MAX_DEVICES) {
+        return;
+    }
+    portENTER_CRITICAL(&s_stats_mux);
+    *out = s_devices[index].stats;
+    portEXIT_CRITICAL(&s_stats_mux);
+}
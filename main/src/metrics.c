@@ -0,0 +1,265 @@
+#include "metrics.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "esp_wifi.h"
+#include "i2c_bus.h"
+#include "sensor_sched.h"
+#include <stdarg.h>
+#include <stdio.h>
+
+#define LINE_LEN 192
+
+static atomic_uint s_counters[METRIC_COUNT];
+
+typedef struct {
+    const char* name;
+    const char* help;
+} metric_desc_t;
+
+static const metric_desc_t s_desc[METRIC_COUNT] = {
+        [METRIC_DHT_TIMEOUTS] = {"dht_timeouts_total", "DHT22 read timeouts"},
+        [METRIC_DHT_CHECKSUM_ERRORS]
+        = {"dht_checksum_errors_total", "DHT22 checksum failures"},
+        [METRIC_DHT_RANGE_ERRORS]
+        = {"dht_range_errors_total", "DHT22 values out of range"},
+        [METRIC_PMS_FRAMES] = {"pms_frames_total", "PMS5003 valid frames"},
+        [METRIC_PMS_CRC_ERRORS]
+        = {"pms_crc_errors_total", "PMS5003 frame checksum errors"},
+        [METRIC_PMS_RESYNCS]
+        = {"pms_resyncs_total", "PMS5003 frame start resynchronisations"},
+        [METRIC_PMS_TIMEOUTS] = {"pms_timeouts_total", "PMS5003 UART timeouts"},
+        [METRIC_TUNNEL_SESSIONS]
+        = {"tunnel_sessions_total", "Tunnel sessions established"},
+        [METRIC_TUNNEL_REQUESTS]
+        = {"tunnel_requests_total", "Requests proxied through the tunnel"},
+        [METRIC_TUNNEL_ERRORS]
+        = {"tunnel_errors_total", "Tunnel connect or handshake failures"},
+        [METRIC_MQTT_PUBLISHES]
+        = {"mqtt_publishes_total", "MQTT messages handed to the client"},
+        [METRIC_MQTT_DROPS]
+        = {"mqtt_drops_total", "MQTT messages rejected by the client"},
+        [METRIC_HTTP_BUSY]
+        = {"http_busy_total", "Requests answered 503, worker queue full"},
+};
+
+void metrics_inc(metric_id_t id)
+{
+    atomic_fetch_add_explicit(&s_counters[id], 1, memory_order_relaxed);
+}
+
+uint32_t metrics_get(metric_id_t id)
+{
+    return atomic_load_explicit(&s_counters[id], memory_order_relaxed);
+}
+
+void metrics_timer_record(metrics_timer_t* t, uint32_t us, bool ok)
+{
+    atomic_fetch_add_explicit(&t->count, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&t->sum_us, us, memory_order_relaxed);
+    if (!ok) {
+        atomic_fetch_add_explicit(&t->errors, 1, memory_order_relaxed);
+    }
+
+    unsigned max = atomic_load_explicit(&t->max_us, memory_order_relaxed);
+    while (us > max
+           && !atomic_compare_exchange_weak_explicit(
+                   &t->max_us,
+                   &max,
+                   us,
+                   memory_order_relaxed,
+                   memory_order_relaxed)) {
+    }
+}
+
+static void emitf(metrics_emit_fn emit, void* ctx, const char* fmt, ...)
+{
+    char line[LINE_LEN];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(line, sizeof(line), fmt, ap);
+    va_end(ap);
+    if (n > 0) {
+        size_t len = (size_t)n < sizeof(line) ? (size_t)n : sizeof(line) - 1;
+        emit(ctx, line, len);
+    }
+}
+
+static void emit_header(
+        metrics_emit_fn emit,
+        void* ctx,
+        const char* name,
+        const char* suffix,
+        const char* help,
+        const char* type)
+{
+    emitf(emit,
+          ctx,
+          "# HELP " METRICS_PREFIX "%s%s %s\n"
+          "# TYPE " METRICS_PREFIX "%s%s %s\n",
+          name,
+          suffix,
+          help,
+          name,
+          suffix,
+          type);
+}
+
+void metrics_write_timers(
+        metrics_emit_fn emit,
+        void* ctx,
+        const char* family,
+        const char* help,
+        const char* label,
+        metrics_timer_get_fn get,
+        int count)
+{
+    const char* name;
+    const metrics_timer_t* t;
+
+    emit_header(emit, ctx, family, "_seconds", help, "summary");
+    for (int i = 0; i < count; i++) {
+        if (!get(i, &name, &t)) {
+            continue;
+        }
+        emitf(emit,
+              ctx,
+              METRICS_PREFIX "%s_seconds_count{%s=\"%s\"} %u\n" METRICS_PREFIX
+                             "%s_seconds_sum{%s=\"%s\"} %.6f\n",
+              family,
+              label,
+              name,
+              atomic_load(&t->count),
+              family,
+              label,
+              name,
+              atomic_load(&t->sum_us) / 1e6);
+    }
+
+    emit_header(
+            emit, ctx, family, "_errors_total", "Failed operations", "counter");
+    for (int i = 0; i < count; i++) {
+        if (get(i, &name, &t)) {
+            emitf(emit,
+                  ctx,
+                  METRICS_PREFIX "%s_errors_total{%s=\"%s\"} %u\n",
+                  family,
+                  label,
+                  name,
+                  atomic_load(&t->errors));
+        }
+    }
+
+    emit_header(
+            emit, ctx, family, "_max_seconds", "Longest operation", "gauge");
+    for (int i = 0; i < count; i++) {
+        if (get(i, &name, &t)) {
+            emitf(emit,
+                  ctx,
+                  METRICS_PREFIX "%s_max_seconds{%s=\"%s\"} %.6f\n",
+                  family,
+                  label,
+                  name,
+                  atomic_load(&t->max_us) / 1e6);
+        }
+    }
+}
+
+static void write_i2c(metrics_emit_fn emit, void* ctx)
+{
+    static const char* const names[] = {
+            "i2c_transactions_total",
+            "i2c_errors_total",
+            "i2c_timeouts_total",
+            "i2c_bus_resets_total",
+    };
+    static const char* const help[] = {
+            "I2C transactions",
+            "I2C failed transactions",
+            "I2C transaction timeouts",
+            "I2C bus recoveries",
+    };
+
+    i2c_bus_dev_stats_t st[I2C_BUS_MAX_DEVICES];
+    for (int i = 0; i < I2C_BUS_MAX_DEVICES; i++) {
+        i2c_bus_get_stats(i, &st[i]);
+    }
+
+    for (int f = 0; f < 4; f++) {
+        emit_header(emit, ctx, names[f], "", help[f], "counter");
+        for (int i = 0; i < I2C_BUS_MAX_DEVICES; i++) {
+            const char* dev = i2c_bus_device_name(i);
+            if (dev == NULL) {
+                continue;
+            }
+            const uint32_t v[] = {
+                    st[i].transactions,
+                    st[i].errors,
+                    st[i].timeouts,
+                    st[i].bus_resets,
+            };
+            emitf(emit,
+                  ctx,
+                  METRICS_PREFIX "%s{device=\"%s\"} %lu\n",
+                  names[f],
+                  dev,
+                  (unsigned long)v[f]);
+        }
+    }
+}
+
+static void write_gauge(
+        metrics_emit_fn emit,
+        void* ctx,
+        const char* name,
+        const char* help,
+        double value)
+{
+    emit_header(emit, ctx, name, "", help, "gauge");
+    emitf(emit, ctx, METRICS_PREFIX "%s %.3f\n", name, value);
+}
+
+void metrics_write(metrics_emit_fn emit, void* ctx)
+{
+    for (int i = 0; i < METRIC_COUNT; i++) {
+        emit_header(emit, ctx, s_desc[i].name, "", s_desc[i].help, "counter");
+        emitf(emit,
+              ctx,
+              METRICS_PREFIX "%s %lu\n",
+              s_desc[i].name,
+              (unsigned long)metrics_get(i));
+    }
+
+    metrics_write_timers(
+            emit,
+            ctx,
+            "sensor_read",
+            "Sensor read duration",
+            "sensor",
+            sensor_sched_get_timer,
+            SENSOR_SCHED_MAX_DRIVERS);
+    write_i2c(emit, ctx);
+
+    write_gauge(
+            emit,
+            ctx,
+            "heap_free_bytes",
+            "Free heap",
+            esp_get_free_heap_size());
+    write_gauge(
+            emit,
+            ctx,
+            "heap_min_free_bytes",
+            "Minimum free heap since boot",
+            esp_get_minimum_free_heap_size());
+    write_gauge(
+            emit,
+            ctx,
+            "uptime_seconds",
+            "Time since boot",
+            esp_timer_get_time() / 1e6);
+
+    wifi_ap_record_t ap;
+    if (esp_wifi_sta_get_ap_info(&ap) == ESP_OK) {
+        write_gauge(emit, ctx, "wifi_rssi_dbm", "WiFi STA signal", ap.rssi);
+    }
+}
@@ -1,13 +1,72 @@
 #include <math.h>
 #include "adc.h"
+#include "esp_attr.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "gas_curve.h"
 #include "hal/adc_types.h"
 #include "mq135.h"
+#include "mq_baseline.h"
+#include "nvs.h"
 #include "sensor_data.h"
 static const char* TAG = "MQ_SENSOR";
 static float s_ro = RO_VALUE;
+static float s_saved_ro = RO_VALUE;
+// Окно базовой линии переживает deep sleep пакетного режима
+static RTC_DATA_ATTR mq_baseline_t s_baseline;
+static RTC_DATA_ATTR bool s_baseline_ready;
+static uint32_t s_uptime_offset_s;
+static uint32_t uptime_s(void)
+{
+return s_uptime_offset_s + (uint32_t)(esp_timer_get_time() / 1000000);
+}
+void mq135_set_uptime_offset(uint32_t offset_s)
+{
+s_uptime_offset_s = offset_s;
+}
+static void mq135_load_ro(void)
+{
+nvs_handle_t nvs;
+if (nvs_open(MQ_NVS_NAMESPACE, NVS_READONLY, &nvs) != ESP_OK) {
+ESP_LOGI(TAG, "Сохранённого Ro нет, используем Ro=%.1f", s_ro);
+return;
+}
+float ro;
+size_t len = sizeof(ro);
+if (nvs_get_blob(nvs, MQ_NVS_KEY_RO, &ro, &len) == ESP_OK && len == sizeof(ro)
+&& ro >= MQ_BASELINE_RO_MIN && ro <= MQ_BASELINE_RO_MAX) {
+s_ro = ro;
+s_saved_ro = ro;
+ESP_LOGI(TAG, "Ro загружен из NVS: %.1f", s_ro);
+}
+nvs_close(nvs);
+}
+static void mq135_save_ro(void)
+{
+nvs_handle_t nvs;
+esp_err_t err = nvs_open(MQ_NVS_NAMESPACE, NVS_READWRITE, &nvs);
+if (err == ESP_OK) {
+err = nvs_set_blob(nvs, MQ_NVS_KEY_RO, &s_ro, sizeof(s_ro));
+if (err == ESP_OK) err = nvs_commit(nvs);
+nvs_close(nvs);
+}
+if (err != ESP_OK) {
+ESP_LOGW(TAG, "Не удалось сохранить Ro: %s", esp_err_to_name(err));
+return;
+}
+s_saved_ro = s_ro;
+}
+static void mq135_track_baseline(float rs)
+{
+if (!mq_baseline_update(&s_baseline, rs, uptime_s())) return;
+s_ro = s_baseline.ro;
+ESP_LOGI(TAG, "Базовая линия: Rs max=%.1f, Ro=%.1f", s_baseline.window_max, s_ro);
+if (fabsf(s_ro - s_saved_ro) > s_saved_ro * MQ_RO_SAVE_THRESHOLD) {
+mq135_save_ro();
+}
+}
 static float read_voltage_avg(adc_channel_t channel, int samples)
 {
 float sum = 0;
@@ -22,22 +81,6 @@ static float voltage_to_rs(float vrl)
 if (vrl <= 0.01f) return INFINITY;
 return ((MQ_VCC - vrl) / vrl) * RL_VALUE;
 }
-static float clamp_ppm(float v, float lo, float hi)
-{
-if (isnan(v) || isinf(v)) return lo;
-if (v < lo) return lo;
-if (v > hi) return hi;
-return v;
-}
-static float ppm_from_ratio(float ratio, float a, float b, float lo, float hi)
-{
-return clamp_ppm(powf(ratio / b, 1.0f / a), lo, hi);
-}
-static float calculate_co2_ppm(float ratio)
-{
-float ppm = 400.0f * powf(ratio / RO_CLEAN_AIR_RATIO, -2.769f);
-return clamp_ppm(ppm, 0.0f, 5000.0f);
-}
 void mq135_calibrate(adc_channel_t channel)
 {
 float vrl = read_voltage_avg(channel, CALIBRATION_SAMPLE_TIMES);
@@ -48,27 +91,41 @@ return;
 }
 s_ro = rs / RO_CLEAN_AIR_RATIO;
 ESP_LOGI(TAG, "Калибровка: Vrl=%.3f Rs=%.1f Ro=%.1f", vrl, rs, s_ro);
+mq_baseline_init(&s_baseline, s_ro, uptime_s());
+s_baseline_ready = true;
+mq135_save_ro();
 }
-void mq_sensor_task(void* mq_params)
+esp_err_t mq135_driver_init(void* ctx)
 {
-mq_params_data_t* params = (mq_params_data_t*)mq_params;
+mq_params_data_t* params = (mq_params_data_t*)ctx;
 if (params == NULL) {
 ESP_LOGE(TAG, "Параметры датчика не переданы");
-vTaskDelete(NULL);
-return;
+return ESP_ERR_INVALID_ARG;
+}
+ESP_LOGI(TAG, "Датчик MQ, канал ADC: %d", params->channel);
+mq135_load_ro();
+// После deep sleep окно продолжается; Ro из NVS мог отстать от него
+if (s_baseline_ready) {
+s_ro = s_baseline.ro;
+} else {
+mq_baseline_init(&s_baseline, s_ro, uptime_s());
+s_baseline_ready = true;
+}
+return ESP_OK;
 }
-ESP_LOGI(TAG, "Задача датчика MQ запущена, канал ADC: %d", params->channel);
-while (1) {
+esp_err_t mq135_driver_read(void* ctx)
+{
+mq_params_data_t* params = (mq_params_data_t*)ctx;
 int raw_adc = read_adc_raw(params->channel);
 float voltage = read_voltage_avg(params->channel, 10);
 float rs = voltage_to_rs(voltage);
+if (uptime_s() >= MQ_WARMUP_S) {
+mq135_track_baseline(rs);
+}
 float ratio = rs / s_ro;
 ESP_LOGI(TAG, "Vrl=%.3f Rs=%.1f ratio=%.2f", voltage, rs, ratio);
-float co2_ppm = calculate_co2_ppm(ratio);
-float co_ppm = ppm_from_ratio(ratio, -0.229115f, 4.98267f, 0.0f, 1000.0f);
-float nh3_ppm = ppm_from_ratio(ratio, -0.41162f, 6.6564f, 0.0f, 300.0f);
-float lpg_ppm = ppm_from_ratio(ratio, -0.30219f, 3.00802f, 0.0f, 1000.0f);
-sensor_data_set_mq(raw_adc, voltage, ratio, co2_ppm, lpg_ppm, co_ppm, nh3_ppm);
-vTaskDelay(pdMS_TO_TICKS(params->task_delay_s * 1000));
-}
+float ppm[GAS_COUNT];
+gas_curve_eval_all(ratio, ppm);
+sensor_data_set_mq(raw_adc, voltage, ratio, ppm[GAS_CO2], ppm[GAS_LPG], ppm[GAS_CO], ppm[GAS_NH3]);
+return ESP_OK;
 }
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include "mq_baseline.h"
+#include "mq135.h"
+#include <math.h>
+#include <string.h>
+
+void mq_baseline_init(mq_baseline_t* b, float ro, uint32_t now_s)
+{
+    memset(b, 0, sizeof(*b));
+    b->ro = ro;
+    b->bucket_start_s = now_s;
+}
+
+static bool mq_baseline_roll(mq_baseline_t* b, uint32_t now_s)
+{
+    uint32_t elapsed = (now_s - b->bucket_start_s) / MQ_BASELINE_BUCKET_S;
+    if (elapsed == 0) {
+        return false;
+    }
+
+    // Пропущенные часы (например, задача стояла) дают пустые корзины
+    uint32_t steps = elapsed < MQ_BASELINE_BUCKETS ? elapsed
+                                                    : MQ_BASELINE_BUCKETS;
+    for (uint32_t i = 0; i < steps; i++) {
+        b->head = (b->head + 1) % MQ_BASELINE_BUCKETS;
+        b->bucket_max[b->head] = 0.0f;
+    }
+    b->bucket_start_s += elapsed * MQ_BASELINE_BUCKET_S;
+
+    // Считаются только корзины с отсчётами: после долгого перерыва окно
+    // снова набирается с нуля
+    b->window_max = 0.0f;
+    b->filled = 0;
+    for (int i = 0; i < MQ_BASELINE_BUCKETS; i++) {
+        if (b->bucket_max[i] > 0.0f) {
+            b->filled++;
+        }
+        if (b->bucket_max[i] > b->window_max) {
+            b->window_max = b->bucket_max[i];
+        }
+    }
+
+    if (b->filled < MQ_BASELINE_MIN_BUCKETS || b->window_max <= 0.0f) {
+        return false;
+    }
+
+    float target = b->window_max / RO_CLEAN_AIR_RATIO;
+    if (target < MQ_BASELINE_RO_MIN || target > MQ_BASELINE_RO_MAX) {
+        return false;
+    }
+
+    b->ro += MQ_BASELINE_ALPHA * (target - b->ro);
+    return true;
+}
+
+bool mq_baseline_update(mq_baseline_t* b, float rs, uint32_t now_s)
+{
+    bool changed = mq_baseline_roll(b, now_s);
+
+    if (isfinite(rs) && rs > 0.0f && rs > b->bucket_max[b->head]) {
+        b->bucket_max[b->head] = rs;
+    }
+
+    return changed;
+}
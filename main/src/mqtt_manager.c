@@ -1,8 +1,16 @@
 #include "mqtt_manager.h"
+#include "config.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/task.h"
+#include "metrics.h"
 #include "mqtt_client.h"
+#include "rules.h"
 #include "sensor_data.h"
+#include "sensor_stats.h"
+#include "wifi_manager.h"
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 static const char* TAG = "MQTT_MGR";
@@ -11,9 +19,82 @@ static const char* TAG = "MQTT_MGR";
 #define MQTT_USERNAME "meteo"
 #define MQTT_PASSWORD "xvtZQo-5GiCaDX"
 #define MQTT_CLIENT_ID "esp32_meteo"
+// Payload команды с нулём: все ключи home/config/set сразу — около
+// 150 байт
+#define MQTT_COMMAND_MAX 256
 
 static esp_mqtt_client_handle_t s_client = NULL;
 static bool s_connected = false;
+static portMUX_TYPE s_pending_mux = portMUX_INITIALIZER_UNLOCKED;
+static int s_pending = 0; // публикаций QoS 1 без PUBACK
+static TaskHandle_t s_publish_task = NULL;
+static int64_t s_connected_us = 0; // первое подключение от старта
+static bool s_published = false;   // первая публикация уже была
+
+// Все публикации идут через эту обёртку ради счётчиков /metrics
+static int mqtt_publish_counted(
+        esp_mqtt_client_handle_t client,
+        const char* topic,
+        const char* data,
+        int len,
+        int qos,
+        int retain)
+{
+    int id = esp_mqtt_client_publish(client, topic, data, len, qos, retain);
+    metrics_inc(id >= 0 ? METRIC_MQTT_PUBLISHES : METRIC_MQTT_DROPS);
+    return id;
+}
+
+static bool topic_is(esp_mqtt_event_handle_t event, const char* topic)
+{
+    return event->topic_len == (int)strlen(topic)
+        && strncmp(event->topic, topic, event->topic_len) == 0;
+}
+
+static void mqtt_handle_command(esp_mqtt_event_handle_t event)
+{
+    char payload[MQTT_COMMAND_MAX];
+    if (event->data_len <= 0) {
+        return;
+    }
+    if (event->data_len >= (int)sizeof(payload)) {
+        ESP_LOGW(TAG,
+                 "Команда %.*s отклонена: %d байт, не больше %d",
+                 event->topic_len,
+                 event->topic,
+                 event->data_len,
+                 (int)sizeof(payload) - 1);
+        return;
+    }
+    memcpy(payload, event->data, event->data_len);
+    payload[event->data_len] = '\0';
+
+    esp_err_t err = ESP_OK;
+    if (topic_is(event, "home/fan/set")) {
+        // "on" / "off" / "auto"
+        char query[sizeof("mode=") + MQTT_COMMAND_MAX];
+        snprintf(query, sizeof(query), "mode=%s", payload);
+        err = rules_apply_query(query);
+    } else if (topic_is(event, "home/rules/set")) {
+        // "id=0&metric=pm2_5&on=35&off=25&n=3&m=3&enabled=1"
+        err = rules_apply_query(payload);
+    } else if (topic_is(event, "home/config/set")) {
+        // "mqtt_period_ms=60000&dht_period_ms=2000"
+        err = config_apply_query(payload);
+        if (err == ESP_OK) {
+            mqtt_publish_config();
+        }
+    } else if (topic_is(event, "home/thresholds/pm25")) {
+        char* end;
+        float value = strtof(payload, &end);
+        err = end == payload ? ESP_ERR_INVALID_ARG
+                             : rules_set_threshold(STATS_PM2_5, value);
+    }
+
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "Команда отклонена: %s", esp_err_to_name(err));
+    }
+}
 
 static void mqtt_event_handler(
         void* arg, esp_event_base_t base, int32_t event_id, void* event_data)
@@ -25,11 +106,22 @@ static void mqtt_event_handler(
         s_connected = true;
         ESP_LOGI(TAG, "Подключён к брокеру");
 
-        esp_mqtt_client_publish(
+        mqtt_publish_counted(
                 s_client, "home/sensors/status", "online", 0, 1, true);
 
         esp_mqtt_client_subscribe(s_client, "home/fan/set", 1);
         esp_mqtt_client_subscribe(s_client, "home/thresholds/pm25", 1);
+        esp_mqtt_client_subscribe(s_client, "home/rules/set", 1);
+        esp_mqtt_client_subscribe(s_client, "home/config/set", 1);
+        mqtt_publish_config();
+
+        // Свежие данные сразу после подключения, не через период
+        if (s_connected_us == 0) {
+            s_connected_us = esp_timer_get_time();
+        }
+        if (s_publish_task != NULL) {
+            xTaskNotifyGive(s_publish_task);
+        }
         break;
 
     case MQTT_EVENT_DISCONNECTED:
@@ -37,6 +129,14 @@ static void mqtt_event_handler(
         ESP_LOGW(TAG, "Отключён от брокера, переподключение...");
         break;
 
+    case MQTT_EVENT_PUBLISHED:
+        portENTER_CRITICAL(&s_pending_mux);
+        if (s_pending > 0) {
+            s_pending--;
+        }
+        portEXIT_CRITICAL(&s_pending_mux);
+        break;
+
     case MQTT_EVENT_DATA:
         ESP_LOGI(
                 TAG,
@@ -45,6 +145,7 @@ static void mqtt_event_handler(
                 event->topic,
                 event->data_len,
                 event->data);
+        mqtt_handle_command(event);
         break;
 
     case MQTT_EVENT_ERROR:
@@ -91,7 +192,7 @@ esp_err_t mqtt_publish_float(const char* topic, const char* key, float value)
         return ESP_ERR_INVALID_STATE;
     char buf[64];
     snprintf(buf, sizeof(buf), "{\"%s\": %.2f}", key, value);
-    int msg_id = esp_mqtt_client_publish(s_client, topic, buf, 0, 0, false);
+    int msg_id = mqtt_publish_counted(s_client, topic, buf, 0, 0, false);
     return (msg_id >= 0) ? ESP_OK : ESP_FAIL;
 }
 
@@ -107,7 +208,7 @@ esp_err_t mqtt_publish_pm(uint16_t pm1_0, uint16_t pm2_5, uint16_t pm10)
             pm1_0,
             pm2_5,
             pm10);
-    int id = esp_mqtt_client_publish(
+    int id = mqtt_publish_counted(
             s_client, "home/sensors/pm25", buf, 0, 0, false);
     return (id >= 0) ? ESP_OK : ESP_FAIL;
 }
@@ -125,11 +226,164 @@ esp_err_t mqtt_publish_gases(float co2, float co, float nh3, float lpg)
             co,
             nh3,
             lpg);
-    int id = esp_mqtt_client_publish(
+    int id = mqtt_publish_counted(
             s_client, "home/sensors/air_quality", buf, 0, 0, false);
     return (id >= 0) ? ESP_OK : ESP_FAIL;
 }
 
+esp_err_t mqtt_publish_derived(void)
+{
+    if (!s_connected)
+        return ESP_ERR_INVALID_STATE;
+
+    derived_metrics_t d;
+    sensor_data_get_derived(&d);
+
+    char buf[256];
+    int len = snprintf(
+            buf,
+            sizeof(buf),
+            "{\"air_level\":%u,\"air_label\":\"%s\"",
+            d.air_level,
+            derived_air_level_label(d.air_level));
+    if (d.humidity_valid && sensor_data_is_fresh(SENSOR_DHT)) {
+        len += snprintf(
+                buf + len,
+                sizeof(buf) - len,
+                ",\"dew_point\":%.2f,\"abs_humidity\":%.2f,"
+                "\"heat_index\":%.2f",
+                d.dew_point,
+                d.abs_humidity,
+                d.heat_index);
+    }
+    if (d.pressure_valid && sensor_data_is_fresh(SENSOR_BMP)) {
+        len += snprintf(
+                buf + len,
+                sizeof(buf) - len,
+                ",\"pressure_sea\":%.2f",
+                d.sea_level_pressure);
+    }
+    if (d.aqi != DERIVED_AQI_NONE && sensor_data_is_fresh(SENSOR_PMS)) {
+        len += snprintf(
+                buf + len,
+                sizeof(buf) - len,
+                ",\"aqi\":%d,\"aqi_category\":%u,\"aqi_label\":\"%s\"",
+                d.aqi,
+                d.aqi_category,
+                derived_aqi_label(d.aqi_category));
+    }
+    if ((size_t)len + 1 >= sizeof(buf))
+        return ESP_ERR_NO_MEM;
+    buf[len++] = '}';
+    buf[len] = '\0';
+
+    int id = mqtt_publish_counted(
+            s_client, "home/sensors/derived", buf, len, 0, false);
+    return (id >= 0) ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t mqtt_publish_forecast(void)
+{
+    if (!s_connected)
+        return ESP_ERR_INVALID_STATE;
+
+    pressure_trend_t t;
+    sensor_data_get_trend(&t);
+    if (!t.valid)
+        return ESP_ERR_INVALID_STATE;
+
+    char buf[256];
+    int len = snprintf(
+            buf,
+            sizeof(buf),
+            "{\"delta_3h\":%.2f,\"tendency\":%d,\"zambretti\":%u,"
+            "\"text\":\"%s\"}",
+            t.delta_3h_hpa,
+            t.tendency,
+            t.zambretti,
+            pressure_trend_forecast_text(t.zambretti));
+    if ((size_t)len >= sizeof(buf))
+        return ESP_ERR_NO_MEM;
+
+    int id = mqtt_publish_counted(
+            s_client, "home/sensors/forecast", buf, len, 0, false);
+    return (id >= 0) ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t mqtt_publish_latency(void)
+{
+    if (!s_connected)
+        return ESP_ERR_INVALID_STATE;
+
+    char buf[192];
+    buf[0] = '{';
+    int len = sensor_data_format_stamps(buf + 1, sizeof(buf) - 2);
+    if (len < 0 || (size_t)len >= sizeof(buf) - 2)
+        return ESP_ERR_NO_MEM;
+    len++;
+    buf[len++] = '}';
+    buf[len] = '\0';
+
+    int id = mqtt_publish_counted(
+            s_client, "home/sensors/latency", buf, len, 0, false);
+    return (id >= 0) ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t mqtt_publish_stats(stats_window_t window)
+{
+    if (!s_connected)
+        return ESP_ERR_INVALID_STATE;
+
+    // Скользящее окно: среднее/разброс/экстремумы между публикациями.
+    // Вызывается только из задачи публикации, буфер статический.
+    static char buf[1536];
+    int pos = snprintf(
+            buf,
+            sizeof(buf),
+            "{\"window\":\"%s\"",
+            sensor_stats_window_name(window));
+    for (int m = 0; m < STATS_METRIC_COUNT && (size_t)pos < sizeof(buf);
+         m++) {
+        sensor_stats_t st;
+        sensor_stats_get(m, window, true, &st);
+        pos += snprintf(
+                buf + pos,
+                sizeof(buf) - pos,
+                ",\"%s\":",
+                sensor_stats_metric_name(m));
+        if ((size_t)pos >= sizeof(buf))
+            break;
+        pos += sensor_stats_format(&st, buf + pos, sizeof(buf) - pos);
+    }
+    if ((size_t)pos + 1 >= sizeof(buf)) {
+        ESP_LOGE(TAG, "Статистика не поместилась в буфер");
+        return ESP_ERR_NO_MEM;
+    }
+    buf[pos++] = '}';
+    buf[pos] = '\0';
+
+    int id = mqtt_publish_counted(
+            s_client, "home/sensors/stats", buf, pos, 0, false);
+    return (id >= 0) ? ESP_OK : ESP_FAIL;
+}
+
+// Разбивка времени от старта до первой публикации для сравнения
+// между прошивками
+static void log_first_publish(void)
+{
+    wifi_manager_timing_t t;
+    wifi_manager_get_timing(&t);
+    int64_t now = esp_timer_get_time();
+    ESP_LOGI(
+            TAG,
+            "От старта до первой публикации %lld мс: IP %lld, "
+            "брокер +%lld, публикация +%lld",
+            (long long)(now / 1000),
+            (long long)(t.ip_us / 1000),
+            (long long)(s_connected_us - t.ip_us) / 1000,
+            (long long)(now - s_connected_us) / 1000);
+}
+
 esp_err_t mqtt_publish_all(void)
 {
     if (!s_connected) {
@@ -147,31 +401,130 @@ esp_err_t mqtt_publish_all(void)
 
     float co2, lpg, co, nh3;
     sensor_data_get_mq(&co2, &lpg, &co, &nh3);
+    bool mq_fresh = sensor_data_is_fresh(SENSOR_MQ);
 
     uint16_t pm1_0, pm2_5, pm10;
     uint8_t pms_valid;
     sensor_data_get_pms5003(&pm1_0, &pm2_5, &pm10, &pms_valid);
 
-    float temperature = sensor_data_get_temp_avg();
-    mqtt_publish_float("home/sensors/temperature", "value", temperature);
-    mqtt_publish_float("home/sensors/humidity", "value", humidity);
-    mqtt_publish_float("home/sensors/pressure", "value", pressure);
-    mqtt_publish_float("home/sensors/co2", "value", co2);
+    float temperature, temp_confidence;
+    sensor_data_get_temp_fused(&temperature, &temp_confidence);
+    char temp_buf[64];
+    snprintf(
+            temp_buf,
+            sizeof(temp_buf),
+            "{\"value\": %.2f, \"confidence\": %.2f}",
+            temperature,
+            temp_confidence);
+    mqtt_publish_counted(
+            s_client, "home/sensors/temperature", temp_buf, 0, 0, false);
+    if (dht_valid) {
+        mqtt_publish_float("home/sensors/humidity", "value", humidity);
+    }
+    if (bmp_valid) {
+        mqtt_publish_float("home/sensors/pressure", "value", pressure);
+    }
+    if (mq_fresh) {
+        mqtt_publish_float("home/sensors/co2", "value", co2);
+    }
 
     if (pms_valid) {
         mqtt_publish_pm(pm1_0, pm2_5, pm10);
     }
-    mqtt_publish_gases(co2, co, nh3, lpg);
+    if (mq_fresh) {
+        mqtt_publish_gases(co2, co, nh3, lpg);
+    }
+    // Возраст выборок в момент публикации — задержка от снятия до MQTT
+    mqtt_publish_latency();
+    mqtt_publish_derived();
+    mqtt_publish_forecast();
+    mqtt_publish_stats(STATS_WIN_15M);
 
     ESP_LOGI(TAG, "Все данные опубликованы в MQTT");
+    if (!s_published) {
+        s_published = true;
+        log_first_publish();
+    }
     return ESP_OK;
 }
+esp_err_t mqtt_publish_config(void)
+{
+    if (!s_connected)
+        return ESP_ERR_INVALID_STATE;
+
+    char buf[640];
+    int len = config_format(buf, sizeof(buf));
+    if (len < 0 || (size_t)len >= sizeof(buf))
+        return ESP_ERR_NO_MEM;
+
+    int id = mqtt_publish_counted(s_client, "home/config", buf, len, 1, true);
+    return (id >= 0) ? ESP_OK : ESP_FAIL;
+}
+
 void mqtt_publish_task(void* arg)
 {
+    // Смена периода будит задачу: публикация сразу и дальше по новому
+    config_set_listener(
+            CONFIG_MQTT_PERIOD_MS,
+            config_notify_task,
+            xTaskGetCurrentTaskHandle());
+    // Подключение к брокеру тоже будит задачу. Первые 5 с датчики
+    // снимают первые выборки; уведомление за это время не нужно.
     vTaskDelay(pdMS_TO_TICKS(5000));
+    s_publish_task = xTaskGetCurrentTaskHandle();
 
     while (1) {
         mqtt_publish_all();
-        vTaskDelay(pdMS_TO_TICKS(300001));
+        ulTaskNotifyTake(
+                pdTRUE, pdMS_TO_TICKS(config_get(CONFIG_MQTT_PERIOD_MS)));
+    }
+}
+
+esp_err_t mqtt_publish_batch(const char* payload, size_t len)
+{
+    if (!s_connected)
+        return ESP_ERR_INVALID_STATE;
+
+    portENTER_CRITICAL(&s_pending_mux);
+    s_pending++;
+    portEXIT_CRITICAL(&s_pending_mux);
+
+    int id = mqtt_publish_counted(
+            s_client, "home/sensors/batch", payload, (int)len, 1, false);
+    if (id < 0) {
+        portENTER_CRITICAL(&s_pending_mux);
+        s_pending--;
+        portEXIT_CRITICAL(&s_pending_mux);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+bool mqtt_manager_wait_published(uint32_t timeout_ms)
+{
+    TickType_t start = xTaskGetTickCount();
+
+    while (1) {
+        portENTER_CRITICAL(&s_pending_mux);
+        int pending = s_pending;
+        portEXIT_CRITICAL(&s_pending_mux);
+        if (pending == 0) {
+            return true;
+        }
+        if (xTaskGetTickCount() - start >= pdMS_TO_TICKS(timeout_ms)) {
+            return false;
+        }
+        vTaskDelay(pdMS_TO_TICKS(50));
+    }
+}
+
+void mqtt_manager_stop(void)
+{
+    if (s_client == NULL) {
+        return;
     }
+    esp_mqtt_client_stop(s_client);
+    esp_mqtt_client_destroy(s_client);
+    s_client = NULL;
+    s_connected = false;
 }
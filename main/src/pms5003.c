@@ -1,10 +1,13 @@
 #include "pms5003.h"
+#include "metrics.h"
+#include "power.h"
 #include "sensor_data.h"
+#include "sdkconfig.h"
 
+#include "driver/gpio.h"
 #include "driver/uart.h"
 #include "esp_log.h"
 #include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
 
 static const char* TAG = "PMS5003";
 
@@ -16,7 +19,13 @@ static esp_err_t pms5003_uart_init(int tx_gpio, int rx_gpio)
             .parity = UART_PARITY_DISABLE,
             .stop_bits = UART_STOP_BITS_1,
             .flow_ctrl = UART_HW_FLOWCTRL_DISABLE,
+#if CONFIG_PM_ENABLE
+            // REF_TICK не зависит от частоты APB, и драйвер UART
+            // не держит блокировку питания всё время работы
+            .source_clk = UART_SCLK_REF_TICK,
+#else
             .source_clk = UART_SCLK_DEFAULT,
+#endif
     };
 
     esp_err_t err;
@@ -84,20 +93,28 @@ static esp_err_t pms5003_parse(const uint8_t* buf, pms5003_data_t* out)
 static esp_err_t pms5003_read_frame(uint8_t* frame_buf)
 {
     uint8_t byte;
+    int skipped = 0;
 
     while (1) {
         int n = uart_read_bytes(
                 PMS5003_UART_PORT, &byte, 1, pdMS_TO_TICKS(2000));
         if (n <= 0) {
             ESP_LOGW(TAG, "Таймаут ожидания данных от датчика");
+            metrics_inc(METRIC_PMS_TIMEOUTS);
             return ESP_ERR_TIMEOUT;
         }
         if (byte == PMS5003_START1)
             break;
+        skipped++;
+    }
+    // Начали с середины кадра — подстройка под начало следующего
+    if (skipped > 0) {
+        metrics_inc(METRIC_PMS_RESYNCS);
     }
 
     int n = uart_read_bytes(PMS5003_UART_PORT, &byte, 1, pdMS_TO_TICKS(100));
     if (n <= 0 || byte != PMS5003_START2) {
+        metrics_inc(METRIC_PMS_RESYNCS);
         return ESP_ERR_INVALID_RESPONSE;
     }
 
@@ -119,9 +136,9 @@ static esp_err_t pms5003_read_frame(uint8_t* frame_buf)
     return ESP_OK;
 }
 
-void pms5003_task(void* pvParameters)
+esp_err_t pms5003_driver_init(void* ctx)
 {
-    pms_params_data_t* params = (pms_params_data_t*)pvParameters;
+    pms_params_data_t* params = (pms_params_data_t*)ctx;
 
     ESP_LOGI(
             TAG,
@@ -130,45 +147,72 @@ void pms5003_task(void* pvParameters)
             params->rx_gpio,
             PMS5003_UART_BAUD);
 
-    if (pms5003_uart_init(params->tx_gpio, params->rx_gpio) != ESP_OK) {
-        ESP_LOGE(TAG, "Не удалось инициализировать UART. Задача завершена.");
-        vTaskDelete(NULL);
-        return;
+    if (uart_is_driver_installed(PMS5003_UART_PORT)) {
+        uart_driver_delete(PMS5003_UART_PORT);
     }
 
-    ESP_LOGI(
-            TAG,
-            "PMS5003 запущен, интервал %lu с",
-            (unsigned long)params->task_delay_s);
+    esp_err_t err = pms5003_uart_init(params->tx_gpio, params->rx_gpio);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Не удалось инициализировать UART");
+        return err;
+    }
 
-    vTaskDelay(pdMS_TO_TICKS(30000));
+    // Мог остаться усыплённым после режима глубокого сна
+    if (params->set_gpio >= 0) {
+        pms5003_set_active(params, true);
+    }
+    return ESP_OK;
+}
 
-    uint8_t frame[PMS5003_FRAME_LEN];
-    pms5003_data_t data;
+esp_err_t pms5003_set_active(const pms_params_data_t* params, bool active)
+{
+    if (params->set_gpio < 0) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
 
-    while (1) {
-        esp_err_t err = pms5003_read_frame(frame);
-        if (err != ESP_OK) {
-            ESP_LOGW(TAG, "Ошибка чтения кадра: %s", esp_err_to_name(err));
-            vTaskDelay(pdMS_TO_TICKS(params->task_delay_s * 1000));
-            continue;
-        }
+    gpio_num_t pin = (gpio_num_t)params->set_gpio;
+    gpio_hold_dis(pin);
+    gpio_set_direction(pin, GPIO_MODE_OUTPUT);
+    esp_err_t err = gpio_set_level(pin, active ? 1 : 0);
+    if (err != ESP_OK) {
+        return err;
+    }
 
-        err = pms5003_parse(frame, &data);
-        if (err != ESP_OK) {
-            vTaskDelay(pdMS_TO_TICKS(params->task_delay_s * 1000));
-            continue;
-        }
+    // Без удержания вывод в deep sleep отпускается и датчик просыпается
+    gpio_hold_en(pin);
+    gpio_deep_sleep_hold_en();
+    return ESP_OK;
+}
 
-        ESP_LOGI(
-                TAG,
-                "PM1.0=%u  PM2.5=%u  PM10=%u  мкг/м³",
-                data.pm1_0,
-                data.pm2_5,
-                data.pm10);
+esp_err_t pms5003_driver_read(void* ctx)
+{
+    uint8_t frame[PMS5003_FRAME_LEN];
+    pms5003_data_t data;
 
-        sensor_data_set_pms5003(&data);
+    // Датчик шлёт кадры непрерывно, между опросами буфер UART
+    // заполняется устаревшими кадрами — берём следующий свежий
+    power_lock_acquire(POWER_LOCK_PMS);
+    uart_flush_input(PMS5003_UART_PORT);
+    esp_err_t err = pms5003_read_frame(frame);
+    power_lock_release(POWER_LOCK_PMS);
+    if (err != ESP_OK) {
+        return err;
+    }
 
-        vTaskDelay(pdMS_TO_TICKS(params->task_delay_s * 1000));
+    err = pms5003_parse(frame, &data);
+    if (err != ESP_OK) {
+        metrics_inc(METRIC_PMS_CRC_ERRORS);
+        return err;
     }
+    metrics_inc(METRIC_PMS_FRAMES);
+
+    ESP_LOGI(
+            TAG,
+            "PM1.0=%u  PM2.5=%u  PM10=%u  мкг/м³",
+            data.pm1_0,
+            data.pm2_5,
+            data.pm10);
+
+    sensor_data_set_pms5003(&data);
+    return ESP_OK;
 }
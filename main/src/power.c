@@ -0,0 +1,100 @@
+#include "power.h"
+#include "esp_log.h"
+#include "sdkconfig.h"
+
+#if CONFIG_PM_ENABLE
+#include "esp_pm.h"
+#endif
+
+static const char* TAG = "POWER";
+
+static power_mode_t s_mode = POWER_MODE_PERFORMANCE;
+
+#if CONFIG_PM_ENABLE
+typedef struct {
+    esp_pm_lock_type_t type;
+    const char* name;
+} power_lock_def_t;
+
+// DHT22 меряет длительность импульсов по esp_timer в цикле опроса,
+// поэтому держит максимальную частоту CPU. UART и SPI тактируются
+// от APB, а в light sleep UART не принимает данные.
+static const power_lock_def_t s_lock_defs[POWER_LOCK_COUNT] = {
+        [POWER_LOCK_DHT] = {ESP_PM_CPU_FREQ_MAX, "dht22"},
+        [POWER_LOCK_PMS] = {ESP_PM_NO_LIGHT_SLEEP, "pms5003"},
+        [POWER_LOCK_DISPLAY] = {ESP_PM_APB_FREQ_MAX, "display"},
+        [POWER_LOCK_HTTP] = {ESP_PM_NO_LIGHT_SLEEP, "httpd"},
+};
+
+static esp_pm_lock_handle_t s_locks[POWER_LOCK_COUNT];
+#endif
+
+esp_err_t power_init(power_mode_t mode)
+{
+#if CONFIG_PM_ENABLE
+    for (int i = 0; i < POWER_LOCK_COUNT; i++) {
+        esp_err_t err = esp_pm_lock_create(
+                s_lock_defs[i].type, 0, s_lock_defs[i].name, &s_locks[i]);
+        if (err != ESP_OK) {
+            return err;
+        }
+    }
+
+    esp_pm_config_t config = {
+            .max_freq_mhz = POWER_CPU_MAX_MHZ,
+            .min_freq_mhz = mode == POWER_MODE_PERFORMANCE ? POWER_CPU_MAX_MHZ
+                                                           : POWER_CPU_MIN_MHZ,
+            .light_sleep_enable = mode == POWER_MODE_LIGHT_SLEEP,
+    };
+
+#if !CONFIG_FREERTOS_USE_TICKLESS_IDLE
+    if (config.light_sleep_enable) {
+        ESP_LOGW(TAG, "Tickless idle выключен, light sleep недоступен");
+        config.light_sleep_enable = false;
+    }
+#endif
+
+    esp_err_t err = esp_pm_configure(&config);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "esp_pm_configure: %s", esp_err_to_name(err));
+        return err;
+    }
+
+    s_mode = mode;
+    ESP_LOGI(
+            TAG,
+            "CPU %d..%d МГц, light sleep %s",
+            config.min_freq_mhz,
+            config.max_freq_mhz,
+            config.light_sleep_enable ? "вкл" : "выкл");
+    return ESP_OK;
+#else
+    if (mode != POWER_MODE_PERFORMANCE) {
+        ESP_LOGW(TAG, "CONFIG_PM_ENABLE выключен, режим питания не применён");
+    }
+    return ESP_OK;
+#endif
+}
+
+power_mode_t power_get_mode(void)
+{
+    return s_mode;
+}
+
+void power_lock_acquire(power_lock_t lock)
+{
+#if CONFIG_PM_ENABLE
+    if (s_locks[lock] != NULL) {
+        esp_pm_lock_acquire(s_locks[lock]);
+    }
+#endif
+}
+
+void power_lock_release(power_lock_t lock)
+{
+#if CONFIG_PM_ENABLE
+    if (s_locks[lock] != NULL) {
+        esp_pm_lock_release(s_locks[lock]);
+    }
+#endif
+}
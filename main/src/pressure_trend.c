@@ -0,0 +1,224 @@
+#include "pressure_trend.h"
+#include <math.h>
+#include <string.h>
+
+#define HPA_PER_MMHG 1.333224f
+
+static const char* const s_forecast_text[33] = {
+        "",
+        // Падает
+        "Устойчиво ясно",
+        "Ясно",
+        "Ясно, становится неустойчиво",
+        "Довольно ясно, позже ливни",
+        "Ливни, неустойчиво",
+        "Неустойчиво, позже дождь",
+        "Временами дождь, ухудшение",
+        "Временами дождь, очень неустойчиво",
+        "Очень неустойчиво, дождь",
+        // Устойчиво
+        "Устойчиво ясно",
+        "Ясно",
+        "Ясно, возможны ливни",
+        "Довольно ясно, вероятны ливни",
+        "Ливни с прояснениями",
+        "Переменчиво, местами дождь",
+        "Неустойчиво, временами дождь",
+        "Частые дожди",
+        "Очень неустойчиво, дождь",
+        "Шторм, сильный дождь",
+        // Растёт
+        "Устойчиво ясно",
+        "Ясно",
+        "Прояснение",
+        "Довольно ясно, улучшение",
+        "Довольно ясно, утром возможны ливни",
+        "Утром ливни, улучшение",
+        "Переменчиво, улучшение",
+        "Довольно неустойчиво, позже прояснение",
+        "Неустойчиво, вероятно улучшение",
+        "Неустойчиво, короткие прояснения",
+        "Очень неустойчиво, временами ясно",
+        "Шторм, возможно улучшение",
+        "Шторм, сильный дождь",
+};
+
+#define F FORECAST_FAIR
+#define C FORECAST_CHANGEABLE
+#define R FORECAST_RAIN
+#define S FORECAST_STORM
+static const uint8_t s_forecast_kind[33] = {
+        C,
+        F, F, F, C, C, R, R, R, R,    // падает
+        F, F, C, C, C, R, R, R, R, S, // устойчиво
+        F, F, F, F, C, C, C, C, C, C, R, S, S, // растёт
+};
+#undef F
+#undef C
+#undef R
+#undef S
+
+static float ring_at(const pressure_trend_t* t, int k)
+{
+    return t->ring[(t->head + k) % PRESSURE_TREND_BUCKETS];
+}
+
+static void rebuild_sums(pressure_trend_t* t)
+{
+    t->sum_y = 0.0f;
+    t->sum_ky = 0.0f;
+    for (int k = 0; k < t->count; k++) {
+        float y = ring_at(t, k);
+        t->sum_y += y;
+        t->sum_ky += k * y;
+    }
+    t->since_rebuild = 0;
+}
+
+static void ring_push(pressure_trend_t* t, float y)
+{
+    if (t->count < PRESSURE_TREND_BUCKETS) {
+        t->ring[(t->head + t->count) % PRESSURE_TREND_BUCKETS] = y;
+        t->sum_ky += t->count * y;
+        t->sum_y += y;
+        t->count++;
+    } else {
+        // Все позиции сдвигаются на одну к началу
+        float y0 = t->ring[t->head];
+        t->sum_ky -= t->sum_y - y0;
+        t->sum_y -= y0;
+        t->ring[t->head] = y;
+        t->head = (t->head + 1) % PRESSURE_TREND_BUCKETS;
+        t->sum_ky += (PRESSURE_TREND_BUCKETS - 1) * y;
+        t->sum_y += y;
+    }
+
+    if (++t->since_rebuild >= PRESSURE_TREND_BUCKETS) {
+        rebuild_sums(t);
+    }
+}
+
+// Наклон, мм рт. ст. на корзину
+static float slope(const pressure_trend_t* t)
+{
+    float n = t->count;
+    float sum_k = n * (n - 1) / 2.0f;
+    float sum_kk = (n - 1) * n * (2 * n - 1) / 6.0f;
+    float den = n * sum_kk - sum_k * sum_k;
+    if (den <= 0.0f) {
+        return 0.0f;
+    }
+    return (n * t->sum_ky - sum_k * t->sum_y) / den;
+}
+
+static void history_reset(pressure_trend_t* t)
+{
+    t->head = 0;
+    t->count = 0;
+    t->sum_y = 0.0f;
+    t->sum_ky = 0.0f;
+    t->since_rebuild = 0;
+    t->valid = false;
+    t->zambretti = 0;
+}
+
+void pressure_trend_init(pressure_trend_t* t)
+{
+    memset(t, 0, sizeof(*t));
+    t->ref = NAN;
+}
+
+pressure_tendency_t pressure_trend_classify(float delta_3h_hpa)
+{
+    if (delta_3h_hpa <= -PRESSURE_TREND_FAST_HPA) {
+        return PRESSURE_FALLING_FAST;
+    }
+    if (delta_3h_hpa <= -PRESSURE_TREND_STEADY_HPA) {
+        return PRESSURE_FALLING;
+    }
+    if (delta_3h_hpa >= PRESSURE_TREND_FAST_HPA) {
+        return PRESSURE_RISING_FAST;
+    }
+    if (delta_3h_hpa >= PRESSURE_TREND_STEADY_HPA) {
+        return PRESSURE_RISING;
+    }
+    return PRESSURE_STEADY;
+}
+
+uint8_t pressure_trend_zambretti(float p, pressure_tendency_t tend)
+{
+    int z;
+    if (tend < PRESSURE_STEADY) {
+        z = (int)lroundf(127.0f - 0.12f * p);
+        z = z < 1 ? 1 : z > 9 ? 9 : z;
+    } else if (tend > PRESSURE_STEADY) {
+        z = (int)lroundf(185.0f - 0.16f * p);
+        z = z < 20 ? 20 : z > 32 ? 32 : z;
+    } else {
+        z = (int)lroundf(144.0f - 0.13f * p);
+        z = z < 10 ? 10 : z > 19 ? 19 : z;
+    }
+    return (uint8_t)z;
+}
+
+forecast_kind_t pressure_trend_forecast_kind(uint8_t z)
+{
+    return z <= 32 ? (forecast_kind_t)s_forecast_kind[z] : FORECAST_CHANGEABLE;
+}
+
+const char* pressure_trend_forecast_text(uint8_t z)
+{
+    return z <= 32 ? s_forecast_text[z] : "";
+}
+
+static void close_bucket(pressure_trend_t* t, float mean, float sea_mmhg)
+{
+    if (isnan(t->ref)) {
+        t->ref = mean;
+    }
+    ring_push(t, mean - t->ref);
+
+    if (t->count < PRESSURE_TREND_MIN_BUCKETS) {
+        return;
+    }
+    float per_3h = slope(t) * (PRESSURE_TREND_BUCKETS - 1) * HPA_PER_MMHG;
+    t->delta_3h_hpa = per_3h;
+    t->tendency = pressure_trend_classify(per_3h);
+    t->zambretti = pressure_trend_zambretti(
+            sea_mmhg * HPA_PER_MMHG, t->tendency);
+    t->valid = true;
+}
+
+bool pressure_trend_add(
+        pressure_trend_t* t, float p_mmhg, float sea_mmhg, uint32_t now_s)
+{
+    if (!isfinite(p_mmhg)) {
+        return false;
+    }
+
+    uint32_t idx = now_s / PRESSURE_TREND_BUCKET_S;
+    bool closed = false;
+
+    if (t->bucket_n > 0 && idx != t->bucket_index) {
+        float mean = t->bucket_sum / t->bucket_n;
+        uint32_t gap = idx - t->bucket_index - 1;
+        if (gap > PRESSURE_TREND_MAX_GAP) {
+            history_reset(t);
+            t->ref = NAN;
+        } else {
+            close_bucket(t, mean, sea_mmhg);
+            // Короткий пропуск заполняем последним средним
+            for (uint32_t i = 0; i < gap; i++) {
+                close_bucket(t, mean, sea_mmhg);
+            }
+            closed = true;
+        }
+        t->bucket_sum = 0.0f;
+        t->bucket_n = 0;
+    }
+
+    t->bucket_index = idx;
+    t->bucket_sum += p_mmhg;
+    t->bucket_n++;
+    return closed;
+}
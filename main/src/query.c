@@ -0,0 +1,23 @@
+#include "query.h"
+#include <string.h>
+
+esp_err_t query_value(const char* q, const char* key, char* out, size_t len)
+{
+    size_t key_len = strlen(key);
+    while (q != NULL && *q) {
+        const char* end = strchr(q, '&');
+        size_t item_len = end ? (size_t)(end - q) : strlen(q);
+        if (item_len > key_len && strncmp(q, key, key_len) == 0
+            && q[key_len] == '=') {
+            size_t n = item_len - key_len - 1;
+            if (n >= len) {
+                return ESP_ERR_INVALID_ARG;
+            }
+            memcpy(out, q + key_len + 1, n);
+            out[n] = '\0';
+            return ESP_OK;
+        }
+        q = end ? end + 1 : NULL;
+    }
+    return ESP_ERR_NOT_FOUND;
+}
@@ -0,0 +1,444 @@
+#include "rules.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "nvs.h"
+#include "query.h"
+#include "relay.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char* TAG = "RULES";
+
+typedef struct {
+    uint8_t above; // выборок подряд выше on_above
+    uint8_t below; // выборок подряд ниже off_below
+    bool active;
+} rule_state_t;
+
+static rule_t s_rules[RULES_MAX] = {
+        {
+                .metric = STATS_PM2_5,
+                .enabled = 1,
+                .on_count = 3,
+                .off_count = 3,
+                .on_above = 35.0f,
+                .off_below = 25.0f,
+        },
+        {
+                .metric = STATS_CO2,
+                .enabled = 0,
+                .on_count = 3,
+                .off_count = 6,
+                .on_above = 1200.0f,
+                .off_below = 900.0f,
+        },
+        {.metric = STATS_PM10, .on_count = 3, .off_count = 3},
+        {.metric = STATS_HUMIDITY, .on_count = 3, .off_count = 3},
+};
+static rule_state_t s_state[RULES_MAX];
+static int64_t s_fed_us[STATS_METRIC_COUNT]; // последняя запись метрики
+static rules_mode_t s_mode = RULES_MODE_AUTO;
+static bool s_relay_on = false;
+static bool s_ready = false; // в пакетном режиме правила не работают
+static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static const char* const s_mode_names[] = {"auto", "on", "off"};
+
+static bool rule_is_valid(const rule_t* r)
+{
+    return r->metric < STATS_METRIC_COUNT && isfinite(r->on_above)
+        && isfinite(r->off_below) && r->off_below <= r->on_above
+        && r->on_count >= 1 && r->on_count <= RULES_COUNT_MAX
+        && r->off_count >= 1 && r->off_count <= RULES_COUNT_MAX;
+}
+
+// Вызывается под s_mux
+static void relay_apply(bool on)
+{
+    if (on != s_relay_on) {
+        s_relay_on = on;
+        if (on) {
+            relay_on();
+        } else {
+            relay_off();
+        }
+    }
+}
+
+// Вызывается под s_mux
+static bool rules_any_active(void)
+{
+    for (int i = 0; i < RULES_MAX; i++) {
+        if (s_rules[i].enabled && s_state[i].active) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void rules_load(void)
+{
+    nvs_handle_t nvs;
+    if (nvs_open(RULES_NVS_NAMESPACE, NVS_READONLY, &nvs) != ESP_OK) {
+        ESP_LOGI(TAG, "Сохранённых правил нет, используются умолчания");
+        return;
+    }
+
+    rule_t rules[RULES_MAX];
+    size_t len = sizeof(rules);
+    if (nvs_get_blob(nvs, RULES_NVS_KEY, rules, &len) == ESP_OK
+        && len == sizeof(rules)) {
+        bool ok = true;
+        for (int i = 0; i < RULES_MAX; i++) {
+            ok &= rule_is_valid(&rules[i]);
+        }
+        if (ok) {
+            memcpy(s_rules, rules, sizeof(s_rules));
+            ESP_LOGI(TAG, "Правила загружены из NVS");
+        } else {
+            ESP_LOGW(TAG, "Правила в NVS повреждены, используются умолчания");
+        }
+    }
+    nvs_close(nvs);
+}
+
+static esp_err_t rules_save(void)
+{
+    rule_t rules[RULES_MAX];
+    portENTER_CRITICAL(&s_mux);
+    memcpy(rules, s_rules, sizeof(rules));
+    portEXIT_CRITICAL(&s_mux);
+
+    nvs_handle_t nvs;
+    esp_err_t err = nvs_open(RULES_NVS_NAMESPACE, NVS_READWRITE, &nvs);
+    if (err == ESP_OK) {
+        err = nvs_set_blob(nvs, RULES_NVS_KEY, rules, sizeof(rules));
+        if (err == ESP_OK) {
+            err = nvs_commit(nvs);
+        }
+        nvs_close(nvs);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "Не удалось сохранить правила: %s", esp_err_to_name(err));
+    }
+    return err;
+}
+
+void rules_init(void)
+{
+    rules_load();
+    s_ready = true;
+    for (int i = 0; i < RULES_MAX; i++) {
+        if (s_rules[i].enabled) {
+            ESP_LOGI(
+                    TAG,
+                    "Правило %d: %s > %.1f (x%u) вкл, < %.1f (x%u) выкл",
+                    i,
+                    sensor_stats_metric_name(s_rules[i].metric),
+                    s_rules[i].on_above,
+                    s_rules[i].on_count,
+                    s_rules[i].off_below,
+                    s_rules[i].off_count);
+        }
+    }
+}
+
+void rules_feed(stats_metric_t metric, float value)
+{
+    if (!s_ready || !isfinite(value) || metric >= STATS_METRIC_COUNT) {
+        return;
+    }
+
+    int64_t now_us = esp_timer_get_time();
+    int64_t stale_us = (int64_t)RULES_STALE_MS * 1000;
+    int stale = -1;
+    bool was_on, now_on;
+    portENTER_CRITICAL(&s_mux);
+    s_fed_us[metric] = now_us;
+    for (int i = 0; i < RULES_MAX; i++) {
+        const rule_t* r = &s_rules[i];
+        rule_state_t* st = &s_state[i];
+        if (!r->enabled) {
+            continue;
+        }
+        if (r->metric != metric) {
+            // Метрика правила давно не поступала: сбрасываем правило
+            if (st->active && now_us - s_fed_us[r->metric] > stale_us) {
+                *st = (rule_state_t){0};
+                stale = i;
+            }
+            continue;
+        }
+
+        if (value > r->on_above) {
+            st->below = 0;
+            if (st->above < RULES_COUNT_MAX) {
+                st->above++;
+            }
+        } else if (value < r->off_below) {
+            st->above = 0;
+            if (st->below < RULES_COUNT_MAX) {
+                st->below++;
+            }
+        } else {
+            st->above = 0;
+            st->below = 0;
+        }
+
+        if (!st->active && st->above >= r->on_count) {
+            st->active = true;
+        } else if (st->active && st->below >= r->off_count) {
+            st->active = false;
+        }
+    }
+
+    was_on = s_relay_on;
+    if (s_mode == RULES_MODE_AUTO) {
+        relay_apply(rules_any_active());
+    }
+    now_on = s_relay_on;
+    portEXIT_CRITICAL(&s_mux);
+
+    if (stale >= 0) {
+        ESP_LOGW(
+                TAG,
+                "Правило %d сброшено: нет данных %s дольше %d с",
+                stale,
+                sensor_stats_metric_name(s_rules[stale].metric),
+                RULES_STALE_MS / 1000);
+    }
+    if (now_on != was_on) {
+        ESP_LOGI(
+                TAG,
+                "Реле %s по правилу (%s = %.1f)",
+                now_on ? "ВКЛ" : "ВЫКЛ",
+                sensor_stats_metric_name(metric),
+                value);
+    }
+}
+
+esp_err_t rules_get(int index, rule_t* out)
+{
+    if (index < 0 || index >= RULES_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    portENTER_CRITICAL(&s_mux);
+    *out = s_rules[index];
+    portEXIT_CRITICAL(&s_mux);
+    return ESP_OK;
+}
+
+esp_err_t rules_set(int index, const rule_t* rule)
+{
+    if (index < 0 || index >= RULES_MAX || !rule_is_valid(rule)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    portENTER_CRITICAL(&s_mux);
+    s_rules[index] = *rule;
+    // Счётчики набираются заново, уже включённое реле не дёргается
+    bool active = s_state[index].active && rule->enabled;
+    s_state[index] = (rule_state_t){.active = active};
+    if (s_mode == RULES_MODE_AUTO) {
+        relay_apply(rules_any_active());
+    }
+    portEXIT_CRITICAL(&s_mux);
+
+    return rules_save();
+}
+
+esp_err_t rules_set_threshold(stats_metric_t metric, float on_above)
+{
+    for (int i = 0; i < RULES_MAX; i++) {
+        rule_t r;
+        rules_get(i, &r);
+        if (r.metric != metric) {
+            continue;
+        }
+        float gap = r.on_above - r.off_below;
+        r.on_above = on_above;
+        r.off_below = on_above - gap;
+        r.enabled = 1;
+        return rules_set(i, &r);
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+void rules_set_mode(rules_mode_t mode)
+{
+    portENTER_CRITICAL(&s_mux);
+    s_mode = mode;
+    switch (mode) {
+    case RULES_MODE_ON:
+        relay_apply(true);
+        break;
+    case RULES_MODE_OFF:
+        relay_apply(false);
+        break;
+    default:
+        relay_apply(rules_any_active());
+        break;
+    }
+    portEXIT_CRITICAL(&s_mux);
+
+    ESP_LOGI(TAG, "Режим реле: %s", rules_mode_name(mode));
+}
+
+rules_mode_t rules_get_mode(void)
+{
+    return s_mode;
+}
+
+bool rules_relay_is_on(void)
+{
+    return s_relay_on;
+}
+
+const char* rules_mode_name(rules_mode_t mode)
+{
+    return mode <= RULES_MODE_OFF ? s_mode_names[mode] : "?";
+}
+
+// Есть ли ключ в запросе; не поместившееся в val значение сбрасывает ok
+static bool query_param(
+        const char* q, const char* key, char* val, size_t len, bool* ok)
+{
+    esp_err_t err = query_value(q, key, val, len);
+    *ok &= err != ESP_ERR_INVALID_ARG;
+    return err == ESP_OK;
+}
+
+static bool parse_float(const char* s, float* out)
+{
+    char* end;
+    float v = strtof(s, &end);
+    if (end == s || *end != '\0') {
+        return false;
+    }
+    *out = v;
+    return true;
+}
+
+static bool parse_index(const char* s, int* out)
+{
+    char* end;
+    long v = strtol(s, &end, 10);
+    if (end == s || *end != '\0' || v < 0 || v >= RULES_MAX) {
+        return false;
+    }
+    *out = (int)v;
+    return true;
+}
+
+static bool parse_count(const char* s, uint8_t* out)
+{
+    char* end;
+    long v = strtol(s, &end, 10);
+    if (end == s || *end != '\0' || v < 0 || v > RULES_COUNT_MAX) {
+        return false;
+    }
+    *out = (uint8_t)v;
+    return true;
+}
+
+esp_err_t rules_apply_query(const char* query)
+{
+    char val[16];
+
+    esp_err_t err = query_value(query, "mode", val, sizeof(val));
+    if (err == ESP_ERR_INVALID_ARG) {
+        return err;
+    }
+    if (err == ESP_OK) {
+        for (int m = RULES_MODE_AUTO; m <= RULES_MODE_OFF; m++) {
+            if (strcmp(val, s_mode_names[m]) == 0) {
+                rules_set_mode((rules_mode_t)m);
+                return ESP_OK;
+            }
+        }
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    int index;
+    if (query_value(query, "id", val, sizeof(val)) != ESP_OK
+        || !parse_index(val, &index)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    rule_t r;
+    if (rules_get(index, &r) != ESP_OK) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    bool ok = true;
+    if (query_param(query, "metric", val, sizeof(val), &ok)) {
+        int m = 0;
+        while (m < STATS_METRIC_COUNT
+               && strcmp(val, sensor_stats_metric_name(m)) != 0) {
+            m++;
+        }
+        ok &= m < STATS_METRIC_COUNT;
+        r.metric = (uint8_t)m;
+    }
+    if (query_param(query, "on", val, sizeof(val), &ok)) {
+        ok &= parse_float(val, &r.on_above);
+    }
+    if (query_param(query, "off", val, sizeof(val), &ok)) {
+        ok &= parse_float(val, &r.off_below);
+    }
+    if (query_param(query, "n", val, sizeof(val), &ok)) {
+        ok &= parse_count(val, &r.on_count);
+    }
+    if (query_param(query, "m", val, sizeof(val), &ok)) {
+        ok &= parse_count(val, &r.off_count);
+    }
+    if (query_param(query, "enabled", val, sizeof(val), &ok)) {
+        r.enabled = strcmp(val, "0") != 0;
+    }
+
+    return ok ? rules_set(index, &r) : ESP_ERR_INVALID_ARG;
+}
+
+int rules_format(char* buf, size_t len)
+{
+    rule_t rules[RULES_MAX];
+    rule_state_t state[RULES_MAX];
+    rules_mode_t mode;
+    bool relay;
+
+    portENTER_CRITICAL(&s_mux);
+    memcpy(rules, s_rules, sizeof(rules));
+    memcpy(state, s_state, sizeof(state));
+    mode = s_mode;
+    relay = s_relay_on;
+    portEXIT_CRITICAL(&s_mux);
+
+    int n = snprintf(
+            buf,
+            len,
+            "{\"mode\":\"%s\",\"relay\":%d,\"rules\":[",
+            rules_mode_name(mode),
+            relay ? 1 : 0);
+    for (int i = 0; i < RULES_MAX && n >= 0 && (size_t)n < len; i++) {
+        n += snprintf(
+                buf + n,
+                len - n,
+                "%s{\"id\":%d,\"metric\":\"%s\",\"enabled\":%u,"
+                "\"on\":%.1f,\"off\":%.1f,\"n\":%u,\"m\":%u,\"active\":%d}",
+                i ? "," : "",
+                i,
+                sensor_stats_metric_name(rules[i].metric),
+                rules[i].enabled,
+                rules[i].on_above,
+                rules[i].off_below,
+                rules[i].on_count,
+                rules[i].off_count,
+                state[i].active ? 1 : 0);
+    }
+    if (n >= 0 && (size_t)n < len) {
+        n += snprintf(buf + n, len - n, "]}");
+    }
+    return n;
+}
@@ -0,0 +1,267 @@
+#include "sample_batch.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+static int32_t round_clamp(float v, float scale, int32_t lo, int32_t hi)
+{
+    if (isnan(v)) {
+        return 0;
+    }
+    float r = roundf(v * scale);
+    if (r < (float)lo) {
+        return lo;
+    }
+    if (r > (float)hi) {
+        return hi;
+    }
+    return (int32_t)r;
+}
+
+void sample_batch_reset(sample_batch_t* b)
+{
+    memset(b, 0, sizeof(*b));
+    b->magic = SAMPLE_BATCH_MAGIC;
+}
+
+bool sample_batch_is_valid(const sample_batch_t* b)
+{
+    return b->magic == SAMPLE_BATCH_MAGIC && b->head < SAMPLE_BATCH_CAPACITY
+        && b->count <= SAMPLE_BATCH_CAPACITY;
+}
+
+void sample_pack(sample_record_t* out, const sample_values_t* in)
+{
+    out->time_s = in->time_s;
+    out->temp_c10 = (int16_t)round_clamp(in->temperature, 10.0f, -32768, 32767);
+    out->hum_p10 = (uint16_t)round_clamp(in->humidity, 10.0f, 0, 1000);
+    out->press_p10 = (uint16_t)round_clamp(in->pressure, 10.0f, 0, 65535);
+    out->co2_ppm = (uint16_t)round_clamp(in->co2, 1.0f, 0, 65535);
+    out->pm1_0 = in->pm1_0;
+    out->pm2_5 = in->pm2_5;
+    out->pm10 = in->pm10;
+    out->flags = in->flags;
+}
+
+void sample_unpack(sample_values_t* out, const sample_record_t* in)
+{
+    out->time_s = in->time_s;
+    out->temperature = in->temp_c10 / 10.0f;
+    out->humidity = in->hum_p10 / 10.0f;
+    out->pressure = in->press_p10 / 10.0f;
+    out->co2 = in->co2_ppm;
+    out->pm1_0 = in->pm1_0;
+    out->pm2_5 = in->pm2_5;
+    out->pm10 = in->pm10;
+    out->flags = in->flags;
+}
+
+void sample_batch_push(sample_batch_t* b, const sample_values_t* v)
+{
+    size_t idx;
+    if (b->count < SAMPLE_BATCH_CAPACITY) {
+        idx = (b->head + b->count) % SAMPLE_BATCH_CAPACITY;
+        b->count++;
+    } else {
+        idx = b->head;
+        b->head = (b->head + 1) % SAMPLE_BATCH_CAPACITY;
+        b->dropped++;
+    }
+    sample_pack(&b->records[idx], v);
+}
+
+size_t sample_batch_count(const sample_batch_t* b)
+{
+    return b->count;
+}
+
+const sample_record_t* sample_batch_at(const sample_batch_t* b, size_t i)
+{
+    if (i >= b->count) {
+        return NULL;
+    }
+    return &b->records[(b->head + i) % SAMPLE_BATCH_CAPACITY];
+}
+
+void sample_batch_drop(sample_batch_t* b, size_t n)
+{
+    if (n > b->count) {
+        n = b->count;
+    }
+    b->head = (b->head + n) % SAMPLE_BATCH_CAPACITY;
+    b->count -= n;
+}
+
+void sample_batch_fix_time(
+        sample_batch_t* b, uint32_t uptime_s, uint32_t wall_s)
+{
+    for (size_t i = 0; i < b->count; i++) {
+        sample_record_t* r = &b->records[(b->head + i) % SAMPLE_BATCH_CAPACITY];
+        if ((r->flags & SAMPLE_F_UPTIME) && r->time_s <= uptime_s) {
+            r->time_s = wall_s - (uptime_s - r->time_s);
+            r->flags &= ~SAMPLE_F_UPTIME;
+        }
+    }
+}
+
+// Одна запись; поля без валидных данных опускаются
+static int encode_record(char* buf, size_t len, const sample_record_t* r)
+{
+    sample_values_t v;
+    sample_unpack(&v, r);
+
+    int n = snprintf(
+            buf,
+            len,
+            "{\"%s\":%lu",
+            v.flags & SAMPLE_F_UPTIME ? "up" : "t",
+            (unsigned long)v.time_s);
+    if (n < 0 || (size_t)n >= len) {
+        return -1;
+    }
+    size_t pos = n;
+
+    if (v.flags & (SAMPLE_F_DHT | SAMPLE_F_BMP)) {
+        n = snprintf(buf + pos, len - pos, ",\"temp\":%.1f", v.temperature);
+        if (n < 0 || (pos += n) >= len) {
+            return -1;
+        }
+    }
+    if (v.flags & SAMPLE_F_DHT) {
+        n = snprintf(buf + pos, len - pos, ",\"hum\":%.1f", v.humidity);
+        if (n < 0 || (pos += n) >= len) {
+            return -1;
+        }
+    }
+    if (v.flags & SAMPLE_F_BMP) {
+        n = snprintf(buf + pos, len - pos, ",\"press\":%.1f", v.pressure);
+        if (n < 0 || (pos += n) >= len) {
+            return -1;
+        }
+    }
+    if (v.flags & SAMPLE_F_GAS) {
+        n = snprintf(
+                buf + pos, len - pos, ",\"co2\":%u", (unsigned)r->co2_ppm);
+        if (n < 0 || (pos += n) >= len) {
+            return -1;
+        }
+    }
+    if (v.flags & SAMPLE_F_PMS) {
+        n = snprintf(
+                buf + pos,
+                len - pos,
+                ",\"pm1_0\":%u,\"pm2_5\":%u,\"pm10\":%u",
+                v.pm1_0,
+                v.pm2_5,
+                v.pm10);
+        if (n < 0 || (pos += n) >= len) {
+            return -1;
+        }
+    }
+
+    n = snprintf(buf + pos, len - pos, "}");
+    if (n < 0 || (pos += n) >= len) {
+        return -1;
+    }
+    return (int)pos;
+}
+
+// Десятые доли: -5 -> "-0.5"; пустая строка, если поля нет
+static void format_p10(char* buf, size_t len, int32_t v, bool valid)
+{
+    if (!valid) {
+        buf[0] = '\0';
+        return;
+    }
+    uint32_t a = v < 0 ? (uint32_t)-v : (uint32_t)v;
+    snprintf(
+            buf,
+            len,
+            "%s%lu.%lu",
+            v < 0 ? "-" : "",
+            (unsigned long)(a / 10),
+            (unsigned long)(a % 10));
+}
+
+static void format_uint(char* buf, size_t len, uint32_t v, bool valid)
+{
+    if (!valid) {
+        buf[0] = '\0';
+        return;
+    }
+    snprintf(buf, len, "%lu", (unsigned long)v);
+}
+
+int sample_encode_csv(const sample_record_t* r, char* buf, size_t len)
+{
+    char temp[8], hum[8], press[8], co2[6], pm1[6], pm25[6], pm10[6];
+    bool pms = r->flags & SAMPLE_F_PMS;
+
+    format_p10(
+            temp,
+            sizeof(temp),
+            r->temp_c10,
+            r->flags & (SAMPLE_F_DHT | SAMPLE_F_BMP));
+    format_p10(hum, sizeof(hum), r->hum_p10, r->flags & SAMPLE_F_DHT);
+    format_p10(press, sizeof(press), r->press_p10, r->flags & SAMPLE_F_BMP);
+    format_uint(co2, sizeof(co2), r->co2_ppm, r->flags & SAMPLE_F_GAS);
+    format_uint(pm1, sizeof(pm1), r->pm1_0, pms);
+    format_uint(pm25, sizeof(pm25), r->pm2_5, pms);
+    format_uint(pm10, sizeof(pm10), r->pm10, pms);
+
+    return snprintf(
+            buf,
+            len,
+            "%lu,%s,%s,%s,%s,%s,%s,%s\n",
+            (unsigned long)r->time_s,
+            temp,
+            hum,
+            press,
+            co2,
+            pm1,
+            pm25,
+            pm10);
+}
+
+size_t sample_batch_encode_json(
+        const sample_batch_t* b,
+        size_t first,
+        char* buf,
+        size_t buf_len,
+        size_t* encoded)
+{
+    *encoded = 0;
+    // '[' + ']' + '\0'
+    if (buf_len < 3 || first >= b->count) {
+        return 0;
+    }
+
+    size_t pos = 1;
+    buf[0] = '[';
+    for (size_t i = first; i < b->count; i++) {
+        size_t sep = *encoded > 0 ? 1 : 0;
+        // Оставляем место под ']' и '\0'
+        if (pos + sep + 2 >= buf_len) {
+            break;
+        }
+        int n = encode_record(
+                buf + pos + sep,
+                buf_len - pos - sep - 2,
+                sample_batch_at(b, i));
+        if (n < 0) {
+            break;
+        }
+        if (sep) {
+            buf[pos] = ',';
+        }
+        pos += sep + n;
+        (*encoded)++;
+    }
+
+    if (*encoded == 0) {
+        return 0;
+    }
+    buf[pos++] = ']';
+    buf[pos] = '\0';
+    return pos;
+}
@@ -0,0 +1,382 @@
+#include "sample_downsample.h"
+#include <string.h>
+
+#define DS_BATCH 16 // записей за одно чтение источника
+
+static const char* const FIELD_NAMES[SAMPLE_FIELD_COUNT] = {
+        "temperature",
+        "humidity",
+        "pressure",
+        "co2",
+        "pm1_0",
+        "pm2_5",
+        "pm10",
+};
+
+static const char* const MODE_NAMES[] = {"mean", "minmax", "lttb"};
+
+// Источник с окном [from_s, to_s] и подглядыванием на запись вперёд
+typedef struct {
+    const sample_ds_config_t* cfg;
+    void* ctx;
+    sample_record_t buf[DS_BATCH];
+    size_t n;
+    size_t pos;
+    bool end;
+} ds_src_t;
+
+// Суммы корзины для MEAN
+typedef struct {
+    uint32_t n;
+    uint64_t time_sum;
+    int64_t temp_sum;
+    uint64_t hum_sum, press_sum, co2_sum;
+    uint64_t pm1_sum, pm25_sum, pm10_sum;
+    uint32_t temp_n, dht_n, bmp_n, gas_n, pms_n;
+} ds_mean_t;
+
+bool sample_field_value(
+        const sample_record_t* r, sample_field_t field, int32_t* out)
+{
+    uint8_t need;
+    switch (field) {
+    case SAMPLE_FIELD_TEMPERATURE:
+        need = SAMPLE_F_DHT | SAMPLE_F_BMP;
+        *out = r->temp_c10;
+        break;
+    case SAMPLE_FIELD_HUMIDITY:
+        need = SAMPLE_F_DHT;
+        *out = r->hum_p10;
+        break;
+    case SAMPLE_FIELD_PRESSURE:
+        need = SAMPLE_F_BMP;
+        *out = r->press_p10;
+        break;
+    case SAMPLE_FIELD_CO2:
+        need = SAMPLE_F_GAS;
+        *out = r->co2_ppm;
+        break;
+    case SAMPLE_FIELD_PM1_0:
+        need = SAMPLE_F_PMS;
+        *out = r->pm1_0;
+        break;
+    case SAMPLE_FIELD_PM2_5:
+        need = SAMPLE_F_PMS;
+        *out = r->pm2_5;
+        break;
+    case SAMPLE_FIELD_PM10:
+        need = SAMPLE_F_PMS;
+        *out = r->pm10;
+        break;
+    default:
+        return false;
+    }
+    return (r->flags & need) != 0;
+}
+
+bool sample_field_parse(const char* name, sample_field_t* out)
+{
+    for (int i = 0; i < SAMPLE_FIELD_COUNT; i++) {
+        if (strcmp(name, FIELD_NAMES[i]) == 0) {
+            *out = (sample_field_t)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool sample_ds_mode_parse(const char* name, sample_ds_mode_t* out)
+{
+    for (size_t i = 0; i < sizeof(MODE_NAMES) / sizeof(MODE_NAMES[0]); i++) {
+        if (strcmp(name, MODE_NAMES[i]) == 0) {
+            *out = (sample_ds_mode_t)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void src_init(ds_src_t* s, const sample_ds_config_t* cfg, void* ctx)
+{
+    s->cfg = cfg;
+    s->ctx = ctx;
+    s->n = 0;
+    s->pos = 0;
+    s->end = false;
+}
+
+// Следующая запись окна без извлечения; NULL — конец
+static const sample_record_t* src_peek(ds_src_t* s)
+{
+    while (!s->end) {
+        if (s->pos >= s->n) {
+            s->n = s->cfg->read(s->ctx, s->buf, DS_BATCH);
+            s->pos = 0;
+            s->end = s->n == 0;
+            continue;
+        }
+        const sample_record_t* r = &s->buf[s->pos];
+        if (r->time_s < s->cfg->from_s) {
+            s->pos++;
+            continue;
+        }
+        if (r->time_s > s->cfg->to_s) {
+            s->end = true;
+            break;
+        }
+        return r;
+    }
+    return NULL;
+}
+
+static void src_next(ds_src_t* s)
+{
+    s->pos++;
+}
+
+static uint32_t bucket_of(const sample_ds_config_t* cfg, uint32_t time_s)
+{
+    uint64_t span = (uint64_t)(cfg->to_s - cfg->from_s) + 1;
+    uint64_t b = (uint64_t)(time_s - cfg->from_s) * cfg->points / span;
+    return b < cfg->points ? (uint32_t)b : cfg->points - 1;
+}
+
+static uint64_t mean_u(uint64_t sum, uint32_t n)
+{
+    return n ? (sum + n / 2) / n : 0;
+}
+
+static int32_t mean_i(int64_t sum, uint32_t n)
+{
+    if (n == 0) {
+        return 0;
+    }
+    return (int32_t)(sum >= 0 ? (sum + n / 2) / n : (sum - n / 2) / n);
+}
+
+static void mean_add(ds_mean_t* m, const sample_record_t* r)
+{
+    m->n++;
+    m->time_sum += r->time_s;
+    if (r->flags & (SAMPLE_F_DHT | SAMPLE_F_BMP)) {
+        m->temp_sum += r->temp_c10;
+        m->temp_n++;
+    }
+    if (r->flags & SAMPLE_F_DHT) {
+        m->hum_sum += r->hum_p10;
+        m->dht_n++;
+    }
+    if (r->flags & SAMPLE_F_BMP) {
+        m->press_sum += r->press_p10;
+        m->bmp_n++;
+    }
+    if (r->flags & SAMPLE_F_GAS) {
+        m->co2_sum += r->co2_ppm;
+        m->gas_n++;
+    }
+    if (r->flags & SAMPLE_F_PMS) {
+        m->pm1_sum += r->pm1_0;
+        m->pm25_sum += r->pm2_5;
+        m->pm10_sum += r->pm10;
+        m->pms_n++;
+    }
+}
+
+static void mean_result(const ds_mean_t* m, sample_record_t* out)
+{
+    memset(out, 0, sizeof(*out));
+    out->time_s = (uint32_t)mean_u(m->time_sum, m->n);
+    out->temp_c10 = (int16_t)mean_i(m->temp_sum, m->temp_n);
+    out->hum_p10 = (uint16_t)mean_u(m->hum_sum, m->dht_n);
+    out->press_p10 = (uint16_t)mean_u(m->press_sum, m->bmp_n);
+    out->co2_ppm = (uint16_t)mean_u(m->co2_sum, m->gas_n);
+    out->pm1_0 = (uint16_t)mean_u(m->pm1_sum, m->pms_n);
+    out->pm2_5 = (uint16_t)mean_u(m->pm25_sum, m->pms_n);
+    out->pm10 = (uint16_t)mean_u(m->pm10_sum, m->pms_n);
+    out->flags = (m->dht_n ? SAMPLE_F_DHT : 0)
+               | (m->bmp_n ? SAMPLE_F_BMP : 0)
+               | (m->gas_n ? SAMPLE_F_GAS : 0)
+               | (m->pms_n ? SAMPLE_F_PMS : 0);
+}
+
+static bool run_mean(const sample_ds_config_t* cfg, ds_src_t* src)
+{
+    const sample_record_t* r;
+    while ((r = src_peek(src)) != NULL) {
+        uint32_t bucket = bucket_of(cfg, r->time_s);
+        ds_mean_t m = {0};
+        while (r != NULL && bucket_of(cfg, r->time_s) == bucket) {
+            mean_add(&m, r);
+            src_next(src);
+            r = src_peek(src);
+        }
+        sample_record_t out;
+        mean_result(&m, &out);
+        if (!cfg->emit(cfg->emit_ctx, &out)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool run_minmax(const sample_ds_config_t* cfg, ds_src_t* src)
+{
+    const sample_record_t* r;
+    while ((r = src_peek(src)) != NULL) {
+        uint32_t bucket = bucket_of(cfg, r->time_s);
+        sample_record_t lo, hi;
+        int32_t lo_v = 0, hi_v = 0, v;
+        bool any = false;
+        while (r != NULL && bucket_of(cfg, r->time_s) == bucket) {
+            if (sample_field_value(r, cfg->field, &v)) {
+                if (!any || v < lo_v) {
+                    lo = *r;
+                    lo_v = v;
+                }
+                if (!any || v > hi_v) {
+                    hi = *r;
+                    hi_v = v;
+                }
+                any = true;
+            }
+            src_next(src);
+            r = src_peek(src);
+        }
+        if (!any) {
+            continue;
+        }
+
+        const sample_record_t* first = lo.time_s <= hi.time_s ? &lo : &hi;
+        const sample_record_t* second = first == &lo ? &hi : &lo;
+        if (!cfg->emit(cfg->emit_ctx, first)) {
+            return false;
+        }
+        if (second->time_s != first->time_s
+            && !cfg->emit(cfg->emit_ctx, second)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Пропуск записей до первой валидной в корзине позже after
+static const sample_record_t* skip_to_bucket(
+        const sample_ds_config_t* cfg, ds_src_t* s, uint32_t after)
+{
+    const sample_record_t* r;
+    int32_t v;
+    while ((r = src_peek(s)) != NULL
+           && (bucket_of(cfg, r->time_s) <= after
+               || !sample_field_value(r, cfg->field, &v))) {
+        src_next(s);
+    }
+    return r;
+}
+
+// Площадь треугольника (a, p, c) × 2n, где c — среднее n точек с
+// суммами sx, sy. Время отсчитывается от a, поэтому всё целое и
+// без переполнения при диапазоне до нескольких лет.
+static uint64_t lttb_area(
+        const sample_record_t* a,
+        int32_t ay,
+        const sample_record_t* p,
+        int32_t py,
+        int64_t sx,
+        int64_t sy,
+        uint32_t n)
+{
+    int64_t px = (int64_t)(p->time_s - a->time_s);
+    int64_t d = px * (sy - (int64_t)n * ay) - sx * (int64_t)(py - ay);
+    return d < 0 ? (uint64_t)-d : (uint64_t)d;
+}
+
+static bool run_lttb(
+        const sample_ds_config_t* cfg, ds_src_t* cur, ds_src_t* lead)
+{
+    const sample_record_t* r;
+    int32_t ay, v;
+
+    // Первая валидная запись — всегда в результате
+    while ((r = src_peek(cur)) != NULL
+           && !sample_field_value(r, cfg->field, &ay)) {
+        src_next(cur);
+    }
+    if (r == NULL) {
+        return true;
+    }
+    sample_record_t a = *r;
+    src_next(cur);
+    if (!cfg->emit(cfg->emit_ctx, &a)) {
+        return false;
+    }
+    uint32_t a_bucket = bucket_of(cfg, a.time_s);
+
+    while ((r = skip_to_bucket(cfg, cur, a_bucket)) != NULL) {
+        uint32_t bucket = bucket_of(cfg, r->time_s);
+
+        // Среднее следующей непустой корзины — вторым источником
+        int64_t sx = 0, sy = 0;
+        uint32_t n = 0;
+        const sample_record_t* q = skip_to_bucket(cfg, lead, bucket);
+        if (q != NULL) {
+            uint32_t next = bucket_of(cfg, q->time_s);
+            while (q != NULL && bucket_of(cfg, q->time_s) == next) {
+                if (sample_field_value(q, cfg->field, &v)) {
+                    sx += q->time_s - a.time_s;
+                    sy += v;
+                    n++;
+                }
+                src_next(lead);
+                q = src_peek(lead);
+            }
+        }
+
+        // Последняя корзина — последняя запись, иначе наибольшая площадь
+        sample_record_t best = *r;
+        int32_t best_y = 0;
+        uint64_t best_area = 0;
+        bool any = false;
+        while (r != NULL && bucket_of(cfg, r->time_s) == bucket) {
+            if (sample_field_value(r, cfg->field, &v)) {
+                uint64_t area = n ? lttb_area(&a, ay, r, v, sx, sy, n) : 0;
+                if (!any || n == 0 || area > best_area) {
+                    best = *r;
+                    best_y = v;
+                    best_area = area;
+                }
+                any = true;
+            }
+            src_next(cur);
+            r = src_peek(cur);
+        }
+
+        if (!cfg->emit(cfg->emit_ctx, &best)) {
+            return false;
+        }
+        a = best;
+        ay = best_y;
+        a_bucket = bucket;
+    }
+    return true;
+}
+
+bool sample_downsample(const sample_ds_config_t* cfg)
+{
+    if (cfg->points == 0 || cfg->from_s > cfg->to_s) {
+        return true;
+    }
+
+    ds_src_t src;
+    src_init(&src, cfg, cfg->src);
+    switch (cfg->mode) {
+    case SAMPLE_DS_MINMAX:
+        return run_minmax(cfg, &src);
+    case SAMPLE_DS_LTTB: {
+        ds_src_t lead;
+        src_init(&lead, cfg, cfg->lead);
+        return run_lttb(cfg, &src, &lead);
+    }
+    default:
+        return run_mean(cfg, &src);
+    }
+}
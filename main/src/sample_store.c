@@ -0,0 +1,337 @@
+#include "sample_store.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "sensor_data.h"
+#include <string.h>
+#include <time.h>
+
+static const char* TAG = "SAMPLE_STORE";
+
+#define SECTOR_SIZE 4096
+#define RECORD_SIZE sizeof(sample_record_t)
+#define RECORDS_PER_SECTOR \
+    ((SECTOR_SIZE - sizeof(sector_header_t)) / RECORD_SIZE)
+#define TIME_EMPTY 0xFFFFFFFFu // стёртая флеш
+
+typedef struct {
+    uint32_t magic;
+    uint32_t seq;
+} sector_header_t;
+
+static const esp_partition_t* s_part = NULL;
+static SemaphoreHandle_t s_mutex = NULL;
+static uint32_t s_sectors = 0;
+
+// Голова: сектор, в который идёт запись, и первая свободная запись
+static uint32_t s_head_seq = 0;
+static uint32_t s_head_idx = 0;
+static uint32_t s_oldest_seq = 0;
+static bool s_empty = true;
+static uint32_t s_last_time = 0;
+
+static size_t sector_offset(uint32_t seq)
+{
+    return (size_t)(seq % s_sectors) * SECTOR_SIZE;
+}
+
+static size_t record_offset(uint32_t seq, uint32_t idx)
+{
+    return sector_offset(seq) + sizeof(sector_header_t) + idx * RECORD_SIZE;
+}
+
+// Номер сектора по заголовку; false — сектор стёрт или чужой
+static bool sector_seq(uint32_t sector, uint32_t* seq)
+{
+    sector_header_t h;
+    if (esp_partition_read(s_part, (size_t)sector * SECTOR_SIZE, &h, sizeof(h))
+        != ESP_OK) {
+        return false;
+    }
+    if (h.magic != SAMPLE_STORE_MAGIC || h.seq % s_sectors != sector) {
+        return false;
+    }
+    *seq = h.seq;
+    return true;
+}
+
+static uint32_t record_time(uint32_t seq, uint32_t idx)
+{
+    uint32_t t = TIME_EMPTY;
+    esp_partition_read(s_part, record_offset(seq, idx), &t, sizeof(t));
+    return t;
+}
+
+// Первая запись со временем >= t в секторе из n записей
+static uint32_t sector_lower_bound(uint32_t seq, uint32_t n, uint32_t t)
+{
+    uint32_t lo = 0, hi = n;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (record_time(seq, mid) < t) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static uint32_t sector_used(uint32_t seq)
+{
+    return seq == s_head_seq ? s_head_idx : RECORDS_PER_SECTOR;
+}
+
+static void store_recover(void)
+{
+    bool found = false;
+    for (uint32_t i = 0; i < s_sectors; i++) {
+        uint32_t seq;
+        if (sector_seq(i, &seq) && (!found || seq > s_head_seq)) {
+            s_head_seq = seq;
+            found = true;
+        }
+    }
+    if (!found) {
+        return;
+    }
+
+    // Самый старый — начало непрерывной цепочки номеров перед головой
+    s_oldest_seq = s_head_seq;
+    while (s_oldest_seq > 0 && s_head_seq - (s_oldest_seq - 1) < s_sectors) {
+        uint32_t seq;
+        if (!sector_seq((s_oldest_seq - 1) % s_sectors, &seq)
+            || seq != s_oldest_seq - 1) {
+            break;
+        }
+        s_oldest_seq--;
+    }
+
+    // Записи в секторе идут подряд, свободные — стёртые
+    s_head_idx = sector_lower_bound(s_head_seq, RECORDS_PER_SECTOR, TIME_EMPTY);
+    if (s_head_idx > 0) {
+        s_last_time = record_time(s_head_seq, s_head_idx - 1);
+        s_empty = false;
+    } else if (s_head_seq > s_oldest_seq) {
+        s_last_time = record_time(s_head_seq - 1, RECORDS_PER_SECTOR - 1);
+        s_empty = false;
+    }
+}
+
+esp_err_t sample_store_init(void)
+{
+    if (s_part != NULL) {
+        return ESP_OK;
+    }
+
+    const esp_partition_t* part = esp_partition_find_first(
+            ESP_PARTITION_TYPE_DATA,
+            ESP_PARTITION_SUBTYPE_ANY,
+            SAMPLE_STORE_PARTITION);
+    if (part == NULL || part->size < 2 * SECTOR_SIZE) {
+        ESP_LOGW(TAG, "Раздел \"%s\" не найден", SAMPLE_STORE_PARTITION);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    s_mutex = xSemaphoreCreateMutex();
+    if (s_mutex == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    s_part = part;
+    s_sectors = part->size / SECTOR_SIZE;
+    store_recover();
+
+    sample_store_info_t info;
+    sample_store_get_info(&info);
+    ESP_LOGI(
+            TAG,
+            "Архив: %lu из %lu записей, %lu..%lu",
+            (unsigned long)info.count,
+            (unsigned long)info.capacity,
+            (unsigned long)info.oldest_s,
+            (unsigned long)info.newest_s);
+    return ESP_OK;
+}
+
+bool sample_store_ready(void)
+{
+    return s_part != NULL;
+}
+
+// Переход головы в следующий сектор; самый старый стирается
+static esp_err_t store_next_sector(uint32_t seq)
+{
+    if (seq - s_oldest_seq >= s_sectors) {
+        s_oldest_seq = seq - s_sectors + 1;
+    }
+
+    esp_err_t err = esp_partition_erase_range(
+            s_part, sector_offset(seq), SECTOR_SIZE);
+    if (err != ESP_OK) {
+        return err;
+    }
+    sector_header_t h = {.magic = SAMPLE_STORE_MAGIC, .seq = seq};
+    err = esp_partition_write(s_part, sector_offset(seq), &h, sizeof(h));
+    if (err != ESP_OK) {
+        return err;
+    }
+    s_head_seq = seq;
+    s_head_idx = 0;
+    return ESP_OK;
+}
+
+esp_err_t sample_store_append(const sample_values_t* v)
+{
+    if (s_part == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (v->time_s < SENSOR_WALL_CLOCK_MIN_S || v->time_s == TIME_EMPTY) {
+        return ESP_OK;
+    }
+
+    sample_record_t r;
+    sample_pack(&r, v);
+
+    esp_err_t err = ESP_OK;
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    // Часы перевели назад: выборку пропускаем, иначе сломается поиск
+    if (!s_empty && r.time_s <= s_last_time) {
+        xSemaphoreGive(s_mutex);
+        return ESP_OK;
+    }
+
+    if (s_empty) {
+        err = store_next_sector(s_head_seq);
+    } else if (s_head_idx >= RECORDS_PER_SECTOR) {
+        err = store_next_sector(s_head_seq + 1);
+    }
+    if (err == ESP_OK) {
+        err = esp_partition_write(
+                s_part, record_offset(s_head_seq, s_head_idx), &r, RECORD_SIZE);
+    }
+    if (err == ESP_OK) {
+        s_head_idx++;
+        s_last_time = r.time_s;
+        s_empty = false;
+    }
+    xSemaphoreGive(s_mutex);
+    return err;
+}
+
+void sample_store_seek(sample_store_iter_t* it, uint32_t from_s)
+{
+    *it = (sample_store_iter_t){0};
+    if (s_part == NULL) {
+        return;
+    }
+
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    if (s_empty) {
+        it->seq = s_head_seq;
+        xSemaphoreGive(s_mutex);
+        return;
+    }
+
+    // Последний сектор, первая запись которого не позже from_s
+    uint32_t lo = s_oldest_seq, hi = s_head_seq;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo + 1) / 2;
+        if (record_time(mid, 0) <= from_s) {
+            lo = mid;
+        } else {
+            hi = mid - 1;
+        }
+    }
+
+    it->seq = lo;
+    it->idx = sector_lower_bound(lo, sector_used(lo), from_s);
+    xSemaphoreGive(s_mutex);
+}
+
+size_t sample_store_read(
+        sample_store_iter_t* it, sample_record_t* out, size_t max)
+{
+    if (s_part == NULL || s_empty) {
+        return 0;
+    }
+
+    size_t n = 0;
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    if (it->seq < s_oldest_seq) {
+        it->seq = s_oldest_seq;
+        it->idx = 0;
+    }
+
+    while (n < max && it->seq <= s_head_seq) {
+        uint32_t used = sector_used(it->seq);
+        if (it->idx >= used) {
+            if (it->seq == s_head_seq) {
+                break;
+            }
+            it->seq++;
+            it->idx = 0;
+            continue;
+        }
+
+        uint32_t k = used - it->idx;
+        if (k > max - n) {
+            k = max - n;
+        }
+        if (esp_partition_read(
+                    s_part,
+                    record_offset(it->seq, it->idx),
+                    &out[n],
+                    k * RECORD_SIZE)
+            != ESP_OK) {
+            break;
+        }
+        n += k;
+        it->idx += k;
+    }
+    xSemaphoreGive(s_mutex);
+    return n;
+}
+
+void sample_store_get_info(sample_store_info_t* out)
+{
+    memset(out, 0, sizeof(*out));
+    if (s_part == NULL) {
+        return;
+    }
+
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    out->capacity = s_sectors * RECORDS_PER_SECTOR;
+    if (!s_empty) {
+        out->count = (s_head_seq - s_oldest_seq) * RECORDS_PER_SECTOR
+                   + s_head_idx;
+        out->newest_s = s_last_time;
+        out->oldest_s = record_time(s_oldest_seq, 0);
+    }
+    xSemaphoreGive(s_mutex);
+}
+
+esp_err_t sample_store_driver_init(void* ctx)
+{
+    return sample_store_init();
+}
+
+esp_err_t sample_store_driver_read(void* ctx)
+{
+    sample_values_t v = {.time_s = (uint32_t)time(NULL)};
+    float t_dht, t_bmp, lpg, co, nh3;
+    uint8_t dht_valid, bmp_valid, pms_valid;
+
+    sensor_data_get_dht(&t_dht, &v.humidity, &dht_valid);
+    sensor_data_get_bmp(&t_bmp, &v.pressure, &bmp_valid);
+    sensor_data_get_pms5003(&v.pm1_0, &v.pm2_5, &v.pm10, &pms_valid);
+    sensor_data_get_mq(&v.co2, &lpg, &co, &nh3);
+    v.temperature = sensor_data_get_temp_avg();
+
+    bool gas_valid = sensor_data_is_fresh(SENSOR_MQ);
+    v.flags = (dht_valid ? SAMPLE_F_DHT : 0) | (bmp_valid ? SAMPLE_F_BMP : 0)
+            | (gas_valid ? SAMPLE_F_GAS : 0) | (pms_valid ? SAMPLE_F_PMS : 0);
+
+    return sample_store_append(&v);
+}
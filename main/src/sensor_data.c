@@ -1,10 +1,30 @@
 #include "sensor_data.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "rules.h"
+#include "sensor_stats.h"
 #include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
 
 static const char* TAG = "SENSOR_DATA";
 static sensor_data_t sensor_data;
 
+static const uint32_t s_default_max_age_ms[SENSOR_GROUP_COUNT] = {
+        [SENSOR_DHT] = SENSOR_DHT_MAX_AGE_MS,
+        [SENSOR_BMP] = SENSOR_BMP_MAX_AGE_MS,
+        [SENSOR_MQ] = SENSOR_MQ_MAX_AGE_MS,
+        [SENSOR_PMS] = SENSOR_PMS_MAX_AGE_MS,
+};
+
+static const char* const s_group_names[SENSOR_GROUP_COUNT] = {
+        "dht",
+        "bmp",
+        "mq",
+        "pms",
+};
+
 void sensor_data_init(void)
 {
     sensor_data.mutex = xSemaphoreCreateMutex();
@@ -13,41 +33,282 @@ void sensor_data_init(void)
     }
 
     sensor_data.dht_valid = 0;
+    memcpy(sensor_data.max_age_ms,
+           s_default_max_age_ms,
+           sizeof(sensor_data.max_age_ms));
+    temp_fusion_init(&sensor_data.fusion);
+    derived_init(&sensor_data.derived);
+    pressure_trend_init(&sensor_data.trend);
+    sensor_stats_init();
+}
+
+static uint32_t now_ms(void)
+{
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+// Вызывается под мьютексом
+static void stamp(sensor_group_t group)
+{
+    time_t wall = time(NULL);
+    sensor_data.stamp[group] = (sensor_stamp_t){
+            .mono_us = esp_timer_get_time(),
+            .wall_s = wall >= SENSOR_WALL_CLOCK_MIN_S ? (int64_t)wall : 0,
+    };
+}
+
+// Вызывается под мьютексом
+static bool is_fresh(sensor_group_t group, int64_t now_us)
+{
+    int64_t t = sensor_data.stamp[group].mono_us;
+    return t != 0
+        && now_us - t <= (int64_t)sensor_data.max_age_ms[group] * 1000;
+}
+
+// Вызывается после освобождения мьютекса
+static void metric_add(stats_metric_t metric, float value)
+{
+    sensor_stats_add(metric, value);
+    rules_feed(metric, value);
 }
 
 float sensor_data_get_temp_avg(void)
 {
-    float t_dht, h_dht, t_bmp, p_bmp;
-    uint8_t dht_valid, bmp_valid;
-    sensor_data_get_dht(&t_dht, &h_dht, &dht_valid);
-    sensor_data_get_bmp(&t_bmp, &p_bmp, &bmp_valid);
+    float temperature = 0.0f, confidence;
+    sensor_data_get_temp_fused(&temperature, &confidence);
+    return temperature;
+}
+
+void sensor_data_get_temp_fused(float* temperature, float* confidence)
+{
+    int64_t now_us = esp_timer_get_time();
+    if (xSemaphoreTake(sensor_data.mutex, portMAX_DELAY) == pdTRUE) {
+        *temperature = sensor_data.fusion.value;
+        *confidence = sensor_data.fusion.confidence;
+        // Оба датчика молчат — значению не доверяем
+        if (!is_fresh(SENSOR_DHT, now_us) && !is_fresh(SENSOR_BMP, now_us)) {
+            *confidence = 0.0f;
+        }
+        xSemaphoreGive(sensor_data.mutex);
+    }
+}
+
+void sensor_data_get_stamp(sensor_group_t group, sensor_stamp_t* out)
+{
+    if (xSemaphoreTake(sensor_data.mutex, portMAX_DELAY) == pdTRUE) {
+        *out = sensor_data.stamp[group];
+        xSemaphoreGive(sensor_data.mutex);
+    }
+}
 
-    if (dht_valid && bmp_valid)
-        return (t_dht + t_bmp) / 2.0f;
-    if (dht_valid)
-        return t_dht;
-    if (bmp_valid)
-        return t_bmp;
-    return 0.0f;
+int64_t sensor_data_age_ms(sensor_group_t group)
+{
+    sensor_stamp_t st = {0};
+    sensor_data_get_stamp(group, &st);
+    if (st.mono_us == 0) {
+        return -1;
+    }
+    return (esp_timer_get_time() - st.mono_us) / 1000;
+}
+
+bool sensor_data_is_fresh(sensor_group_t group)
+{
+    bool fresh = false;
+    int64_t now_us = esp_timer_get_time();
+    if (xSemaphoreTake(sensor_data.mutex, portMAX_DELAY) == pdTRUE) {
+        fresh = is_fresh(group, now_us);
+        xSemaphoreGive(sensor_data.mutex);
+    }
+    return fresh;
+}
+
+void sensor_data_set_max_age(sensor_group_t group, uint32_t max_age_ms)
+{
+    if (group >= SENSOR_GROUP_COUNT) {
+        return;
+    }
+    if (xSemaphoreTake(sensor_data.mutex, portMAX_DELAY) == pdTRUE) {
+        sensor_data.max_age_ms[group] = max_age_ms;
+        xSemaphoreGive(sensor_data.mutex);
+    }
+}
+
+static uint32_t max_u32(uint32_t a, uint32_t b)
+{
+    return a > b ? a : b;
+}
+
+void sensor_data_set_period(sensor_group_t group, uint32_t period_ms)
+{
+    if (group >= SENSOR_GROUP_COUNT) {
+        return;
+    }
+    uint64_t age = (uint64_t)period_ms * SENSOR_MAX_AGE_PERIODS;
+    if (age > UINT32_MAX) {
+        age = UINT32_MAX;
+    }
+    if (xSemaphoreTake(sensor_data.mutex, portMAX_DELAY) == pdTRUE) {
+        sensor_data.max_age_ms[group] =
+                max_u32((uint32_t)age, s_default_max_age_ms[group]);
+        if (group == SENSOR_DHT || group == SENSOR_BMP) {
+            temp_fusion_set_max_age(
+                    &sensor_data.fusion,
+                    group == SENSOR_DHT ? TEMP_SRC_DHT : TEMP_SRC_BMP,
+                    max_u32((uint32_t)age, TEMP_FUSION_MAX_AGE_MS));
+        }
+        xSemaphoreGive(sensor_data.mutex);
+    }
+}
+
+// "key":{"dht":..,..}, значение none выводится как null
+static int format_groups(
+        char* buf, size_t len, const char* key, const int64_t* v, int64_t none)
+{
+    int n = snprintf(buf, len, "\"%s\":{", key);
+    for (int g = 0; g < SENSOR_GROUP_COUNT && n >= 0 && (size_t)n < len; g++) {
+        const char* sep = g ? "," : "";
+        if (v[g] == none) {
+            n += snprintf(
+                    buf + n, len - n, "%s\"%s\":null", sep, s_group_names[g]);
+        } else {
+            n += snprintf(
+                    buf + n,
+                    len - n,
+                    "%s\"%s\":%lld",
+                    sep,
+                    s_group_names[g],
+                    (long long)v[g]);
+        }
+    }
+    if (n >= 0 && (size_t)n < len) {
+        n += snprintf(buf + n, len - n, "}");
+    }
+    return n;
+}
+
+static void copy_stamps(sensor_stamp_t* st)
+{
+    memset(st, 0, sizeof(sensor_data.stamp));
+    if (xSemaphoreTake(sensor_data.mutex, portMAX_DELAY) == pdTRUE) {
+        memcpy(st, sensor_data.stamp, sizeof(sensor_data.stamp));
+        xSemaphoreGive(sensor_data.mutex);
+    }
+}
+
+int sensor_data_format_ages(char* buf, size_t len)
+{
+    sensor_stamp_t st[SENSOR_GROUP_COUNT];
+    copy_stamps(st);
+
+    int64_t now_us = esp_timer_get_time();
+    int64_t age[SENSOR_GROUP_COUNT];
+    for (int g = 0; g < SENSOR_GROUP_COUNT; g++) {
+        age[g] = st[g].mono_us ? (now_us - st[g].mono_us) / 1000 : -1;
+    }
+    return format_groups(buf, len, "age_ms", age, -1);
+}
+
+int sensor_data_format_times(char* buf, size_t len)
+{
+    sensor_stamp_t st[SENSOR_GROUP_COUNT];
+    copy_stamps(st);
+
+    int64_t wall[SENSOR_GROUP_COUNT];
+    for (int g = 0; g < SENSOR_GROUP_COUNT; g++) {
+        wall[g] = st[g].wall_s;
+    }
+    return format_groups(buf, len, "ts", wall, 0);
+}
+
+int sensor_data_format_stamps(char* buf, size_t len)
+{
+    int n = sensor_data_format_ages(buf, len);
+    if (n >= 0 && (size_t)n + 1 < len) {
+        buf[n++] = ',';
+        int m = sensor_data_format_times(buf + n, len - n);
+        n = m < 0 ? m : n + m;
+    }
+    return n;
+}
+
+uint32_t sensor_data_get_generation(uint8_t* fresh_mask)
+{
+    uint32_t gen = 0;
+    uint8_t mask = 0;
+    int64_t now_us = esp_timer_get_time();
+    if (xSemaphoreTake(sensor_data.mutex, portMAX_DELAY) == pdTRUE) {
+        gen = sensor_data.generation;
+        for (int g = 0; g < SENSOR_GROUP_COUNT; g++) {
+            if (is_fresh(g, now_us)) {
+                mask |= 1u << g;
+            }
+        }
+        xSemaphoreGive(sensor_data.mutex);
+    }
+    *fresh_mask = mask;
+    return gen;
+}
+
+const char* sensor_data_group_name(sensor_group_t group)
+{
+    return group < SENSOR_GROUP_COUNT ? s_group_names[group] : "";
+}
+
+void sensor_data_get_derived(derived_metrics_t* out)
+{
+    if (xSemaphoreTake(sensor_data.mutex, portMAX_DELAY) == pdTRUE) {
+        *out = sensor_data.derived;
+        xSemaphoreGive(sensor_data.mutex);
+    }
+}
+
+void sensor_data_get_trend(pressure_trend_t* out)
+{
+    if (xSemaphoreTake(sensor_data.mutex, portMAX_DELAY) == pdTRUE) {
+        *out = sensor_data.trend;
+        xSemaphoreGive(sensor_data.mutex);
+    }
 }
 
 void sensor_data_set_dht(float temperature_dht, float humidity, uint8_t valid)
 {
     if (xSemaphoreTake(sensor_data.mutex, portMAX_DELAY) == pdTRUE) {
+        sensor_data.generation++;
         sensor_data.temperature_dht = temperature_dht;
         sensor_data.humidity = humidity;
         sensor_data.dht_valid = valid;
+        if (valid) {
+            stamp(SENSOR_DHT);
+        }
+        temp_fusion_update(
+                &sensor_data.fusion,
+                TEMP_SRC_DHT,
+                temperature_dht,
+                valid,
+                now_ms());
+        if (valid) {
+            derived_update_humidity(
+                    &sensor_data.derived, temperature_dht, humidity);
+        } else {
+            derived_invalidate_humidity(&sensor_data.derived);
+        }
         xSemaphoreGive(sensor_data.mutex);
     }
+
+    if (valid) {
+        metric_add(STATS_TEMP_DHT, temperature_dht);
+        metric_add(STATS_HUMIDITY, humidity);
+    }
 }
 
 void sensor_data_get_dht(
         float* temperature_dht, float* humidity, uint8_t* valid)
 {
+    int64_t now_us = esp_timer_get_time();
     if (xSemaphoreTake(sensor_data.mutex, portMAX_DELAY) == pdTRUE) {
         *temperature_dht = sensor_data.temperature_dht;
         *humidity = sensor_data.humidity;
-        *valid = sensor_data.dht_valid;
+        *valid = sensor_data.dht_valid && is_fresh(SENSOR_DHT, now_us);
         xSemaphoreGive(sensor_data.mutex);
     }
 }
@@ -55,20 +316,47 @@ void sensor_data_get_dht(
 void sensor_data_set_bmp(float temperature_bmp, float pressure, uint8_t valid)
 {
     if (xSemaphoreTake(sensor_data.mutex, portMAX_DELAY) == pdTRUE) {
+        sensor_data.generation++;
         sensor_data.temperature_bmp = temperature_bmp;
         sensor_data.pressure = pressure;
         sensor_data.bmp_valid = valid;
+        if (valid) {
+            stamp(SENSOR_BMP);
+        }
+        temp_fusion_update(
+                &sensor_data.fusion,
+                TEMP_SRC_BMP,
+                temperature_bmp,
+                valid,
+                now_ms());
+        if (valid) {
+            derived_update_pressure(
+                    &sensor_data.derived, pressure, temperature_bmp);
+            pressure_trend_add(
+                    &sensor_data.trend,
+                    pressure,
+                    sensor_data.derived.sea_level_pressure,
+                    (uint32_t)(esp_timer_get_time() / 1000000));
+        } else {
+            derived_invalidate_pressure(&sensor_data.derived);
+        }
         xSemaphoreGive(sensor_data.mutex);
     }
+
+    if (valid) {
+        metric_add(STATS_TEMP_BMP, temperature_bmp);
+        metric_add(STATS_PRESSURE, pressure);
+    }
 }
 
 void sensor_data_get_bmp(
         float* temperature_bmp, float* pressure, uint8_t* valid)
 {
+    int64_t now_us = esp_timer_get_time();
     if (xSemaphoreTake(sensor_data.mutex, portMAX_DELAY) == pdTRUE) {
         *temperature_bmp = sensor_data.temperature_bmp;
         *pressure = sensor_data.pressure;
-        *valid = sensor_data.bmp_valid;
+        *valid = sensor_data.bmp_valid && is_fresh(SENSOR_BMP, now_us);
         xSemaphoreGive(sensor_data.mutex);
     }
 }
@@ -83,6 +371,7 @@ void sensor_data_set_mq(
         float nh3)
 {
     if (xSemaphoreTake(sensor_data.mutex, portMAX_DELAY) == pdTRUE) {
+        sensor_data.generation++;
         sensor_data.mq_raw_adc = raw_adc;
         sensor_data.mq_voltage = voltage;
         sensor_data.mq_rs_ro_ratio = rs_ro_ratio;
@@ -90,8 +379,15 @@ void sensor_data_set_mq(
         sensor_data.lpg_ppm = lpg;
         sensor_data.co_ppm = co;
         sensor_data.nh3_ppm = nh3;
+        stamp(SENSOR_MQ);
+        derived_update_air_level(&sensor_data.derived, co2, co, lpg, nh3);
         xSemaphoreGive(sensor_data.mutex);
     }
+
+    metric_add(STATS_CO2, co2);
+    metric_add(STATS_CO, co);
+    metric_add(STATS_NH3, nh3);
+    metric_add(STATS_LPG, lpg);
 }
 
 void sensor_data_get_mq(float* co2, float* lpg, float* co, float* nh3)
@@ -108,22 +404,30 @@ void sensor_data_get_mq(float* co2, float* lpg, float* co, float* nh3)
 void sensor_data_set_pms5003(const pms5003_data_t* data)
 {
     if (xSemaphoreTake(sensor_data.mutex, portMAX_DELAY) == pdTRUE) {
+        sensor_data.generation++;
         sensor_data.pm1_0 = data->pm1_0;
         sensor_data.pm2_5 = data->pm2_5;
         sensor_data.pm10 = data->pm10;
         sensor_data.pms_valid = 1;
+        stamp(SENSOR_PMS);
+        derived_update_aqi(&sensor_data.derived, data->pm2_5, data->pm10);
         xSemaphoreGive(sensor_data.mutex);
     }
+
+    metric_add(STATS_PM1_0, data->pm1_0);
+    metric_add(STATS_PM2_5, data->pm2_5);
+    metric_add(STATS_PM10, data->pm10);
 }
 
 void sensor_data_get_pms5003(
         uint16_t* pm1_0, uint16_t* pm2_5, uint16_t* pm10, uint8_t* valid)
 {
+    int64_t now_us = esp_timer_get_time();
     if (xSemaphoreTake(sensor_data.mutex, portMAX_DELAY) == pdTRUE) {
         *pm1_0 = sensor_data.pm1_0;
         *pm2_5 = sensor_data.pm2_5;
         *pm10 = sensor_data.pm10;
-        *valid = sensor_data.pms_valid;
+        *valid = sensor_data.pms_valid && is_fresh(SENSOR_PMS, now_us);
         xSemaphoreGive(sensor_data.mutex);
     }
 }
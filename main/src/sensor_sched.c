@@ -0,0 +1,377 @@
+#include "sensor_sched.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include "metrics.h"
+#include <string.h>
+
+static const char* TAG = "SENSOR_SCHED";
+
+#define COALESCE_US (SENSOR_SCHED_COALESCE_MS * 1000LL)
+#define STATS_LOG_PERIOD_US (SENSOR_SCHED_STATS_LOG_S * 1000000LL)
+
+typedef enum {
+    SCHED_EV_START,
+    SCHED_EV_READ,
+} sched_ev_type_t;
+
+typedef struct {
+    int64_t at_us;
+    uint8_t slot;
+    uint8_t type;
+} sched_event_t;
+
+typedef struct {
+    sensor_driver_t* drv;
+    int64_t deadline_us; // момент выборки, к которому относится событие
+    bool ready;          // init прошёл успешно
+    volatile bool busy;  // чтение ещё выполняется в рабочей задаче
+    uint32_t overruns;
+    metrics_timer_t read_timer;
+} sched_slot_t;
+
+static sched_slot_t s_slots[SENSOR_SCHED_MAX_DRIVERS];
+static size_t s_slot_count = 0;
+static int64_t s_epoch_us = 0;
+
+// Очередь событий, отсортированная по времени; на датчик не больше одного
+static sched_event_t s_events[SENSOR_SCHED_MAX_DRIVERS];
+static size_t s_event_count = 0;
+
+static QueueHandle_t s_worker_queue = NULL;
+static TaskHandle_t s_task = NULL;
+
+// Новые периоды от sensor_sched_set_period; 0 — без изменений
+static uint32_t s_new_period_ms[SENSOR_SCHED_MAX_DRIVERS];
+static portMUX_TYPE s_period_mux = portMUX_INITIALIZER_UNLOCKED;
+
+// Опоздание пробуждения относительно запланированного момента
+static uint32_t s_wakes = 0;
+static uint32_t s_wake_late_max_us = 0;
+static uint64_t s_wake_late_total_us = 0;
+
+static void sched_push(int64_t at_us, uint8_t slot, sched_ev_type_t type)
+{
+    size_t i = s_event_count++;
+    while (i > 0 && s_events[i - 1].at_us > at_us) {
+        s_events[i] = s_events[i - 1];
+        i--;
+    }
+    s_events[i] = (sched_event_t){.at_us = at_us, .slot = slot, .type = type};
+}
+
+static sched_event_t sched_pop(void)
+{
+    sched_event_t ev = s_events[0];
+    s_event_count--;
+    memmove(&s_events[0], &s_events[1], s_event_count * sizeof(s_events[0]));
+    return ev;
+}
+
+// Ближайший момент сетки периода, не раньше not_before_us
+static int64_t sched_align(const sensor_driver_t* drv, int64_t not_before_us)
+{
+    int64_t period_us = (int64_t)drv->period_ms * 1000;
+    int64_t k = (not_before_us - s_epoch_us + period_us - 1) / period_us;
+    return s_epoch_us + k * period_us;
+}
+
+// Убирает из очереди событие датчика, если оно есть
+static void sched_remove(uint8_t slot)
+{
+    for (size_t i = 0; i < s_event_count; i++) {
+        if (s_events[i].slot == slot) {
+            s_event_count--;
+            memmove(
+                    &s_events[i],
+                    &s_events[i + 1],
+                    (s_event_count - i) * sizeof(s_events[0]));
+            return;
+        }
+    }
+}
+
+static void sched_plan(uint8_t slot, int64_t not_before_us)
+{
+    sched_slot_t* s = &s_slots[slot];
+    int64_t lead_us = 0;
+    if (s->drv->start) {
+        lead_us = (int64_t)s->drv->read_delay_ms * 1000;
+    }
+
+    s->deadline_us = sched_align(s->drv, not_before_us + lead_us);
+    if (s->drv->start) {
+        sched_push(s->deadline_us - lead_us, slot, SCHED_EV_START);
+    } else {
+        sched_push(s->deadline_us, slot, SCHED_EV_READ);
+    }
+}
+
+static void sched_report(const sched_slot_t* s, const char* what, esp_err_t err)
+{
+    if (err != ESP_OK) {
+        ESP_LOGW(
+                TAG,
+                "%s: ошибка %s: %s",
+                s->drv->name,
+                what,
+                esp_err_to_name(err));
+    }
+}
+
+// Чтение с замером длительности для /metrics
+static void sched_do_read(sched_slot_t* s)
+{
+    int64_t start_us = esp_timer_get_time();
+    esp_err_t err = s->drv->read(s->drv->ctx);
+    metrics_timer_record(
+            &s->read_timer,
+            (uint32_t)(esp_timer_get_time() - start_us),
+            err == ESP_OK);
+    sched_report(s, "чтения", err);
+}
+
+static void sched_read(uint8_t slot)
+{
+    sched_slot_t* s = &s_slots[slot];
+
+    if (!s->drv->blocking) {
+        sched_do_read(s);
+        return;
+    }
+
+    if (!s->busy) {
+        s->busy = true;
+        if (xQueueSend(s_worker_queue, &slot, 0) == pdTRUE) {
+            return;
+        }
+        s->busy = false;
+    }
+
+    s->overruns++;
+    ESP_LOGW(
+            TAG,
+            "%s: предыдущее чтение не завершено, пропуск (%lu)",
+            s->drv->name,
+            (unsigned long)s->overruns);
+}
+
+static void sched_handle(const sched_event_t* ev)
+{
+    sched_slot_t* s = &s_slots[ev->slot];
+    int64_t now_us = esp_timer_get_time();
+
+    if (!s->ready) {
+        s->ready = s->drv->init(s->drv->ctx) == ESP_OK;
+        if (!s->ready) {
+            ESP_LOGW(TAG, "%s: инициализация не удалась", s->drv->name);
+            sched_plan(ev->slot, now_us + 1);
+            return;
+        }
+    }
+
+    if (ev->type == SCHED_EV_START) {
+        esp_err_t err = s->drv->start(s->drv->ctx);
+        if (err == ESP_OK) {
+            sched_push(s->deadline_us, ev->slot, SCHED_EV_READ);
+            return;
+        }
+        sched_report(s, "запуска", err);
+    } else {
+        sched_read(ev->slot);
+    }
+
+    sched_plan(ev->slot, s->deadline_us + 1);
+}
+
+static void sched_note_wake(int64_t late_us)
+{
+    uint32_t late = late_us > 0 ? (uint32_t)late_us : 0;
+    s_wakes++;
+    s_wake_late_total_us += late;
+    if (late > s_wake_late_max_us) {
+        s_wake_late_max_us = late;
+    }
+}
+
+static void sched_log_wakes(void)
+{
+    if (s_wakes == 0) {
+        return;
+    }
+    ESP_LOGI(
+            TAG,
+            "Пробуждений %lu, опоздание среднее %lu мкс, макс %lu мкс",
+            (unsigned long)s_wakes,
+            (unsigned long)(s_wake_late_total_us / s_wakes),
+            (unsigned long)s_wake_late_max_us);
+    s_wakes = 0;
+    s_wake_late_max_us = 0;
+    s_wake_late_total_us = 0;
+}
+
+// Смена периода сразу перестраивает план датчика: новая сетка
+// начинается с ближайшего момента, не дожидаясь выборки по старой
+static void sched_apply_periods(int64_t now_us)
+{
+    for (uint8_t i = 0; i < s_slot_count; i++) {
+        portENTER_CRITICAL(&s_period_mux);
+        uint32_t period_ms = s_new_period_ms[i];
+        s_new_period_ms[i] = 0;
+        portEXIT_CRITICAL(&s_period_mux);
+
+        sensor_driver_t* drv = s_slots[i].drv;
+        if (period_ms == 0 || period_ms == drv->period_ms) {
+            continue;
+        }
+        ESP_LOGI(
+                TAG,
+                "%s: период %lu -> %lu мс",
+                drv->name,
+                (unsigned long)drv->period_ms,
+                (unsigned long)period_ms);
+        drv->period_ms = period_ms;
+        sched_remove(i);
+
+        int64_t warm_us = s_epoch_us + (int64_t)drv->warmup_ms * 1000;
+        sched_plan(i, now_us > warm_us ? now_us : warm_us);
+    }
+}
+
+static void sensor_worker_task(void* arg)
+{
+    uint8_t slot;
+
+    while (1) {
+        if (xQueueReceive(s_worker_queue, &slot, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        sched_slot_t* s = &s_slots[slot];
+        sched_do_read(s);
+        s->busy = false;
+    }
+}
+
+static void sensor_sched_task(void* arg)
+{
+    for (uint8_t i = 0; i < s_slot_count; i++) {
+        sched_slot_t* s = &s_slots[i];
+        s->ready = s->drv->init(s->drv->ctx) == ESP_OK;
+        if (!s->ready) {
+            ESP_LOGW(TAG, "%s: инициализация не удалась", s->drv->name);
+        }
+        sched_plan(i, s_epoch_us + (int64_t)s->drv->warmup_ms * 1000);
+    }
+
+    int64_t next_log_us = esp_timer_get_time() + STATS_LOG_PERIOD_US;
+
+    while (1) {
+        int64_t now_us = esp_timer_get_time();
+        sched_apply_periods(now_us);
+        if (s_event_count > 0 && s_events[0].at_us <= now_us) {
+            sched_note_wake(now_us - s_events[0].at_us);
+        }
+
+        // События, до которых осталось меньше окна, обрабатываются
+        // в это же пробуждение, а не отдельным выходом из сна
+        while (s_event_count > 0 && s_events[0].at_us <= now_us + COALESCE_US) {
+            sched_event_t ev = sched_pop();
+            sched_handle(&ev);
+            now_us = esp_timer_get_time();
+        }
+
+        if (now_us >= next_log_us) {
+            sched_log_wakes();
+            next_log_us = now_us + STATS_LOG_PERIOD_US;
+        }
+
+        TickType_t wait = portMAX_DELAY;
+        if (s_event_count > 0) {
+            int64_t wait_ms = (s_events[0].at_us - now_us + 999) / 1000;
+            wait = pdMS_TO_TICKS(wait_ms);
+            if (wait == 0) {
+                wait = 1;
+            }
+        }
+        // Ожидание прерывает только смена периода
+        ulTaskNotifyTake(pdTRUE, wait);
+    }
+}
+
+esp_err_t sensor_sched_start(sensor_driver_t* drivers, size_t count)
+{
+    if (drivers == NULL || count == 0 || count > SENSOR_SCHED_MAX_DRIVERS) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        if (drivers[i].init == NULL || drivers[i].read == NULL
+            || drivers[i].period_ms == 0) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        s_slots[i] = (sched_slot_t){.drv = &drivers[i]};
+    }
+    s_slot_count = count;
+    s_epoch_us = esp_timer_get_time();
+
+    s_worker_queue = xQueueCreate(SENSOR_SCHED_MAX_DRIVERS, sizeof(uint8_t));
+    if (s_worker_queue == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    // Рабочая задача выполняет и чтение DHT22 с критической секцией,
+    // поэтому остаётся на ядре 1, как прежняя задача DHT22
+    if (xTaskCreatePinnedToCore(
+                sensor_worker_task,
+                "sensor_worker",
+                SENSOR_SCHED_WORKER_STACK,
+                NULL,
+                SENSOR_SCHED_TASK_PRIO,
+                NULL,
+                1)
+        != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    if (xTaskCreatePinnedToCore(
+                sensor_sched_task,
+                "sensor_sched",
+                SENSOR_SCHED_TASK_STACK,
+                NULL,
+                SENSOR_SCHED_TASK_PRIO,
+                &s_task,
+                0)
+        != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(TAG, "Планировщик запущен, датчиков: %u", (unsigned)count);
+    return ESP_OK;
+}
+
+esp_err_t sensor_sched_set_period(size_t index, uint32_t period_ms)
+{
+    if (index >= s_slot_count || period_ms == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    portENTER_CRITICAL(&s_period_mux);
+    s_new_period_ms[index] = period_ms;
+    portEXIT_CRITICAL(&s_period_mux);
+    if (s_task != NULL) {
+        xTaskNotifyGive(s_task);
+    }
+    return ESP_OK;
+}
+
+bool sensor_sched_get_timer(
+        int index, const char** name, const metrics_timer_t** timer)
+{
+    if (index < 0 || (size_t)index >= s_slot_count) {
+        return false;
+    }
+    *name = s_slots[index].drv->name;
+    *timer = &s_slots[index].read_timer;
+    return true;
+}
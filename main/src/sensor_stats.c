@@ -0,0 +1,280 @@
+#include "sensor_stats.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+typedef struct {
+    uint32_t count;
+    float mean;
+    float m2;
+    float min;
+    float max;
+} stats_acc_t;
+
+typedef struct {
+    const char* name;
+    uint32_t len_s;
+    uint32_t sub_s;
+    uint8_t sub_count;
+    uint8_t sub_offset; // в общем пуле подкорзин метрики
+} stats_window_def_t;
+
+#define SUB_TOTAL (6 + 15 + 12)
+
+static const stats_window_def_t s_windows[STATS_WIN_COUNT] = {
+        [STATS_WIN_1M] = {"1m", 60, 10, 6, 0},
+        [STATS_WIN_15M] = {"15m", 900, 60, 15, 6},
+        [STATS_WIN_1H] = {"1h", 3600, 300, 12, 21},
+};
+
+static const char* const s_metric_names[STATS_METRIC_COUNT] = {
+        [STATS_TEMP_DHT] = "temperature_dht",
+        [STATS_HUMIDITY] = "humidity",
+        [STATS_TEMP_BMP] = "temperature_bmp",
+        [STATS_PRESSURE] = "pressure",
+        [STATS_CO2] = "CO2",
+        [STATS_CO] = "CO",
+        [STATS_NH3] = "NH3",
+        [STATS_LPG] = "LPG",
+        [STATS_PM1_0] = "pm1_0",
+        [STATS_PM2_5] = "pm2_5",
+        [STATS_PM10] = "pm10",
+};
+
+typedef struct {
+    stats_acc_t cur;  // текущее окно сетки
+    stats_acc_t last; // последнее завершённое
+    uint32_t cur_index;
+    uint32_t sub_index; // номер самой новой подкорзины
+} stats_win_state_t;
+
+typedef struct {
+    bool started;
+    stats_win_state_t win[STATS_WIN_COUNT];
+    stats_acc_t sub[SUB_TOTAL];
+} stats_metric_state_t;
+
+static stats_metric_state_t s_metrics[STATS_METRIC_COUNT];
+static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static uint32_t now_s(void)
+{
+    return (uint32_t)(esp_timer_get_time() / 1000000);
+}
+
+static void acc_add(stats_acc_t* a, float x)
+{
+    a->count++;
+    float delta = x - a->mean;
+    a->mean += delta / a->count;
+    a->m2 += delta * (x - a->mean);
+    if (a->count == 1 || x < a->min) {
+        a->min = x;
+    }
+    if (a->count == 1 || x > a->max) {
+        a->max = x;
+    }
+}
+
+static void acc_merge(stats_acc_t* a, const stats_acc_t* b)
+{
+    if (b->count == 0) {
+        return;
+    }
+    if (a->count == 0) {
+        *a = *b;
+        return;
+    }
+    uint32_t n = a->count + b->count;
+    float delta = b->mean - a->mean;
+    a->mean += delta * b->count / n;
+    a->m2 += b->m2 + delta * delta * ((float)a->count * b->count / n);
+    a->min = fminf(a->min, b->min);
+    a->max = fmaxf(a->max, b->max);
+    a->count = n;
+}
+
+// Сдвигает окно к моменту t: закрывает окно сетки и очищает
+// подкорзины, через которые перешли
+static void window_roll(stats_metric_state_t* m, stats_window_t w, uint32_t t)
+{
+    const stats_window_def_t* def = &s_windows[w];
+    stats_win_state_t* ws = &m->win[w];
+    stats_acc_t* sub = &m->sub[def->sub_offset];
+
+    uint32_t idx = t / def->len_s;
+    if (idx != ws->cur_index) {
+        if (idx == ws->cur_index + 1) {
+            ws->last = ws->cur;
+        } else {
+            memset(&ws->last, 0, sizeof(ws->last));
+        }
+        memset(&ws->cur, 0, sizeof(ws->cur));
+        ws->cur_index = idx;
+    }
+
+    uint32_t sidx = t / def->sub_s;
+    uint32_t steps = sidx - ws->sub_index;
+    if (steps >= def->sub_count) {
+        memset(sub, 0, def->sub_count * sizeof(sub[0]));
+    } else {
+        for (uint32_t k = 1; k <= steps; k++) {
+            memset(&sub[(ws->sub_index + k) % def->sub_count],
+                   0,
+                   sizeof(sub[0]));
+        }
+    }
+    ws->sub_index = sidx;
+}
+
+static void metric_start(stats_metric_state_t* m, uint32_t t)
+{
+    memset(m, 0, sizeof(*m));
+    for (int w = 0; w < STATS_WIN_COUNT; w++) {
+        m->win[w].cur_index = t / s_windows[w].len_s;
+        m->win[w].sub_index = t / s_windows[w].sub_s;
+    }
+    m->started = true;
+}
+
+void sensor_stats_init(void)
+{
+    portENTER_CRITICAL(&s_mux);
+    memset(s_metrics, 0, sizeof(s_metrics));
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void sensor_stats_add_at(stats_metric_t metric, float value, uint32_t t)
+{
+    if (metric >= STATS_METRIC_COUNT || !isfinite(value)) {
+        return;
+    }
+
+    portENTER_CRITICAL(&s_mux);
+    stats_metric_state_t* m = &s_metrics[metric];
+    if (!m->started) {
+        metric_start(m, t);
+    }
+    for (int w = 0; w < STATS_WIN_COUNT; w++) {
+        const stats_window_def_t* def = &s_windows[w];
+        window_roll(m, w, t);
+        acc_add(&m->win[w].cur, value);
+        acc_add(&m->sub[def->sub_offset
+                        + m->win[w].sub_index % def->sub_count],
+                value);
+    }
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void sensor_stats_add(stats_metric_t metric, float value)
+{
+    sensor_stats_add_at(metric, value, now_s());
+}
+
+void sensor_stats_get(
+        stats_metric_t metric,
+        stats_window_t window,
+        bool sliding,
+        sensor_stats_t* out)
+{
+    stats_acc_t acc = {0};
+    memset(out, 0, sizeof(*out));
+    if (metric >= STATS_METRIC_COUNT || window >= STATS_WIN_COUNT) {
+        return;
+    }
+
+    const stats_window_def_t* def = &s_windows[window];
+    uint32_t t = now_s();
+
+    portENTER_CRITICAL(&s_mux);
+    stats_metric_state_t* m = &s_metrics[metric];
+    if (m->started) {
+        window_roll(m, window, t);
+        if (sliding) {
+            for (int i = 0; i < def->sub_count; i++) {
+                acc_merge(&acc, &m->sub[def->sub_offset + i]);
+            }
+        } else {
+            acc = m->win[window].last;
+        }
+    }
+    portEXIT_CRITICAL(&s_mux);
+
+    out->count = acc.count;
+    if (acc.count == 0) {
+        return;
+    }
+    out->mean = acc.mean;
+    out->min = acc.min;
+    out->max = acc.max;
+    out->stddev = acc.count > 1 ? sqrtf(fmaxf(acc.m2, 0.0f) / (acc.count - 1))
+                                : 0.0f;
+}
+
+const char* sensor_stats_metric_name(stats_metric_t metric)
+{
+    return metric < STATS_METRIC_COUNT ? s_metric_names[metric] : "";
+}
+
+const char* sensor_stats_window_name(stats_window_t window)
+{
+    return window < STATS_WIN_COUNT ? s_windows[window].name : "";
+}
+
+int sensor_stats_format(const sensor_stats_t* st, char* buf, size_t len)
+{
+    if (st->count == 0) {
+        return snprintf(buf, len, "{\"n\":0}");
+    }
+    return snprintf(
+            buf,
+            len,
+            "{\"n\":%lu,\"mean\":%.2f,\"sd\":%.3f,\"min\":%.2f,\"max\":%.2f}",
+            (unsigned long)st->count,
+            st->mean,
+            st->stddev,
+            st->min,
+            st->max);
+}
+
+int sensor_stats_format_metric(stats_metric_t metric, char* buf, size_t len)
+{
+    int pos = snprintf(buf, len, "\"%s\":{", sensor_stats_metric_name(metric));
+
+    for (int w = 0; w < STATS_WIN_COUNT && pos >= 0 && (size_t)pos < len;
+         w++) {
+        sensor_stats_t tumbling, sliding;
+        sensor_stats_get(metric, w, false, &tumbling);
+        sensor_stats_get(metric, w, true, &sliding);
+
+        pos += snprintf(
+                buf + pos,
+                len - pos,
+                "%s\"%s\":{\"tumbling\":",
+                w > 0 ? "," : "",
+                s_windows[w].name);
+        if ((size_t)pos >= len) {
+            break;
+        }
+        pos += sensor_stats_format(&tumbling, buf + pos, len - pos);
+        if ((size_t)pos >= len) {
+            break;
+        }
+        pos += snprintf(buf + pos, len - pos, ",\"sliding\":");
+        if ((size_t)pos >= len) {
+            break;
+        }
+        pos += sensor_stats_format(&sliding, buf + pos, len - pos);
+        if ((size_t)pos >= len) {
+            break;
+        }
+        pos += snprintf(buf + pos, len - pos, "}");
+    }
+
+    if (pos >= 0 && (size_t)pos < len) {
+        pos += snprintf(buf + pos, len - pos, "}");
+    }
+    return pos;
+}
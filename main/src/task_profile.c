@@ -0,0 +1,212 @@
+#include "task_profile.h"
+#include "esp_log.h"
+#include "freertos/semphr.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char* TAG = "TASK_PROF";
+
+#if CONFIG_FREERTOS_USE_TRACE_FACILITY                                         \
+        && CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS                             \
+        && CONFIG_FREERTOS_VTASKLIST_INCLUDE_COREID
+#define TASK_PROFILE_SUPPORTED 1
+#else
+#define TASK_PROFILE_SUPPORTED 0
+#endif
+
+#if TASK_PROFILE_SUPPORTED
+
+typedef struct {
+    UBaseType_t number;
+    configRUN_TIME_COUNTER_TYPE runtime;
+} prev_entry_t;
+
+// Снимки берут и httpd, и задача лога
+static SemaphoreHandle_t s_mutex = NULL;
+static StaticSemaphore_t s_mutex_buf;
+static TaskStatus_t s_status[TASK_PROFILE_MAX_TASKS];
+static prev_entry_t s_prev[TASK_PROFILE_MAX_TASKS];
+static size_t s_prev_count = 0;
+static configRUN_TIME_COUNTER_TYPE s_prev_total = 0;
+
+static configRUN_TIME_COUNTER_TYPE prev_runtime(UBaseType_t number)
+{
+    for (size_t i = 0; i < s_prev_count; i++) {
+        if (s_prev[i].number == number) {
+            return s_prev[i].runtime;
+        }
+    }
+    return 0; // задача появилась после прошлого снимка
+}
+
+static esp_err_t take_snapshot(task_profile_t* out)
+{
+    configRUN_TIME_COUNTER_TYPE total;
+    UBaseType_t n = uxTaskGetSystemState(
+            s_status, TASK_PROFILE_MAX_TASKS, &total);
+
+    memset(out, 0, sizeof(*out));
+    if (n == 0) {
+        // Массив меньше числа задач: FreeRTOS не заполняет ничего.
+        // Прошлый снимок не трогаем, окно продлится до следующего
+        ESP_LOGE(
+                TAG,
+                "Задач %u больше TASK_PROFILE_MAX_TASKS (%d), "
+                "снимок пропущен",
+                (unsigned)uxTaskGetNumberOfTasks(),
+                TASK_PROFILE_MAX_TASKS);
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    configRUN_TIME_COUNTER_TYPE elapsed = total - s_prev_total;
+    // Счётчик run-time stats тикает в микросекундах (esp_timer)
+    out->window_ms = (uint32_t)(elapsed / 1000);
+
+    for (UBaseType_t i = 0; i < n; i++) {
+        const TaskStatus_t* st = &s_status[i];
+        configRUN_TIME_COUNTER_TYPE delta
+                = st->ulRunTimeCounter - prev_runtime(st->xTaskNumber);
+
+        task_profile_entry_t* e = &out->tasks[i];
+        snprintf(e->name, sizeof(e->name), "%s", st->pcTaskName);
+        e->number = st->xTaskNumber;
+        e->prio = st->uxCurrentPriority;
+        e->core = st->xCoreID < portNUM_PROCESSORS ? st->xCoreID : -1;
+        e->stack_free = st->usStackHighWaterMark * sizeof(StackType_t);
+        if (elapsed > 0) {
+            e->cpu_pct = 100.0f * delta / (elapsed * portNUM_PROCESSORS);
+            if (strncmp(st->pcTaskName, "IDLE", 4) == 0 && e->core >= 0) {
+                out->idle_pct[e->core] = 100.0f * delta / elapsed;
+            }
+        }
+
+        s_prev[i] = (prev_entry_t){
+                .number = st->xTaskNumber,
+                .runtime = st->ulRunTimeCounter,
+        };
+    }
+    out->count = n;
+    s_prev_count = n;
+    s_prev_total = total;
+    return ESP_OK;
+}
+
+esp_err_t task_profile_sample(task_profile_t* out)
+{
+    if (s_mutex == NULL) {
+        // Первый вызов — из app_main до запуска httpd и задачи лога
+        s_mutex = xSemaphoreCreateMutexStatic(&s_mutex_buf);
+    }
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    esp_err_t err = take_snapshot(out);
+    xSemaphoreGive(s_mutex);
+    return err;
+}
+
+static void task_profile_log(const task_profile_t* p)
+{
+    // Три самых загруженных задачи, кроме IDLE
+    const task_profile_entry_t* top[3] = {NULL};
+    const task_profile_entry_t* tight = NULL;
+    for (size_t i = 0; i < p->count; i++) {
+        const task_profile_entry_t* t = &p->tasks[i];
+        if (tight == NULL || t->stack_free < tight->stack_free) {
+            tight = t;
+        }
+        if (strncmp(t->name, "IDLE", 4) == 0) {
+            continue;
+        }
+        for (int k = 0; k < 3; k++) {
+            if (top[k] == NULL || t->cpu_pct > top[k]->cpu_pct) {
+                memmove(&top[k + 1], &top[k], (2 - k) * sizeof(top[0]));
+                top[k] = t;
+                break;
+            }
+        }
+    }
+
+    char line[192];
+    int len = 0;
+    for (int k = 0; k < 3 && top[k] != NULL; k++) {
+        len += snprintf(
+                line + len,
+                sizeof(line) - len,
+                "%s%s %.1f%%",
+                k ? ", " : "",
+                top[k]->name,
+                top[k]->cpu_pct);
+    }
+    ESP_LOGI(
+            TAG,
+            "Простой ядер: %.1f%% / %.1f%%; загрузка: %s; "
+            "меньше всего стека: %s (%lu байт)",
+            p->idle_pct[0],
+            portNUM_PROCESSORS > 1 ? p->idle_pct[portNUM_PROCESSORS - 1] : 0,
+            line,
+            tight ? tight->name : "-",
+            (unsigned long)(tight ? tight->stack_free : 0));
+}
+
+static void task_profile_task(void* arg)
+{
+    static task_profile_t profile;
+
+    while (1) {
+        vTaskDelay(pdMS_TO_TICKS(TASK_PROFILE_LOG_S * 1000));
+        if (task_profile_sample(&profile) == ESP_OK) {
+            task_profile_log(&profile);
+        }
+    }
+}
+
+esp_err_t task_profile_start_log(void)
+{
+    // Нулевой снимок задаёт начало первого окна
+    static task_profile_t profile;
+    task_profile_sample(&profile);
+
+    if (xTaskCreatePinnedToCore(
+                task_profile_task,
+                "task_prof",
+                TASK_PROFILE_TASK_STACK,
+                NULL,
+                TASK_PROFILE_TASK_PRIO,
+                NULL,
+                tskNO_AFFINITY)
+        != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+#else
+
+esp_err_t task_profile_sample(task_profile_t* out)
+{
+    memset(out, 0, sizeof(*out));
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t task_profile_start_log(void)
+{
+    ESP_LOGW(TAG, "Run-time stats FreeRTOS выключены в sdkconfig");
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+#endif
+
+int task_profile_format_task(
+        const task_profile_entry_t* t, char* buf, size_t len)
+{
+    return snprintf(
+            buf,
+            len,
+            "{\"name\":\"%s\",\"number\":%lu,\"prio\":%u,\"core\":%d,"
+            "\"cpu\":%.2f,\"stack_free\":%lu}",
+            t->name,
+            (unsigned long)t->number,
+            t->prio,
+            t->core,
+            t->cpu_pct,
+            (unsigned long)t->stack_free);
+}
@@ -0,0 +1,225 @@
+#include "temp_fusion.h"
+#include <math.h>
+#include <string.h>
+
+#define NOISE_ALPHA 0.1f
+#define NOISE_MIN 0.01f
+#define KF_R 0.05f       // шум измерения разности, °C²
+#define KF_Q_OFFSET 1e-5f // на секунду
+#define KF_Q_DRIFT 1e-11f
+#define KF_P0_OFFSET 4.0f
+#define KF_P0_DRIFT 1e-6f
+#define KF_CONVERGED_P 0.05f
+#define KF_GATE_SIGMA2 9.0f
+
+static float median(float* v, int n)
+{
+    // Вставками: n не больше TEMP_FUSION_WIN
+    for (int i = 1; i < n; i++) {
+        float x = v[i];
+        int j = i;
+        while (j > 0 && v[j - 1] > x) {
+            v[j] = v[j - 1];
+            j--;
+        }
+        v[j] = x;
+    }
+    return (n & 1) ? v[n / 2] : 0.5f * (v[n / 2 - 1] + v[n / 2]);
+}
+
+// Фильтр Хампеля: возвращает true, если x признан выбросом
+static bool hampel(temp_src_state_t* s, float x, float* out)
+{
+    float tmp[TEMP_FUSION_WIN];
+    bool outlier = false;
+    *out = x;
+
+    if (s->filled >= 3) {
+        memcpy(tmp, s->window, s->filled * sizeof(float));
+        float m = median(tmp, s->filled);
+        for (int i = 0; i < s->filled; i++) {
+            tmp[i] = fabsf(s->window[i] - m);
+        }
+        float mad = median(tmp, s->filled);
+        float thr = fmaxf(
+                TEMP_FUSION_HAMPEL_K * 1.4826f * mad, TEMP_FUSION_MIN_THR_C);
+        if (fabsf(x - m) > thr) {
+            *out = m;
+            outlier = true;
+        }
+    }
+
+    // В окно идёт сырое значение: настоящий скачок принимается,
+    // как только займёт половину окна
+    s->window[s->head] = x;
+    s->head = (s->head + 1) % TEMP_FUSION_WIN;
+    if (s->filled < TEMP_FUSION_WIN) {
+        s->filled++;
+    }
+    return outlier;
+}
+
+static bool src_fresh(const temp_src_state_t* s, uint32_t now_ms)
+{
+    return s->valid && s->filled > 0
+        && now_ms - s->last_ms <= s->max_age_ms;
+}
+
+static void kalman_update(temp_fusion_t* f, float d, uint32_t now_ms)
+{
+    if (!f->kf_started) {
+        f->offset = d;
+        f->drift = 0.0f;
+        f->p[0][0] = KF_P0_OFFSET;
+        f->p[0][1] = f->p[1][0] = 0.0f;
+        f->p[1][1] = KF_P0_DRIFT;
+        f->kf_ms = now_ms;
+        f->kf_started = true;
+        return;
+    }
+
+    // Прогноз: offset += drift * dt
+    float dt = (now_ms - f->kf_ms) / 1000.0f;
+    f->kf_ms = now_ms;
+    f->offset += f->drift * dt;
+    float p00 = f->p[0][0] + dt * (f->p[1][0] + f->p[0][1])
+              + dt * dt * f->p[1][1] + KF_Q_OFFSET * dt;
+    float p01 = f->p[0][1] + dt * f->p[1][1];
+    float p10 = f->p[1][0] + dt * f->p[1][1];
+    float p11 = f->p[1][1] + KF_Q_DRIFT * dt;
+
+    // Коррекция по измеренной разности; невязка за 3 сигмы — сбой
+    // одного из датчиков, а не изменение смещения
+    float y = d - f->offset;
+    float s = p00 + KF_R;
+    if (p00 < KF_CONVERGED_P && y * y > KF_GATE_SIGMA2 * s) {
+        f->p[0][0] = p00;
+        f->p[0][1] = p01;
+        f->p[1][0] = p10;
+        f->p[1][1] = p11;
+        return;
+    }
+    float k0 = p00 / s;
+    float k1 = p10 / s;
+    f->offset += k0 * y;
+    f->drift += k1 * y;
+    f->p[0][0] = (1.0f - k0) * p00;
+    f->p[0][1] = (1.0f - k0) * p01;
+    f->p[1][0] = p10 - k1 * p00;
+    f->p[1][1] = p11 - k1 * p01;
+}
+
+// Датчик «застрял»: значение не меняется, а второй заметно ушёл
+static bool src_stuck(const temp_src_state_t* s, float other_now)
+{
+    return s->unchanged >= TEMP_FUSION_STUCK_N
+        && fabsf(other_now - s->ref_other) > TEMP_FUSION_STUCK_DELTA_C;
+}
+
+static void fuse(temp_fusion_t* f, uint32_t now_ms)
+{
+    temp_src_state_t* dht = &f->src[TEMP_SRC_DHT];
+    temp_src_state_t* bmp = &f->src[TEMP_SRC_BMP];
+    float est_dht = dht->clean;
+    float est_bmp = bmp->clean - (f->kf_started ? f->offset : 0.0f);
+
+    bool use_dht = src_fresh(dht, now_ms) && !src_stuck(dht, est_bmp);
+    bool use_bmp = src_fresh(bmp, now_ms) && !src_stuck(bmp, est_dht);
+
+    // Датчик, чей последний отсчёт заменён медианой, подождёт, пока
+    // есть второй: замена отстаёт при настоящем скачке
+    if (use_dht && use_bmp && dht->last_outlier != bmp->last_outlier) {
+        use_dht = !dht->last_outlier;
+        use_bmp = !bmp->last_outlier;
+    }
+
+    if (use_dht && use_bmp) {
+        float w_dht = 1.0f / dht->noise;
+        float w_bmp = 1.0f / (bmp->noise + (f->kf_started ? f->p[0][0] : 0));
+        f->value = (est_dht * w_dht + est_bmp * w_bmp) / (w_dht + w_bmp);
+
+        float diff = est_dht - est_bmp;
+        f->confidence = 1.0f / (1.0f + diff * diff);
+        if (!f->kf_started || f->p[0][0] > KF_CONVERGED_P) {
+            f->confidence *= 0.8f;
+        }
+    } else if (use_dht || use_bmp) {
+        f->value = use_dht ? est_dht : est_bmp;
+        f->confidence = 0.5f;
+    } else {
+        f->confidence = 0.0f;
+    }
+}
+
+void temp_fusion_init(temp_fusion_t* f)
+{
+    memset(f, 0, sizeof(*f));
+    for (int i = 0; i < TEMP_SRC_COUNT; i++) {
+        f->src[i].max_age_ms = TEMP_FUSION_MAX_AGE_MS;
+    }
+}
+
+void temp_fusion_set_max_age(
+        temp_fusion_t* f, temp_src_t src, uint32_t max_age_ms)
+{
+    if (src < TEMP_SRC_COUNT) {
+        f->src[src].max_age_ms = max_age_ms;
+    }
+}
+
+void temp_fusion_update(
+        temp_fusion_t* f,
+        temp_src_t src,
+        float value,
+        bool valid,
+        uint32_t now_ms)
+{
+    if (src >= TEMP_SRC_COUNT) {
+        return;
+    }
+
+    temp_src_state_t* s = &f->src[src];
+    temp_src_state_t* other = &f->src[src == TEMP_SRC_DHT ? TEMP_SRC_BMP
+                                                          : TEMP_SRC_DHT];
+    s->valid = valid && isfinite(value);
+    if (!s->valid) {
+        fuse(f, now_ms);
+        return;
+    }
+
+    if (s->filled > 0 && value == s->last_raw) {
+        if (s->unchanged++ == 0) {
+            s->ref_other = other->clean;
+        }
+    } else {
+        s->unchanged = 0;
+    }
+    s->last_raw = value;
+
+    bool first = s->filled == 0;
+    float clean;
+    s->last_outlier = hampel(s, value, &clean);
+    if (s->last_outlier) {
+        s->outliers++;
+    }
+
+    if (first) {
+        s->noise = NOISE_MIN;
+    } else {
+        float r = clean - s->clean;
+        s->noise += NOISE_ALPHA * (r * r - s->noise);
+        s->noise = fmaxf(s->noise, NOISE_MIN);
+    }
+    s->clean = clean;
+    s->last_ms = now_ms;
+
+    // Пока любой из датчиков подозрительно неподвижен, разность
+    // не говорит о смещении
+    if (src_fresh(other, now_ms) && s->unchanged < TEMP_FUSION_HOLD_N
+        && other->unchanged < TEMP_FUSION_HOLD_N) {
+        float d = f->src[TEMP_SRC_BMP].clean - f->src[TEMP_SRC_DHT].clean;
+        kalman_update(f, d, now_ms);
+    }
+
+    fuse(f, now_ms);
+}
@@ -7,6 +7,8 @@
 #include "freertos/task.h"
 #include "lwip/netdb.h"
 #include "lwip/sockets.h"
+#include "metrics.h"
+#include "wifi_manager.h"
 static const char* TAG = "TUNNEL";
 #define VPS_HOST "72.56.247.97"
 #define VPS_TUNNEL_PORT 9000
@@ -38,6 +40,8 @@ static void tunnel_worker(void* arg)
         return;
     }
     while (1) {
+        // Без сети connect только копил бы ошибки в /metrics
+        wifi_manager_wait_connected(portMAX_DELAY);
         int vps_sock = socket(AF_INET, SOCK_STREAM, 0);
         if (vps_sock < 0) {
             vTaskDelay(pdMS_TO_TICKS(3000));
@@ -51,6 +55,7 @@ static void tunnel_worker(void* arg)
         if (connect(vps_sock, (struct sockaddr*)&vps_addr, sizeof(vps_addr))
             != 0) {
             ESP_LOGW(TAG, "Не удалось подключиться к VPS, повтор через 5с");
+            metrics_inc(METRIC_TUNNEL_ERRORS);
             close(vps_sock);
             vTaskDelay(pdMS_TO_TICKS(5000));
             continue;
@@ -62,11 +67,13 @@ static void tunnel_worker(void* arg)
         int n = recv(vps_sock, ack, sizeof(ack) - 1, 0);
         if (n <= 0 || strncmp(ack, "OK", 2) != 0) {
             ESP_LOGW(TAG, "Рукопожатие не прошло");
+            metrics_inc(METRIC_TUNNEL_ERRORS);
             close(vps_sock);
             vTaskDelay(pdMS_TO_TICKS(5000));
             continue;
         }
         ESP_LOGI(TAG, "Туннель установлен, ждём запрос...");
+        metrics_inc(METRIC_TUNNEL_SESSIONS);
         memset(request, 0, REQ_BUF_SIZE);
         struct timeval tv_req = {.tv_sec = 60};
         setsockopt(vps_sock, SOL_SOCKET, SO_RCVTIMEO, &tv_req, sizeof(tv_req));
@@ -103,8 +110,10 @@ static void tunnel_worker(void* arg)
                 send(vps_sock, response, resp_len, 0);
             }
             ESP_LOGI(TAG, "Запрос проксирован");
+            metrics_inc(METRIC_TUNNEL_REQUESTS);
         } else {
             ESP_LOGE(TAG, "Не удалось подключиться к webserver");
+            metrics_inc(METRIC_TUNNEL_ERRORS);
         }
         close(local_sock);
         close(vps_sock);
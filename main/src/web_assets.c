@@ -0,0 +1,2609 @@
+// Сгенерировано gzip_assets.py из data/ — не редактировать
+#include "web_assets.h"
+
+static const uint8_t s_page_html_br[] = {
+        0x1b, 0xe7, 0x66, 0x20, 0x2c, 0x0a, 0x63, 0x63, 0x59, 0xf8, 0x21, 0x1a, 0x6f, 0x7e, 0x0b, 0x6c,
+        0x16, 0x69, 0xa9, 0x69, 0x2b, 0x4d, 0x05, 0x87, 0x11, 0x92, 0xcc, 0x42, 0xd1, 0x2e, 0x4f, 0xe8,
+        0xec, 0xe4, 0xa7, 0x3c, 0x8d, 0x24, 0x20, 0x7e, 0xa0, 0x5d, 0xd0, 0x16, 0xdd, 0x3c, 0xee, 0xb7,
+        0x32, 0x08, 0x4c, 0xcc, 0xee, 0xd4, 0x94, 0xff, 0x75, 0xea, 0xff, 0xb4, 0x3a, 0x55, 0x28, 0x46,
+        0x18, 0x09, 0x57, 0x88, 0x9c, 0xd7, 0xaa, 0x93, 0x57, 0xda, 0x77, 0x9a, 0x80, 0x0b, 0xe8, 0x18,
+        0x10, 0x46, 0x32, 0x26, 0x07, 0x33, 0x0c, 0x7b, 0x86, 0xf9, 0xfb, 0x7d, 0x73, 0xe6, 0xd7, 0xa8,
+        0x6d, 0x79, 0xda, 0x1f, 0x6e, 0x8f, 0xe6, 0xcd, 0x31, 0xbb, 0x02, 0xe9, 0x23, 0x9c, 0xac, 0x37,
+        0x11, 0x6a, 0x23, 0x6c, 0xac, 0x9c, 0x26, 0xa2, 0x5f, 0xda, 0x79, 0x34, 0xf2, 0xea, 0x8a, 0x2c,
+        0x7d, 0x45, 0x28, 0x45, 0x2e, 0x87, 0x53, 0x68, 0x0c, 0x08, 0xc8, 0xff, 0x99, 0x6a, 0x3e, 0x77,
+        0x4a, 0x0e, 0x29, 0x95, 0xce, 0x45, 0x15, 0x72, 0xed, 0x5c, 0x9f, 0x3b, 0xbb, 0xe8, 0x76, 0x7f,
+        0x9a, 0xe3, 0xcc, 0x02, 0x3c, 0x01, 0x20, 0x69, 0x61, 0x41, 0x51, 0x21, 0x92, 0x97, 0x29, 0x87,
+        0x3c, 0x7f, 0x66, 0x76, 0x05, 0x2c, 0xc8, 0x23, 0x00, 0x52, 0x09, 0x4e, 0x39, 0x94, 0x7d, 0xc8,
+        0xd5, 0x95, 0xa5, 0xec, 0xa2, 0x72, 0x79, 0xb6, 0x99, 0x45, 0xa8, 0xda, 0x62, 0x2e, 0xc8, 0x44,
+        0x9d, 0xef, 0xb2, 0xfb, 0x43, 0xb5, 0x7f, 0xf4, 0xdb, 0x6d, 0xaf, 0xe9, 0xf8, 0x77, 0x09, 0x66,
+        0x0a, 0x09, 0x24, 0x96, 0x47, 0x9a, 0x20, 0x06, 0x2a, 0xc7, 0x26, 0xeb, 0x5d, 0xfc, 0xa2, 0xad,
+        0x8e, 0x94, 0xb2, 0x81, 0xa4, 0x94, 0x49, 0xe2, 0xbc, 0x60, 0x10, 0x8e, 0xa9, 0x21, 0x87, 0x1c,
+        0x51, 0x4a, 0x58, 0xcb, 0x61, 0x6b, 0x62, 0xae, 0x4e, 0x8b, 0xdf, 0xfa, 0xfc, 0xe4, 0xb8, 0x04,
+        0xdf, 0x67, 0xaa, 0x94, 0x86, 0x16, 0xdb, 0x1d, 0xbd, 0x53, 0x83, 0x7c, 0x1b, 0xb9, 0x0d, 0x08,
+        0x4a, 0xa6, 0x51, 0xbb, 0x95, 0xc8, 0x7f, 0xb4, 0x23, 0x24, 0x4c, 0xfd, 0x13, 0x80, 0x84, 0xfa,
+        0xf8, 0x46, 0x08, 0x00, 0x5b, 0x3e, 0xe5, 0xe6, 0x41, 0x02, 0x4d, 0x5e, 0xf5, 0x74, 0xb6, 0x4c,
+        0x17, 0x01, 0xc0, 0xc9, 0xbe, 0x67, 0xa0, 0xce, 0xaa, 0xc8, 0xb9, 0x62, 0x67, 0x20, 0x96, 0x67,
+        0x98, 0x8e, 0x33, 0x2e, 0x80, 0x74, 0xb8, 0xd7, 0xd3, 0x73, 0xf3, 0xb4, 0xf1, 0xa1, 0x9f, 0x67,
+        0xf2, 0x0c, 0xf1, 0x62, 0x18, 0x90, 0x8f, 0x84, 0x22, 0x0e, 0x3c, 0x21, 0x62, 0x99, 0xf7, 0xd5,
+        0x27, 0xe4, 0x4e, 0xfb, 0x38, 0x3d, 0xbf, 0xef, 0x75, 0x20, 0x5f, 0x77, 0x6f, 0xa1, 0x6a, 0xe9,
+        0x12, 0x96, 0xc0, 0x1e, 0xf9, 0x9b, 0xda, 0x09, 0x1b, 0x54, 0xa2, 0x38, 0x82, 0x65, 0x2d, 0x92,
+        0x53, 0xd9, 0x57, 0x78, 0x35, 0xf8, 0x2a, 0x22, 0x02, 0x86, 0x67, 0xb5, 0xe3, 0xe7, 0x1d, 0xff,
+        0x80, 0x54, 0xc1, 0xe0, 0xd7, 0xc7, 0x3a, 0xba, 0xcb, 0xdd, 0x8d, 0xca, 0xfe, 0x00, 0x79, 0x03,
+        0x46, 0x46, 0xc2, 0x7e, 0x59, 0x4b, 0x91, 0xdb, 0x48, 0x13, 0xea, 0x46, 0x7c, 0xa2, 0x11, 0xb5,
+        0x05, 0xa4, 0x36, 0x1e, 0x0b, 0x84, 0x3f, 0x08, 0x84, 0x29, 0xcc, 0x48, 0x71, 0x9a, 0x46, 0xbd,
+        0x91, 0x31, 0x1a, 0x80, 0x70, 0x9f, 0x00, 0x22, 0x62, 0x24, 0xb2, 0x3e, 0x32, 0xaf, 0xb8, 0x10,
+        0x9d, 0x4e, 0x77, 0x85, 0x68, 0xb3, 0xba, 0x2e, 0x4d, 0x79, 0x98, 0xb0, 0x0c, 0x48, 0x68, 0x02,
+        0x80, 0x9b, 0x69, 0xfe, 0x6a, 0xfb, 0xcc, 0xa2, 0xa1, 0xc3, 0x43, 0xdc, 0x58, 0x84, 0xeb, 0xe7,
+        0x24, 0xb5, 0xda, 0x77, 0xdd, 0x09, 0xd6, 0x93, 0x1c, 0xda, 0xe0, 0xdf, 0x21, 0x92, 0x4f, 0x12,
+        0x7e, 0x9f, 0x0c, 0x52, 0x51, 0x81, 0x5a, 0x45, 0x90, 0xf7, 0xac, 0xd3, 0x21, 0x69, 0x4a, 0xfc,
+        0x32, 0x28, 0x8d, 0x45, 0xc5, 0x66, 0x48, 0xed, 0xe4, 0xcd, 0xe0, 0xd7, 0xc2, 0x46, 0xaf, 0x8d,
+        0x1b, 0x1e, 0x45, 0xa2, 0xc3, 0x07, 0xad, 0x8c, 0xcc, 0x62, 0x72, 0x6a, 0x12, 0x8c, 0xf8, 0x71,
+        0x0b, 0x47, 0xe0, 0x9a, 0x41, 0x46, 0x27, 0xfa, 0xfc, 0x3c, 0x6c, 0x3f, 0x50, 0xcc, 0x38, 0x71,
+        0xf3, 0x14, 0x58, 0x43, 0x3a, 0x1b, 0xdf, 0xd5, 0xb6, 0x60, 0xac, 0x30, 0x47, 0x75, 0xe4, 0x7c,
+        0x7f, 0x28, 0x93, 0xc1, 0x77, 0x08, 0x81, 0xe7, 0x76, 0xdf, 0x8d, 0x75, 0xe1, 0xf0, 0xbe, 0x55,
+        0x14, 0xc6, 0x6c, 0x5e, 0x7c, 0xb6, 0xc9, 0x90, 0xac, 0xcc, 0xb9, 0x6c, 0x1b, 0x5a, 0xe4, 0x51,
+        0xcd, 0x8b, 0x78, 0xbc, 0xbf, 0x09, 0x8e, 0x78, 0x30, 0x10, 0x31, 0x06, 0xef, 0xdb, 0xea, 0xac,
+        0x96, 0xe5, 0xc6, 0x0f, 0xb5, 0xb9, 0x5e, 0x73, 0x11, 0x1f, 0x75, 0xb3, 0xe2, 0xf9, 0x71, 0x8b,
+        0x61, 0xce, 0xc4, 0x5c, 0xb7, 0xb9, 0xf3, 0x84, 0xc9, 0xaf, 0x85, 0x03, 0x34, 0xec, 0x8f, 0x3b,
+        0x22, 0x23, 0xb4, 0x65, 0xcb, 0x18, 0xe8, 0x3a, 0x89, 0xc6, 0x05, 0x88, 0x43, 0xde, 0xcb, 0x7e,
+        0x2a, 0x55, 0xba, 0xc4, 0xde, 0x43, 0x2e, 0x60, 0xc9, 0xad, 0x73, 0xc9, 0x15, 0x0a, 0xe0, 0x91,
+        0xde, 0xd0, 0x38, 0x93, 0xff, 0x9d, 0xa9, 0x65, 0x59, 0xc2, 0x3e, 0xd4, 0x50, 0x6a, 0x55, 0x6b,
+        0x52, 0xd4, 0x99, 0xd4, 0x85, 0xc7, 0x36, 0xf8, 0xb7, 0x4d, 0xf2, 0xd9, 0x16, 0x79, 0xce, 0x7f,
+        0x28, 0x5b, 0xbf, 0xd0, 0x62, 0x81, 0x7a, 0x8d, 0xf1, 0x76, 0x1f, 0x8b, 0x53, 0x96, 0x14, 0x1d,
+        0x11, 0xd8, 0xad, 0x1b, 0x59, 0x1a, 0x1b, 0x43, 0xab, 0x7d, 0xf9, 0xb9, 0x7f, 0x93, 0x67, 0x6a,
+        0x3a, 0xb2, 0x4d, 0x07, 0x21, 0x3d, 0x34, 0x07, 0x00, 0x42, 0xc3, 0x84, 0x0a, 0x72, 0xf5, 0x91,
+        0x0e, 0x11, 0x77, 0x2d, 0x0c, 0x4f, 0xc2, 0x4c, 0xed, 0x1b, 0xe5, 0x9e, 0xb3, 0x30, 0xc1, 0x7a,
+        0x78, 0xea, 0x3e, 0x16, 0x44, 0x9a, 0x7e, 0x1a, 0xab, 0x7a, 0xe9, 0x33, 0xce, 0xa7, 0x32, 0x15,
+        0xb0, 0x87, 0x49, 0x09, 0x0a, 0x45, 0x20, 0x32, 0xfc, 0x42, 0x6f, 0xa1, 0xcc, 0x0f, 0x44, 0xe6,
+        0x25, 0xda, 0x8b, 0x8f, 0x25, 0x12, 0x19, 0x7b, 0x8e, 0xde, 0x85, 0x4b, 0x70, 0x79, 0xe9, 0xd3,
+        0x61, 0x2e, 0x7c, 0x31, 0x14, 0x2e, 0x42, 0x8a, 0x5f, 0xdc, 0x11, 0x12, 0xf9, 0x27, 0x40, 0xd3,
+        0x3c, 0x2e, 0xb7, 0x14, 0xde, 0xe7, 0xaf, 0x43, 0xc2, 0x7c, 0x6c, 0xaa, 0xcc, 0x76, 0xc5, 0xc2,
+        0x78, 0x66, 0xd4, 0x33, 0x41, 0x92, 0x4c, 0x3c, 0x79, 0x94, 0xd8, 0xca, 0xe7, 0x99, 0x4d, 0x5e,
+        0x83, 0x38, 0xb7, 0x3e, 0x75, 0x50, 0xc8, 0x22, 0xd0, 0xdb, 0xf3, 0xb8, 0x5c, 0x74, 0x9a, 0x3d,
+        0x19, 0xa2, 0x64, 0xb6, 0x54, 0x50, 0xf5, 0x06, 0xa5, 0xa6, 0x91, 0xdd, 0x27, 0xec, 0x31, 0x5b,
+        0xb9, 0x8c, 0x63, 0x05, 0xe8, 0x38, 0x98, 0x2d, 0x91, 0x7a, 0x00, 0x85, 0x29, 0xf8, 0x74, 0x94,
+        0x0e, 0xb0, 0x47, 0x45, 0x8a, 0x99, 0x72, 0xd3, 0xa8, 0x81, 0x48, 0xa8, 0x21, 0x5a, 0xbe, 0x0a,
+        0x88, 0x49, 0xc1, 0xe4, 0xd1, 0x21, 0x6f, 0x90, 0x57, 0xe9, 0xcb, 0x1b, 0x19, 0xfb, 0x38, 0x2f,
+        0x93, 0x81, 0xeb, 0x6e, 0x68, 0x57, 0xcb, 0xcc, 0x8b, 0xcf, 0x0d, 0xe6, 0x85, 0x96, 0xf2, 0x34,
+        0x91, 0x88, 0x64, 0x76, 0x4b, 0x28, 0xea, 0x2e, 0x4b, 0xae, 0x40, 0x41, 0xb1, 0xb9, 0x4e, 0x43,
+        0x61, 0xb9, 0xe1, 0xaf, 0xb9, 0x11, 0x99, 0x36, 0xf6, 0x79, 0x41, 0x36, 0x8a, 0x53, 0x16, 0xc8,
+        0xe6, 0xe4, 0xc0, 0xdd, 0xc0, 0x7d, 0x4b, 0x78, 0x53, 0xf1, 0x04, 0xb9, 0x6e, 0xca, 0x8b, 0x75,
+        0x6e, 0xab, 0xb1, 0x98, 0xb8, 0x89, 0xb1, 0xd8, 0x4b, 0xef, 0x34, 0xad, 0x50, 0x1e, 0x3c, 0xe1,
+        0x46, 0xfd, 0x7d, 0x1e, 0x9d, 0x3c, 0xf7, 0x3c, 0x7d, 0xd7, 0x1f, 0x8f, 0xcb, 0x5d, 0xa3, 0x8b,
+        0xca, 0x7d, 0x85, 0xad, 0x99, 0x03, 0x5e, 0x8e, 0x59, 0x3d, 0xbc, 0xaf, 0x4b, 0xe1, 0xdf, 0x04,
+        0xb2, 0x62, 0xc9, 0xca, 0xdf, 0x83, 0x8d, 0xf3, 0xd9, 0xcd, 0x16, 0x61, 0x88, 0xc1, 0x1b, 0xcc,
+        0x2e, 0x67, 0x53, 0xce, 0xa7, 0x7d, 0xcf, 0xcd, 0x0e, 0x71, 0xd2, 0xdf, 0x4c, 0xb9, 0xee, 0x67,
+        0x12, 0x43, 0xec, 0x08, 0xf3, 0xd2, 0xc3, 0x9d, 0xb8, 0x23, 0x92, 0xd5, 0x6c, 0x86, 0xc9, 0xaf,
+        0x3c, 0x88, 0x44, 0xd9, 0x08, 0x6d, 0x41, 0x31, 0xc2, 0x64, 0x37, 0xbc, 0x25, 0xc0, 0x32, 0x27,
+        0x34, 0xab, 0x84, 0x99, 0x0c, 0xe0, 0x35, 0xbf, 0xa3, 0xeb, 0xde, 0x26, 0x7d, 0xb5, 0x36, 0x63,
+        0x0d, 0x5a, 0x33, 0x31, 0xcc, 0x77, 0x17, 0x60, 0x48, 0x52, 0x6d, 0x29, 0x3f, 0x11, 0x00, 0xeb,
+        0x0c, 0x47, 0x9b, 0x32, 0x5c, 0x7d, 0xb3, 0x57, 0xc5, 0x4a, 0xe5, 0x52, 0xa7, 0x47, 0x9d, 0xa1,
+        0x20, 0xa8, 0x80, 0xc4, 0x41, 0x05, 0x56, 0x5d, 0xb6, 0xdb, 0xf3, 0x05, 0x51, 0x41, 0xa7, 0x5a,
+        0xd5, 0x9f, 0x09, 0x8a, 0xe2, 0x05, 0xc9, 0x06, 0xf5, 0xaa, 0x17, 0x66, 0x54, 0xf4, 0xbe, 0x44,
+        0x2f, 0x44, 0x35, 0xfb, 0xa7, 0x3a, 0x83, 0x86, 0x95, 0xc3, 0x8c, 0x92, 0xd2, 0x98, 0x2e, 0x77,
+        0x26, 0x13, 0xaa, 0x0c, 0x52, 0xec, 0x9a, 0xc8, 0x7d, 0xd5, 0x10, 0x74, 0x2b, 0x73, 0x4e, 0xe4,
+        0x6c, 0x68, 0xca, 0xae, 0x44, 0xb5, 0x88, 0xf6, 0xcb, 0xa9, 0x5a, 0x44, 0xfb, 0xdc, 0x53, 0x9f,
+        0xbb, 0xe0, 0xcc, 0xa3, 0x25, 0x77, 0x48, 0x7a, 0x0b, 0x32, 0x8d, 0x18, 0xf2, 0x93, 0x3e, 0xdd,
+        0x24, 0x0e, 0x1c, 0x43, 0x47, 0x55, 0x0a, 0x9a, 0x7d, 0xbb, 0x00, 0x22, 0x48, 0x12, 0x66, 0x80,
+        0x24, 0x46, 0xbd, 0x92, 0x80, 0x84, 0xea, 0x4d, 0x3b, 0x95, 0xd8, 0x69, 0x88, 0x29, 0x65, 0x14,
+        0x2f, 0x1d, 0x10, 0x6d, 0xc9, 0x08, 0xba, 0xe0, 0x88, 0xd4, 0xe9, 0xba, 0x70, 0xcd, 0x72, 0x37,
+        0x62, 0x01, 0x32, 0xde, 0x8d, 0x9c, 0xa2, 0x07, 0x19, 0x25, 0xd6, 0x31, 0x1d, 0xdf, 0xc6, 0x1b,
+        0x8b, 0x41, 0x62, 0x6b, 0x9a, 0x8d, 0x20, 0x46, 0x34, 0x47, 0x22, 0x17, 0x50, 0x4a, 0x76, 0xeb,
+        0xe9, 0xde, 0x71, 0xae, 0xed, 0x91, 0x49, 0xde, 0xd2, 0x11, 0x11, 0x6f, 0x1e, 0x8c, 0x92, 0x54,
+        0xd7, 0x18, 0x9f, 0xeb, 0xe2, 0xe8, 0x29, 0x4c, 0xa1, 0x04, 0xf4, 0x5c, 0xa5, 0x97, 0x2d, 0x74,
+        0x5e, 0x97, 0xb9, 0x4a, 0x33, 0xef, 0xba, 0xa8, 0x31, 0x1a, 0xb0, 0x10, 0x3c, 0xf7, 0x31, 0xba,
+        0x8e, 0x42, 0x9c, 0x64, 0xa6, 0xa8, 0xa4, 0x0c, 0x2c, 0xc9, 0x93, 0xff, 0x55, 0x9d, 0x7e, 0xe3,
+        0xdc, 0x25, 0x38, 0x18, 0x66, 0xc3, 0x28, 0x4e, 0x58, 0x29, 0x22, 0x84, 0x83, 0x65, 0x48, 0xcb,
+        0x75, 0x8c, 0xbf, 0x7d, 0x2f, 0xa1, 0xf0, 0x47, 0x8e, 0xc9, 0xd8, 0xb5, 0x7e, 0x55, 0x89, 0x23,
+        0xb5, 0x30, 0x0d, 0xdd, 0x3b, 0x54, 0x12, 0x91, 0x59, 0xa8, 0xe7, 0x88, 0x65, 0x07, 0x81, 0x6a,
+        0x1d, 0x20, 0x61, 0xb7, 0x5b, 0x2b, 0x7a, 0x3f, 0xab, 0x60, 0x69, 0xd6, 0x4e, 0x97, 0x49, 0xac,
+        0x92, 0xae, 0x7c, 0xce, 0x62, 0x2a, 0xb0, 0x86, 0xca, 0xde, 0x3c, 0x5a, 0x6f, 0xe2, 0xa4, 0x08,
+        0x97, 0xb0, 0x84, 0xc4, 0x8e, 0x74, 0x49, 0xe3, 0xa0, 0xa7, 0xf2, 0xfd, 0xaa, 0x82, 0x49, 0xb0,
+        0x80, 0x15, 0x5c, 0xd8, 0x9f, 0xc7, 0xf5, 0xc0, 0x39, 0xb4, 0x30, 0x6c, 0x48, 0xf5, 0x92, 0x65,
+        0x61, 0x70, 0x88, 0x5f, 0x50, 0x45, 0x45, 0x61, 0x23, 0x33, 0x99, 0x7c, 0xc6, 0xa6, 0xb7, 0x41,
+        0x52, 0xce, 0x55, 0x70, 0x28, 0xd3, 0xd3, 0x42, 0xd6, 0xa4, 0x06, 0xec, 0x62, 0xd3, 0x04, 0xb1,
+        0xec, 0x5a, 0x24, 0x44, 0xea, 0xa8, 0x21, 0x17, 0x8f, 0x4b, 0x8c, 0x1a, 0xdf, 0xc2, 0xf4, 0xa1,
+        0xb3, 0x7e, 0x78, 0x9d, 0x4e, 0xa2, 0x68, 0x51, 0x31, 0x16, 0x2c, 0xa7, 0xc2, 0x59, 0xbd, 0xb6,
+        0x16, 0x2e, 0xdb, 0x48, 0x96, 0x52, 0xf8, 0x64, 0xb1, 0x46, 0x05, 0x1e, 0x53, 0xef, 0x18, 0xa8,
+        0x25, 0xd4, 0xb5, 0xb0, 0xaa, 0x9e, 0x93, 0x1b, 0x9a, 0x02, 0x66, 0x3c, 0x92, 0xc0, 0xdb, 0x4e,
+        0xd0, 0x5a, 0xbd, 0x9c, 0xab, 0x5d, 0xa6, 0x2a, 0x08, 0xaa, 0x4a, 0xe5, 0x87, 0x0d, 0xdb, 0xd5,
+        0xc0, 0xc1, 0x4a, 0x0a, 0xff, 0x70, 0x11, 0xe2, 0x26, 0xa9, 0xae, 0x79, 0xd9, 0x3f, 0x76, 0x2d,
+        0xda, 0x8e, 0xe7, 0x1d, 0x00, 0x21, 0x82, 0xa0, 0xde, 0x8a, 0x79, 0xe4, 0x6f, 0x3b, 0xde, 0xef,
+        0x49, 0x22, 0x2d, 0x15, 0xf2, 0xe2, 0x30, 0x37, 0xec, 0xe5, 0x3e, 0xca, 0x74, 0xa5, 0xe2, 0x5c,
+        0x9d, 0x7e, 0xd8, 0x7a, 0x94, 0xdb, 0xfb, 0x21, 0xa3, 0x1b, 0xa0, 0xa9, 0x04, 0xc1, 0xe3, 0x16,
+        0x75, 0xe2, 0x3a, 0xd2, 0x8a, 0xe0, 0x43, 0x15, 0xbb, 0x7e, 0xbd, 0x41, 0x31, 0x10, 0x2e, 0xa3,
+        0x66, 0x48, 0x8a, 0x67, 0xef, 0x87, 0xf2, 0xbe, 0x55, 0x0b, 0xdc, 0x45, 0x7a, 0x0e, 0x29, 0x56,
+        0x51, 0x8b, 0xb8, 0x93, 0x28, 0xaf, 0xe6, 0xda, 0xdf, 0x6f, 0xd4, 0xae, 0x01, 0xa9, 0x3d, 0x86,
+        0xdd, 0x6a, 0xad, 0x16, 0x78, 0xb6, 0x47, 0x3d, 0xe8, 0xed, 0xc2, 0x14, 0xbc, 0x5f, 0x06, 0x38,
+        0x88, 0x95, 0xdc, 0x53, 0x30, 0x4e, 0x8a, 0x27, 0x8a, 0xc7, 0xe9, 0x1f, 0x77, 0x5e, 0x93, 0x40,
+        0x6c, 0x2b, 0x14, 0xa0, 0xd5, 0xe5, 0x72, 0x1a, 0xc5, 0x1f, 0x42, 0xb6, 0x2b, 0x64, 0x2c, 0xcd,
+        0xd3, 0xfb, 0x76, 0x5b, 0xaf, 0x65, 0x0c, 0xfb, 0x11, 0xb6, 0x75, 0x2d, 0x24, 0xb4, 0x27, 0x7f,
+        0x41, 0xa3, 0x9b, 0x3a, 0x0f, 0x35, 0xc6, 0xd0, 0xba, 0xfe, 0x93, 0x46, 0x81, 0xe7, 0x03, 0x1a,
+        0xf7, 0xd7, 0x4b, 0x22, 0x9b, 0xd0, 0xdb, 0xee, 0x8c, 0xaa, 0x38, 0x5d, 0xfe, 0x00, 0xf1, 0xa7,
+        0xaa, 0xe9, 0x2f, 0xdd, 0xcf, 0x1a, 0xca, 0x18, 0x34, 0x7b, 0x2e, 0xe8, 0xeb, 0x97, 0xec, 0xf6,
+        0x6b, 0x12, 0x01, 0x8d, 0x4f, 0xae, 0xa0, 0x1f, 0xf1, 0xfb, 0x0f, 0x30, 0xa2, 0x96, 0xcf, 0xbf,
+        0x02, 0x03, 0x36, 0xa3, 0x69, 0x3d, 0xae, 0x06, 0x68, 0x1f, 0xfb, 0x84, 0x03, 0xed, 0xc9, 0x72,
+        0x4d, 0xd1, 0xbd, 0x04, 0x66, 0xeb, 0xeb, 0x2f, 0x8d, 0x76, 0x8f, 0x67, 0x1f, 0xc3, 0xf8, 0x4e,
+        0x33, 0x5b, 0xe3, 0x98, 0x60, 0x4c, 0xf3, 0x8e, 0x2d, 0xea, 0xfc, 0xdc, 0x0e, 0xd6, 0x3a, 0xd5,
+        0x7f, 0xc1, 0x32, 0x1e, 0x4a, 0xdf, 0xe3, 0x42, 0xa4, 0xee, 0xe2, 0xc4, 0x9e, 0xcb, 0x54, 0xaf,
+        0x55, 0xfd, 0x26, 0xf0, 0x0a, 0xa5, 0x48, 0x19, 0xaf, 0x0a, 0x95, 0x2c, 0xbf, 0x53, 0xb2, 0x40,
+        0xf9, 0x80, 0x23, 0xc5, 0x96, 0x2f, 0xd5, 0xc1, 0x75, 0xc5, 0x18, 0xd0, 0xd1, 0xc5, 0xe4, 0x8f,
+        0x79, 0xaf, 0x55, 0x01, 0x6b, 0xfd, 0x11, 0x0f, 0x64, 0x85, 0xa5, 0xbe, 0xf7, 0xeb, 0x6a, 0xf9,
+        0x80, 0xf3, 0x2a, 0x55, 0x1f, 0xaa, 0xcb, 0x9b, 0x93, 0x15, 0xdd, 0xbb, 0x8e, 0x6e, 0xaf, 0x75,
+        0x99, 0x79, 0x5f, 0xaa, 0xeb, 0x0f, 0x15, 0xe3, 0x6f, 0xe8, 0xe2, 0x75, 0xa4, 0x5e, 0x6b, 0xb1,
+        0x95, 0x1b, 0x7b, 0xdf, 0xce, 0xec, 0x25, 0x4b, 0xb4, 0x3d, 0xfd, 0xdf, 0x55, 0xb4, 0x96, 0x62,
+        0x2b, 0x3b, 0x24, 0x54, 0x08, 0x34, 0x32, 0xa9, 0x4e, 0x73, 0x6c, 0xdb, 0xa2, 0xa5, 0x21, 0xb9,
+        0xcb, 0x3b, 0xd2, 0x5a, 0xad, 0xc8, 0xf6, 0x33, 0x31, 0xb6, 0x3e, 0xb3, 0x0e, 0x2e, 0xa0, 0x5e,
+        0xf1, 0x63, 0x09, 0xb2, 0xb4, 0x5a, 0x16, 0x20, 0x4f, 0xa0, 0x03, 0x0e, 0x32, 0x91, 0x53, 0x21,
+        0x3b, 0xb1, 0x87, 0x7c, 0xa0, 0x3b, 0x0d, 0x2f, 0xf9, 0x30, 0x25, 0x91, 0x5d, 0xeb, 0x17, 0x86,
+        0xaf, 0x8c, 0xf3, 0xc0, 0x61, 0x79, 0xc1, 0x84, 0x05, 0xa7, 0x07, 0xf1, 0xe0, 0x53, 0x4f, 0x76,
+        0x85, 0xa3, 0x42, 0x83, 0x6c, 0x0c, 0xea, 0x53, 0x0f, 0x96, 0xf8, 0x46, 0xd8, 0x43, 0x69, 0x3c,
+        0x9f, 0x4b, 0xe3, 0x5b, 0xed, 0x27, 0x2a, 0x84, 0x78, 0xbd, 0x3c, 0xdc, 0xa8, 0x79, 0xa4, 0x5d,
+        0x33, 0x96, 0x6c, 0x4a, 0xc2, 0x85, 0x0c, 0x9a, 0xaa, 0x86, 0x0d, 0x97, 0x7b, 0xe2, 0xc3, 0xae,
+        0x78, 0x6d, 0xc8, 0xf4, 0x15, 0x99, 0x9c, 0xa2, 0xdf, 0x44, 0x9f, 0x65, 0xe4, 0xe9, 0x64, 0x4d,
+        0xff, 0x5c, 0x3f, 0x31, 0xb7, 0x9b, 0x5c, 0xfc, 0x72, 0x3b, 0x89, 0xc5, 0x3d, 0x28, 0x15, 0x3a,
+        0x06, 0x43, 0x03, 0x41, 0xbd, 0xf6, 0xc8, 0xdc, 0xb8, 0x36, 0xc0, 0xd0, 0xae, 0x5d, 0xca, 0x7c,
+        0x46, 0x71, 0x82, 0x19, 0xe0, 0x7d, 0xf9, 0x6d, 0xe3, 0x09, 0xbd, 0xb0, 0xea, 0x5e, 0xab, 0x23,
+        0x32, 0x57, 0x3c, 0xf0, 0x2d, 0xb5, 0x08, 0x2e, 0x5e, 0xd8, 0x97, 0x83, 0x62, 0x81, 0x73, 0x81,
+        0xf1, 0x0f, 0x91, 0x02, 0x98, 0xab, 0x62, 0xc2, 0xdf, 0xa6, 0x76, 0x9d, 0x73, 0x2a, 0xbd, 0x89,
+        0xe9, 0xde, 0xeb, 0x25, 0x27, 0xb3, 0xe2, 0x5a, 0x33, 0xf2, 0x1e, 0x68, 0x20, 0x80, 0xf7, 0xe0,
+        0x46, 0xc4, 0x25, 0x45, 0xe6, 0x79, 0xa2, 0x30, 0x7b, 0xff, 0x82, 0x2f, 0xe7, 0xff, 0xad, 0x72,
+        0xb9, 0xba, 0xc3, 0x57, 0xbc, 0xc2, 0xf6, 0x6d, 0x27, 0x77, 0x6e, 0xaf, 0x1e, 0x5d, 0x42, 0x8b,
+        0xb9, 0xe9, 0x87, 0x33, 0x25, 0xfd, 0x74, 0xdb, 0xac, 0xe3, 0xef, 0x19, 0xf0, 0xc4, 0x1c, 0x7e,
+        0x78, 0x4c, 0x39, 0x20, 0x83, 0x38, 0x33, 0xfb, 0x45, 0x03, 0x20, 0x5d, 0x2f, 0x61, 0xf8, 0x26,
+        0x5f, 0x7d, 0x0b, 0x12, 0xb1, 0xf5, 0xff, 0xaf, 0xd8, 0xaa, 0x6f, 0xf6, 0xed, 0xd7, 0x87, 0x21,
+        0x20, 0xea, 0x9e, 0x51, 0x15, 0x7a, 0x6d, 0x58, 0x1f, 0x21, 0x58, 0x14, 0x35, 0x5e, 0xee, 0x80,
+        0x1d, 0xde, 0x68, 0xbd, 0x51, 0xeb, 0xce, 0xc6, 0x41, 0x72, 0x84, 0x4e, 0x47, 0x16, 0x53, 0x36,
+        0x54, 0x7e, 0xe9, 0xec, 0xaa, 0xbd, 0x65, 0x97, 0x31, 0xae, 0x7f, 0x07, 0x7e, 0xf4, 0xbd, 0x4a,
+        0x79, 0x48, 0xfb, 0xd3, 0xf7, 0x35, 0x54, 0x6c, 0xe9, 0x18, 0xc9, 0x2e, 0xc8, 0xdb, 0xa6, 0xe7,
+        0x27, 0x84, 0xa4, 0x5b, 0x43, 0x67, 0xc5, 0x8f, 0x7c, 0x65, 0xca, 0xe3, 0xfe, 0xaa, 0xc4, 0x1e,
+        0x30, 0x84, 0x0b, 0x5f, 0x05, 0x42, 0xf6, 0x02, 0x0e, 0x60, 0x2b, 0x4e, 0xe4, 0x73, 0xfd, 0x01,
+        0xca, 0xd9, 0x88, 0x04, 0x8b, 0xd8, 0xad, 0x30, 0xe6, 0x69, 0x4f, 0xc8, 0xf9, 0x48, 0x95, 0xf1,
+        0xaa, 0xb8, 0xb6, 0x23, 0x94, 0x9b, 0xc0, 0xbb, 0x16, 0x4b, 0x2e, 0xdc, 0x0b, 0xf9, 0x88, 0xe9,
+        0x8d, 0x48, 0xfd, 0x12, 0xe5, 0x8a, 0xf0, 0x05, 0xa7, 0x1f, 0x5a, 0x90, 0x32, 0x2e, 0x21, 0xd1,
+        0x55, 0x2e, 0xf6, 0x04, 0x0b, 0x2d, 0x69, 0x9b, 0xf9, 0x3c, 0x21, 0xb8, 0xfc, 0xc7, 0xc4, 0xf4,
+        0xdb, 0x8c, 0x8f, 0xd9, 0xa3, 0x06, 0x1f, 0xb4, 0x1d, 0xf2, 0xfe, 0x8e, 0xf6, 0x49, 0x96, 0xfc,
+        0x98, 0xc2, 0xfb, 0x89, 0x76, 0xc5, 0x43, 0xbf, 0xc9, 0x89, 0xc9, 0x2e, 0x46, 0xe8, 0xaa, 0x7c,
+        0xc9, 0xfe, 0xfb, 0xb5, 0x37, 0x66, 0x13, 0xfd, 0x40, 0x33, 0x4a, 0xf1, 0x3d, 0x0d, 0xdb, 0xc7,
+        0x3d, 0x71, 0x33, 0xce, 0xa9, 0xe7, 0x25, 0x72, 0x68, 0x42, 0x17, 0x84, 0x27, 0xd6, 0x8d, 0x7a,
+        0x17, 0x3c, 0x23, 0x25, 0x47, 0x6d, 0x8d, 0x28, 0xd5, 0x25, 0x50, 0xea, 0x04, 0x90, 0x86, 0xa4,
+        0x64, 0x39, 0xd3, 0xed, 0x99, 0x2e, 0x57, 0x60, 0x0f, 0xdd, 0xbc, 0xe5, 0xa8, 0xcb, 0x88, 0x6e,
+        0x77, 0xcb, 0x18, 0x8a, 0xbc, 0xca, 0x17, 0x95, 0x2e, 0x0e, 0x5a, 0xfd, 0x22, 0xc8, 0x12, 0xc3,
+        0x0e, 0x1d, 0x3e, 0x82, 0x17, 0xf6, 0x61, 0x05, 0x87, 0xc3, 0x46, 0xa8, 0xed, 0x47, 0x53, 0x3a,
+        0x6d, 0x22, 0x22, 0x6d, 0x8f, 0x8a, 0xb7, 0xf6, 0x1d, 0x12, 0x4c, 0xf8, 0x57, 0x11, 0xdd, 0x03,
+        0x19, 0x66, 0x37, 0x54, 0xc8, 0x5a, 0x13, 0xcb, 0x44, 0x5e, 0x81, 0x34, 0xa5, 0x57, 0xb2, 0x1c,
+        0xc3, 0x07, 0x3e, 0x07, 0x02, 0x76, 0x76, 0x9a, 0x71, 0x17, 0xcc, 0x6e, 0xff, 0x0a, 0xdf, 0x36,
+        0xf0, 0xf3, 0x6d, 0x61, 0x67, 0x67, 0x1d, 0x97, 0x9d, 0xeb, 0x9c, 0xb5, 0xcb, 0xea, 0xeb, 0x69,
+        0x3b, 0x3d, 0x19, 0x17, 0x6e, 0x76, 0xfa, 0x78, 0x4b, 0xa9, 0xea, 0xbf, 0xdd, 0xbb, 0x87, 0xc3,
+        0x0f, 0x8f, 0x92, 0x02, 0x7c, 0xfa, 0xfe, 0xd7, 0x5b, 0xe1, 0xa7, 0x9f, 0xbc, 0x7c, 0x10, 0xbd,
+        0xdf, 0xed, 0xd7, 0x6e, 0xb9, 0x45, 0x8d, 0x2e, 0xed, 0x0d, 0xcc, 0x7f, 0xb8, 0xd8, 0x75, 0x00,
+        0x3f, 0xaa, 0x6a, 0xab, 0xab, 0xf0, 0x04, 0xd6, 0xbe, 0xc0, 0x3f, 0x5f, 0xf3, 0x12, 0xf6, 0x83,
+        0x77, 0xb9, 0x12, 0xc6, 0xe3, 0x59, 0x0c, 0x3d, 0x93, 0x07, 0x59, 0x74, 0xda, 0xfc, 0x3e, 0x6d,
+        0xc1, 0x24, 0xb4, 0x56, 0x07, 0x77, 0x7a, 0xc0, 0xee, 0x62, 0xc7, 0xe1, 0x1e, 0x77, 0x8d, 0x51,
+        0x9f, 0x62, 0xd1, 0x00, 0x12, 0xb9, 0xed, 0x63, 0x99, 0xc8, 0xd2, 0x19, 0x20, 0x96, 0x45, 0xa2,
+        0xfb, 0x56, 0xbd, 0x11, 0xc6, 0x92, 0x03, 0x32, 0xfc, 0x60, 0x4e, 0xac, 0x2d, 0xe7, 0x3f, 0x7a,
+        0x28, 0x71, 0x2b, 0x68, 0x0b, 0x77, 0x5c, 0xbe, 0x54, 0x11, 0x9f, 0xd9, 0x60, 0x6d, 0xf8, 0x75,
+        0x8f, 0xc2, 0x8b, 0x39, 0x72, 0x37, 0x37, 0x98, 0x73, 0x30, 0x03, 0x68, 0x64, 0x64, 0x20, 0xe6,
+        0x2b, 0xb1, 0x0a, 0x64, 0x62, 0x7d, 0xb9, 0xcb, 0x97, 0x38, 0x64, 0xb4, 0xaf, 0xbe, 0xad, 0x99,
+        0xc3, 0x61, 0x08, 0x06, 0xf2, 0x1d, 0x74, 0x75, 0x17, 0xaf, 0x94, 0x43, 0xde, 0xb2, 0x87, 0x3b,
+        0xde, 0x04, 0x4e, 0xf8, 0xc0, 0x53, 0x3e, 0x8f, 0x50, 0xdf, 0x08, 0x48, 0x47, 0x65, 0x62, 0xf9,
+        0xb4, 0xcc, 0x05, 0xb0, 0x93, 0x87, 0x83, 0x36, 0x7f, 0x8d, 0x60, 0x40, 0x6e, 0xae, 0x41, 0x47,
+        0xa2, 0xb4, 0xfa, 0xf0, 0x4f, 0x34, 0x97, 0x36, 0x57, 0x9a, 0xa5, 0x8d, 0xb6, 0x6e, 0x40, 0x20,
+        0xc2, 0xfd, 0xb6, 0xa5, 0xb9, 0x66, 0x37, 0x38, 0xc5, 0xd8, 0xc0, 0x83, 0x45, 0xfb, 0x00, 0xd1,
+        0xaa, 0x2e, 0xe9, 0xd3, 0xbd, 0xe9, 0x54, 0x0e, 0x3a, 0xe4, 0xbf, 0xd5, 0xe4, 0x50, 0x68, 0xd0,
+        0x60, 0x63, 0x80, 0x9c, 0xc6, 0x16, 0x98, 0xfa, 0x8a, 0x92, 0xbb, 0x37, 0x79, 0x09, 0x75, 0x17,
+        0x8c, 0x83, 0x20, 0x12, 0x28, 0x9a, 0x38, 0x22, 0xae, 0x50, 0x84, 0x4e, 0x14, 0xb2, 0xc4, 0x0e,
+        0xbb, 0x46, 0xc7, 0x2e, 0xa3, 0x03, 0x4e, 0xdb, 0x06, 0x37, 0xd1, 0x16, 0x77, 0x98, 0x5f, 0xe0,
+        0x75, 0x23, 0x47, 0x60, 0xcb, 0xbb, 0xd1, 0x5a, 0x11, 0x2d, 0x96, 0x82, 0x51, 0x2f, 0xc6, 0xf9,
+        0xe2, 0x08, 0x8a, 0x53, 0xd9, 0xce, 0x94, 0x08, 0x0d, 0x66, 0xc8, 0x44, 0xd1, 0x42, 0x7f, 0x90,
+        0x28, 0x51, 0xd8, 0xdd, 0xeb, 0x19, 0xb2, 0xa4, 0x5d, 0xf0, 0x7b, 0x4c, 0x41, 0x4b, 0xa6, 0xd5,
+        0x3a, 0xed, 0xa4, 0x60, 0x7e, 0x2d, 0x3f, 0x4f, 0x23, 0x36, 0x23, 0x78, 0x93, 0xb4, 0x42, 0xa6,
+        0xe8, 0x31, 0x6d, 0x22, 0xc9, 0x85, 0x6f, 0xac, 0x41, 0x37, 0xf2, 0xb5, 0xe0, 0xf7, 0x42, 0xe4,
+        0xeb, 0x0f, 0x07, 0xf0, 0x3c, 0x18, 0x1d, 0x65, 0x4c, 0x03, 0xea, 0x53, 0x7b, 0x38, 0xbe, 0x83,
+        0x5c, 0x02, 0x38, 0xdc, 0xa9, 0xb2, 0x2c, 0x2c, 0xdb, 0x19, 0x85, 0x97, 0xb3, 0x34, 0x58, 0xb4,
+        0xc3, 0xa1, 0xc6, 0xee, 0xf9, 0x61, 0xcb, 0xbf, 0xb2, 0xdb, 0xe5, 0xca, 0x77, 0x43, 0x26, 0x7d,
+        0xba, 0x1a, 0xe6, 0x81, 0x06, 0x92, 0x39, 0x9c, 0x14, 0x71, 0xfc, 0xa5, 0x8f, 0x57, 0xcb, 0x32,
+        0xd2, 0xa9, 0x61, 0xd4, 0x07, 0x66, 0x30, 0xfe, 0x66, 0x46, 0x03, 0x28, 0x88, 0x86, 0x39, 0x68,
+        0xf9, 0xb7, 0x90, 0x69, 0x12, 0x39, 0xc2, 0x68, 0x89, 0x68, 0xe7, 0x50, 0x8e, 0x69, 0xa0, 0xc7,
+        0x8a, 0xaa, 0x4d, 0x80, 0x13, 0x0e, 0x21, 0x90, 0x3d, 0x7a, 0xc4, 0xc4, 0xc2, 0x79, 0x2c, 0xf5,
+        0x35, 0x4b, 0x1a, 0x66, 0x75, 0x24, 0x96, 0x0d, 0x9b, 0xcc, 0x2d, 0x3a, 0x4f, 0xae, 0x84, 0xea,
+        0xa8, 0x36, 0x82, 0x52, 0xe4, 0x84, 0x93, 0xa8, 0xfa, 0xca, 0x4a, 0xaf, 0x6a, 0xbe, 0x8c, 0x02,
+        0x70, 0x9c, 0x69, 0x7e, 0x40, 0xf1, 0x93, 0x77, 0x30, 0x66, 0x1d, 0xac, 0xe0, 0xa1, 0x1c, 0x25,
+        0xd7, 0x4e, 0x01, 0x4e, 0xdb, 0xf0, 0xf0, 0x0c, 0xb0, 0x41, 0x36, 0x6f, 0x78, 0x97, 0x83, 0xa5,
+        0xc7, 0x69, 0x80, 0xf1, 0x75, 0xcc, 0x3d, 0x71, 0x4c, 0xf5, 0x46, 0xfa, 0x00, 0x08, 0x0f, 0x52,
+        0x30, 0xbf, 0xf9, 0xf9, 0x3a, 0xf3, 0x25, 0x44, 0x80, 0xc1, 0x3f, 0x64, 0x20, 0xaf, 0x1e, 0x6e,
+        0xf3, 0xe7, 0x69, 0x79, 0x81, 0x3e, 0xf9, 0x73, 0xeb, 0x93, 0xb5, 0xb1, 0x9b, 0x54, 0x9a, 0xd4,
+        0x1c, 0x27, 0x8e, 0xae, 0x37, 0x77, 0x64, 0xe4, 0x23, 0xf1, 0xcf, 0x22, 0x56, 0x43, 0xb4, 0x93,
+        0x2b, 0x1c, 0x59, 0x28, 0x41, 0x0f, 0x87, 0x7b, 0x66, 0xde, 0x2b, 0xe8, 0x4d, 0x22, 0x8d, 0xb5,
+        0x71, 0x16, 0xc2, 0xb4, 0xc8, 0x43, 0x07, 0x0e, 0x37, 0xc2, 0x27, 0x48, 0x56, 0xd8, 0x0e, 0xa4,
+        0xec, 0x96, 0xf7, 0x4d, 0x66, 0x28, 0x59, 0x12, 0x3b, 0xb7, 0x4f, 0x2c, 0x03, 0x37, 0xd4, 0x26,
+        0xd6, 0xd8, 0xc0, 0xc9, 0x4a, 0xc4, 0xfc, 0x65, 0xd3, 0x85, 0x1b, 0xd3, 0x5f, 0x4e, 0x3e, 0x67,
+        0x45, 0xa8, 0x2d, 0x47, 0xf3, 0xd4, 0x4d, 0x30, 0x6d, 0x51, 0x2b, 0x34, 0x6c, 0x67, 0x91, 0x7b,
+        0x6e, 0x25, 0x3a, 0xcb, 0xe7, 0xe7, 0x36, 0x3a, 0x97, 0x3c, 0x8e, 0x10, 0x3c, 0x32, 0x9b, 0x25,
+        0x4d, 0x9c, 0xb3, 0x5e, 0xa6, 0x5d, 0xd7, 0xb7, 0xaf, 0x65, 0xc8, 0xba, 0x57, 0x11, 0xe3, 0xf0,
+        0x82, 0x29, 0xe3, 0xf2, 0x02, 0x59, 0x36, 0xb0, 0x6c, 0x82, 0x6e, 0x87, 0x9a, 0x81, 0xec, 0x17,
+        0x06, 0xf2, 0xf0, 0xc0, 0x22, 0x29, 0x94, 0x85, 0xdc, 0x7c, 0x25, 0x85, 0x26, 0x95, 0x47, 0xd6,
+        0xfe, 0xcf, 0x72, 0x37, 0x04, 0xda, 0x50, 0x83, 0xa3, 0xac, 0x48, 0xd1, 0x62, 0xca, 0xa2, 0xdc,
+        0xc0, 0xd8, 0xd4, 0xf9, 0xb9, 0x27, 0xd7, 0x2c, 0x63, 0xd2, 0xe9, 0x12, 0x52, 0x00, 0xf7, 0x6a,
+        0x18, 0xb5, 0x43, 0x91, 0x8a, 0x12, 0x47, 0xa6, 0x6b, 0xf6, 0x06, 0xff, 0x59, 0x6a, 0x78, 0x29,
+        0xf9, 0xd5, 0xb5, 0xb3, 0x81, 0xa7, 0x3b, 0x4e, 0xf4, 0x22, 0x0c, 0x79, 0x87, 0xf3, 0x01, 0x67,
+        0x6f, 0x7b, 0xb5, 0x12, 0x2b, 0xbf, 0xc1, 0xc5, 0x3a, 0x21, 0x4c, 0x9b, 0xfc, 0x24, 0xa0, 0x10,
+        0xa9, 0x43, 0x24, 0x59, 0x81, 0x16, 0x9b, 0x9a, 0x3a, 0x1c, 0xd8, 0x81, 0x39, 0x1e, 0x69, 0xf6,
+        0xc3, 0x56, 0x4c, 0x51, 0xd2, 0xe6, 0x79, 0xb7, 0x40, 0x60, 0x80, 0x35, 0xba, 0x30, 0x6a, 0x72,
+        0x8a, 0x79, 0xb7, 0x29, 0x2d, 0x0d, 0x3c, 0x69, 0xca, 0x70, 0xfa, 0x17, 0x7d, 0x8e, 0x1c, 0x07,
+        0xf1, 0x62, 0xce, 0xf8, 0xd9, 0xd6, 0xb4, 0x4d, 0x48, 0xe8, 0x13, 0x86, 0x4b, 0xec, 0x1c, 0x8d,
+        0xc5, 0xb2, 0xe4, 0x64, 0x2c, 0x4a, 0xee, 0xcd, 0x3b, 0x38, 0xcd, 0x3b, 0xb5, 0x57, 0x6c, 0x4d,
+        0x87, 0x30, 0xca, 0xf6, 0xb7, 0x03, 0xe1, 0x02, 0xfa, 0xf5, 0x86, 0x34, 0x25, 0x4d, 0x1a, 0x09,
+        0x4c, 0xc2, 0x31, 0xb4, 0xd1, 0xb1, 0x5f, 0xd3, 0x9e, 0xfe, 0x5b, 0x4c, 0x63, 0xe3, 0xb5, 0xa8,
+        0x38, 0x3a, 0x47, 0x0e, 0x2f, 0x55, 0xfc, 0x64, 0x04, 0x1d, 0xf5, 0xe3, 0x04, 0xa2, 0x52, 0x59,
+        0x3d, 0x81, 0xf0, 0x71, 0x7f, 0x48, 0x49, 0xd1, 0xd9, 0x70, 0xfd, 0x99, 0x52, 0xaf, 0xc4, 0xca,
+        0x12, 0x38, 0x3f, 0xe8, 0xad, 0x84, 0x38, 0x78, 0x9b, 0x1d, 0x6d, 0x6a, 0xb5, 0x81, 0x71, 0x76,
+        0x43, 0x1c, 0x81, 0x10, 0x1f, 0x28, 0xef, 0x73, 0xd1, 0x61, 0x6d, 0xc3, 0x95, 0xee, 0x06, 0x40,
+        0xc2, 0x98, 0xb8, 0xde, 0x4f, 0x05, 0x15, 0xdb, 0x06, 0x00, 0x1f, 0x40, 0x0e, 0x35, 0x10, 0x98,
+        0x22, 0xa4, 0x8c, 0x4c, 0x0e, 0xe9, 0xdb, 0xbe, 0xd0, 0xf8, 0x0a, 0x05, 0x10, 0xfc, 0x11, 0x94,
+        0x18, 0xa3, 0xa0, 0x22, 0x3e, 0xf8, 0xe4, 0x77, 0x88, 0x4c, 0xb7, 0x70, 0xaf, 0x70, 0x1d, 0xb6,
+        0xb3, 0xb2, 0x46, 0xcc, 0x77, 0x5a, 0x86, 0x3a, 0xf0, 0xfc, 0x82, 0x40, 0x47, 0x21, 0x6f, 0x72,
+        0x45, 0xc0, 0x18, 0x68, 0x15, 0xa4, 0x08, 0xbf, 0x13, 0x3a, 0x59, 0x34, 0x31, 0x19, 0xe9, 0x06,
+        0x28, 0x0d, 0xf0, 0xa9, 0x94, 0xa6, 0x0e, 0x48, 0x62, 0xda, 0xfd, 0xe4, 0x1c, 0x60, 0x38, 0x2d,
+        0x8a, 0x7f, 0x43, 0x83, 0xcc, 0xa7, 0x26, 0x9b, 0xfc, 0xc8, 0x47, 0xfe, 0x0d, 0xe2, 0xd4, 0x88,
+        0xbd, 0xcd, 0x19, 0x31, 0xf2, 0x05, 0xce, 0xf2, 0xc3, 0x23, 0x81, 0x28, 0x4a, 0xc0, 0xf4, 0xe2,
+        0x75, 0xac, 0xb5, 0x26, 0x23, 0xe6, 0x1c, 0x65, 0x2a, 0x2a, 0x22, 0x0e, 0x71, 0x86, 0xe0, 0x70,
+        0x5c, 0xe1, 0x36, 0xa3, 0x1a, 0x25, 0xb6, 0x8b, 0x8b, 0x61, 0xf4, 0x3b, 0xdb, 0x60, 0xd2, 0xed,
+        0x32, 0x52, 0x93, 0x78, 0xed, 0x3c, 0xb3, 0x65, 0x8c, 0x51, 0xfb, 0x1b, 0x18, 0xe7, 0x4d, 0x40,
+        0x49, 0x34, 0x07, 0x5e, 0x08, 0x43, 0x1c, 0x40, 0x30, 0x43, 0xcb, 0x9c, 0x6d, 0xc3, 0x75, 0x18,
+        0x67, 0x12, 0xd6, 0xda, 0xf8, 0xa3, 0x73, 0xf4, 0x0f, 0x8c, 0x4b, 0xfc, 0x49, 0x7a, 0x87, 0xda,
+        0xd1, 0xd6, 0x6a, 0x03, 0xce, 0x7b, 0x6c, 0x94, 0xa4, 0x70, 0xdd, 0x79, 0x3c, 0xdc, 0x0f, 0x22,
+        0xa0, 0xc2, 0x80, 0xfd, 0xb4, 0xaf, 0xc1, 0x70, 0xbf, 0x7f, 0x4b, 0x6f, 0x84, 0xce, 0xac, 0xf5,
+        0x38, 0x8c, 0xdf, 0x88, 0x0c, 0xaf, 0x6e, 0x6d, 0x97, 0xe8, 0x1a, 0x5a, 0xc2, 0xf0, 0x81, 0x61,
+        0x28, 0xe2, 0x15, 0x9c, 0xb0, 0x2b, 0xa6, 0xfe, 0xf8, 0x0f, 0x3c, 0x3e, 0xa3, 0xc4, 0x06, 0x8f,
+        0x4c, 0x53, 0xc5, 0xec, 0xfe, 0xa0, 0xb7, 0xcb, 0x5f, 0x7b, 0xb5, 0x25, 0x5c, 0xb4, 0x64, 0x1c,
+        0x28, 0xfa, 0x6b, 0xfa, 0x52, 0xa7, 0x6b, 0x93, 0xf1, 0xee, 0x33, 0xe4, 0x41, 0xc7, 0x5a, 0x0c,
+        0x8e, 0x11, 0xc3, 0xe9, 0x9a, 0x2f, 0xdf, 0x05, 0xe6, 0x18, 0x07, 0xac, 0x0b, 0x1d, 0x23, 0x5d,
+        0xb8, 0x1f, 0x0d, 0x92, 0x7c, 0xac, 0x13, 0x5a, 0xc2, 0x60, 0x5f, 0x02, 0xd5, 0x4f, 0x58, 0x22,
+        0x92, 0x73, 0x38, 0x1a, 0x19, 0xc6, 0xe8, 0xc6, 0x36, 0x53, 0x85, 0x64, 0xec, 0x9b, 0xc7, 0x02,
+        0x9b, 0xf5, 0x63, 0x4d, 0x00, 0xb8, 0x98, 0x85, 0xe9, 0xbd, 0x94, 0xfa, 0xa6, 0x53, 0x37, 0xe3,
+        0xb4, 0x1f, 0x1e, 0x1c, 0xcc, 0x3d, 0xc9, 0x5d, 0x79, 0x16, 0xc6, 0x2e, 0x5b, 0x7e, 0x79, 0xe1,
+        0x3b, 0xa5, 0x8a, 0x21, 0x2a, 0xd5, 0x70, 0xe6, 0x87, 0x62, 0x6e, 0x2a, 0xb4, 0x2e, 0x37, 0xdd,
+        0xe8, 0x9b, 0x37, 0xce, 0x1b, 0x21, 0xaf, 0x74, 0x38, 0x37, 0x60, 0x49, 0x1a, 0xf2, 0x1e, 0xb4,
+        0x84, 0x23, 0xd9, 0xd1, 0xa5, 0x05, 0xdd, 0x3d, 0x5d, 0x1c, 0x1b, 0x4e, 0x07, 0x8e, 0xb1, 0x02,
+        0xf5, 0x56, 0x74, 0xc0, 0xfd, 0x02, 0x15, 0xcf, 0xa4, 0x20, 0x1b, 0x61, 0xb0, 0xb5, 0x61, 0xae,
+        0xf8, 0x37, 0xaa, 0x0a, 0xbc, 0xf2, 0xec, 0xc2, 0xae, 0x34, 0xfa, 0xb2, 0x4c, 0x93, 0x9a, 0x2f,
+        0x1b, 0x8e, 0xe1, 0xf3, 0xbd, 0x81, 0xfb, 0xa7, 0x39, 0x97, 0xce, 0xc5, 0xd8, 0x5d, 0x26, 0x35,
+        0x13, 0x9e, 0x0d, 0xfa, 0x34, 0x7a, 0x73, 0x7d, 0xc5, 0xfe, 0xd3, 0xaf, 0xa0, 0xa3, 0x83, 0x2f,
+        0x2d, 0x5c, 0xdf, 0x80, 0x8f, 0x09, 0x6b, 0x74, 0x24, 0x19, 0x10, 0x1f, 0x90, 0xc9, 0xf8, 0x4c,
+        0x11, 0x2a, 0x11, 0x96, 0x10, 0xe5, 0x17, 0xf9, 0x48, 0xb4, 0x24, 0xe9, 0x63, 0x2c, 0xc0, 0x67,
+        0xe2, 0x0d, 0x0c, 0xd0, 0x8d, 0x8b, 0xbf, 0x66, 0x9c, 0xf8, 0x22, 0x7a, 0xaf, 0x6c, 0x40, 0x90,
+        0xce, 0x4b, 0xbf, 0xa3, 0xbd, 0xee, 0x36, 0xf0, 0xe4, 0xa3, 0x93, 0xce, 0x29, 0xd0, 0xef, 0xb4,
+        0x85, 0x46, 0x8d, 0x75, 0xcf, 0xb8, 0x9c, 0x15, 0x5b, 0x40, 0xed, 0xbd, 0x83, 0x3a, 0xb8, 0x22,
+        0x5d, 0xf4, 0xcc, 0x37, 0xf7, 0x88, 0x37, 0x2a, 0xd2, 0x01, 0xd0, 0x58, 0x97, 0x1e, 0x68, 0x46,
+        0xf1, 0xc8, 0x38, 0xa3, 0x82, 0x1d, 0xec, 0xca, 0xba, 0x49, 0x64, 0x3f, 0x32, 0x15, 0x1a, 0x23,
+        0x74, 0xfc, 0x1b, 0xcc, 0xc9, 0x6d, 0x2d, 0x52, 0xcc, 0x1b, 0x1e, 0xf3, 0x66, 0x14, 0xf6, 0x9b,
+        0xc1, 0x50, 0x91, 0x61, 0xb3, 0xf0, 0x08, 0x3b, 0x5f, 0x99, 0xf7, 0xb5, 0xbc, 0x4a, 0x57, 0x1e,
+        0xf1, 0x67, 0xd4, 0xda, 0x97, 0x9b, 0x93, 0xf5, 0xb1, 0x65, 0xe6, 0xf1, 0x98, 0x3e, 0xa3, 0xb0,
+        0x43, 0x87, 0xc4, 0x09, 0x12, 0x93, 0x6e, 0xf0, 0x20, 0xe9, 0x86, 0x26, 0xe5, 0x86, 0xdd, 0xe6,
+        0xd2, 0x00, 0x8f, 0x9d, 0xf0, 0x4c, 0x50, 0xb0, 0xd7, 0x59, 0x5a, 0xdc, 0xb0, 0xcf, 0x86, 0x6f,
+        0x7c, 0x77, 0x0a, 0x7c, 0x60, 0x97, 0x1d, 0x82, 0x3d, 0xdd, 0x9b, 0xc0, 0x05, 0x2b, 0x64, 0x58,
+        0x5e, 0x82, 0xfa, 0x8c, 0x24, 0x63, 0x24, 0x16, 0x73, 0x0f, 0x05, 0xa3, 0x9a, 0xd7, 0x48, 0x3c,
+        0x6a, 0xa7, 0x75, 0x83, 0x0d, 0xa7, 0xe2, 0xee, 0x57, 0x26, 0xeb, 0x74, 0xc4, 0x97, 0xab, 0x8a,
+        0x8c, 0xe5, 0x9f, 0x2a, 0x07, 0x81, 0x79, 0x14, 0x84, 0x56, 0xdf, 0xba, 0xdc, 0x15, 0xbc, 0xe1,
+        0x4b, 0xb1, 0xe6, 0xf0, 0xe1, 0x80, 0x37, 0x24, 0x58, 0xd4, 0x2a, 0xe0, 0x10, 0xb7, 0x02, 0x7c,
+        0x0a, 0xd3, 0x1e, 0x57, 0xdb, 0x0e, 0x77, 0x44, 0x72, 0xd2, 0x2f, 0x77, 0x85, 0xab, 0xc3, 0x8e,
+        0xfe, 0x32, 0x06, 0x0d, 0x78, 0x26, 0x44, 0xb3, 0x87, 0x81, 0xe3, 0xca, 0xb6, 0xbc, 0x7c, 0x06,
+        0x46, 0xa4, 0xd8, 0x96, 0xfe, 0xeb, 0xeb, 0x54, 0xa9, 0xe5, 0x06, 0x84, 0xbc, 0x4a, 0xdf, 0xfc,
+        0xe5, 0xe6, 0xa4, 0xbd, 0x52, 0x99, 0x79, 0x0f, 0x5b, 0x7d, 0xc8, 0x10, 0x11, 0xbc, 0x2f, 0xd4,
+        0x81, 0xaf, 0x57, 0x62, 0x1f, 0x43, 0x54, 0x68, 0x3c, 0xb0, 0x0c, 0x40, 0x2e, 0xdb, 0xa5, 0x74,
+        0x90, 0xc2, 0x14, 0xe1, 0x39, 0xec, 0xc8, 0xae, 0x16, 0x03, 0x17, 0xe7, 0xe8, 0xd1, 0x19, 0x34,
+        0xdf, 0xc8, 0x81, 0x61, 0xee, 0x18, 0x8a, 0x83, 0xf4, 0x88, 0xf9, 0x48, 0xcd, 0x45, 0xc1, 0x1c,
+        0xd8, 0xaa, 0xb6, 0xcc, 0x2b, 0xbe, 0x6c, 0x34, 0xcf, 0xcc, 0x0c, 0x0a, 0xf8, 0x09, 0xb6, 0x48,
+        0x13, 0x69, 0x78, 0x95, 0xa3, 0x3d, 0xc7, 0xf1, 0x11, 0x6b, 0xc1, 0x28, 0xdc, 0xaa, 0xb2, 0xac,
+        0x57, 0x3f, 0x05, 0x51, 0x26, 0xe7, 0xee, 0x70, 0x31, 0xaf, 0xd0, 0x7b, 0x24, 0x60, 0xa2, 0xcc,
+        0x7a, 0x1c, 0xf1, 0x07, 0xc5, 0xd5, 0xec, 0x1c, 0xb7, 0xf0, 0x50, 0x96, 0xe7, 0x9e, 0xf4, 0x4e,
+        0xbb, 0xfb, 0x9d, 0xbe, 0x1d, 0xd6, 0x3c, 0x02, 0xf7, 0x7a, 0xfd, 0x5c, 0xca, 0x15, 0x07, 0xdf,
+        0xd5, 0x51, 0x1b, 0xfc, 0x99, 0xd5, 0x6a, 0x8f, 0xe8, 0x78, 0x35, 0xef, 0xed, 0xe3, 0x4c, 0x52,
+        0x19, 0xc5, 0x18, 0xa3, 0x3e, 0xed, 0x60, 0x9b, 0x31, 0xeb, 0x8c, 0x84, 0x3d, 0xdf, 0xc1, 0xaa,
+        0x15, 0x97, 0x2d, 0x8a, 0x82, 0x65, 0xec, 0xe0, 0xfc, 0x26, 0x7c, 0xfd, 0x0b, 0xa0, 0x4c, 0x14,
+        0x8b, 0xc8, 0x1f, 0x28, 0x90, 0x81, 0x4b, 0x9b, 0x9c, 0xf0, 0xc9, 0xc0, 0x17, 0xf8, 0x0e, 0x8f,
+        0x5a, 0x31, 0x9a, 0x88, 0x97, 0x47, 0xeb, 0x8a, 0x8b, 0xff, 0x48, 0xc5, 0xe5, 0x85, 0x15, 0x49,
+        0x94, 0x8d, 0x5c, 0xa4, 0x9a, 0x3b, 0xfd, 0x27, 0x52, 0x30, 0xbf, 0x64, 0x69, 0xe6, 0x17, 0x35,
+        0xa4, 0x85, 0xc0, 0xbf, 0x4e, 0xf1, 0xb8, 0x28, 0x4e, 0xfb, 0xb0, 0x6c, 0xc3, 0xf7, 0xbd, 0x6a,
+        0x46, 0x14, 0xd7, 0x95, 0x58, 0x19, 0x29, 0x0b, 0xcd, 0x9d, 0x71, 0xe7, 0x8d, 0x24, 0xa9, 0x84,
+        0x74, 0xaa, 0xa2, 0xb8, 0x18, 0x76, 0x56, 0x3b, 0x8b, 0xcb, 0x5f, 0x97, 0x09, 0xde, 0x3f, 0xfd,
+        0x63, 0x69, 0x68, 0xee, 0x8e, 0x43, 0x65, 0x89, 0x47, 0x63, 0xbe, 0x65, 0x5c, 0x86, 0x11, 0x60,
+        0xb2, 0x75, 0x9f, 0xa9, 0x10, 0x9a, 0xaf, 0xd0, 0xa3, 0x88, 0x3a, 0x34, 0x27, 0x8a, 0x24, 0xc3,
+        0xd8, 0xda, 0xd3, 0xbc, 0xa3, 0x7a, 0x14, 0x2b, 0x44, 0x9c, 0x29, 0x2f, 0xf7, 0x98, 0xd1, 0x17,
+        0x63, 0xa4, 0xc5, 0x04, 0xd5, 0xa0, 0x4e, 0x26, 0x2d, 0x2f, 0x92, 0x2f, 0xa5, 0x67, 0x5a, 0x75,
+        0x36, 0xbf, 0xd8, 0xc3, 0x24, 0x5a, 0x61, 0xea, 0x8f, 0xc5, 0xb6, 0x74, 0x05, 0xd6, 0x78, 0x72,
+        0x58, 0xd8, 0xe5, 0x4c, 0x8d, 0x63, 0xa6, 0x16, 0xb9, 0xab, 0xd2, 0x4b, 0xe5, 0x3f, 0xe7, 0xf1,
+        0xf9, 0x78, 0xb4, 0xe1, 0xd4, 0xe2, 0xdb, 0x6d, 0xaa, 0xe1, 0x6e, 0x6f, 0xf5, 0x2d, 0x74, 0xd5,
+        0xc3, 0x26, 0xbd, 0x74, 0x09, 0x61, 0x89, 0x78, 0x22, 0x2e, 0x9c, 0x11, 0x67, 0x36, 0x56, 0x9f,
+        0x5e, 0x02, 0x1a, 0xc9, 0x65, 0x62, 0x24, 0x86, 0xa2, 0xcf, 0x19, 0x4e, 0x6a, 0x8d, 0x98, 0x34,
+        0xcd, 0x1f, 0x92, 0x63, 0x48, 0xf1, 0x40, 0x71, 0xd4, 0x32, 0x13, 0x63, 0xec, 0x47, 0xf1, 0x5c,
+        0x49, 0x71, 0x43, 0x63, 0x59, 0x1e, 0xf0, 0x2f, 0x79, 0x16, 0xb2, 0xc2, 0x90, 0x43, 0x68, 0xfe,
+        0xbd, 0x19, 0x07, 0x62, 0xd7, 0x1e, 0xb2, 0x80, 0xe2, 0x8b, 0xdb, 0xaf, 0x6f, 0xc8, 0x7b, 0x93,
+        0xaf, 0x1c, 0x2b, 0xe3, 0x21, 0xcf, 0xe7, 0xb4, 0x3b, 0x56, 0xc1, 0x82, 0x0d, 0xec, 0x76, 0x41,
+        0x05, 0x0c, 0xfe, 0xfc, 0xdf, 0x06, 0x8c, 0x1e, 0x18, 0xb1, 0xd0, 0xeb, 0x7b, 0xf4, 0x39, 0x10,
+        0x1e, 0x4f, 0xbb, 0x08, 0x6d, 0xf4, 0xb6, 0xa4, 0xd7, 0x52, 0x18, 0x35, 0x2b, 0x77, 0x50, 0xc8,
+        0x07, 0x43, 0x84, 0xdd, 0x22, 0x1c, 0x52, 0x89, 0x00, 0x71, 0x09, 0x78, 0x9b, 0x06, 0xad, 0xb8,
+        0xb9, 0x50, 0x0a, 0xa4, 0xc3, 0x4c, 0x2f, 0x5c, 0x64, 0x86, 0x9c, 0x98, 0x4f, 0x48, 0x10, 0xa6,
+        0x8f, 0x71, 0xc9, 0x63, 0xd2, 0x54, 0x85, 0x45, 0x14, 0xcc, 0x54, 0xcc, 0xd6, 0x0d, 0xeb, 0x5e,
+        0x0f, 0xcb, 0x0c, 0x2a, 0x2d, 0xc1, 0x19, 0x70, 0x19, 0x09, 0x38, 0xfe, 0x1d, 0x37, 0x14, 0x16,
+        0x9c, 0xe3, 0x50, 0x62, 0xc9, 0x53, 0x45, 0xd0, 0xe7, 0x1d, 0x1a, 0x02, 0x89, 0xb8, 0x85, 0xe3,
+        0x49, 0xf6, 0x56, 0xb3, 0x8c, 0xcf, 0x5e, 0xe8, 0xdb, 0xef, 0xe8, 0x51, 0x2e, 0xb4, 0x89, 0x28,
+        0xac, 0x44, 0x7c, 0x45, 0xc2, 0xce, 0xb2, 0x80, 0x5c, 0xe9, 0x6b, 0xb7, 0xa2, 0xb0, 0x96, 0xe9,
+        0xc1, 0xb3, 0x3d, 0x46, 0x53, 0xbb, 0x0f, 0xd6, 0x3a, 0xaf, 0xcf, 0x2b, 0x43, 0x4b, 0x10, 0xf4,
+        0x18, 0x71, 0x02, 0xfb, 0xb1, 0x2c, 0xeb, 0xb7, 0xc0, 0x03, 0x8a, 0xe2, 0x5a, 0xad, 0xfb, 0x6f,
+        0x62, 0xc0, 0x7c, 0x12, 0xda, 0x8e, 0xb2, 0x38, 0xef, 0x86, 0x46, 0x29, 0x18, 0x84, 0x6e, 0x5c,
+        0xdc, 0x49, 0xed, 0x77, 0x68, 0x17, 0x89, 0x2d, 0x72, 0x9d, 0xb4, 0x37, 0xb6, 0x50, 0xa9, 0xc8,
+        0x59, 0xd3, 0x5d, 0x69, 0xe7, 0x98, 0x1b, 0x60, 0x2b, 0x1b, 0x38, 0x3f, 0x03, 0x57, 0xc5, 0x56,
+        0x67, 0x1a, 0x3c, 0x1b, 0x1e, 0x31, 0xe7, 0xe1, 0x7a, 0x8d, 0x07, 0x0d, 0x87, 0x11, 0x3e, 0xde,
+        0xc0, 0xcd, 0xdb, 0x59, 0x22, 0xfd, 0x86, 0xf4, 0xe2, 0xa9, 0xe8, 0xc5, 0x86, 0x0b, 0x36, 0x57,
+        0x68, 0xab, 0xfe, 0x6a, 0x33, 0x11, 0xfc, 0x8f, 0x96, 0x44, 0x71, 0x4f, 0xa1, 0x98, 0x85, 0xdb,
+        0x67, 0xdc, 0x30, 0xb2, 0xdd, 0x20, 0x51, 0x29, 0x14, 0x8b, 0xea, 0x8b, 0x2a, 0x5e, 0x74, 0xb3,
+        0x80, 0xec, 0x1d, 0x16, 0x2b, 0xc6, 0xb0, 0x1d, 0x51, 0xfc, 0x2d, 0x3a, 0xb1, 0x6f, 0x5f, 0xb0,
+        0xd6, 0x42, 0x47, 0xec, 0x85, 0x44, 0x63, 0x23, 0x83, 0xc4, 0xcd, 0x98, 0x25, 0xb6, 0x90, 0x28,
+        0x2c, 0x12, 0x4a, 0xcc, 0x0c, 0xc9, 0xc0, 0x22, 0xb0, 0xe8, 0x97, 0xd6, 0xcb, 0x5e, 0xed, 0x11,
+        0x6c, 0x80, 0x9d, 0xb9, 0xc6, 0x36, 0x38, 0xd8, 0xf1, 0x7e, 0x3b, 0xfe, 0xa3, 0xd3, 0xd6, 0xeb,
+        0x3d, 0x9b, 0x8d, 0xe8, 0xce, 0xf3, 0xba, 0x46, 0xed, 0x6a, 0xd3, 0x42, 0x96, 0xc0, 0x44, 0x39,
+        0x8a, 0x9d, 0xa5, 0x0a, 0x40, 0x4a, 0x59, 0x76, 0x9b, 0xd3, 0x90, 0xa3, 0x50, 0xca, 0xd8, 0xe6,
+        0xad, 0x84, 0x7d, 0xde, 0x1b, 0xe4, 0xf5, 0x31, 0x3d, 0x19, 0xd3, 0xd1, 0x24, 0xe4, 0x4d, 0x60,
+        0x68, 0x7f, 0x8d, 0x73, 0x99, 0xb5, 0x70, 0xf9, 0x70, 0xd0, 0x75, 0xcf, 0x4d, 0x5b, 0xd3, 0x90,
+        0xb7, 0x3f, 0x9f, 0x46, 0x84, 0xa0, 0xaa, 0xa7, 0xd0, 0x46, 0x92, 0x51, 0xc9, 0x4d, 0x88, 0x1c,
+        0x3e, 0xff, 0x10, 0x8e, 0x61, 0x1d, 0x83, 0x02, 0x02, 0x0c, 0xb6, 0x6a, 0xfa, 0xc8, 0x25, 0xe4,
+        0x13, 0x3c, 0x84, 0x1c, 0x3e, 0x86, 0xf9, 0xe6, 0x09, 0x22, 0xe0, 0x09, 0x0a, 0xab, 0x7a, 0x55,
+        0xa0, 0x8c, 0xa2, 0x11, 0x41, 0x87, 0xec, 0x82, 0x7f, 0xf3, 0x39, 0xe4, 0x1d, 0x08, 0xfc, 0x81,
+        0xc0, 0x74, 0xc3, 0x88, 0xc1, 0xbf, 0x3a, 0xb8, 0x1c, 0x92, 0x41, 0x00, 0x79, 0x1f, 0x01, 0xa8,
+        0xd5, 0xa3, 0xdf, 0xd3, 0xb4, 0x45, 0x14, 0xe0, 0x15, 0x84, 0x47, 0x9c, 0xc0, 0xf1, 0xb4, 0xe7,
+        0x9f, 0x4d, 0x71, 0x66, 0xae, 0x37, 0x1c, 0x67, 0xf3, 0x9b, 0x7b, 0x98, 0x73, 0x72, 0xe9, 0x88,
+        0x4f, 0xf4, 0xda, 0x78, 0x4e, 0xab, 0xc5, 0x51, 0x25, 0x82, 0x94, 0x19, 0xed, 0xad, 0xed, 0x19,
+        0xc5, 0x76, 0x31, 0x18, 0x4b, 0x9e, 0x12, 0xde, 0x9a, 0xfe, 0xcc, 0x99, 0xa3, 0xc7, 0xe3, 0xb1,
+        0xc1, 0xe5, 0x62, 0xbb, 0x80, 0x0f, 0x10, 0x09, 0x63, 0x46, 0x92, 0xfd, 0xf2, 0xab, 0x0d, 0x86,
+        0x86, 0x12, 0xff, 0xa4, 0xda, 0x5c, 0xa1, 0x5a, 0x3a, 0x4b, 0x3a, 0xe2, 0x0d, 0xba, 0x85, 0xf6,
+        0xc8, 0xa0, 0x4e, 0xa5, 0x12, 0xec, 0xf9, 0xdd, 0x22, 0x50, 0x49, 0x95, 0x9a, 0x57, 0x5f, 0x64,
+        0x20, 0x6d, 0x88, 0xd9, 0x74, 0x2a, 0xb9, 0x4a, 0x68, 0x5e, 0x55, 0x31, 0xbc, 0xa5, 0x0d, 0x86,
+        0x2f, 0x6d, 0x22, 0x02, 0x51, 0xc4, 0x3a, 0xf8, 0x2e, 0xf6, 0x44, 0x29, 0x35, 0x5f, 0x7e, 0x85,
+        0x47, 0xdc, 0xa8, 0xd4, 0x7a, 0xf9, 0x55, 0x20, 0x69, 0x4e, 0xfa, 0x4b, 0x2e, 0x1e, 0x7a, 0x26,
+        0x62, 0x36, 0xf7, 0xc3, 0xa6, 0x64, 0x30, 0x65, 0x3f, 0xf4, 0x4b, 0xae, 0x6a, 0x2d, 0x19, 0xad,
+        0xe7, 0x65, 0x42, 0xa7, 0x44, 0xe4, 0x40, 0x25, 0x4e, 0x18, 0x64, 0x6d, 0x83, 0x57, 0x1d, 0xac,
+        0x77, 0xea, 0xb4, 0x0e, 0xef, 0x2a, 0x09, 0xc9, 0x96, 0xdc, 0xa4, 0x6e, 0x10, 0x95, 0xa0, 0x63,
+        0xf9, 0x4a, 0xd4, 0x60, 0xca, 0xa1, 0x82, 0x7b, 0xf6, 0xd7, 0x04, 0x16, 0x6d, 0x8e, 0x87, 0x9c,
+        0x2a, 0xa8, 0xcf, 0x09, 0xcc, 0x0c, 0x12, 0xc4, 0xb5, 0x73, 0x6b, 0x08, 0x13, 0x56, 0x4d, 0x0e,
+        0x62, 0x39, 0x19, 0x88, 0x66, 0xa4, 0x2a, 0x7d, 0x81, 0x8d, 0xcf, 0x38, 0x3f, 0xcf, 0x84, 0x6e,
+        0xa1, 0xf4, 0xfc, 0x27, 0x57, 0xdd, 0xba, 0xee, 0x92, 0x6a, 0x34, 0x7f, 0xd6, 0x9d, 0x98, 0xe6,
+        0x92, 0x27, 0xfc, 0x1a, 0xa1, 0xce, 0xe5, 0x72, 0x10, 0xd3, 0x0e, 0xc6, 0xbf, 0xac, 0x85, 0x02,
+        0x12, 0x9d, 0xc9, 0x96, 0xc1, 0xfb, 0x67, 0xa6, 0x0e, 0x2e, 0xc4, 0xf9, 0x57, 0x86, 0x11, 0xab,
+        0x83, 0xc3, 0x92, 0x93, 0x65, 0x0d, 0x60, 0x3b, 0x8c, 0x73, 0xcf, 0x01, 0xd3, 0x61, 0x61, 0x7c,
+        0x24, 0x31, 0x28, 0x0a, 0xae, 0xce, 0xbd, 0xe1, 0xf8, 0x30, 0x36, 0xcd, 0x74, 0x03, 0x0a, 0x42,
+        0xd6, 0x61, 0x68, 0x00, 0x93, 0x4f, 0x53, 0xbf, 0xdc, 0x99, 0x70, 0x74, 0x75, 0x8a, 0x63, 0xdc,
+        0x68, 0x8b, 0x4a, 0x55, 0xbc, 0x63, 0xba, 0x53, 0x7c, 0xa2, 0x62, 0x2b, 0xdf, 0x02, 0x55, 0xc6,
+        0xdd, 0xe5, 0xcb, 0x58, 0xd9, 0xfb, 0x97, 0x70, 0xa5, 0x31, 0x75, 0x94, 0x04, 0xe8, 0x01, 0x13,
+        0x6f, 0x7e, 0x6d, 0x1d, 0x95, 0x6b, 0xb8, 0x45, 0xff, 0x88, 0x21, 0x49, 0x16, 0x17, 0xbe, 0x66,
+        0x36, 0x3a, 0x02, 0xf3, 0x48, 0x4d, 0x88, 0x46, 0x40, 0x97, 0x4c, 0x50, 0x1a, 0x90, 0x5a, 0x80,
+        0xb7, 0x25, 0xe7, 0xa9, 0x70, 0xbe, 0x0b, 0x71, 0x99, 0x9c, 0x42, 0x6f, 0x24, 0x27, 0xc3, 0xb6,
+        0x00, 0x7e, 0x34, 0xe5, 0x4d, 0x60, 0x9f, 0x64, 0xe1, 0x19, 0x16, 0x22, 0xb2, 0x88, 0xe4, 0xb4,
+        0x3a, 0x8a, 0xbb, 0x51, 0x84, 0xdb, 0x0f, 0x47, 0xf2, 0x7d, 0xa7, 0xfc, 0xb0, 0x46, 0x84, 0x98,
+        0xa4, 0x49, 0x6b, 0xb3, 0xe6, 0x18, 0x4e, 0xc1, 0xc4, 0x43, 0xb8, 0x62, 0x2a, 0xf4, 0xb0, 0xde,
+        0x0d, 0xa4, 0x7a, 0x19, 0xe6, 0xc1, 0x96, 0xb0, 0x7a, 0x58, 0xd0, 0xbb, 0x18, 0xaf, 0x24, 0x5d,
+        0x8d, 0x7e, 0x56, 0x61, 0xb8, 0xd5, 0xd8, 0xbb, 0x52, 0x1a, 0x5c, 0x0d, 0x7e, 0xf0, 0xe8, 0xcc,
+        0xd5, 0xe3, 0x69, 0xc7, 0x5a, 0x78, 0x6c, 0xc5, 0x9d, 0x28, 0x39, 0xdb, 0x54, 0xd3, 0xfd, 0x7e,
+        0xee, 0x07, 0x3c, 0xc8, 0x70, 0x99, 0x59, 0x22, 0x36, 0x23, 0x3c, 0x3e, 0x57, 0xfb, 0xde, 0xda,
+        0x16, 0xcb, 0x8b, 0xe3, 0x52, 0x17, 0xf4, 0x41, 0x52, 0x98, 0x5a, 0x66, 0x30, 0xdc, 0x7a, 0xb8,
+        0x54, 0xf8, 0x5f, 0x6b, 0x81, 0x07, 0x91, 0x9b, 0x3b, 0x28, 0x13, 0x33, 0xe4, 0x4e, 0xf5, 0x46,
+        0x99, 0xe5, 0x1f, 0xc0, 0xfe, 0x7e, 0x52, 0xe5, 0x60, 0x5e, 0xdc, 0x79, 0xa8, 0x56, 0xe3, 0xde,
+        0x35, 0xb6, 0x70, 0x66, 0xce, 0x88, 0x50, 0x3f, 0xf0, 0xc6, 0xf9, 0xe6, 0xc1, 0xe2, 0x51, 0x7f,
+        0xfd, 0x59, 0x12, 0xf2, 0x0d, 0x55, 0x48, 0x66, 0xd8, 0x26, 0xa4, 0x7f, 0x3f, 0x3e, 0x2f, 0x81,
+        0xf8, 0x88, 0xb5, 0xe3, 0x0f, 0x1a, 0xc4, 0x84, 0xa9, 0x19, 0xe8, 0x36, 0x4b, 0x26, 0x66, 0xac,
+        0x99, 0x50, 0x41, 0x98, 0xbc, 0xb8, 0xdf, 0x34, 0xe7, 0x42, 0x89, 0x80, 0x10, 0x97, 0x06, 0xb5,
+        0x16, 0x65, 0xac, 0xb8, 0xdd, 0x18, 0x58, 0xa1, 0x9b, 0x49, 0xbb, 0xcd, 0x93, 0x4c, 0xb6, 0x3f,
+        0xb1, 0xae, 0xd5, 0x9e, 0xaf, 0xd1, 0xff, 0x30, 0x2e, 0xc0, 0x03, 0xdb, 0xcd, 0xc1, 0xf5, 0x81,
+        0xd5, 0x2a, 0x74, 0xc5, 0x4b, 0xff, 0x28, 0xbe, 0x0f, 0x0f, 0x99, 0xf5, 0x10, 0xa2, 0x48, 0xdc,
+        0x4f, 0x2a, 0x33, 0x99, 0xd1, 0xd8, 0x18, 0xd9, 0x16, 0x9a, 0xee, 0xd1, 0xfc, 0xdf, 0xe8, 0x32,
+        0x7e, 0x75, 0x86, 0xc8, 0x47, 0x28, 0x88, 0x21, 0x8a, 0xb5, 0x18, 0x3e, 0xc0, 0x29, 0xb0, 0x5f,
+        0xf6, 0xcd, 0xee, 0x4d, 0xa3, 0x5b, 0xc7, 0xab, 0x41, 0x2e, 0xa7, 0x56, 0xf6, 0x0f, 0x29, 0x8a,
+        0x61, 0x90, 0xd9, 0xd0, 0xed, 0x03, 0x05, 0x00, 0x9c, 0x0d, 0x86, 0x6b, 0xd1, 0xa1, 0x32, 0x17,
+        0xda, 0x12, 0x76, 0x4c, 0x36, 0xf7, 0x81, 0x86, 0xaa, 0x7d, 0x37, 0xa3, 0x7e, 0x53, 0xf8, 0x56,
+        0x9b, 0x3b, 0x77, 0x11, 0xf3, 0x2e, 0x4c, 0xdb, 0x8c, 0x7a, 0xb0, 0xe1, 0x19, 0x36, 0xc3, 0xd9,
+        0x90, 0x36, 0x26, 0x59, 0x95, 0xc9, 0x5f, 0x4a, 0x59, 0x3f, 0x84, 0xc5, 0xdd, 0x05, 0x13, 0x1f,
+        0x45, 0xe5, 0x89, 0x30, 0xcf, 0x66, 0xf2, 0x20, 0xb0, 0x7a, 0x3c, 0x54, 0x2d, 0x3e, 0xd8, 0x0c,
+        0x4d, 0x82, 0x04, 0xc7, 0x1d, 0xd0, 0xf4, 0xda, 0xb4, 0xe9, 0xa2, 0x14, 0x2b, 0x54, 0xd1, 0xf7,
+        0x5d, 0x03, 0x28, 0x9d, 0xc6, 0xc1, 0x6b, 0x45, 0x9f, 0xa5, 0x08, 0x63, 0x9e, 0x41, 0x84, 0x30,
+        0xe8, 0xc6, 0x5e, 0x1f, 0xa7, 0xcb, 0xc2, 0x16, 0x2f, 0x3a, 0x15, 0xaf, 0xaa, 0x22, 0xd3, 0xff,
+        0x9e, 0x2f, 0xbd, 0x0b, 0x49, 0x56, 0x6e, 0xd4, 0xe9, 0x14, 0x79, 0x1b, 0x09, 0x3d, 0xf7, 0x0f,
+        0x3f, 0xf2, 0x78, 0xda, 0xd1, 0xae, 0xea, 0x5b, 0xf3, 0x6d, 0xde, 0x04, 0x51, 0x0b, 0x7c, 0x5e,
+        0x7d, 0xe9, 0x81, 0x95, 0x02, 0xbd, 0x7d, 0x53, 0x49, 0xf6, 0x28, 0x73, 0x2c, 0x2c, 0xa8, 0x89,
+        0xe2, 0x45, 0x93, 0xdb, 0x28, 0x06, 0x5c, 0x00, 0xbb, 0x9d, 0xc7, 0x90, 0x77, 0x83, 0x87, 0xf1,
+        0x4e, 0x18, 0xfc, 0xcd, 0xe3, 0xd5, 0x12, 0xc9, 0xc1, 0x1b, 0xd0, 0x46, 0x8a, 0xb5, 0x5a, 0xf8,
+        0x6e, 0xa4, 0x3b, 0x05, 0xff, 0x0a, 0x09, 0x73, 0x7f, 0x0d, 0x5d, 0xe5, 0x2b, 0x04, 0x88, 0xe3,
+        0xdc, 0x12, 0xbf, 0xd0, 0x84, 0xf1, 0x14, 0x35, 0x1c, 0xbe, 0x53, 0xc1, 0xc3, 0x06, 0xed, 0x36,
+        0x13, 0xa8, 0x7e, 0x76, 0x81, 0x1b, 0x1a, 0x6a, 0xda, 0xc8, 0x89, 0x2b, 0xf4, 0xfc, 0x20, 0x66,
+        0x75, 0xd8, 0xf8, 0x38, 0x14, 0x0a, 0x58, 0x68, 0x33, 0xfa, 0xae, 0xa8, 0x33, 0x31, 0x59, 0x13,
+        0x36, 0xc1, 0xb7, 0x76, 0x94, 0xf0, 0x30, 0xa0, 0xbb, 0x43, 0x5a, 0x4f, 0xab, 0x6b, 0xce, 0xdb,
+        0x0e, 0x98, 0x58, 0xb5, 0x9a, 0xa8, 0xd0, 0x84, 0x51, 0xa8, 0xe1, 0xf0, 0x9d, 0xaa, 0x2f, 0xf1,
+        0x36, 0x61, 0xd3, 0xbb, 0x2a, 0xd6, 0x46, 0x33, 0xb2, 0x19, 0x5f, 0xe8, 0x92, 0x95, 0x59, 0x3f,
+        0x86, 0x0b, 0xca, 0x2c, 0x78, 0xe5, 0x60, 0xe3, 0x9e, 0x9d, 0x53, 0xd7, 0x40, 0xd3, 0x42, 0x03,
+        0xb2, 0xb9, 0xe5, 0xdf, 0xf2, 0x81, 0x1e, 0x62, 0x48, 0x5f, 0x64, 0x31, 0x9b, 0xc6, 0x81, 0x1e,
+        0xd6, 0x47, 0x31, 0x20, 0xe0, 0xe9, 0x18, 0x9f, 0x05, 0xf0, 0xa5, 0x05, 0x8d, 0x33, 0x3d, 0x70,
+        0xae, 0xd3, 0x00, 0x11, 0xec, 0xd6, 0xd8, 0x2d, 0x1a, 0xc0, 0x82, 0x37, 0x04, 0x55, 0x42, 0x1b,
+        0x8e, 0xd9, 0xbd, 0x44, 0xc8, 0xe9, 0x09, 0x22, 0xee, 0xfd, 0x03, 0xdc, 0x19, 0xb5, 0xf8, 0xe3,
+        0x15, 0x29, 0xbe, 0xa0, 0x67, 0xf1, 0xbf, 0xe9, 0xc1, 0xa2, 0xc6, 0x19, 0xe3, 0x2f, 0x0f, 0x74,
+        0xdc, 0x0b, 0xd6, 0x16, 0xa1, 0x1d, 0xd0, 0x95, 0x24, 0xf8, 0x3d, 0xf6, 0xa6, 0xfd, 0x64, 0xe7,
+        0x74, 0x65, 0x1f, 0x12, 0xdb, 0x30, 0x2c, 0xe2, 0xdb, 0xa1, 0x42, 0x78, 0x7c, 0x11, 0x96, 0x47,
+        0x75, 0x46, 0xda, 0x85, 0x50, 0xe5, 0x59, 0x5d, 0x95, 0x6c, 0x38, 0xae, 0x48, 0x17, 0xb4, 0x9a,
+        0x3d, 0x68, 0x94, 0xaf, 0x9a, 0xa6, 0x69, 0xb0, 0x66, 0xf2, 0x0f, 0x19, 0x62, 0xc5, 0x1a, 0x6d,
+        0x7c, 0xbf, 0x0a, 0x71, 0x33, 0x0f, 0x93, 0xec, 0x87, 0x03, 0x07, 0x44, 0xe5, 0xd5, 0x0b, 0xf8,
+        0xf0, 0x8f, 0x00, 0xeb, 0x72, 0xca, 0xe7, 0x78, 0xcf, 0x4b, 0x39, 0xed, 0xaa, 0x64, 0x17, 0xdd,
+        0x48, 0x50, 0x35, 0xae, 0x55, 0x67, 0x22, 0x34, 0xd4, 0xb3, 0x98, 0xf7, 0x13, 0x57, 0xd0, 0x96,
+        0xaa, 0xc8, 0x9a, 0xe3, 0x66, 0x8f, 0x56, 0xcd, 0x16, 0x60, 0x54, 0xaa, 0x0c, 0x48, 0x42, 0x63,
+        0xea, 0xc3, 0xc0, 0xa0, 0x40, 0x9b, 0x15, 0xac, 0x2e, 0x36, 0x50, 0xb2, 0x6a, 0x8e, 0x64, 0xbf,
+        0x9f, 0x07, 0x29, 0xa1, 0xc6, 0x16, 0xa1, 0x97, 0x0e, 0x6f, 0x91, 0x5d, 0x0c, 0x4d, 0x54, 0x5c,
+        0x83, 0x76, 0xec, 0xe3, 0x82, 0x2b, 0x5f, 0x09, 0x4a, 0x76, 0x2b, 0xc3, 0x3d, 0x72, 0x4e, 0x2c,
+        0x87, 0x20, 0xe5, 0xef, 0x9f, 0x09, 0x4d, 0xe2, 0x3e, 0x67, 0x50, 0x07, 0xb9, 0x6e, 0xde, 0x5d,
+        0x4d, 0x18, 0xb3, 0xb0, 0x73, 0x25, 0x7f, 0xb0, 0xb1, 0x11, 0xdd, 0x99, 0xd6, 0xf1, 0x81, 0x6c,
+        0x4a, 0x13, 0x0a, 0x2f, 0xb5, 0x3b, 0x9c, 0xd0, 0x6e, 0x70, 0x00,
+};
+
+static const uint8_t s_page_html_gzip[] = {
+        0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x3d, 0x6b, 0x73, 0x1b, 0xc9,
+        0x71, 0xdf, 0xf5, 0x2b, 0x56, 0x94, 0x4e, 0x8b, 0x95, 0x16, 0x20, 0x00, 0x3e, 0x44, 0x02, 0x5a,
+        0x2a, 0x3a, 0x4a, 0x77, 0x52, 0x4a, 0x2f, 0x8b, 0x3c, 0x27, 0x8e, 0x8a, 0x45, 0x2d, 0xb0, 0x03,
+        0x70, 0x4d, 0x00, 0x0b, 0xed, 0x2e, 0xf8, 0x30, 0x84, 0x2a, 0x9d, 0x2e, 0x77, 0xb2, 0x73, 0x2e,
+        0x5f, 0x72, 0x76, 0xa5, 0x5c, 0xa9, 0x24, 0x2e, 0x27, 0x55, 0xfe, 0xac, 0x48, 0x77, 0xb6, 0xee,
+        0x21, 0x5d, 0xd5, 0xfd, 0x02, 0xf2, 0x2f, 0xdc, 0x2f, 0x49, 0x77, 0xcf, 0xcc, 0xee, 0xcc, 0x62,
+        0x01, 0x92, 0xd2, 0xc5, 0x15, 0xdb, 0x22, 0xb0, 0xb3, 0x3d, 0x3d, 0xdd, 0x3d, 0xfd, 0x9c, 0x07,
+        0x7c, 0xe9, 0xf4, 0xd5, 0x3b, 0xab, 0xeb, 0x3f, 0xbb, 0x7b, 0xcd, 0xd8, 0x8a, 0xbb, 0x9d, 0x95,
+        0x53, 0x97, 0xf0, 0xc3, 0xe8, 0xb8, 0xbd, 0xb6, 0x33, 0x13, 0x0e, 0x66, 0xb0, 0x81, 0xb9, 0x1e,
+        0x7c, 0x74, 0x59, 0xec, 0x1a, 0xcd, 0x2d, 0x37, 0x8c, 0x58, 0xec, 0xcc, 0x7c, 0xb0, 0xfe, 0x5e,
+        0x71, 0x69, 0x46, 0x36, 0xf7, 0xdc, 0x2e, 0x73, 0x66, 0x76, 0x7c, 0xb6, 0xdb, 0x0f, 0xc2, 0x78,
+        0xc6, 0x68, 0x06, 0xbd, 0x98, 0xf5, 0x00, 0x6c, 0xd7, 0xf7, 0xe2, 0x2d, 0xc7, 0x63, 0x3b, 0x7e,
+        0x93, 0x15, 0xe9, 0xc1, 0x36, 0xfc, 0x9e, 0x1f, 0xfb, 0x6e, 0xa7, 0x18, 0x35, 0xdd, 0x0e, 0x73,
+        0x2a, 0xa5, 0x32, 0xa2, 0x89, 0xfd, 0xb8, 0xc3, 0x56, 0x0e, 0xfe, 0xfd, 0xe0, 0xf5, 0xc1, 0xab,
+        0x83, 0x97, 0x87, 0x4f, 0x0e, 0x5e, 0x1f, 0x3e, 0x3e, 0x78, 0x09, 0xdf, 0x5f, 0x18, 0x07, 0x5f,
+        0x1f, 0x3c, 0x3b, 0x7c, 0x7a, 0xf0, 0xe5, 0xe1, 0x87, 0xd0, 0xfc, 0xfc, 0xe0, 0x99, 0x01, 0x7f,
+        0x5e, 0x1f, 0xfc, 0xe5, 0xe0, 0x8b, 0xc3, 0x8f, 0x0e, 0x3f, 0x3e, 0x78, 0x76, 0x69, 0x96, 0xf7,
+        0x3d, 0x75, 0x29, 0x8a, 0xf7, 0xe1, 0xb3, 0x16, 0x06, 0x41, 0x3c, 0x2c, 0x16, 0x1b, 0xed, 0xda,
+        0x19, 0xc6, 0x5a, 0x95, 0xd6, 0x7c, 0xbd, 0x58, 0x8c, 0x06, 0x61, 0xcb, 0x6d, 0xb2, 0xda, 0x99,
+        0x16, 0xfd, 0x07, 0x5a, 0x1a, 0x41, 0xe8, 0xb1, 0x10, 0x40, 0xaa, 0x6c, 0x91, 0xb9, 0xd0, 0x10,
+        0xb3, 0xbd, 0xb8, 0x76, 0xa6, 0xd2, 0xaa, 0x2e, 0xcf, 0xcd, 0xc1, 0x63, 0x77, 0x10, 0x33, 0xaf,
+        0x76, 0x66, 0xb1, 0x71, 0xb1, 0xba, 0x54, 0x86, 0xe7, 0x76, 0x10, 0xc0, 0x63, 0x65, 0xd1, 0x9d,
+        0x9b, 0x47, 0xe8, 0x5d, 0x37, 0xec, 0xd5, 0xce, 0x78, 0xcb, 0x17, 0x2f, 0x96, 0x17, 0x11, 0x9b,
+        0x0b, 0x2f, 0xbd, 0x66, 0x75, 0xb1, 0x8a, 0x4f, 0xa1, 0xeb, 0xf9, 0x83, 0xa8, 0x56, 0x29, 0xf7,
+        0xf7, 0x46, 0xe7, 0x87, 0x5d, 0x37, 0x6c, 0xfb, 0xbd, 0x5a, 0xb9, 0xde, 0x77, 0x3d, 0xcf, 0xef,
+        0xb5, 0xe1, 0x5b, 0x23, 0xd8, 0x2b, 0x46, 0xfe, 0x2f, 0xf0, 0x81, 0xd3, 0x01, 0xe4, 0xec, 0x8d,
+        0x1a, 0x81, 0xb7, 0x3f, 0x6c, 0x81, 0xe8, 0x8a, 0x2d, 0xb7, 0xeb, 0x77, 0xf6, 0x6b, 0x45, 0xb7,
+        0xdf, 0xef, 0xb0, 0x62, 0xb4, 0x1f, 0xc5, 0xac, 0x6b, 0xbf, 0xdb, 0xf1, 0x7b, 0xdb, 0xb7, 0xdc,
+        0xe6, 0x1a, 0x3d, 0xbe, 0x07, 0x70, 0xf6, 0xcc, 0x1a, 0x6b, 0x07, 0xcc, 0xf8, 0xe0, 0xc6, 0x8c,
+        0x7d, 0x2f, 0x68, 0x04, 0x71, 0x60, 0x5f, 0x67, 0x9d, 0x1d, 0x16, 0xfb, 0x4d, 0xd7, 0xbe, 0x12,
+        0x82, 0x90, 0xed, 0xc8, 0xed, 0x45, 0xc5, 0x88, 0x85, 0x7e, 0xab, 0xde, 0x70, 0x9b, 0xdb, 0xed,
+        0x30, 0x18, 0xf4, 0xbc, 0xda, 0x8e, 0x1b, 0x16, 0x50, 0x42, 0x56, 0xbd, 0x19, 0x74, 0x82, 0x50,
+        0x3c, 0xa3, 0x04, 0xac, 0x3a, 0x8c, 0xc2, 0x8a, 0x5b, 0xcc, 0x6f, 0x6f, 0xc5, 0xb5, 0x4a, 0x09,
+        0x84, 0xb7, 0xcb, 0x1a, 0xdb, 0x7e, 0x4c, 0x6f, 0x91, 0x68, 0x56, 0x74, 0xbd, 0x9f, 0x0f, 0x22,
+        0x78, 0x59, 0x2e, 0xbf, 0x33, 0x2a, 0xe1, 0x54, 0xbb, 0xd0, 0x25, 0x04, 0x3e, 0xf7, 0xf8, 0x14,
+        0xd7, 0x2a, 0xf0, 0xaa, 0xbf, 0x57, 0x97, 0x8c, 0x1b, 0xee, 0x20, 0x0e, 0x12, 0xee, 0x2b, 0x8b,
+        0x20, 0x15, 0xd4, 0x29, 0xea, 0x82, 0x10, 0xc0, 0x7c, 0x1c, 0x07, 0x5d, 0xfe, 0xa6, 0xc4, 0x5f,
+        0x15, 0xc3, 0x60, 0x77, 0xe8, 0xf9, 0x51, 0xbf, 0xe3, 0xee, 0xd7, 0x5a, 0x1d, 0xb6, 0x57, 0xc7,
+        0x3f, 0x45, 0xcf, 0x0f, 0x59, 0x33, 0xf6, 0x83, 0x5e, 0x0d, 0x08, 0x1f, 0x74, 0x7b, 0xf5, 0xb6,
+        0xdb, 0x27, 0x39, 0xab, 0xdc, 0x21, 0x07, 0x6e, 0x58, 0x6c, 0xe3, 0x34, 0x80, 0x16, 0x16, 0x2a,
+        0x73, 0x0b, 0x1e, 0x6b, 0xdb, 0x62, 0x6e, 0xed, 0x33, 0xd5, 0xc6, 0x9c, 0x3b, 0xef, 0x4a, 0xde,
+        0x51, 0x25, 0x34, 0xe2, 0x8c, 0xca, 0x12, 0xe2, 0xe3, 0xf3, 0x22, 0xa6, 0x92, 0x0b, 0x88, 0x3f,
+        0x58, 0x82, 0x7a, 0x63, 0xab, 0xc2, 0x67, 0x0b, 0x85, 0x02, 0xa2, 0xaa, 0x2e, 0x84, 0xac, 0x5b,
+        0xa7, 0x96, 0x5d, 0x2e, 0xbe, 0xc5, 0x72, 0x79, 0x54, 0x8a, 0x62, 0x37, 0x1e, 0x44, 0x09, 0x2f,
+        0x7e, 0x8f, 0x04, 0x4c, 0x2c, 0xb9, 0x1d, 0xbf, 0xdd, 0x2b, 0xfa, 0x30, 0x9b, 0x51, 0xad, 0x09,
+        0x94, 0xb2, 0x90, 0xf8, 0xc1, 0xe1, 0x53, 0xc4, 0xe5, 0xd2, 0x32, 0xe2, 0x15, 0xc4, 0x36, 0x1b,
+        0x5e, 0xd5, 0x5b, 0x96, 0x58, 0x8b, 0x7e, 0xcf, 0x83, 0xb9, 0x8e, 0x83, 0x70, 0xc8, 0x25, 0xbf,
+        0x0c, 0x5d, 0xc5, 0xdc, 0x2d, 0x8f, 0x31, 0xb1, 0x50, 0x7e, 0x27, 0x47, 0x09, 0x5c, 0xcf, 0xe2,
+        0xb2, 0x8d, 0xb6, 0x42, 0x50, 0xb0, 0x5a, 0x42, 0x32, 0x4e, 0x6d, 0x0f, 0xa4, 0xcd, 0x3c, 0x63,
+        0x7c, 0x38, 0x05, 0xcf, 0x99, 0x79, 0x90, 0xc6, 0x12, 0x74, 0xeb, 0xbb, 0x3d, 0xd6, 0x19, 0x8e,
+        0x8d, 0x20, 0x6c, 0xcf, 0x12, 0xd4, 0xd4, 0x2a, 0x20, 0xe2, 0x28, 0xe8, 0xf8, 0x9e, 0x21, 0x28,
+        0xa0, 0x66, 0x6b, 0x9a, 0xc4, 0xb5, 0xf9, 0xa9, 0xe7, 0x69, 0x0d, 0x8d, 0x5d, 0x24, 0x4f, 0xa0,
+        0x4e, 0x4a, 0xce, 0x8c, 0x64, 0xbb, 0xcf, 0x03, 0x46, 0x81, 0xbe, 0xd8, 0x61, 0xad, 0x58, 0xa8,
+        0x13, 0x27, 0x86, 0x1a, 0xe6, 0x13, 0x82, 0xcf, 0x54, 0x17, 0x16, 0xe7, 0x58, 0x03, 0x24, 0xc4,
+        0x7a, 0x51, 0x10, 0x46, 0xa0, 0x63, 0xbe, 0x97, 0x4c, 0x2d, 0x3e, 0xd4, 0xf1, 0x0f, 0xd8, 0x4a,
+        0x17, 0x5a, 0x62, 0x56, 0xe4, 0x5a, 0x1a, 0xd5, 0x42, 0xd6, 0x67, 0x6e, 0x5c, 0xa8, 0xda, 0x95,
+        0x16, 0x70, 0x4a, 0x4a, 0x5b, 0x45, 0xb2, 0x39, 0x9e, 0x62, 0xd3, 0x0d, 0xbd, 0x71, 0xc1, 0xc5,
+        0x3e, 0x98, 0x38, 0xaa, 0xe7, 0x71, 0x45, 0x17, 0x07, 0xfd, 0xda, 0x5c, 0x06, 0xa4, 0x69, 0x6b,
+        0xa0, 0x59, 0x31, 0x2f, 0xa5, 0xdc, 0x93, 0x28, 0x12, 0x92, 0xd0, 0xa5, 0x0f, 0x55, 0x2d, 0x5c,
+        0xaa, 0xe6, 0x09, 0x53, 0xf5, 0x1f, 0x72, 0x28, 0x72, 0x9d, 0x30, 0x92, 0x2e, 0xe8, 0x45, 0x05,
+        0xf9, 0x8e, 0xdb, 0x19, 0x68, 0xf3, 0xc4, 0x75, 0x5c, 0x45, 0x7e, 0x71, 0x02, 0x72, 0x72, 0x52,
+        0x56, 0x5d, 0x73, 0x0d, 0xaa, 0x1d, 0x35, 0xdc, 0x88, 0xa1, 0x85, 0x91, 0x90, 0x69, 0xcc, 0x01,
+        0xc4, 0x1b, 0x9d, 0x93, 0x31, 0x43, 0x9d, 0xcf, 0x0c, 0xc6, 0x39, 0x00, 0x72, 0x07, 0x0d, 0xbd,
+        0xe7, 0x51, 0x22, 0xe0, 0x1d, 0x25, 0xe7, 0x38, 0x1f, 0x44, 0x42, 0x93, 0x34, 0x02, 0x82, 0x52,
+        0x13, 0x02, 0x4e, 0xa5, 0xe2, 0xcd, 0x2f, 0xd5, 0xf9, 0xf4, 0x82, 0xf7, 0x61, 0xad, 0x6a, 0x6b,
+        0x1e, 0x41, 0xb6, 0x06, 0x5d, 0x0e, 0xc1, 0x95, 0x2c, 0x81, 0x60, 0xad, 0xd6, 0x42, 0xab, 0x85,
+        0x10, 0xee, 0x43, 0x9f, 0x43, 0x5c, 0x6c, 0xce, 0xb9, 0xcc, 0x4b, 0x71, 0x2c, 0x40, 0x98, 0x63,
+        0x08, 0xd1, 0x0f, 0x59, 0x14, 0x71, 0x98, 0x72, 0x75, 0x69, 0xbe, 0x79, 0x31, 0xc5, 0xd2, 0x6c,
+        0x5d, 0x14, 0x30, 0xdd, 0x8a, 0x80, 0x58, 0x5a, 0xae, 0x34, 0xaa, 0x2a, 0x44, 0x43, 0x42, 0x54,
+        0x17, 0x38, 0x48, 0x12, 0xe0, 0xc4, 0x40, 0xad, 0xd6, 0x45, 0xd6, 0x14, 0x48, 0xca, 0x02, 0x44,
+        0x46, 0x3d, 0x85, 0x9f, 0x2a, 0x82, 0x34, 0x83, 0x2a, 0x87, 0x48, 0x82, 0x66, 0xc2, 0x8f, 0xdb,
+        0xaa, 0x70, 0x08, 0x21, 0x12, 0x77, 0x61, 0xa9, 0xdc, 0x54, 0x47, 0x99, 0xe3, 0xa3, 0x74, 0xfa,
+        0x6d, 0x0e, 0x31, 0xdf, 0x9a, 0x5f, 0x64, 0x0b, 0x29, 0x44, 0x19, 0xfe, 0x4b, 0xa4, 0xf6, 0xb6,
+        0xe6, 0x04, 0x33, 0xde, 0xf2, 0xfc, 0x52, 0x2a, 0x56, 0xe6, 0xc2, 0x20, 0x17, 0x47, 0xa5, 0x86,
+        0x1b, 0x0e, 0x85, 0x43, 0x5c, 0xd4, 0xa3, 0x44, 0xd8, 0x6e, 0xb8, 0x85, 0xb2, 0x4d, 0xff, 0x2d,
+        0x95, 0x17, 0xb3, 0x86, 0x01, 0x76, 0x54, 0x0f, 0x76, 0x58, 0xd8, 0xea, 0x04, 0xbb, 0xb5, 0x2d,
+        0xdf, 0xf3, 0x58, 0x4f, 0x06, 0x34, 0xb0, 0x19, 0xa3, 0x6c, 0x94, 0x09, 0x79, 0xb1, 0xe5, 0x77,
+        0x3a, 0x72, 0x04, 0x8c, 0x88, 0x75, 0xee, 0x88, 0xf3, 0x5c, 0xad, 0x54, 0x61, 0x4c, 0x25, 0xac,
+        0xbc, 0xf1, 0xe2, 0x10, 0xa2, 0xb5, 0x4f, 0xe1, 0x8d, 0xb0, 0x18, 0xe5, 0xd2, 0x7c, 0x64, 0x30,
+        0xd0, 0x68, 0x3b, 0x45, 0x96, 0x36, 0x02, 0xff, 0x90, 0x8e, 0xc5, 0xd1, 0xb1, 0xe3, 0xe4, 0x12,
+        0xe9, 0x22, 0xf6, 0x29, 0x62, 0x08, 0xcb, 0xe9, 0xb7, 0x1b, 0x02, 0x1c, 0xfe, 0xc9, 0xb7, 0x29,
+        0x8c, 0xfb, 0x7e, 0x6b, 0xbf, 0x28, 0xf2, 0xbb, 0x5a, 0xd4, 0x07, 0xc7, 0x5e, 0x6c, 0xb0, 0x78,
+        0x97, 0x31, 0x3e, 0x06, 0xfa, 0x4a, 0x74, 0x6d, 0x19, 0xe3, 0x57, 0x46, 0xee, 0xb0, 0x36, 0xeb,
+        0x4d, 0x1f, 0x3b, 0x09, 0xea, 0x8a, 0x87, 0xa8, 0xa6, 0x18, 0x10, 0xa6, 0xcf, 0x64, 0xc8, 0x23,
+        0xa1, 0x8b, 0x09, 0xa8, 0x56, 0xcb, 0x63, 0x60, 0x46, 0xd3, 0xed, 0xed, 0xb8, 0x91, 0x02, 0x6d,
+        0x9c, 0xf6, 0xbb, 0x98, 0xa7, 0xba, 0xbd, 0xb8, 0xae, 0xcc, 0x9c, 0xda, 0x2c, 0xa9, 0x6b, 0x74,
+        0x82, 0xe6, 0xb6, 0x32, 0x93, 0x45, 0xbf, 0xeb, 0xb6, 0xd9, 0x58, 0x86, 0x81, 0x89, 0x66, 0xb9,
+        0x35, 0x67, 0x80, 0x7f, 0xb6, 0x69, 0x12, 0xfb, 0x6e, 0x08, 0xed, 0xf8, 0x6c, 0xd9, 0x59, 0xe0,
+        0xe5, 0x32, 0x65, 0x23, 0x53, 0xba, 0xa8, 0x03, 0x12, 0xf7, 0x55, 0xa0, 0xae, 0x8a, 0xd9, 0x56,
+        0xbc, 0x1b, 0x60, 0x4c, 0x39, 0x4e, 0xc8, 0x81, 0x48, 0x43, 0x82, 0xe4, 0x22, 0xf1, 0x7b, 0xad,
+        0xe0, 0xd8, 0xd1, 0x4a, 0x76, 0x5d, 0x4a, 0x7a, 0xa2, 0x1e, 0xe8, 0x53, 0x76, 0xb4, 0x2a, 0xd0,
+        0x0c, 0xca, 0xd8, 0x82, 0x36, 0xa3, 0x04, 0xd6, 0xa3, 0x22, 0x19, 0xc5, 0xdd, 0xb9, 0x6c, 0xdc,
+        0xcd, 0x98, 0xcc, 0x62, 0x26, 0x4f, 0x5a, 0x42, 0xf7, 0x2c, 0x08, 0xee, 0xb8, 0x0d, 0xc8, 0x45,
+        0xf2, 0x7c, 0x3a, 0xbd, 0x56, 0x02, 0x90, 0x9a, 0xab, 0x21, 0x33, 0x61, 0xd0, 0x89, 0x8e, 0xd4,
+        0xce, 0xa5, 0x09, 0x69, 0x48, 0x23, 0xee, 0x0d, 0x93, 0x70, 0x5a, 0x46, 0x9e, 0xe7, 0x8f, 0xc1,
+        0xb3, 0x92, 0x4b, 0xb5, 0x16, 0x5b, 0x4b, 0x2d, 0x37, 0x27, 0x2d, 0x1f, 0x0f, 0xdb, 0xcd, 0x41,
+        0x08, 0xb1, 0xb4, 0xd6, 0x0f, 0x7c, 0xca, 0x1c, 0xc7, 0x32, 0x46, 0x24, 0xbb, 0x56, 0x31, 0x2a,
+        0x94, 0x7e, 0x13, 0x69, 0xb5, 0x2d, 0xf4, 0x68, 0x5a, 0xee, 0xc6, 0x9a, 0xe0, 0x8e, 0xab, 0xfc,
+        0xad, 0x0b, 0x1e, 0x63, 0x87, 0xe9, 0xaf, 0xa9, 0x3a, 0xa2, 0xd7, 0x90, 0x62, 0x0d, 0x22, 0xa6,
+        0xa5, 0x29, 0x72, 0x5a, 0x94, 0x44, 0x5a, 0x90, 0x29, 0x5a, 0x64, 0xba, 0x04, 0xdd, 0x8b, 0x51,
+        0xd7, 0x05, 0x4f, 0x49, 0x44, 0x81, 0xf3, 0xd4, 0x6b, 0x82, 0x45, 0xe9, 0x35, 0xc6, 0x12, 0x8e,
+        0x51, 0xa9, 0xe5, 0xb3, 0x8e, 0x37, 0x1c, 0x4f, 0xda, 0xc4, 0x1b, 0x83, 0xcf, 0xb4, 0x6e, 0xb0,
+        0x63, 0x5a, 0x91, 0xe7, 0x8e, 0x78, 0x77, 0xbf, 0xd7, 0x1f, 0xc4, 0xf7, 0xe3, 0xfd, 0x3e, 0x14,
+        0xb0, 0x60, 0x86, 0x6d, 0x36, 0xb3, 0xa1, 0x3a, 0x16, 0xb7, 0x89, 0x89, 0x79, 0x96, 0x9f, 0xe6,
+        0x16, 0x6b, 0x6e, 0x43, 0xc9, 0x36, 0x9c, 0x98, 0x86, 0x4c, 0x49, 0xe7, 0x39, 0x41, 0xfa, 0xec,
+        0xa5, 0x28, 0x39, 0x41, 0xc3, 0xfc, 0x71, 0x3b, 0x41, 0x3b, 0xc7, 0x73, 0x4f, 0x37, 0xc5, 0x1c,
+        0xaa, 0x32, 0xc2, 0x24, 0xd7, 0x0a, 0xa8, 0xa9, 0x82, 0x93, 0x9e, 0x94, 0x2a, 0x38, 0x19, 0x00,
+        0x8b, 0xfb, 0x35, 0x9a, 0xaf, 0x13, 0x65, 0xf0, 0x5a, 0x6a, 0x59, 0xce, 0x0a, 0x61, 0x81, 0x26,
+        0x17, 0x19, 0x02, 0x9a, 0xc2, 0xfd, 0xc4, 0x6a, 0x30, 0x80, 0x94, 0xeb, 0x49, 0x55, 0xcc, 0x29,
+        0x4c, 0x1d, 0x01, 0xf8, 0x4c, 0x4a, 0x97, 0x92, 0x8e, 0xb5, 0x8e, 0x1b, 0x81, 0x9c, 0xb6, 0x7c,
+        0x50, 0x12, 0xbd, 0x57, 0x2f, 0xe8, 0x31, 0x0e, 0x18, 0xfb, 0x90, 0xcb, 0x4e, 0x4e, 0xd3, 0x42,
+        0x99, 0x1e, 0x8c, 0xfe, 0xa6, 0xcb, 0x3c, 0xdf, 0x35, 0x0a, 0x5d, 0x68, 0xe5, 0x4a, 0xb0, 0x88,
+        0x72, 0xb0, 0x86, 0x4a, 0x99, 0x2b, 0x09, 0xad, 0xce, 0x67, 0xaa, 0xd5, 0x4c, 0xe0, 0x85, 0xa6,
+        0x13, 0xcf, 0xcc, 0x84, 0xca, 0x92, 0xcb, 0x4a, 0xab, 0x39, 0xa6, 0x96, 0x19, 0x73, 0x54, 0x66,
+        0xa8, 0x4e, 0xff, 0x18, 0x55, 0x49, 0x36, 0xba, 0x4a, 0x45, 0x58, 0xc4, 0xf8, 0x91, 0x23, 0x99,
+        0x65, 0x29, 0x19, 0x3d, 0x07, 0x99, 0x1e, 0x56, 0x0c, 0xf8, 0x27, 0x07, 0x6a, 0x0d, 0xc0, 0x1f,
+        0x10, 0x24, 0x07, 0x00, 0x5f, 0x35, 0x6b, 0x14, 0x2b, 0x69, 0x90, 0x9b, 0x8e, 0x65, 0x54, 0x72,
+        0xfd, 0x10, 0x8a, 0xcb, 0x2e, 0xcc, 0xe2, 0xfe, 0x8f, 0x63, 0x10, 0x98, 0xaf, 0xab, 0xf5, 0x20,
+        0x99, 0xc6, 0xf1, 0x5c, 0x78, 0x6e, 0xb9, 0xa8, 0x29, 0xdb, 0xb8, 0x71, 0x68, 0x7e, 0x1f, 0xbc,
+        0x7e, 0xab, 0xa9, 0xf1, 0x24, 0x62, 0x58, 0xb6, 0xdc, 0xc8, 0xfa, 0x79, 0xbd, 0xcf, 0x78, 0x60,
+        0xbb, 0xa8, 0xf5, 0xa9, 0x94, 0xca, 0x0b, 0xe9, 0x72, 0x82, 0x16, 0x19, 0x2f, 0xcd, 0xf2, 0x05,
+        0xb4, 0x53, 0x97, 0x66, 0xc5, 0x92, 0x1f, 0x2e, 0x48, 0xc1, 0x87, 0xe7, 0xef, 0x18, 0x4d, 0x30,
+        0xb3, 0xc8, 0x99, 0x49, 0xcc, 0x40, 0x2e, 0x0c, 0xb2, 0x50, 0x07, 0x48, 0xed, 0x81, 0x20, 0x2a,
+        0x6f, 0xb8, 0xa4, 0x07, 0x1d, 0x35, 0xb4, 0x7c, 0xfd, 0x61, 0xc6, 0xf0, 0xbd, 0xe4, 0x3b, 0x2e,
+        0xf8, 0x41, 0xd5, 0xaf, 0x43, 0xa4, 0x2b, 0x14, 0x33, 0x2b, 0xc0, 0x0f, 0xbc, 0xcf, 0x07, 0xc3,
+        0x98, 0x3a, 0xb3, 0x72, 0xf0, 0x07, 0x18, 0xf5, 0x0b, 0x20, 0xe6, 0x9b, 0xc3, 0xdf, 0x20, 0x39,
+        0x48, 0xe7, 0xc1, 0x97, 0x3f, 0x3c, 0xfe, 0x53, 0xd2, 0x75, 0x16, 0x68, 0x50, 0x3e, 0x12, 0x8e,
+        0x23, 0x6e, 0xe4, 0x12, 0x2b, 0xad, 0x3e, 0x10, 0xc3, 0x55, 0xad, 0x89, 0x2f, 0x48, 0xc0, 0x40,
+        0xff, 0x05, 0xc8, 0xbf, 0x06, 0xe6, 0x7e, 0x85, 0x03, 0x18, 0x07, 0xdf, 0xc1, 0xb8, 0x20, 0x02,
+        0xe0, 0xf8, 0x19, 0xc9, 0xe6, 0x33, 0x40, 0x5d, 0xcd, 0x70, 0xac, 0x58, 0xfb, 0x4c, 0xde, 0x2b,
+        0x5a, 0x34, 0x30, 0x78, 0x65, 0x99, 0x0f, 0x80, 0x25, 0xbc, 0x18, 0xfb, 0x5b, 0x18, 0xf2, 0x4b,
+        0x10, 0xff, 0xb3, 0xc3, 0x27, 0x40, 0xc5, 0x63, 0x14, 0x31, 0x67, 0x69, 0xbc, 0x17, 0x69, 0x10,
+        0x48, 0x8f, 0xa4, 0x86, 0xf2, 0xc6, 0x01, 0x58, 0x08, 0x62, 0x0b, 0xa1, 0xb9, 0x58, 0x14, 0xb2,
+        0xd1, 0xa4, 0x8a, 0x25, 0xf6, 0xcc, 0xca, 0xf7, 0xcf, 0x56, 0xe5, 0xcb, 0x1c, 0xec, 0x83, 0x06,
+        0x9f, 0x3e, 0x90, 0x61, 0x7c, 0xa3, 0xe7, 0xb1, 0x3d, 0x8e, 0x4c, 0x13, 0xf0, 0x44, 0x26, 0xa1,
+        0x36, 0x9e, 0xca, 0xe3, 0xe7, 0x07, 0xdf, 0x80, 0x28, 0xff, 0x0c, 0xc2, 0x7c, 0x8d, 0x3a, 0x75,
+        0xf8, 0xeb, 0x13, 0xf0, 0x07, 0xb8, 0x7d, 0xcf, 0x8f, 0xf7, 0xa7, 0x33, 0xf7, 0xce, 0x31, 0x58,
+        0xf3, 0xd8, 0xee, 0x5d, 0x8c, 0xe7, 0x27, 0xe1, 0x8c, 0x2a, 0xf6, 0xa9, 0xbc, 0xfd, 0x0e, 0x38,
+        0x7b, 0x0e, 0xfc, 0x09, 0xf5, 0x3c, 0x01, 0x67, 0x84, 0xfb, 0xc8, 0x69, 0x03, 0xe5, 0xf8, 0xd6,
+        0x38, 0x7c, 0x7c, 0xf8, 0xa4, 0x84, 0xa2, 0x2b, 0x1d, 0x83, 0x4f, 0x89, 0x77, 0x8d, 0xb9, 0x2a,
+        0xab, 0xd3, 0x40, 0xd7, 0xa1, 0xb8, 0xf1, 0x4e, 0x24, 0x97, 0x6e, 0x65, 0x9a, 0x54, 0xee, 0xde,
+        0x02, 0x4f, 0x76, 0x12, 0x51, 0x74, 0x2b, 0x9b, 0xe5, 0x23, 0xe5, 0xf0, 0xf5, 0xc1, 0x8b, 0xd9,
+        0x83, 0x6f, 0xbf, 0x7f, 0x31, 0x59, 0x06, 0x50, 0xf2, 0x03, 0x5a, 0xbd, 0x81, 0xd6, 0x00, 0x66,
+        0xe4, 0x30, 0xef, 0x12, 0x04, 0xf5, 0x3c, 0x3e, 0xaf, 0xd5, 0x85, 0xe9, 0xcc, 0x56, 0x4b, 0x0b,
+        0x27, 0x62, 0xb6, 0xba, 0xb9, 0xf0, 0xd7, 0x60, 0xb6, 0xba, 0x90, 0xc3, 0x6d, 0xae, 0x1a, 0x00,
+        0xe8, 0x4f, 0x06, 0x10, 0x79, 0xa5, 0x99, 0x1d, 0x5b, 0x09, 0xca, 0x47, 0x68, 0xc1, 0x09, 0x95,
+        0xe0, 0xaf, 0xa3, 0x03, 0xe5, 0xc9, 0x4a, 0x20, 0x3f, 0x44, 0x04, 0x79, 0x83, 0x58, 0xf2, 0x6f,
+        0x18, 0x50, 0x0f, 0x3f, 0x41, 0x7f, 0x00, 0x9e, 0x0e, 0x7d, 0xfa, 0x27, 0x18, 0x42, 0x8c, 0x83,
+        0x17, 0x14, 0x51, 0x5e, 0x1f, 0x3c, 0x7f, 0x8b, 0x68, 0xd2, 0x0c, 0xaa, 0xd3, 0x04, 0xbe, 0x7a,
+        0xe7, 0x87, 0x27, 0x4f, 0x4e, 0x20, 0x71, 0x42, 0x37, 0x4d, 0xe0, 0xfd, 0x7e, 0x37, 0x23, 0xe8,
+        0xa3, 0x74, 0xa2, 0x19, 0x4c, 0x27, 0xf0, 0x44, 0xd4, 0xfd, 0xd8, 0xc4, 0x75, 0xfa, 0xed, 0x69,
+        0xd4, 0xdd, 0xbc, 0xfb, 0xfe, 0x09, 0xc8, 0x23, 0x64, 0x3f, 0x2e, 0x7d, 0xbd, 0xad, 0xb9, 0x69,
+        0xf4, 0xdd, 0xbe, 0xfe, 0xc3, 0x93, 0x8f, 0x4e, 0x40, 0x21, 0xa1, 0xfb, 0x71, 0x29, 0x74, 0x1f,
+        0xfa, 0xd3, 0x28, 0xbc, 0xf2, 0x93, 0x1b, 0x46, 0x81, 0xfc, 0xe1, 0x2c, 0x1a, 0xbf, 0x75, 0x02,
+        0x62, 0x01, 0xf3, 0x4f, 0x79, 0xdb, 0x54, 0x0f, 0x80, 0x19, 0xea, 0x17, 0x94, 0xae, 0x7d, 0x78,
+        0x8c, 0x50, 0x08, 0x48, 0x6f, 0x62, 0x9a, 0x3e, 0xb3, 0xf2, 0xc3, 0xe3, 0xdf, 0xe5, 0x9b, 0xba,
+        0xd2, 0x4d, 0xc9, 0xd4, 0x45, 0x77, 0x3f, 0x5c, 0x13, 0xcf, 0x99, 0x44, 0x75, 0xac, 0x10, 0x00,
+        0xd2, 0xfe, 0xf3, 0xe0, 0x7f, 0x28, 0x83, 0xfc, 0xca, 0xa0, 0x24, 0x0e, 0x2c, 0x9d, 0x9c, 0xc0,
+        0xaf, 0x0d, 0x4a, 0x24, 0x5f, 0x40, 0x0c, 0xff, 0x0c, 0xbe, 0xbd, 0xe2, 0x99, 0x02, 0x26, 0x95,
+        0x39, 0x09, 0xf0, 0x58, 0xb1, 0x90, 0x10, 0x72, 0x93, 0xed, 0xe0, 0x28, 0x89, 0x70, 0x8e, 0xeb,
+        0xab, 0x0c, 0x5e, 0x01, 0x66, 0x66, 0x8d, 0xd7, 0x78, 0xb4, 0x1c, 0x93, 0xfb, 0x06, 0x53, 0x69,
+        0x98, 0x9d, 0x69, 0x09, 0xf3, 0x58, 0xd2, 0x6a, 0x1b, 0x94, 0x08, 0x69, 0x89, 0x1e, 0xb4, 0x7d,
+        0x91, 0x4d, 0x90, 0xc0, 0xfb, 0xe5, 0x08, 0x5f, 0x2b, 0x6f, 0x61, 0x68, 0xbe, 0x2e, 0x9c, 0xa4,
+        0xb8, 0xd7, 0x07, 0xdd, 0x55, 0x84, 0x98, 0x31, 0xf8, 0xa1, 0x85, 0x19, 0x28, 0xb6, 0x66, 0x0c,
+        0x5e, 0x05, 0x3b, 0x33, 0x50, 0x06, 0xa3, 0x43, 0xe7, 0x7d, 0xa6, 0x28, 0xf3, 0x5b, 0xb2, 0xfd,
+        0x5b, 0x74, 0xe1, 0x87, 0x9f, 0xbe, 0x01, 0x0b, 0x6d, 0x37, 0xfa, 0x71, 0xc9, 0x37, 0xd2, 0x2a,
+        0xfd, 0x4d, 0x38, 0xf9, 0x1c, 0x34, 0x11, 0xd4, 0xf3, 0xf0, 0x97, 0x34, 0x2d, 0xaf, 0x0e, 0x3f,
+        0x85, 0xba, 0x07, 0x6a, 0xac, 0x67, 0x54, 0xf2, 0xbd, 0x3c, 0xfc, 0xe4, 0x8d, 0x98, 0xf4, 0xa0,
+        0xb0, 0x7f, 0x53, 0x2e, 0x8f, 0xd2, 0x62, 0xb1, 0xea, 0x20, 0x78, 0x9d, 0x12, 0x7f, 0xff, 0xc8,
+        0x55, 0x0f, 0xfe, 0x7e, 0xc6, 0x15, 0xce, 0x38, 0xfc, 0x10, 0x38, 0xc2, 0x26, 0xd0, 0x59, 0xc1,
+        0x97, 0xc6, 0x51, 0xb2, 0x0e, 0x33, 0x93, 0xd3, 0x8e, 0x0b, 0x11, 0x33, 0xba, 0x27, 0x4a, 0x57,
+        0xb0, 0x79, 0x8d, 0x0a, 0xf8, 0x51, 0xbb, 0xbf, 0x20, 0xd3, 0x86, 0xf2, 0xf1, 0xf5, 0xc1, 0xff,
+        0xa0, 0x01, 0xe8, 0x4a, 0x3f, 0xee, 0xd0, 0xd2, 0x95, 0x6e, 0x6e, 0xe3, 0xb8, 0x52, 0xf6, 0x41,
+        0xdf, 0x73, 0x63, 0x72, 0x81, 0x35, 0xfa, 0xdf, 0x64, 0x17, 0x77, 0x2c, 0xe2, 0xfe, 0xc8, 0x09,
+        0x03, 0xf3, 0xfc, 0x0d, 0x78, 0xa6, 0xb7, 0x21, 0xae, 0x07, 0x15, 0xb9, 0x24, 0x0e, 0x5c, 0xa9,
+        0x31, 0xcd, 0xfb, 0x1e, 0x8b, 0xb4, 0xdf, 0x91, 0xdf, 0x78, 0x0a, 0xe3, 0x7f, 0x6d, 0x5c, 0xbd,
+        0xbe, 0x5e, 0xad, 0x1e, 0x87, 0x0a, 0x6f, 0x2b, 0x5e, 0x13, 0xcb, 0x0b, 0x6f, 0x2d, 0x1b, 0x95,
+        0x80, 0x5b, 0x3f, 0x29, 0x56, 0xe6, 0x16, 0x8e, 0x43, 0x41, 0xf7, 0xe1, 0xff, 0x09, 0x01, 0x77,
+        0x6f, 0xad, 0x2d, 0x94, 0xcb, 0x73, 0xc7, 0xa1, 0xa0, 0xdf, 0x8d, 0x7e, 0x34, 0x12, 0x3e, 0x07,
+        0xd5, 0xfd, 0x12, 0x12, 0xd3, 0xd7, 0x79, 0x7a, 0xf1, 0xd5, 0x71, 0xa8, 0x89, 0x83, 0xd8, 0xed,
+        0x70, 0xc5, 0x00, 0x82, 0xca, 0x6f, 0x4d, 0xcf, 0x63, 0x32, 0xd2, 0xcf, 0x0c, 0x8c, 0x27, 0x40,
+        0xd1, 0x6b, 0x90, 0xd0, 0xa7, 0xc7, 0xa1, 0x63, 0xd0, 0xc7, 0x55, 0x64, 0xa0, 0xa0, 0x5c, 0xa3,
+        0xff, 0xe5, 0xa7, 0x35, 0x29, 0x59, 0x53, 0x1c, 0xc8, 0x7f, 0x1f, 0x7c, 0x47, 0xa3, 0x67, 0x63,
+        0xd6, 0xd8, 0x4a, 0x1b, 0x6e, 0x45, 0xa1, 0xcb, 0x68, 0x0c, 0xe2, 0x38, 0xe0, 0x49, 0x4c, 0xc8,
+        0x5a, 0x50, 0x51, 0x6f, 0xbd, 0x1b, 0xf7, 0x66, 0x92, 0xea, 0x03, 0xbe, 0x53, 0x6e, 0x20, 0xc4,
+        0xfb, 0x92, 0xaf, 0x7f, 0xf0, 0x4e, 0x7a, 0x6f, 0xda, 0xc2, 0x19, 0xef, 0xfb, 0x07, 0x50, 0x94,
+        0x8f, 0x30, 0x87, 0xc8, 0xef, 0xd5, 0xec, 0x30, 0x37, 0xcc, 0x19, 0x11, 0x55, 0x4b, 0xb8, 0xf3,
+        0x27, 0x98, 0x84, 0xbc, 0xa0, 0x58, 0xfd, 0x8f, 0xa8, 0x6f, 0x07, 0x2f, 0x15, 0x54, 0xe3, 0x73,
+        0x45, 0x5b, 0x2f, 0xc8, 0x19, 0xcd, 0x8b, 0xd1, 0x0a, 0x42, 0x14, 0x30, 0xce, 0xf1, 0x0d, 0x5c,
+        0x8f, 0x05, 0xb1, 0x03, 0xfe, 0xdf, 0x63, 0x7d, 0x43, 0x09, 0xc0, 0x73, 0x10, 0xd6, 0x37, 0x39,
+        0x1a, 0x74, 0xf8, 0x59, 0xcd, 0x48, 0xf3, 0x3b, 0x5f, 0x74, 0x15, 0x49, 0x9e, 0xb4, 0x36, 0xf2,
+        0x24, 0x34, 0x0e, 0x8c, 0x47, 0x9b, 0x2b, 0x86, 0xba, 0xdb, 0x23, 0x26, 0x57, 0x1b, 0xdb, 0xe8,
+        0xfa, 0x3d, 0x67, 0xa6, 0x02, 0x9f, 0xee, 0x9e, 0x33, 0x33, 0x07, 0x11, 0x86, 0x14, 0xc1, 0x99,
+        0xa1, 0x2a, 0x5d, 0xb0, 0xc3, 0x49, 0x4f, 0x62, 0x16, 0xdf, 0xbd, 0x99, 0xc9, 0x8c, 0x91, 0xb4,
+        0xf3, 0x24, 0x6b, 0x10, 0x07, 0xf7, 0xf8, 0x04, 0x82, 0x2c, 0xf1, 0x15, 0xf3, 0x56, 0x4e, 0x1d,
+        0xfc, 0xf3, 0xc1, 0x73, 0x0c, 0x27, 0x90, 0xef, 0x3c, 0x23, 0x61, 0xd2, 0xc2, 0x28, 0xc8, 0xf0,
+        0xf5, 0x04, 0x77, 0x7a, 0x2a, 0xe5, 0xe7, 0xf8, 0xd5, 0xa4, 0x22, 0x7d, 0xb9, 0x8b, 0x34, 0xad,
+        0xc8, 0xfc, 0x57, 0xca, 0xb8, 0x5e, 0x91, 0xe0, 0x81, 0x18, 0xa0, 0xe2, 0xf0, 0x53, 0x24, 0x0e,
+        0x8d, 0x96, 0x54, 0x35, 0xab, 0x1f, 0x37, 0x83, 0xb6, 0xaa, 0x1f, 0x46, 0xb2, 0xe5, 0x37, 0xae,
+        0x29, 0x53, 0x55, 0xa3, 0x83, 0x78, 0x10, 0x2b, 0x64, 0xa3, 0xbd, 0x18, 0xb1, 0x8e, 0x13, 0x4f,
+        0x1b, 0x3f, 0x19, 0x33, 0x97, 0xfb, 0x3c, 0x33, 0x2b, 0xf7, 0x65, 0x6c, 0xdb, 0x90, 0x1a, 0x00,
+        0x61, 0x2a, 0x89, 0xcf, 0xb8, 0xd8, 0x8c, 0xd9, 0xf2, 0x77, 0xb4, 0x1a, 0x8b, 0x12, 0x7d, 0x36,
+        0x39, 0x51, 0x10, 0x2d, 0x51, 0x33, 0xf4, 0xfb, 0xf1, 0x0a, 0x98, 0x64, 0x14, 0x1b, 0xab, 0xd7,
+        0xaf, 0xdc, 0x5b, 0xdf, 0x5c, 0x5b, 0xbf, 0x76, 0x77, 0xf3, 0xee, 0xdf, 0x3b, 0xd5, 0x3a, 0x6f,
+        0xbd, 0x7e, 0x63, 0x6d, 0xfd, 0xce, 0xbd, 0x9f, 0x6d, 0xae, 0xdd, 0xbd, 0x72, 0x7b, 0x73, 0xcd,
+        0xa9, 0xce, 0x9f, 0x9f, 0xe3, 0x67, 0x83, 0xf0, 0xe5, 0xbd, 0x6b, 0xab, 0x77, 0xee, 0x5d, 0xdd,
+        0x5c, 0xbb, 0xf1, 0x0f, 0xd7, 0x9c, 0xca, 0xb2, 0x68, 0x7c, 0x6f, 0x13, 0xa2, 0x92, 0x53, 0xb1,
+        0xdf, 0xdb, 0x7c, 0xf7, 0xd6, 0x5d, 0xa7, 0x0a, 0x9f, 0xef, 0x5f, 0x59, 0x73, 0xe6, 0xe1, 0x13,
+        0x7c, 0xb5, 0xb3, 0x54, 0x27, 0xbe, 0x8c, 0x35, 0x16, 0xfa, 0x2c, 0xba, 0xe7, 0xf7, 0xda, 0x43,
+        0xea, 0x16, 0x0e, 0x9a, 0x71, 0x10, 0x16, 0x9a, 0x6e, 0xdf, 0x6d, 0xfa, 0xf1, 0xbe, 0x35, 0x8c,
+        0xb7, 0xfc, 0xa8, 0x44, 0xea, 0x19, 0x39, 0x3d, 0xb6, 0x6b, 0xbc, 0xd7, 0x09, 0xdc, 0x78, 0xae,
+        0x7a, 0x25, 0x0c, 0xdd, 0xfd, 0x14, 0xac, 0x4e, 0x60, 0xf2, 0xd1, 0x91, 0x5f, 0x44, 0x33, 0xce,
+        0x5f, 0xc1, 0xaa, 0x8f, 0x4e, 0x89, 0x6f, 0x1c, 0x69, 0x14, 0x43, 0xa2, 0xe5, 0x94, 0x39, 0x4c,
+        0x87, 0xf5, 0xda, 0x90, 0x6f, 0x89, 0x27, 0xb4, 0x8f, 0x1b, 0xbd, 0x16, 0x9e, 0xe4, 0x15, 0x38,
+        0xd0, 0x52, 0x8a, 0x49, 0xd3, 0xe8, 0x94, 0x1b, 0x17, 0x7c, 0x6b, 0x18, 0xb2, 0x78, 0x10, 0xf6,
+        0x0c, 0x85, 0xc6, 0xfb, 0x85, 0x14, 0xf7, 0x05, 0xdf, 0x7a, 0x47, 0xa3, 0x6b, 0x03, 0x3a, 0xf6,
+        0x07, 0xd1, 0x56, 0x61, 0xc7, 0x1a, 0xee, 0x38, 0xb7, 0xdc, 0x78, 0xab, 0xd4, 0xa2, 0xfd, 0x11,
+        0x68, 0xa8, 0x77, 0x58, 0x6c, 0xe0, 0x39, 0xe2, 0x98, 0x79, 0xce, 0x6d, 0xf7, 0x76, 0xdd, 0x6f,
+        0x15, 0x14, 0xca, 0x2e, 0x69, 0x88, 0x34, 0xb1, 0x68, 0x43, 0x2a, 0x5d, 0x2e, 0x5c, 0xc8, 0x0e,
+        0xef, 0xec, 0xd4, 0x47, 0xac, 0x13, 0xb1, 0xa1, 0x1c, 0x47, 0xc5, 0x92, 0x22, 0xd9, 0xa8, 0x4f,
+        0x68, 0x87, 0xfe, 0x8a, 0xe4, 0xd4, 0x61, 0x2b, 0x99, 0xa1, 0x80, 0x51, 0xa0, 0x5f, 0x0e, 0xe3,
+        0x38, 0x52, 0xaa, 0x8f, 0x1e, 0x65, 0xdb, 0xdc, 0x3d, 0x4b, 0x95, 0x22, 0xf8, 0x0e, 0x48, 0x6f,
+        0x61, 0xb2, 0xa0, 0xfb, 0xce, 0xa5, 0xb4, 0xdb, 0xce, 0x4a, 0x02, 0x3e, 0x4c, 0xa6, 0x88, 0x24,
+        0x08, 0x5f, 0x0a, 0xb2, 0xc5, 0xde, 0xb1, 0xd2, 0xe9, 0xe2, 0x6f, 0xdd, 0xbd, 0x82, 0x6c, 0xc1,
+        0xb7, 0x72, 0xac, 0x70, 0xc0, 0x80, 0x46, 0xf1, 0xd4, 0x72, 0x41, 0x28, 0xf4, 0xc8, 0x07, 0x1f,
+        0xe2, 0x5c, 0xa8, 0x3a, 0x60, 0xeb, 0xd3, 0x0f, 0xfe, 0xbc, 0x80, 0x20, 0x3e, 0xe8, 0x8b, 0x7f,
+        0x49, 0x11, 0x79, 0xdd, 0x07, 0xa1, 0x73, 0x45, 0x36, 0x76, 0x38, 0x83, 0xa4, 0x28, 0x9c, 0x1b,
+        0xc0, 0x68, 0x21, 0xd6, 0x1d, 0x7a, 0x5c, 0x41, 0x5e, 0x10, 0xef, 0x0e, 0x2a, 0x26, 0x75, 0x81,
+        0xca, 0x00, 0x5c, 0xb6, 0xe7, 0x00, 0xd0, 0x69, 0x55, 0x66, 0x00, 0x75, 0x3a, 0x95, 0x57, 0xaa,
+        0xa2, 0xf0, 0x2f, 0x65, 0x17, 0xdf, 0x08, 0x7e, 0x04, 0x9e, 0xfa, 0x08, 0x35, 0x1e, 0xad, 0xec,
+        0xa6, 0xdf, 0x63, 0x54, 0x57, 0x64, 0x8c, 0x0c, 0xeb, 0x08, 0x3b, 0x22, 0x13, 0x14, 0x62, 0xe5,
+        0x6d, 0x0e, 0xff, 0x10, 0xe6, 0x13, 0xef, 0x89, 0xe7, 0x52, 0x9b, 0xc5, 0xab, 0xb8, 0xe7, 0xb8,
+        0x17, 0x17, 0xcc, 0xaa, 0x67, 0x0a, 0x61, 0xf3, 0x52, 0x45, 0x80, 0xd0, 0x03, 0x6f, 0x17, 0x65,
+        0x8b, 0x78, 0xc1, 0x9f, 0x84, 0x02, 0xd1, 0x90, 0x0e, 0xff, 0xc8, 0xd8, 0x2e, 0x37, 0x8b, 0x4e,
+        0x00, 0x04, 0xa6, 0xd8, 0x67, 0x35, 0xaf, 0x64, 0x5d, 0xa8, 0xf0, 0x4e, 0x21, 0xf8, 0x0d, 0x89,
+        0x06, 0x84, 0xd0, 0x2f, 0x14, 0x2c, 0x67, 0x05, 0xbd, 0x44, 0xea, 0x56, 0x0a, 0xba, 0xe1, 0x08,
+        0x92, 0xe9, 0x6c, 0xfe, 0x58, 0xcf, 0xc2, 0xb0, 0x13, 0xd4, 0xca, 0xf6, 0x96, 0x5f, 0xab, 0x8c,
+        0x24, 0x24, 0xfc, 0x03, 0x59, 0xed, 0x4b, 0xcf, 0xe0, 0x7a, 0xde, 0x4d, 0x3a, 0xe0, 0x55, 0x10,
+        0xef, 0x43, 0xe6, 0x85, 0xee, 0x2e, 0x79, 0x17, 0xe5, 0x9d, 0xd0, 0x01, 0x8c, 0x42, 0x8e, 0x22,
+        0x57, 0x70, 0x45, 0x41, 0xc4, 0x22, 0x90, 0x5e, 0x49, 0xa9, 0x44, 0x4d, 0xeb, 0x72, 0xe9, 0xe1,
+        0x80, 0x85, 0xfb, 0x6b, 0xac, 0xc3, 0x68, 0x66, 0x4c, 0xe5, 0x14, 0x9b, 0x49, 0xda, 0x73, 0x1a,
+        0xbf, 0x0a, 0x4b, 0x11, 0x0e, 0x96, 0x1f, 0x34, 0x73, 0xbc, 0xa0, 0x39, 0xe8, 0x42, 0xc4, 0x28,
+        0x35, 0x43, 0x06, 0x41, 0xfe, 0x5a, 0x87, 0xe1, 0x53, 0xc1, 0x04, 0xd7, 0x6e, 0xa2, 0x57, 0x41,
+        0xa0, 0x12, 0xa9, 0xc1, 0x6d, 0xbc, 0xc5, 0x60, 0xaa, 0xa7, 0xd4, 0x4c, 0x75, 0x3a, 0x4a, 0xa0,
+        0xd6, 0xd7, 0xdc, 0xe6, 0x56, 0x21, 0x72, 0x56, 0x04, 0xfd, 0x98, 0x6e, 0x4e, 0x1c, 0x00, 0x63,
+        0x0f, 0x12, 0x07, 0x30, 0x25, 0x54, 0x89, 0x55, 0x71, 0x29, 0x02, 0x8c, 0x01, 0xa3, 0x37, 0x7f,
+        0x41, 0x5b, 0xae, 0x25, 0xda, 0x8d, 0x75, 0x22, 0xfe, 0x29, 0x69, 0xc2, 0xfa, 0xb7, 0xe7, 0xad,
+        0xe2, 0xc9, 0x86, 0x02, 0xc2, 0x82, 0x08, 0xad, 0x3a, 0xb2, 0xa9, 0xbd, 0xe1, 0xc0, 0x28, 0x5e,
+        0x50, 0x3e, 0x83, 0x9b, 0x59, 0x41, 0xf7, 0xbc, 0xa4, 0x05, 0xf7, 0xcb, 0x1b, 0xd2, 0x08, 0x47,
+        0xa7, 0xf6, 0x14, 0xe7, 0xec, 0x9f, 0xd7, 0x74, 0x07, 0xde, 0xee, 0x17, 0xb6, 0xc1, 0x15, 0x08,
+        0x16, 0x23, 0x47, 0x51, 0x88, 0xfb, 0xdb, 0x1b, 0x75, 0x15, 0x33, 0xd7, 0xd9, 0x62, 0x61, 0xa7,
+        0x08, 0x4c, 0x05, 0xd6, 0x6c, 0x01, 0xf5, 0x81, 0x7f, 0x3f, 0xaf, 0x00, 0x00, 0xce, 0x96, 0x1f,
+        0x17, 0xb6, 0x25, 0x4e, 0x24, 0xc8, 0x51, 0x48, 0xdb, 0xde, 0xb0, 0xc7, 0x86, 0x81, 0x39, 0xc5,
+        0x97, 0x68, 0xc7, 0x2b, 0xfc, 0x4b, 0xea, 0x09, 0xb9, 0x3f, 0x12, 0xb8, 0xd0, 0x94, 0x1d, 0x09,
+        0x51, 0x94, 0x7d, 0xc4, 0xdb, 0x3e, 0xe8, 0x17, 0x41, 0x9c, 0x2f, 0x97, 0x2a, 0x8f, 0x1e, 0x91,
+        0xed, 0xb8, 0x8d, 0xa8, 0x90, 0x60, 0x84, 0xf6, 0xf2, 0xc2, 0xa3, 0x47, 0x15, 0x01, 0xef, 0xf7,
+        0x22, 0xdf, 0x93, 0xe8, 0x60, 0x64, 0x9c, 0xac, 0xe0, 0xdc, 0x39, 0x09, 0x7e, 0xc9, 0x41, 0x06,
+        0x91, 0x36, 0x0e, 0x78, 0xee, 0x5c, 0xc2, 0xf0, 0x25, 0xa7, 0x7a, 0xbe, 0x40, 0x43, 0x5d, 0xa8,
+        0x9e, 0x87, 0x61, 0x2d, 0x9d, 0x58, 0x04, 0x49, 0xd0, 0x16, 0xe1, 0x7d, 0x1d, 0x7b, 0x26, 0x74,
+        0x5f, 0xc0, 0x16, 0xdd, 0xf7, 0x76, 0xdd, 0x70, 0xfb, 0x3a, 0x37, 0x2e, 0x19, 0x91, 0xa5, 0xad,
+        0xa9, 0x1e, 0x55, 0x46, 0x4c, 0x0a, 0x46, 0x36, 0xda, 0x9a, 0x83, 0x08, 0xa4, 0xa8, 0x71, 0xf9,
+        0x46, 0x85, 0x97, 0x71, 0x25, 0x09, 0x44, 0xc0, 0x0b, 0xc2, 0x9c, 0x3b, 0xa7, 0x8e, 0xb0, 0x52,
+        0xb6, 0xd4, 0xc7, 0x62, 0x91, 0xa2, 0x2f, 0xb9, 0xff, 0x0e, 0x73, 0x38, 0x47, 0x79, 0x96, 0x51,
+        0x88, 0xec, 0x6d, 0x2b, 0xb1, 0x8e, 0x1d, 0x47, 0x84, 0xc8, 0xa8, 0xb4, 0xcd, 0xf6, 0x37, 0xea,
+        0xda, 0x8c, 0x97, 0x38, 0xd9, 0x8e, 0xd3, 0x83, 0xd1, 0x2f, 0x43, 0x40, 0xaf, 0xed, 0x58, 0x49,
+        0x4c, 0xe7, 0xda, 0x62, 0xc9, 0x01, 0xb9, 0x44, 0xb8, 0x9d, 0x23, 0x87, 0xd2, 0xce, 0x51, 0x47,
+        0x38, 0xc8, 0xa3, 0x47, 0x6a, 0x2e, 0x30, 0x27, 0xe4, 0x95, 0xf8, 0x1e, 0x01, 0x9f, 0xc4, 0x11,
+        0x47, 0x3a, 0x6e, 0xc9, 0x3e, 0x88, 0xab, 0xd4, 0xee, 0x04, 0x0d, 0xb7, 0xb3, 0x1a, 0x74, 0xfb,
+        0x41, 0x04, 0xf6, 0x76, 0x87, 0x36, 0xbd, 0x21, 0x0f, 0x04, 0x97, 0x10, 0xf4, 0xf7, 0xcd, 0x7a,
+        0xb3, 0x84, 0xd8, 0x6e, 0xe0, 0x01, 0xd0, 0x82, 0xe2, 0xb3, 0xec, 0xa2, 0x66, 0x3f, 0x76, 0xd9,
+        0xaa, 0x4f, 0xc3, 0x15, 0x05, 0x83, 0xb0, 0xc9, 0x8a, 0x78, 0xb2, 0xca, 0x04, 0x82, 0x08, 0x11,
+        0xe2, 0x5d, 0x63, 0x6d, 0x72, 0x1b, 0x0a, 0x1f, 0xc5, 0x2a, 0x9a, 0xb5, 0xfa, 0x12, 0xac, 0x16,
+        0x75, 0xef, 0x42, 0x45, 0x4e, 0xa3, 0x98, 0x20, 0xdd, 0xf1, 0x29, 0xec, 0x35, 0x4b, 0x78, 0xfa,
+        0xf4, 0xef, 0x28, 0x00, 0x55, 0xc5, 0xd3, 0xaa, 0xdb, 0x77, 0x4c, 0x4a, 0xab, 0x4c, 0x65, 0x4a,
+        0xd2, 0x39, 0xc4, 0x47, 0x75, 0x1a, 0x5d, 0xae, 0xa5, 0x14, 0xa8, 0xed, 0x46, 0xfa, 0x00, 0x49,
+        0x0d, 0x8a, 0xef, 0xf6, 0xa0, 0xdb, 0x60, 0x61, 0xc9, 0x07, 0xf7, 0x79, 0xbb, 0xe0, 0x5a, 0x8f,
+        0x1e, 0x69, 0x0d, 0x0d, 0x2b, 0xa1, 0x0d, 0x7c, 0x5d, 0x18, 0x6c, 0xb3, 0x35, 0xf4, 0x78, 0x8e,
+        0xa2, 0x3d, 0xa8, 0x0c, 0xdc, 0xf1, 0x35, 0x4b, 0x0d, 0xd6, 0xf6, 0x7b, 0x77, 0x5d, 0x74, 0x61,
+        0xf0, 0xd4, 0x05, 0x29, 0xad, 0x07, 0x5c, 0x24, 0xe8, 0xb2, 0x6c, 0xfa, 0x86, 0xee, 0xc9, 0xb5,
+        0x2c, 0xc1, 0x8d, 0xf2, 0x1e, 0x08, 0x4a, 0x21, 0x1a, 0x04, 0xc1, 0x87, 0x2c, 0x90, 0xeb, 0xc4,
+        0xfc, 0x85, 0xeb, 0xc3, 0x30, 0x47, 0x4e, 0x94, 0xfa, 0xde, 0x83, 0xf0, 0x42, 0x67, 0xc2, 0xd3,
+        0xc8, 0x6a, 0x2b, 0x7e, 0xcc, 0xca, 0x26, 0x9d, 0x55, 0xd4, 0x1b, 0x3c, 0x5c, 0xe3, 0x98, 0x15,
+        0x3a, 0xf6, 0x93, 0xdc, 0xb6, 0x42, 0x75, 0xc1, 0x2d, 0x41, 0xce, 0xad, 0x79, 0x66, 0xd9, 0x75,
+        0x17, 0x1a, 0x15, 0x6c, 0xc5, 0x50, 0x70, 0x05, 0x8f, 0x20, 0x81, 0x5e, 0xd1, 0xe9, 0x23, 0x09,
+        0xba, 0x4e, 0x69, 0xc3, 0xc1, 0x7f, 0x40, 0x71, 0x82, 0xb5, 0xdf, 0x77, 0x69, 0xc1, 0xc7, 0x97,
+        0xb8, 0x69, 0x15, 0xf5, 0xf0, 0xe3, 0x1f, 0x1e, 0xff, 0xc9, 0x54, 0xe8, 0x9b, 0xad, 0xaa, 0x14,
+        0xce, 0x56, 0x2d, 0x7d, 0x08, 0x3c, 0x91, 0x64, 0x2a, 0xfa, 0x9f, 0xa3, 0x0f, 0x7f, 0x1b, 0x40,
+        0xaa, 0x74, 0x4c, 0x85, 0x38, 0xe9, 0x1c, 0xa2, 0xdb, 0x68, 0x83, 0xbe, 0x91, 0x05, 0xeb, 0x69,
+        0x21, 0xe9, 0x51, 0x5e, 0x5a, 0x98, 0x6a, 0x1b, 0x39, 0xda, 0xac, 0xaa, 0x27, 0xe8, 0xb2, 0xba,
+        0xb7, 0x63, 0x59, 0xc3, 0xe4, 0x25, 0x2e, 0x9f, 0xf8, 0x3d, 0x72, 0xa4, 0x00, 0x07, 0xcd, 0xd6,
+        0x34, 0x75, 0x82, 0xae, 0x75, 0x4c, 0xfc, 0x8d, 0x31, 0x9d, 0xca, 0x00, 0x21, 0x7e, 0x99, 0x0d,
+        0xeb, 0xda, 0x95, 0x18, 0xb2, 0xf0, 0xd9, 0xb7, 0xc0, 0x7d, 0x17, 0xa4, 0xfd, 0x6a, 0x6d, 0x43,
+        0xa9, 0x44, 0xd2, 0x9d, 0x3b, 0x4e, 0x79, 0xb2, 0x01, 0x53, 0xc3, 0x9e, 0x23, 0xe8, 0xd1, 0x24,
+        0xa1, 0x3b, 0x9e, 0x59, 0x9c, 0xcf, 0xc8, 0xdd, 0x61, 0x05, 0x2b, 0x63, 0x6b, 0xaa, 0xf6, 0xa5,
+        0xd3, 0x5f, 0x41, 0x28, 0x16, 0x63, 0xea, 0x7b, 0xd5, 0x05, 0x57, 0x7c, 0x7f, 0xde, 0x9e, 0xdf,
+        0xb0, 0x26, 0xd9, 0xe0, 0x1e, 0xf7, 0x6b, 0x42, 0x3a, 0x7b, 0xba, 0x55, 0x28, 0x92, 0x48, 0xcc,
+        0xa1, 0x72, 0x72, 0x73, 0xa0, 0x73, 0x98, 0x9a, 0x35, 0x3c, 0x38, 0x78, 0x76, 0xf8, 0xf8, 0xf0,
+        0x63, 0xb0, 0x81, 0xe7, 0xc6, 0xd9, 0xa1, 0x5e, 0x63, 0x1b, 0xb3, 0x06, 0x96, 0xd8, 0x23, 0xe3,
+        0xf0, 0xe9, 0x03, 0x7b, 0xaf, 0x38, 0x6f, 0x57, 0xf2, 0x75, 0x5f, 0x35, 0x2e, 0x5a, 0x8d, 0xfc,
+        0x8a, 0x6f, 0x43, 0x98, 0xf6, 0xde, 0x05, 0xd9, 0x09, 0xa2, 0x08, 0x48, 0x94, 0x8d, 0xd7, 0xc0,
+        0xba, 0x25, 0x84, 0xce, 0x4a, 0x28, 0xab, 0xe5, 0xfc, 0xf4, 0x37, 0xcd, 0x76, 0x65, 0x69, 0xb1,
+        0x46, 0xbb, 0x91, 0xb7, 0x02, 0x28, 0x8c, 0x82, 0x50, 0x2b, 0x2f, 0xc4, 0x10, 0xfa, 0xda, 0x13,
+        0x85, 0x43, 0x91, 0xf1, 0x83, 0x45, 0xc6, 0x5e, 0xb0, 0xdb, 0xcb, 0x79, 0xc7, 0x57, 0x23, 0xf3,
+        0x3a, 0x0d, 0x42, 0xbc, 0x46, 0x90, 0xbc, 0x59, 0x28, 0x97, 0xcb, 0x19, 0x74, 0xce, 0x02, 0x6f,
+        0xf0, 0xa3, 0xbb, 0x74, 0xa2, 0x5b, 0x8d, 0xe7, 0x9c, 0x98, 0x55, 0x04, 0x95, 0x2c, 0x51, 0x01,
+        0xbb, 0x0e, 0xa3, 0x39, 0x57, 0xe1, 0x55, 0xa9, 0x17, 0xec, 0xca, 0xd4, 0x5e, 0xdd, 0x35, 0x53,
+        0x48, 0x90, 0x3b, 0x51, 0x4a, 0x53, 0xb2, 0x6f, 0xa3, 0xb4, 0x89, 0x6b, 0xc0, 0xfe, 0x2f, 0xb8,
+        0xd8, 0xd5, 0x47, 0x99, 0x7a, 0xf2, 0x32, 0x1a, 0x1d, 0x8f, 0x70, 0x35, 0xf1, 0xa0, 0x4f, 0x68,
+        0x22, 0x49, 0x02, 0x35, 0x5d, 0xa3, 0x95, 0x22, 0x98, 0x08, 0xd6, 0x63, 0x61, 0xfa, 0x0a, 0x7b,
+        0x7f, 0x40, 0x72, 0x22, 0x7e, 0x58, 0x28, 0xdf, 0x74, 0x02, 0xd7, 0x4b, 0x32, 0x2b, 0xd0, 0x8e,
+        0x9e, 0xdb, 0xe9, 0xec, 0x53, 0x81, 0x93, 0x76, 0xbc, 0x1b, 0x74, 0x3a, 0x58, 0x1d, 0xc1, 0x3c,
+        0x8f, 0xd0, 0xd3, 0x24, 0x49, 0x3e, 0xe4, 0xf8, 0xde, 0x3e, 0xae, 0x8f, 0x33, 0xb0, 0x5b, 0x13,
+        0x51, 0x01, 0x98, 0x69, 0x0d, 0x13, 0x00, 0xa8, 0x72, 0x34, 0x82, 0x0a, 0xe6, 0xd5, 0x3b, 0xb7,
+        0x44, 0xee, 0x7f, 0x13, 0xc0, 0x99, 0x67, 0xda, 0x34, 0x84, 0x25, 0x16, 0x1b, 0xe8, 0x81, 0xab,
+        0x8c, 0xc6, 0xa1, 0x90, 0x02, 0xde, 0x9f, 0x96, 0xb8, 0x21, 0xc5, 0x17, 0xe5, 0xc5, 0xbb, 0xfb,
+        0x37, 0xbc, 0x82, 0xa9, 0xce, 0x80, 0x69, 0x09, 0x67, 0x01, 0xf2, 0x9f, 0xdc, 0x43, 0x4e, 0x4e,
+        0x02, 0x8d, 0x53, 0x33, 0x19, 0x3c, 0x99, 0x38, 0x53, 0xc4, 0x3e, 0x6b, 0x7c, 0xe6, 0x45, 0x85,
+        0xbd, 0xcd, 0x92, 0x2a, 0x1a, 0xe0, 0xec, 0xfb, 0x43, 0xc8, 0xf9, 0x6a, 0xa6, 0x72, 0x78, 0xd0,
+        0xb4, 0xf9, 0xa1, 0x53, 0x53, 0x5c, 0x19, 0x33, 0x6d, 0xaa, 0x83, 0x6a, 0x66, 0xfe, 0x66, 0xaf,
+        0x39, 0xb2, 0x39, 0x0a, 0x79, 0x3e, 0x2f, 0xed, 0xcf, 0x8f, 0xc3, 0xa7, 0xfd, 0xc7, 0x4e, 0xff,
+        0x25, 0x7d, 0xe5, 0xf1, 0xb3, 0xb4, 0x2f, 0xbf, 0x16, 0x97, 0xf6, 0xcd, 0x9c, 0xae, 0x33, 0x47,
+        0x1b, 0xc4, 0x29, 0xc8, 0xc9, 0xd2, 0xb5, 0x39, 0x87, 0x4d, 0x78, 0x27, 0xf9, 0x6c, 0x06, 0xd5,
+        0x74, 0x0c, 0x7e, 0xe1, 0x2d, 0x19, 0x83, 0x0e, 0xcd, 0x24, 0x24, 0x35, 0x03, 0x45, 0x10, 0x74,
+        0xbd, 0x4e, 0x01, 0x4c, 0xa0, 0x3a, 0xfd, 0x76, 0x0a, 0xc6, 0xaf, 0xfb, 0x25, 0x60, 0x37, 0xef,
+        0xbe, 0x9f, 0xc0, 0xf5, 0xb6, 0xe6, 0x14, 0xde, 0xe8, 0x42, 0x5f, 0x02, 0x47, 0xa7, 0x39, 0x24,
+        0x43, 0x38, 0x93, 0x56, 0xc6, 0x18, 0x73, 0x58, 0xc2, 0x97, 0x92, 0x27, 0x3a, 0x33, 0x37, 0x51,
+        0xea, 0x74, 0x02, 0x2f, 0x15, 0x34, 0x1e, 0x39, 0x9b, 0xc8, 0x18, 0x1d, 0xd8, 0x50, 0x60, 0x2b,
+        0xe5, 0x89, 0xca, 0x80, 0xa7, 0x3a, 0x88, 0x66, 0xac, 0x80, 0x54, 0xca, 0x32, 0xab, 0x31, 0xa2,
+        0x58, 0xc2, 0xc5, 0x8c, 0x49, 0x30, 0xa2, 0x26, 0x6e, 0x4a, 0x7b, 0xe2, 0x5d, 0xee, 0x8f, 0x69,
+        0xb0, 0xad, 0x4d, 0xb4, 0xad, 0x0b, 0x69, 0x03, 0xc3, 0x07, 0x3a, 0x8f, 0xa6, 0xb3, 0xd2, 0x14,
+        0xab, 0x18, 0xeb, 0x81, 0x74, 0x1f, 0xe0, 0x2d, 0x5d, 0x69, 0xa8, 0xbd, 0x41, 0xd7, 0xd9, 0x71,
+        0x56, 0x64, 0x4d, 0xf3, 0xe8, 0x11, 0x7c, 0x71, 0x8a, 0xcb, 0xcb, 0xcb, 0x54, 0xdd, 0xf0, 0x54,
+        0x05, 0x93, 0x14, 0x61, 0x78, 0x62, 0xcd, 0x76, 0xa8, 0x58, 0x48, 0x0d, 0x50, 0x10, 0xca, 0x92,
+        0xd2, 0x68, 0xd9, 0xd2, 0x00, 0xd2, 0xd7, 0xb2, 0xc5, 0xb2, 0xa5, 0x82, 0xa7, 0xef, 0x64, 0x8b,
+        0x05, 0x12, 0xae, 0xa6, 0xcd, 0xab, 0x77, 0xaa, 0xd8, 0xa2, 0x36, 0x58, 0x36, 0x68, 0x59, 0xda,
+        0x00, 0x6a, 0x65, 0xd9, 0xa0, 0x4f, 0x69, 0xcb, 0xed, 0xeb, 0x73, 0x30, 0x02, 0x6a, 0x81, 0x82,
+        0x1e, 0x1f, 0xb1, 0x15, 0xe6, 0x5b, 0x6d, 0x85, 0x47, 0x82, 0xd5, 0x41, 0xcb, 0xd6, 0x48, 0x44,
+        0x1f, 0x9a, 0x84, 0x24, 0x92, 0xa2, 0x30, 0x4b, 0x4a, 0xe1, 0x6a, 0x91, 0x64, 0xa3, 0xfd, 0x5e,
+        0xd3, 0xd0, 0xbc, 0xf3, 0x30, 0x59, 0xf8, 0x83, 0xde, 0x8e, 0x82, 0x89, 0x6a, 0x41, 0x81, 0x94,
+        0x27, 0x91, 0x7a, 0x0a, 0xd5, 0x0a, 0x83, 0xae, 0xba, 0x54, 0x96, 0xc6, 0xae, 0xd9, 0x0a, 0x84,
+        0x44, 0xab, 0xa8, 0x27, 0x13, 0x72, 0xb9, 0x00, 0x4f, 0xef, 0x46, 0xe9, 0xca, 0x68, 0xa9, 0x24,
+        0x09, 0xc7, 0x25, 0x30, 0x22, 0x5a, 0x5d, 0x29, 0x0b, 0xf7, 0xe5, 0x82, 0x06, 0x8b, 0xfa, 0xf0,
+        0x85, 0x39, 0xee, 0xae, 0xeb, 0xc3, 0xe0, 0x2c, 0x06, 0x1e, 0x1f, 0xcc, 0x8a, 0xe4, 0xe0, 0x32,
+        0x70, 0xdd, 0x75, 0x63, 0xa7, 0xe1, 0xf7, 0xce, 0x89, 0x11, 0xce, 0x0e, 0xf9, 0x97, 0xd1, 0x39,
+        0x22, 0xf4, 0xec, 0x10, 0x3f, 0x46, 0x0f, 0x78, 0x89, 0x2b, 0xb1, 0x95, 0x82, 0x6d, 0xb0, 0xd8,
+        0x30, 0xd8, 0x25, 0x2d, 0xbf, 0x16, 0x86, 0xc0, 0xc7, 0x83, 0xeb, 0xeb, 0xeb, 0x77, 0x21, 0x17,
+        0x4a, 0x60, 0xf8, 0x81, 0x76, 0xec, 0x2a, 0xd4, 0xca, 0x67, 0xbb, 0xb4, 0x11, 0x00, 0x1c, 0xbb,
+        0x3f, 0x85, 0x87, 0x02, 0xa7, 0x29, 0xe9, 0xe0, 0xe2, 0xce, 0xc0, 0xbb, 0x83, 0x56, 0x8b, 0x51,
+        0x16, 0x23, 0x04, 0x4c, 0x11, 0x5f, 0x91, 0x17, 0xa2, 0x29, 0x35, 0xf6, 0x63, 0x76, 0x93, 0x84,
+        0x3b, 0xab, 0x6c, 0x61, 0x58, 0x99, 0x44, 0x9e, 0xfa, 0xaa, 0x29, 0x7c, 0xe0, 0xf8, 0xe7, 0x15,
+        0x78, 0x39, 0x23, 0x1d, 0xb7, 0x1d, 0x39, 0x84, 0x17, 0xac, 0xf2, 0x03, 0xe0, 0x7e, 0xa9, 0x10,
+        0x5c, 0xa8, 0x2c, 0x49, 0x12, 0xfa, 0x95, 0xb2, 0x53, 0x08, 0x30, 0xcd, 0x06, 0x1b, 0x0a, 0xb6,
+        0x2f, 0xef, 0xc0, 0x44, 0xd5, 0xc0, 0x72, 0x92, 0xf7, 0xdd, 0xc8, 0x21, 0x1c, 0xe7, 0x68, 0x87,
+        0x64, 0x8a, 0x15, 0x01, 0xa6, 0x02, 0x87, 0x2c, 0xd0, 0x26, 0xcb, 0x23, 0xda, 0x62, 0xb1, 0x6c,
+        0x39, 0x36, 0x24, 0x47, 0x95, 0x45, 0x18, 0x7b, 0xde, 0xa6, 0x95, 0x12, 0xc5, 0xc0, 0xd2, 0x9e,
+        0xd4, 0xd1, 0x56, 0xa9, 0xa5, 0x2e, 0x8b, 0xb2, 0x4b, 0x62, 0x77, 0x6a, 0x17, 0x18, 0x65, 0xbc,
+        0xcb, 0x92, 0xec, 0x82, 0xe6, 0x28, 0x21, 0xdf, 0xbf, 0xb2, 0x76, 0x79, 0x0c, 0xb2, 0x52, 0xe6,
+        0xa0, 0xc8, 0xb5, 0x30, 0x3b, 0x60, 0x3a, 0x07, 0xae, 0xaa, 0xc1, 0xa1, 0x21, 0xe6, 0xc3, 0xcd,
+        0xeb, 0xf8, 0x26, 0xa1, 0x5b, 0x4c, 0xc1, 0x46, 0xf5, 0x23, 0x0c, 0xd5, 0xa6, 0x64, 0x91, 0xcc,
+        0x15, 0x54, 0x95, 0xa6, 0xde, 0xca, 0xeb, 0xa2, 0xad, 0x5e, 0x59, 0xb9, 0x58, 0x65, 0xae, 0x4c,
+        0x4a, 0xcf, 0x31, 0x25, 0x4b, 0xc8, 0x41, 0xfb, 0x1a, 0xee, 0xf1, 0x41, 0x01, 0xf0, 0x7b, 0x71,
+        0xd6, 0xe6, 0x31, 0xdf, 0xee, 0x3d, 0x3b, 0x24, 0x48, 0xc8, 0xfa, 0xb1, 0x11, 0xef, 0x6c, 0x7c,
+        0x4d, 0xfb, 0x79, 0x53, 0xcb, 0x03, 0xa0, 0xb6, 0xe9, 0xa2, 0x49, 0x32, 0xb4, 0x21, 0x91, 0x77,
+        0xab, 0xc3, 0x98, 0xfa, 0x30, 0x06, 0x1d, 0xb4, 0xf9, 0x42, 0x64, 0x13, 0x1f, 0x41, 0x66, 0xf2,
+        0x0a, 0xf2, 0x11, 0x9e, 0xa1, 0x69, 0xc9, 0x21, 0xc7, 0x44, 0xe6, 0x8e, 0xe6, 0x56, 0x48, 0x17,
+        0x08, 0xf4, 0xac, 0xde, 0xa2, 0xa2, 0x41, 0x3e, 0xe5, 0x42, 0xd4, 0xf3, 0x8a, 0x81, 0x88, 0x25,
+        0x99, 0x3c, 0xe5, 0xa7, 0x58, 0x3a, 0x9e, 0xd6, 0x92, 0x77, 0x6b, 0x8c, 0x82, 0x91, 0x9d, 0x57,
+        0x08, 0xa8, 0x49, 0xf1, 0xaa, 0xac, 0x04, 0x28, 0xf1, 0xe6, 0x43, 0x0a, 0x96, 0x92, 0xd1, 0x22,
+        0x06, 0xf6, 0xe5, 0x25, 0xbb, 0x1e, 0x99, 0xaa, 0x42, 0xbc, 0x3d, 0x5f, 0xc9, 0xa9, 0x2e, 0xc4,
+        0xbb, 0xff, 0xf7, 0x92, 0x60, 0x31, 0xaf, 0x09, 0xd3, 0x83, 0x47, 0xa6, 0xfd, 0xe0, 0xec, 0x50,
+        0xe7, 0x06, 0xd4, 0xe7, 0xc3, 0x07, 0x56, 0x3d, 0x4f, 0x2f, 0x8f, 0x75, 0x3a, 0xe1, 0xec, 0x50,
+        0x88, 0x43, 0x20, 0x12, 0x0a, 0xa4, 0xcc, 0x40, 0xb2, 0x1a, 0x30, 0x56, 0xee, 0xe5, 0x89, 0x6a,
+        0x1c, 0x68, 0x52, 0xad, 0x98, 0x27, 0x30, 0x5d, 0x5e, 0x22, 0x5e, 0xea, 0xfd, 0x8b, 0xc5, 0xfa,
+        0x18, 0x41, 0x97, 0x1c, 0xb1, 0x1c, 0x9c, 0x4e, 0x72, 0x76, 0x13, 0x2a, 0x23, 0x63, 0x1e, 0x63,
+        0xdf, 0x40, 0xd0, 0x23, 0x9b, 0xf7, 0x14, 0x72, 0xca, 0x94, 0x6f, 0xc3, 0x54, 0xa7, 0xd4, 0xf2,
+        0x37, 0x5f, 0xa7, 0x34, 0x88, 0xdc, 0xaa, 0x79, 0x4c, 0x44, 0x72, 0xc7, 0x43, 0xe1, 0x4e, 0x49,
+        0x1c, 0x8a, 0x7a, 0x39, 0x2c, 0x12, 0x09, 0x11, 0x87, 0xb6, 0xb6, 0x9c, 0xb5, 0x18, 0x57, 0x0b,
+        0x0a, 0x4a, 0xe7, 0x68, 0x16, 0x5d, 0x90, 0x65, 0x95, 0xfa, 0xae, 0xb7, 0x46, 0x55, 0x5e, 0xd5,
+        0x36, 0xcb, 0x49, 0xe9, 0xd5, 0xed, 0xe6, 0xf4, 0x29, 0x44, 0xef, 0x50, 0xa7, 0xd9, 0xc5, 0xc9,
+        0x1d, 0xa3, 0x48, 0x76, 0x8c, 0xde, 0x01, 0xb0, 0x31, 0x28, 0x5d, 0xee, 0x9c, 0x6b, 0x92, 0xf9,
+        0xd6, 0xd6, 0xa8, 0x76, 0x76, 0xd8, 0xed, 0xe2, 0xdf, 0x88, 0x92, 0x86, 0x54, 0xe0, 0x3c, 0xfb,
+        0x52, 0xec, 0x67, 0x78, 0x44, 0x7e, 0x63, 0xce, 0x42, 0x14, 0x31, 0xed, 0x21, 0xbf, 0x14, 0x17,
+        0xd5, 0x86, 0xe6, 0x2a, 0xf8, 0x76, 0x56, 0x5c, 0xe5, 0x27, 0x97, 0x4c, 0x28, 0x4e, 0x82, 0x62,
+        0x13, 0x9b, 0xcc, 0xd1, 0xe8, 0x47, 0xc8, 0x6c, 0x30, 0xa7, 0x74, 0x32, 0xc9, 0xcc, 0xcf, 0xa3,
+        0xa0, 0x57, 0xd0, 0x3c, 0xc6, 0x55, 0x7e, 0x11, 0x94, 0x67, 0xe6, 0x63, 0x8b, 0x1a, 0x17, 0x2e,
+        0x24, 0xb6, 0x9c, 0x49, 0xe2, 0x13, 0xa1, 0xad, 0xf2, 0x5f, 0x3d, 0xf2, 0x83, 0x1e, 0x3f, 0x05,
+        0x57, 0xc0, 0xe0, 0x68, 0x9b, 0x39, 0x77, 0x05, 0x5f, 0x8f, 0x89, 0x5a, 0x3d, 0xac, 0x26, 0x16,
+        0x69, 0x95, 0xc1, 0x73, 0xc3, 0x50, 0xde, 0x88, 0x14, 0x63, 0x6d, 0x5c, 0x0a, 0xfe, 0xf2, 0xf0,
+        0x09, 0x1e, 0xbf, 0x79, 0x4e, 0x07, 0xbb, 0x5f, 0xf2, 0x10, 0x94, 0xc3, 0xa7, 0xba, 0x92, 0x44,
+        0xc7, 0x9f, 0x0a, 0x7a, 0xe1, 0x3d, 0x56, 0x53, 0xd4, 0xc7, 0x3b, 0xa4, 0x65, 0xb6, 0x5e, 0x62,
+        0xe4, 0x80, 0xa6, 0x55, 0xb5, 0x5e, 0x71, 0xe4, 0x80, 0x52, 0x5d, 0x9c, 0x14, 0x20, 0xb9, 0x00,
+        0xc9, 0xfb, 0xbc, 0xd7, 0x54, 0x07, 0x27, 0xe5, 0x49, 0x0e, 0x00, 0x15, 0xc0, 0x49, 0xb5, 0xa2,
+        0x02, 0x5c, 0x11, 0x47, 0xda, 0xc7, 0x55, 0xe1, 0x2a, 0x14, 0x77, 0x39, 0xad, 0x50, 0x35, 0xee,
+        0x30, 0x2f, 0xa3, 0x0e, 0x7c, 0x62, 0xd3, 0xa3, 0xb3, 0xa6, 0x2d, 0x92, 0x6b, 0x56, 0xb0, 0x4a,
+        0x71, 0x70, 0x33, 0xc0, 0xed, 0x27, 0xf4, 0x07, 0xc2, 0x22, 0x2d, 0x0d, 0x27, 0x5f, 0xfd, 0x13,
+        0xd3, 0xca, 0x11, 0xcb, 0x09, 0xe4, 0xf4, 0xfb, 0x9e, 0x4d, 0x89, 0x95, 0xcc, 0x9d, 0x59, 0x67,
+        0xe2, 0x62, 0x8c, 0xef, 0x71, 0x23, 0x62, 0x1d, 0x65, 0xff, 0x8b, 0x1f, 0x4c, 0x73, 0x9c, 0x41,
+        0xcf, 0x63, 0x2d, 0xa8, 0x83, 0x3d, 0x28, 0x3b, 0x45, 0x53, 0x8f, 0xf6, 0xb5, 0x58, 0x47, 0xdb,
+        0x7c, 0x36, 0x8b, 0x45, 0x53, 0x1e, 0x72, 0xd1, 0xdf, 0xc8, 0x02, 0x95, 0xa8, 0x01, 0xce, 0xde,
+        0xf3, 0xf7, 0x40, 0x18, 0x55, 0xb9, 0x2e, 0x45, 0x72, 0x00, 0x6a, 0xe9, 0xd7, 0x28, 0x8e, 0x4d,
+        0x2c, 0xd0, 0x9a, 0x19, 0x06, 0xbf, 0xd7, 0x09, 0xe3, 0x98, 0xda, 0x27, 0xbf, 0x37, 0x66, 0x77,
+        0x41, 0xa1, 0xdc, 0xf6, 0x71, 0x84, 0x62, 0x72, 0x2f, 0x61, 0x66, 0x45, 0x23, 0xd6, 0xce, 0x60,
+        0x30, 0x07, 0x08, 0xc8, 0x9e, 0x1e, 0x50, 0x6e, 0x01, 0x8b, 0x85, 0x2d, 0xe4, 0x0a, 0xff, 0x68,
+        0xb4, 0x0a, 0x32, 0xea, 0x80, 0x81, 0x16, 0x73, 0x71, 0x49, 0x0f, 0x24, 0xd3, 0x6e, 0x77, 0x48,
+        0x71, 0x05, 0xb5, 0xb8, 0x94, 0x21, 0xbe, 0xa6, 0xb3, 0x3b, 0x3e, 0xf1, 0x82, 0x17, 0x6f, 0x2b,
+        0xbe, 0xb3, 0xed, 0x90, 0xc2, 0xc2, 0xd7, 0x4d, 0x10, 0xb7, 0xef, 0x9d, 0x76, 0xf8, 0x1a, 0xec,
+        0xb9, 0x73, 0x59, 0x43, 0x3d, 0xcd, 0x57, 0x10, 0x64, 0xc0, 0x78, 0x28, 0xbb, 0x76, 0x1f, 0xea,
+        0x3d, 0x13, 0x75, 0xe5, 0x23, 0x72, 0xa5, 0x4d, 0x0e, 0x33, 0x83, 0x81, 0xe0, 0xa8, 0x56, 0x2e,
+        0x94, 0x3c, 0x70, 0x6c, 0xda, 0x88, 0xde, 0xe2, 0x73, 0xa3, 0x00, 0xc0, 0x9c, 0x07, 0xdb, 0x6f,
+        0xa4, 0x9e, 0x99, 0x99, 0x87, 0x9a, 0xce, 0xa4, 0x25, 0xba, 0xc7, 0x78, 0x0a, 0x0f, 0xc2, 0x03,
+        0x66, 0xd9, 0xe0, 0xdf, 0xd4, 0xcd, 0x2d, 0x13, 0x3b, 0xa9, 0x67, 0x22, 0xb0, 0x93, 0x5c, 0x4f,
+        0x4b, 0x17, 0x8b, 0x12, 0x31, 0xa7, 0x96, 0x2c, 0x4f, 0x94, 0xe0, 0xe2, 0x67, 0xb2, 0x4e, 0x71,
+        0x5a, 0x31, 0x0c, 0x21, 0x5c, 0xd9, 0xae, 0xae, 0xa5, 0x23, 0xa6, 0x7b, 0xee, 0xae, 0xf4, 0x6e,
+        0x7c, 0xd9, 0x4b, 0x59, 0xed, 0x98, 0x04, 0x47, 0x4b, 0x5e, 0xca, 0xfa, 0xc7, 0x44, 0x7c, 0x0a,
+        0xba, 0x24, 0x63, 0x20, 0xdd, 0x9c, 0xa8, 0xd6, 0xc9, 0x21, 0xec, 0x75, 0xae, 0xa3, 0xf2, 0x78,
+        0x42, 0x2b, 0x38, 0x46, 0x9f, 0x69, 0x3a, 0x0d, 0x02, 0xca, 0x4e, 0xc3, 0x77, 0x74, 0x97, 0xe8,
+        0x05, 0x1d, 0x8d, 0x7e, 0x6e, 0xf2, 0xd3, 0x0d, 0xad, 0x00, 0xb2, 0x2d, 0xf8, 0x7b, 0xd2, 0xbe,
+        0xd8, 0x45, 0x9d, 0x3f, 0xea, 0xa2, 0x4e, 0x20, 0x5f, 0x18, 0x94, 0x3b, 0xdf, 0xa0, 0x6a, 0xef,
+        0xba, 0x21, 0xc9, 0x08, 0x3e, 0x55, 0xa1, 0x63, 0x5e, 0x92, 0x2a, 0xac, 0x00, 0xa2, 0xfb, 0xa6,
+        0xaa, 0xc8, 0xed, 0xea, 0xc2, 0x38, 0x14, 0x5d, 0xbf, 0x54, 0x24, 0x6e, 0x2f, 0xa4, 0x79, 0xda,
+        0xc3, 0x81, 0xdb, 0x99, 0x26, 0xc1, 0xe4, 0x9a, 0x2a, 0x97, 0x21, 0x82, 0x9f, 0x3b, 0x07, 0x4c,
+        0xa4, 0xdb, 0x93, 0xe9, 0xe0, 0x1c, 0xe5, 0x7d, 0x5a, 0xb8, 0xe4, 0xcb, 0x99, 0x1b, 0xce, 0xa9,
+        0x9d, 0x4b, 0x4e, 0xa5, 0x7a, 0xf9, 0xbe, 0x89, 0x27, 0xcb, 0xa1, 0x12, 0xc0, 0xd3, 0xbc, 0x78,
+        0xf9, 0xe5, 0x2b, 0xd3, 0x4e, 0xc4, 0xb0, 0x51, 0x43, 0xa8, 0xb9, 0x05, 0x80, 0x3a, 0xfc, 0x98,
+        0x84, 0xf9, 0xfa, 0xf0, 0x97, 0x78, 0xb4, 0x16, 0x61, 0x84, 0x80, 0x38, 0xcc, 0x02, 0xc1, 0x7c,
+        0x04, 0xc2, 0xfe, 0x92, 0x24, 0xfc, 0x2a, 0xc5, 0xc5, 0x16, 0x2f, 0xb2, 0x6a, 0x55, 0xc0, 0x55,
+        0x16, 0xca, 0x38, 0x24, 0x56, 0xad, 0x7f, 0xa1, 0xba, 0x95, 0x2e, 0x87, 0x49, 0x50, 0x61, 0x34,
+        0x00, 0x8a, 0x64, 0x41, 0x35, 0xfb, 0x0c, 0x52, 0x8a, 0x04, 0x91, 0x58, 0x5c, 0xde, 0xa8, 0x23,
+        0xaf, 0xda, 0x74, 0xf3, 0x63, 0x4a, 0xd4, 0xac, 0x4e, 0x29, 0xdf, 0xe7, 0x95, 0x67, 0x29, 0xdc,
+        0x87, 0xfe, 0xb5, 0x29, 0x12, 0x95, 0x97, 0xee, 0x12, 0x15, 0xc6, 0x0b, 0x73, 0x8d, 0xe9, 0x1d,
+        0xe8, 0x42, 0x1d, 0x97, 0x3f, 0x61, 0x17, 0x96, 0x0b, 0xdf, 0x4f, 0x8b, 0xa0, 0x46, 0xcd, 0x1a,
+        0xad, 0x12, 0x42, 0xce, 0x49, 0x83, 0x66, 0x64, 0xc3, 0xb9, 0xaf, 0xc9, 0xf8, 0xb5, 0x3a, 0x0b,
+        0x76, 0x56, 0xb4, 0xfc, 0xb5, 0x9c, 0x00, 0x7c, 0xfd, 0x14, 0x00, 0x9e, 0x8b, 0x1f, 0xa9, 0x78,
+        0x49, 0xe7, 0x87, 0xbf, 0x39, 0xfc, 0x35, 0x89, 0xee, 0x5b, 0x75, 0x0e, 0xec, 0xa3, 0x65, 0x6f,
+        0x93, 0x46, 0x3c, 0x95, 0xf7, 0xf5, 0x26, 0x40, 0x2f, 0xcf, 0xcd, 0xcd, 0x31, 0x57, 0x40, 0x4f,
+        0x9a, 0x28, 0x7b, 0xe3, 0xbe, 0xe4, 0x76, 0x13, 0xf2, 0x49, 0xd6, 0x86, 0x1c, 0x76, 0xe3, 0xd1,
+        0xa3, 0xfb, 0x18, 0xda, 0x01, 0x8c, 0xff, 0x62, 0x2d, 0xcc, 0x27, 0x17, 0x52, 0x66, 0xe6, 0x84,
+        0x50, 0x61, 0x0a, 0x48, 0x8a, 0xf0, 0xa9, 0x4f, 0x79, 0xa3, 0x53, 0x17, 0xcd, 0xd9, 0x8e, 0xa3,
+        0x34, 0xf5, 0x54, 0x13, 0x25, 0x79, 0xce, 0xa8, 0x1b, 0x3b, 0x85, 0x1d, 0x1b, 0xef, 0x50, 0xe2,
+        0xfa, 0xdd, 0x0e, 0x9f, 0xa9, 0xcb, 0x50, 0x73, 0x24, 0x0b, 0xdf, 0x49, 0x4e, 0x51, 0xb1, 0x46,
+        0x90, 0xe7, 0x23, 0xe8, 0xe8, 0x41, 0x0d, 0xa9, 0xce, 0x66, 0x5b, 0xc9, 0x4f, 0x44, 0x40, 0xd1,
+        0x02, 0x22, 0xfa, 0x15, 0x1d, 0xd5, 0x7e, 0x86, 0xc1, 0x02, 0xe6, 0xe2, 0x33, 0xe8, 0x0b, 0xa3,
+        0x89, 0x85, 0x70, 0x80, 0xdc, 0xf4, 0x11, 0xd4, 0x36, 0xcc, 0xef, 0x9f, 0xad, 0x9a, 0xd6, 0xe8,
+        0x41, 0x16, 0x9b, 0xfc, 0x55, 0x06, 0x40, 0x26, 0x16, 0x8d, 0xbe, 0x3e, 0x78, 0x66, 0x90, 0x46,
+        0x7c, 0x78, 0xf8, 0xa9, 0x8a, 0x0d, 0x20, 0x37, 0x69, 0x5d, 0x36, 0x41, 0x66, 0x7c, 0xff, 0x17,
+        0x15, 0xc0, 0x6d, 0x44, 0x9b, 0x32, 0x31, 0x06, 0x18, 0x71, 0x53, 0x3c, 0x6f, 0x50, 0xe5, 0x27,
+        0x12, 0x90, 0x89, 0x57, 0x38, 0xa2, 0xbc, 0xb3, 0xf9, 0x0a, 0x4f, 0x74, 0x7c, 0x8b, 0x73, 0xaf,
+        0x33, 0x23, 0xfb, 0x6c, 0x46, 0xcc, 0x45, 0xec, 0xdf, 0x82, 0x96, 0x59, 0x62, 0x51, 0x58, 0x07,
+        0x88, 0xf1, 0xd7, 0x14, 0x64, 0x86, 0x97, 0x3f, 0x30, 0xfd, 0xe0, 0x02, 0xe8, 0x03, 0x69, 0x2d,
+        0xbf, 0xd1, 0xfa, 0x8a, 0x5f, 0x14, 0xaf, 0x19, 0x74, 0xae, 0x7f, 0xda, 0x19, 0x13, 0x53, 0xee,
+        0x4d, 0x0a, 0x9b, 0x85, 0x7a, 0x65, 0xd7, 0xb9, 0x6f, 0xfe, 0xf0, 0xf4, 0x9f, 0x00, 0xe3, 0x0f,
+        0x9f, 0xfc, 0x96, 0xfe, 0x7e, 0x4e, 0x7f, 0xff, 0x05, 0xff, 0x3e, 0xfd, 0xa5, 0x29, 0x94, 0x12,
+        0xb4, 0xc8, 0x63, 0xbd, 0xe6, 0xfe, 0x85, 0x2a, 0xa8, 0xa4, 0x69, 0xca, 0xd2, 0x8d, 0x75, 0xa0,
+        0x76, 0x13, 0x9a, 0x90, 0xc3, 0x4a, 0x52, 0xd8, 0xe2, 0xbe, 0x3d, 0x01, 0xaf, 0x94, 0x2f, 0x9b,
+        0x17, 0x20, 0x60, 0x98, 0xf5, 0xa9, 0xec, 0x81, 0x7e, 0x11, 0x71, 0xa8, 0x50, 0xd8, 0x79, 0x74,
+        0x76, 0x48, 0xdd, 0x35, 0x5d, 0x3b, 0x78, 0x81, 0x37, 0x5c, 0x66, 0xe7, 0x0e, 0x9f, 0xf2, 0xe9,
+        0x24, 0x02, 0x5a, 0x41, 0xc8, 0x9a, 0x90, 0xd5, 0x6f, 0xa2, 0xfa, 0x53, 0x25, 0x2c, 0xd5, 0x5b,
+        0xaf, 0x1b, 0x8e, 0x91, 0x82, 0xca, 0xbb, 0xb3, 0x89, 0x8f, 0x6b, 0x04, 0x7b, 0x53, 0xa1, 0xc5,
+        0x95, 0xdf, 0x09, 0x49, 0x6b, 0x07, 0x71, 0xbd, 0x9d, 0xe3, 0xa2, 0x89, 0x7d, 0x8d, 0xfd, 0xc9,
+        0x4d, 0xd1, 0xcf, 0x6b, 0x8e, 0xf9, 0x20, 0x0d, 0x26, 0xf1, 0x53, 0xd2, 0xb9, 0xf8, 0xe1, 0x26,
+        0x11, 0x42, 0x27, 0x31, 0x4f, 0xd3, 0xd7, 0xfc, 0x62, 0x22, 0x93, 0xb0, 0x25, 0x0e, 0x08, 0xfb,
+        0x81, 0x20, 0x2c, 0xf8, 0x27, 0x00, 0xf8, 0x2f, 0x20, 0xdd, 0x64, 0x2d, 0x40, 0xa0, 0x83, 0xea,
+        0xe7, 0xf3, 0xf4, 0x88, 0x4a, 0x43, 0x67, 0x73, 0x49, 0x1e, 0x9a, 0x58, 0x5e, 0x60, 0x3a, 0x72,
+        0x58, 0x19, 0xbf, 0x44, 0xc2, 0x20, 0x2b, 0x30, 0x9b, 0xce, 0xce, 0x9f, 0x20, 0xcd, 0x4d, 0x2a,
+        0x2d, 0x32, 0x43, 0x6d, 0x0a, 0xfb, 0xcd, 0x38, 0x3d, 0x7c, 0x0f, 0x89, 0x8c, 0xcd, 0xcb, 0xaa,
+        0x59, 0x3a, 0x71, 0x4a, 0x89, 0x4d, 0x42, 0x3a, 0x3f, 0x1c, 0x0e, 0x7a, 0x0c, 0x7d, 0x46, 0xef,
+        0x3c, 0x48, 0x5f, 0xa4, 0xbf, 0x0e, 0xe5, 0xc0, 0xab, 0x4b, 0x73, 0x65, 0x25, 0x8f, 0xc2, 0x86,
+        0x45, 0x6c, 0x10, 0x73, 0x9e, 0x93, 0x19, 0x27, 0xf9, 0xe7, 0xc9, 0x2b, 0xcc, 0xf1, 0xa2, 0x8d,
+        0x93, 0x2f, 0xa2, 0xef, 0x65, 0x7a, 0xa8, 0xf1, 0x4a, 0xf2, 0x54, 0xee, 0x09, 0x8c, 0x64, 0xd9,
+        0x88, 0xee, 0x3a, 0x4d, 0xb6, 0x85, 0xf4, 0x36, 0x1b, 0xb7, 0x05, 0xf1, 0x6c, 0x89, 0xcf, 0x9c,
+        0xb3, 0x14, 0xcd, 0x8e, 0xdf, 0xdc, 0x36, 0xed, 0xe4, 0xb0, 0x86, 0xb2, 0x5e, 0x95, 0x6c, 0x14,
+        0xe1, 0xf2, 0xe6, 0x94, 0x1c, 0x4f, 0xdc, 0x81, 0xe3, 0x23, 0xd2, 0x93, 0x45, 0x7f, 0xa7, 0x8f,
+        0x36, 0xd4, 0xcf, 0xcc, 0xe8, 0x6b, 0xcf, 0x75, 0x8e, 0x40, 0xab, 0x73, 0xd5, 0xf7, 0x90, 0x35,
+        0xff, 0x81, 0x9c, 0x3f, 0x44, 0x7c, 0xb0, 0xba, 0x3f, 0xf3, 0x7b, 0x50, 0x98, 0x3f, 0x27, 0x57,
+        0xef, 0x4c, 0x81, 0x63, 0xbc, 0xd0, 0xe4, 0xbf, 0xbb, 0x28, 0x96, 0x93, 0x92, 0xd5, 0xdb, 0xfa,
+        0xf8, 0x02, 0xf8, 0xf0, 0xcd, 0x17, 0x69, 0xb5, 0x65, 0xf3, 0x51, 0xb2, 0x2b, 0x88, 0xeb, 0xaa,
+        0x93, 0x25, 0x29, 0xef, 0x05, 0x72, 0x49, 0xd2, 0x13, 0x5f, 0x8a, 0x3d, 0x8e, 0x24, 0xf3, 0x76,
+        0x84, 0xf4, 0xa3, 0x55, 0xfa, 0x06, 0xcd, 0x6f, 0xd5, 0xcb, 0x85, 0x06, 0xf9, 0xb1, 0x97, 0xfc,
+        0x02, 0xd7, 0xe1, 0xa7, 0x26, 0x9d, 0xc0, 0x13, 0x21, 0x04, 0xaa, 0x62, 0x36, 0x85, 0x68, 0x7d,
+        0x5f, 0xc1, 0xd4, 0xbb, 0xfd, 0x74, 0x5a, 0x71, 0xa0, 0xdd, 0x2f, 0xe4, 0x3c, 0xf3, 0x5e, 0xe7,
+        0xce, 0x25, 0xbd, 0xad, 0x21, 0xff, 0x9a, 0x23, 0x01, 0xba, 0x16, 0x68, 0xda, 0xcc, 0x59, 0x49,
+        0xa0, 0x35, 0x85, 0x01, 0xf5, 0x71, 0x43, 0x18, 0x93, 0xdf, 0x2b, 0xb2, 0xea, 0x13, 0x11, 0xf1,
+        0xdb, 0x2b, 0x84, 0x49, 0xa9, 0x37, 0xb3, 0x1b, 0x38, 0x7d, 0xfc, 0x3f, 0x6a, 0x80, 0xa7, 0x42,
+        0x06, 0x2f, 0x6d, 0xdd, 0x89, 0xb0, 0x3e, 0x88, 0xa7, 0x54, 0x93, 0xca, 0x65, 0x45, 0x91, 0x8b,
+        0x43, 0x83, 0x85, 0x7f, 0xa6, 0xd3, 0x44, 0x3b, 0x33, 0xc9, 0xa0, 0xe2, 0x96, 0xa3, 0xba, 0x74,
+        0xaf, 0x6d, 0xf6, 0x0c, 0xdf, 0x70, 0x3f, 0x88, 0xca, 0x77, 0xda, 0x83, 0x9c, 0xb0, 0x2f, 0x32,
+        0x7c, 0xab, 0xdd, 0x13, 0x81, 0x7e, 0xf2, 0x06, 0x86, 0x49, 0x49, 0xfb, 0xd7, 0x07, 0xdf, 0x98,
+        0xb9, 0xda, 0x2a, 0xaf, 0x74, 0xe6, 0xdc, 0xde, 0x34, 0xa8, 0x32, 0xcc, 0xae, 0x23, 0xf3, 0x74,
+        0x2b, 0xe7, 0xfc, 0xd9, 0x89, 0xb1, 0x3f, 0x1f, 0xc7, 0xad, 0x1b, 0x34, 0x20, 0x3a, 0xc2, 0xa6,
+        0x01, 0x42, 0xb1, 0x69, 0x78, 0xb2, 0xe4, 0x97, 0x23, 0x2c, 0x5b, 0x24, 0x30, 0xd3, 0x06, 0x90,
+        0xd7, 0x3a, 0xf9, 0x00, 0x00, 0x6a, 0xc1, 0xbf, 0x92, 0xdf, 0x03, 0x5c, 0xd7, 0xd7, 0x6f, 0xdd,
+        0x74, 0x1e, 0x9c, 0xf0, 0xb2, 0xe7, 0xd9, 0xe1, 0x11, 0xeb, 0xb1, 0xa3, 0xf4, 0x1a, 0xa8, 0x7a,
+        0xa9, 0x55, 0xf5, 0x20, 0xfc, 0x9e, 0xe7, 0x03, 0x7e, 0x48, 0x5c, 0x15, 0x75, 0x66, 0x1d, 0xf2,
+        0x04, 0x8c, 0x9d, 0x46, 0xce, 0xb4, 0x9c, 0x80, 0xf8, 0x38, 0xe2, 0x36, 0x12, 0xc1, 0xa8, 0x97,
+        0x91, 0x12, 0x01, 0x98, 0xe2, 0x9d, 0x2a, 0xa8, 0xb7, 0x97, 0xc8, 0xd9, 0xa1, 0xe0, 0x70, 0xf4,
+        0xa0, 0x8e, 0xd3, 0xa0, 0x5e, 0x2c, 0xa2, 0xf1, 0x2c, 0x6a, 0x8e, 0x9a, 0x21, 0xa8, 0xe3, 0x7a,
+        0xd0, 0x77, 0xd2, 0xa7, 0xeb, 0xfc, 0x66, 0xcf, 0x2e, 0xc0, 0x32, 0x9c, 0xc6, 0x12, 0xfd, 0x04,
+        0x2b, 0xc4, 0x17, 0x71, 0x1c, 0x67, 0x65, 0xa1, 0x4c, 0x33, 0x1b, 0x32, 0x3c, 0x41, 0x2c, 0xee,
+        0x2a, 0xc1, 0x73, 0xcb, 0x0f, 0xf1, 0x64, 0x15, 0x3c, 0x52, 0xca, 0xbd, 0x0b, 0xc5, 0x5b, 0xb0,
+        0x9b, 0xa3, 0x56, 0x78, 0x0c, 0x48, 0x68, 0x95, 0x80, 0x89, 0xd4, 0x93, 0xb4, 0x0e, 0xbf, 0xc5,
+        0xa6, 0xb4, 0xf0, 0x63, 0xd8, 0xc0, 0x19, 0xbf, 0xac, 0x7b, 0xea, 0xd2, 0xac, 0xf8, 0xf9, 0xca,
+        0x59, 0xfa, 0x3f, 0xb6, 0xf9, 0x5f, 0x17, 0x29, 0xc2, 0x0c, 0xe8, 0x66, 0x00, 0x00,
+};
+
+static const uint8_t s_page_html_identity[] = {
+        0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a,
+        0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x3d, 0x22, 0x72, 0x75, 0x22, 0x3e,
+        0x0a, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x63, 0x68,
+        0x61, 0x72, 0x73, 0x65, 0x74, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22, 0x3e, 0x0a, 0x3c,
+        0x6d, 0x65, 0x74, 0x61, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x76, 0x69, 0x65, 0x77, 0x70,
+        0x6f, 0x72, 0x74, 0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x77, 0x69,
+        0x64, 0x74, 0x68, 0x3d, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68,
+        0x2c, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x2d, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x3d,
+        0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0xd0, 0x9c, 0xd0,
+        0xbe, 0xd0, 0xbd, 0xd0, 0xb8, 0xd1, 0x82, 0xd0, 0xbe, 0xd1, 0x80, 0xd0, 0xb8, 0xd0, 0xbd, 0xd0,
+        0xb3, 0x20, 0xd0, 0xba, 0xd0, 0xb0, 0xd1, 0x87, 0xd0, 0xb5, 0xd1, 0x81, 0xd1, 0x82, 0xd0, 0xb2,
+        0xd0, 0xb0, 0x20, 0xd0, 0xb2, 0xd0, 0xbe, 0xd0, 0xb7, 0xd0, 0xb4, 0xd1, 0x83, 0xd1, 0x85, 0xd0,
+        0xb0, 0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x0a, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65,
+        0x3e, 0x3a, 0x72, 0x6f, 0x6f, 0x74, 0x7b, 0x2d, 0x2d, 0x62, 0x67, 0x3a, 0x23, 0x65, 0x65, 0x66,
+        0x31, 0x66, 0x34, 0x3b, 0x2d, 0x2d, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x3a, 0x23, 0x66,
+        0x66, 0x66, 0x66, 0x66, 0x66, 0x3b, 0x2d, 0x2d, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x23,
+        0x65, 0x32, 0x65, 0x36, 0x65, 0x61, 0x3b, 0x2d, 0x2d, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x23, 0x31,
+        0x66, 0x32, 0x39, 0x33, 0x33, 0x3b, 0x2d, 0x2d, 0x6d, 0x75, 0x74, 0x65, 0x64, 0x3a, 0x23, 0x36,
+        0x62, 0x37, 0x32, 0x38, 0x30, 0x3b, 0x2d, 0x2d, 0x67, 0x6f, 0x6f, 0x64, 0x3a, 0x23, 0x31, 0x36,
+        0x61, 0x33, 0x34, 0x61, 0x3b, 0x2d, 0x2d, 0x77, 0x61, 0x72, 0x6e, 0x3a, 0x23, 0x64, 0x39, 0x37,
+        0x37, 0x30, 0x36, 0x3b, 0x2d, 0x2d, 0x62, 0x61, 0x64, 0x3a, 0x23, 0x64, 0x63, 0x32, 0x36, 0x32,
+        0x36, 0x3b, 0x2d, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x31, 0x30, 0x70, 0x78, 0x7d,
+        0x2a, 0x7b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x30, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69,
+        0x6e, 0x67, 0x3a, 0x30, 0x3b, 0x62, 0x6f, 0x78, 0x2d, 0x73, 0x69, 0x7a, 0x69, 0x6e, 0x67, 0x3a,
+        0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x62, 0x6f, 0x78, 0x7d, 0x62, 0x6f, 0x64, 0x79, 0x7b,
+        0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x2d, 0x61, 0x70, 0x70,
+        0x6c, 0x65, 0x2d, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x2c, 0x42, 0x6c, 0x69, 0x6e, 0x6b, 0x4d,
+        0x61, 0x63, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x46, 0x6f, 0x6e, 0x74, 0x2c, 0x22, 0x53, 0x65,
+        0x67, 0x6f, 0x65, 0x20, 0x55, 0x49, 0x22, 0x2c, 0x52, 0x6f, 0x62, 0x6f, 0x74, 0x6f, 0x2c, 0x48,
+        0x65, 0x6c, 0x76, 0x65, 0x74, 0x69, 0x63, 0x61, 0x2c, 0x41, 0x72, 0x69, 0x61, 0x6c, 0x2c, 0x73,
+        0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72,
+        0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x62, 0x67, 0x29, 0x3b, 0x63,
+        0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x74, 0x65, 0x78, 0x74, 0x29,
+        0x3b, 0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x31, 0x2e, 0x34,
+        0x3b, 0x2d, 0x77, 0x65, 0x62, 0x6b, 0x69, 0x74, 0x2d, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x73, 0x69,
+        0x7a, 0x65, 0x2d, 0x61, 0x64, 0x6a, 0x75, 0x73, 0x74, 0x3a, 0x31, 0x30, 0x30, 0x25, 0x7d, 0x2e,
+        0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x7b, 0x6d, 0x61, 0x78, 0x2d, 0x77, 0x69,
+        0x64, 0x74, 0x68, 0x3a, 0x31, 0x31, 0x30, 0x30, 0x70, 0x78, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69,
+        0x6e, 0x3a, 0x30, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67,
+        0x3a, 0x31, 0x36, 0x70, 0x78, 0x7d, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x7b, 0x6d, 0x61, 0x72,
+        0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x31, 0x36, 0x70, 0x78, 0x7d,
+        0x2e, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x6f, 0x77, 0x7b, 0x64, 0x69, 0x73, 0x70,
+        0x6c, 0x61, 0x79, 0x3a, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0x66, 0x6c, 0x65, 0x78, 0x2d, 0x64, 0x69,
+        0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x3b, 0x67,
+        0x61, 0x70, 0x3a, 0x31, 0x30, 0x70, 0x78, 0x3b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75,
+        0x6e, 0x64, 0x3a, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x72, 0x2d, 0x67, 0x72, 0x61, 0x64, 0x69, 0x65,
+        0x6e, 0x74, 0x28, 0x31, 0x33, 0x35, 0x64, 0x65, 0x67, 0x2c, 0x23, 0x31, 0x66, 0x32, 0x39, 0x33,
+        0x33, 0x2c, 0x23, 0x32, 0x62, 0x33, 0x61, 0x34, 0x61, 0x29, 0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+        0x3a, 0x23, 0x66, 0x66, 0x66, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31, 0x36,
+        0x70, 0x78, 0x20, 0x31, 0x38, 0x70, 0x78, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72,
+        0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x72, 0x61, 0x64, 0x69,
+        0x75, 0x73, 0x29, 0x7d, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x68, 0x31, 0x7b, 0x66, 0x6f,
+        0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x31, 0x2e, 0x32, 0x35, 0x72, 0x65, 0x6d, 0x3b,
+        0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x36, 0x30, 0x30, 0x7d,
+        0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a,
+        0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0x61, 0x6c, 0x69, 0x67,
+        0x6e, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x3a, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x67,
+        0x61, 0x70, 0x3a, 0x38, 0x70, 0x78, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65,
+        0x3a, 0x30, 0x2e, 0x39, 0x72, 0x65, 0x6d, 0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x63,
+        0x62, 0x64, 0x32, 0x64, 0x39, 0x7d, 0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2d, 0x69, 0x6e,
+        0x64, 0x69, 0x63, 0x61, 0x74, 0x6f, 0x72, 0x7b, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x39, 0x70,
+        0x78, 0x3b, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x39, 0x70, 0x78, 0x3b, 0x62, 0x6f, 0x72,
+        0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x35, 0x30, 0x25, 0x3b, 0x62,
+        0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
+        0x62, 0x61, 0x64, 0x29, 0x3b, 0x66, 0x6c, 0x65, 0x78, 0x2d, 0x73, 0x68, 0x72, 0x69, 0x6e, 0x6b,
+        0x3a, 0x30, 0x7d, 0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2e, 0x63, 0x6f, 0x6e, 0x6e, 0x65,
+        0x63, 0x74, 0x65, 0x64, 0x20, 0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2d, 0x69, 0x6e, 0x64,
+        0x69, 0x63, 0x61, 0x74, 0x6f, 0x72, 0x7b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e,
+        0x64, 0x3a, 0x23, 0x34, 0x61, 0x64, 0x65, 0x38, 0x30, 0x7d, 0x2e, 0x70, 0x61, 0x6e, 0x65, 0x6c,
+        0x7b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x76, 0x61, 0x72, 0x28,
+        0x2d, 0x2d, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x29, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65,
+        0x72, 0x3a, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28,
+        0x2d, 0x2d, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x29, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72,
+        0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x72, 0x61,
+        0x64, 0x69, 0x75, 0x73, 0x29, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31, 0x36,
+        0x70, 0x78, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d,
+        0x3a, 0x31, 0x36, 0x70, 0x78, 0x7d, 0x2e, 0x70, 0x61, 0x6e, 0x65, 0x6c, 0x2d, 0x74, 0x69, 0x74,
+        0x6c, 0x65, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x31, 0x72, 0x65,
+        0x6d, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x36, 0x30,
+        0x30, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a,
+        0x31, 0x34, 0x70, 0x78, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x2d, 0x6c, 0x65, 0x66,
+        0x74, 0x3a, 0x31, 0x30, 0x70, 0x78, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x6c, 0x65,
+        0x66, 0x74, 0x3a, 0x34, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 0x32, 0x35,
+        0x36, 0x33, 0x65, 0x62, 0x7d, 0x2e, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x73, 0x2d, 0x67, 0x72,
+        0x69, 0x64, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x67, 0x72, 0x69, 0x64, 0x3b,
+        0x67, 0x72, 0x69, 0x64, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x2d, 0x63, 0x6f,
+        0x6c, 0x75, 0x6d, 0x6e, 0x73, 0x3a, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x28, 0x32, 0x2c, 0x31,
+        0x66, 0x72, 0x29, 0x3b, 0x67, 0x61, 0x70, 0x3a, 0x31, 0x32, 0x70, 0x78, 0x7d, 0x2e, 0x73, 0x65,
+        0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x63, 0x61, 0x72, 0x64, 0x7b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72,
+        0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x74, 0x69, 0x6e, 0x74, 0x2c,
+        0x23, 0x66, 0x66, 0x66, 0x29, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x31, 0x70, 0x78,
+        0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x62, 0x6f, 0x72,
+        0x64, 0x65, 0x72, 0x29, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x74, 0x6f, 0x70, 0x3a,
+        0x33, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
+        0x63, 0x2c, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x29, 0x29,
+        0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x38,
+        0x70, 0x78, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31, 0x34, 0x70, 0x78, 0x7d,
+        0x2e, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x7b, 0x66, 0x6f, 0x6e,
+        0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x30, 0x2e, 0x38, 0x32, 0x72, 0x65, 0x6d, 0x3b, 0x66,
+        0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x36, 0x30, 0x30, 0x3b, 0x63,
+        0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x2c, 0x76, 0x61, 0x72,
+        0x28, 0x2d, 0x2d, 0x6d, 0x75, 0x74, 0x65, 0x64, 0x29, 0x29, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69,
+        0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x36, 0x70, 0x78, 0x7d, 0x2e, 0x73, 0x65,
+        0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d,
+        0x73, 0x69, 0x7a, 0x65, 0x3a, 0x31, 0x2e, 0x39, 0x72, 0x65, 0x6d, 0x3b, 0x66, 0x6f, 0x6e, 0x74,
+        0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x37, 0x30, 0x30, 0x3b, 0x63, 0x6f, 0x6c, 0x6f,
+        0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x2c, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
+        0x74, 0x65, 0x78, 0x74, 0x29, 0x29, 0x3b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x66,
+        0x6c, 0x65, 0x78, 0x3b, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x3a,
+        0x62, 0x61, 0x73, 0x65, 0x6c, 0x69, 0x6e, 0x65, 0x3b, 0x67, 0x61, 0x70, 0x3a, 0x36, 0x70, 0x78,
+        0x7d, 0x2e, 0x75, 0x6e, 0x69, 0x74, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65,
+        0x3a, 0x30, 0x2e, 0x38, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65,
+        0x69, 0x67, 0x68, 0x74, 0x3a, 0x34, 0x30, 0x30, 0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76,
+        0x61, 0x72, 0x28, 0x2d, 0x2d, 0x6d, 0x75, 0x74, 0x65, 0x64, 0x29, 0x7d, 0x2e, 0x73, 0x75, 0x62,
+        0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x30, 0x2e, 0x38, 0x72, 0x65,
+        0x6d, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x36, 0x30,
+        0x30, 0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x6d, 0x75,
+        0x74, 0x65, 0x64, 0x29, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70, 0x3a,
+        0x36, 0x70, 0x78, 0x7d, 0x2e, 0x63, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x7b, 0x2d, 0x2d, 0x63, 0x3a,
+        0x23, 0x65, 0x31, 0x31, 0x64, 0x34, 0x38, 0x3b, 0x2d, 0x2d, 0x74, 0x69, 0x6e, 0x74, 0x3a, 0x23,
+        0x66, 0x65, 0x66, 0x32, 0x66, 0x34, 0x7d, 0x2e, 0x63, 0x2d, 0x68, 0x75, 0x6d, 0x7b, 0x2d, 0x2d,
+        0x63, 0x3a, 0x23, 0x32, 0x35, 0x36, 0x33, 0x65, 0x62, 0x3b, 0x2d, 0x2d, 0x74, 0x69, 0x6e, 0x74,
+        0x3a, 0x23, 0x65, 0x66, 0x66, 0x35, 0x66, 0x66, 0x7d, 0x2e, 0x63, 0x2d, 0x61, 0x71, 0x69, 0x7b,
+        0x2d, 0x2d, 0x63, 0x3a, 0x23, 0x37, 0x63, 0x33, 0x61, 0x65, 0x64, 0x3b, 0x2d, 0x2d, 0x74, 0x69,
+        0x6e, 0x74, 0x3a, 0x23, 0x66, 0x35, 0x66, 0x31, 0x66, 0x65, 0x7d, 0x2e, 0x63, 0x2d, 0x70, 0x72,
+        0x65, 0x73, 0x73, 0x7b, 0x2d, 0x2d, 0x63, 0x3a, 0x23, 0x30, 0x32, 0x38, 0x34, 0x63, 0x37, 0x3b,
+        0x2d, 0x2d, 0x74, 0x69, 0x6e, 0x74, 0x3a, 0x23, 0x65, 0x63, 0x66, 0x37, 0x66, 0x65, 0x7d, 0x2e,
+        0x63, 0x2d, 0x70, 0x6d, 0x31, 0x7b, 0x2d, 0x2d, 0x63, 0x3a, 0x23, 0x30, 0x38, 0x39, 0x31, 0x62,
+        0x32, 0x3b, 0x2d, 0x2d, 0x74, 0x69, 0x6e, 0x74, 0x3a, 0x23, 0x65, 0x63, 0x66, 0x62, 0x66, 0x65,
+        0x7d, 0x2e, 0x63, 0x2d, 0x70, 0x6d, 0x32, 0x35, 0x7b, 0x2d, 0x2d, 0x63, 0x3a, 0x23, 0x64, 0x39,
+        0x37, 0x37, 0x30, 0x36, 0x3b, 0x2d, 0x2d, 0x74, 0x69, 0x6e, 0x74, 0x3a, 0x23, 0x66, 0x66, 0x66,
+        0x37, 0x65, 0x63, 0x7d, 0x2e, 0x63, 0x2d, 0x70, 0x6d, 0x31, 0x30, 0x7b, 0x2d, 0x2d, 0x63, 0x3a,
+        0x23, 0x64, 0x63, 0x32, 0x36, 0x32, 0x36, 0x3b, 0x2d, 0x2d, 0x74, 0x69, 0x6e, 0x74, 0x3a, 0x23,
+        0x66, 0x65, 0x66, 0x32, 0x66, 0x32, 0x7d, 0x2e, 0x63, 0x2d, 0x63, 0x6f, 0x32, 0x7b, 0x2d, 0x2d,
+        0x63, 0x3a, 0x23, 0x31, 0x36, 0x61, 0x33, 0x34, 0x61, 0x3b, 0x2d, 0x2d, 0x74, 0x69, 0x6e, 0x74,
+        0x3a, 0x23, 0x65, 0x66, 0x66, 0x61, 0x66, 0x31, 0x7d, 0x2e, 0x63, 0x2d, 0x63, 0x6f, 0x7b, 0x2d,
+        0x2d, 0x63, 0x3a, 0x23, 0x65, 0x61, 0x35, 0x38, 0x30, 0x63, 0x3b, 0x2d, 0x2d, 0x74, 0x69, 0x6e,
+        0x74, 0x3a, 0x23, 0x66, 0x66, 0x66, 0x33, 0x65, 0x63, 0x7d, 0x2e, 0x63, 0x2d, 0x6c, 0x70, 0x67,
+        0x7b, 0x2d, 0x2d, 0x63, 0x3a, 0x23, 0x34, 0x66, 0x34, 0x36, 0x65, 0x35, 0x3b, 0x2d, 0x2d, 0x74,
+        0x69, 0x6e, 0x74, 0x3a, 0x23, 0x66, 0x30, 0x66, 0x30, 0x66, 0x65, 0x7d, 0x2e, 0x63, 0x2d, 0x6e,
+        0x68, 0x33, 0x7b, 0x2d, 0x2d, 0x63, 0x3a, 0x23, 0x30, 0x64, 0x39, 0x34, 0x38, 0x38, 0x3b, 0x2d,
+        0x2d, 0x74, 0x69, 0x6e, 0x74, 0x3a, 0x23, 0x65, 0x61, 0x66, 0x61, 0x66, 0x37, 0x7d, 0x2e, 0x62,
+        0x61, 0x72, 0x7b, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x36, 0x70, 0x78, 0x3b, 0x62, 0x61,
+        0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2c,
+        0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2e, 0x30, 0x36, 0x29, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72,
+        0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x33, 0x70, 0x78, 0x3b, 0x6f, 0x76, 0x65, 0x72,
+        0x66, 0x6c, 0x6f, 0x77, 0x3a, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x3b, 0x6d, 0x61, 0x72, 0x67,
+        0x69, 0x6e, 0x3a, 0x38, 0x70, 0x78, 0x20, 0x30, 0x20, 0x30, 0x7d, 0x2e, 0x62, 0x61, 0x72, 0x2d,
+        0x66, 0x69, 0x6c, 0x6c, 0x7b, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x31, 0x30, 0x30, 0x25,
+        0x3b, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x30, 0x25, 0x3b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72,
+        0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x2c, 0x76, 0x61, 0x72,
+        0x28, 0x2d, 0x2d, 0x67, 0x6f, 0x6f, 0x64, 0x29, 0x29, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72,
+        0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x33, 0x70, 0x78, 0x3b, 0x74, 0x72, 0x61, 0x6e,
+        0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x30, 0x2e, 0x34,
+        0x73, 0x20, 0x65, 0x61, 0x73, 0x65, 0x2c, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e,
+        0x64, 0x20, 0x30, 0x2e, 0x34, 0x73, 0x20, 0x65, 0x61, 0x73, 0x65, 0x7d, 0x2e, 0x63, 0x68, 0x61,
+        0x72, 0x74, 0x73, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x66, 0x6c, 0x65, 0x78,
+        0x3b, 0x66, 0x6c, 0x65, 0x78, 0x2d, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3a,
+        0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x3b, 0x67, 0x61, 0x70, 0x3a, 0x31, 0x38, 0x70, 0x78, 0x7d,
+        0x2e, 0x63, 0x68, 0x61, 0x72, 0x74, 0x2d, 0x68, 0x65, 0x61, 0x64, 0x7b, 0x64, 0x69, 0x73, 0x70,
+        0x6c, 0x61, 0x79, 0x3a, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0x66, 0x6c, 0x65, 0x78, 0x2d, 0x77, 0x72,
+        0x61, 0x70, 0x3a, 0x77, 0x72, 0x61, 0x70, 0x3b, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x69, 0x74,
+        0x65, 0x6d, 0x73, 0x3a, 0x62, 0x61, 0x73, 0x65, 0x6c, 0x69, 0x6e, 0x65, 0x3b, 0x6a, 0x75, 0x73,
+        0x74, 0x69, 0x66, 0x79, 0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x73, 0x70, 0x61,
+        0x63, 0x65, 0x2d, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x3b, 0x67, 0x61, 0x70, 0x3a, 0x34,
+        0x70, 0x78, 0x20, 0x31, 0x32, 0x70, 0x78, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62,
+        0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x38, 0x70, 0x78, 0x7d, 0x2e, 0x63, 0x68, 0x61, 0x72, 0x74,
+        0x2d, 0x6c, 0x65, 0x67, 0x65, 0x6e, 0x64, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a,
+        0x66, 0x6c, 0x65, 0x78, 0x3b, 0x66, 0x6c, 0x65, 0x78, 0x2d, 0x77, 0x72, 0x61, 0x70, 0x3a, 0x77,
+        0x72, 0x61, 0x70, 0x3b, 0x67, 0x61, 0x70, 0x3a, 0x31, 0x30, 0x70, 0x78, 0x3b, 0x66, 0x6f, 0x6e,
+        0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x31, 0x32, 0x70, 0x78, 0x7d, 0x2e, 0x63, 0x68, 0x61,
+        0x72, 0x74, 0x2d, 0x77, 0x72, 0x61, 0x70, 0x70, 0x65, 0x72, 0x7b, 0x77, 0x69, 0x64, 0x74, 0x68,
+        0x3a, 0x31, 0x30, 0x30, 0x25, 0x3b, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x32, 0x32, 0x30,
+        0x70, 0x78, 0x7d, 0x2e, 0x63, 0x68, 0x61, 0x72, 0x74, 0x2d, 0x77, 0x72, 0x61, 0x70, 0x70, 0x65,
+        0x72, 0x20, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x7b, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x31,
+        0x30, 0x30, 0x25, 0x20, 0x21, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x61, 0x6e, 0x74, 0x3b, 0x68,
+        0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x31, 0x30, 0x30, 0x25, 0x20, 0x21, 0x69, 0x6d, 0x70, 0x6f,
+        0x72, 0x74, 0x61, 0x6e, 0x74, 0x3b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x62, 0x6c,
+        0x6f, 0x63, 0x6b, 0x3b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x69,
+        0x6d, 0x61, 0x67, 0x65, 0x3a, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x72, 0x2d, 0x67, 0x72, 0x61, 0x64,
+        0x69, 0x65, 0x6e, 0x74, 0x28, 0x23, 0x65, 0x65, 0x66, 0x30, 0x66, 0x33, 0x20, 0x31, 0x70, 0x78,
+        0x2c, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x31, 0x70, 0x78,
+        0x29, 0x2c, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x72, 0x2d, 0x67, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6e,
+        0x74, 0x28, 0x39, 0x30, 0x64, 0x65, 0x67, 0x2c, 0x23, 0x65, 0x65, 0x66, 0x30, 0x66, 0x33, 0x20,
+        0x31, 0x70, 0x78, 0x2c, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x20,
+        0x31, 0x70, 0x78, 0x29, 0x3b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d,
+        0x73, 0x69, 0x7a, 0x65, 0x3a, 0x32, 0x30, 0x25, 0x20, 0x32, 0x30, 0x25, 0x7d, 0x2e, 0x74, 0x77,
+        0x6f, 0x2d, 0x63, 0x6f, 0x6c, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x67, 0x72,
+        0x69, 0x64, 0x3b, 0x67, 0x72, 0x69, 0x64, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+        0x2d, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x73, 0x3a, 0x31, 0x66, 0x72, 0x3b, 0x67, 0x61, 0x70,
+        0x3a, 0x32, 0x30, 0x70, 0x78, 0x7d, 0x2e, 0x69, 0x6e, 0x66, 0x6f, 0x2d, 0x67, 0x72, 0x69, 0x64,
+        0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x67, 0x72, 0x69, 0x64, 0x3b, 0x67, 0x72,
+        0x69, 0x64, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x2d, 0x63, 0x6f, 0x6c, 0x75,
+        0x6d, 0x6e, 0x73, 0x3a, 0x31, 0x66, 0x72, 0x3b, 0x67, 0x61, 0x70, 0x3a, 0x38, 0x70, 0x78, 0x7d,
+        0x2e, 0x69, 0x6e, 0x66, 0x6f, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c,
+        0x61, 0x79, 0x3a, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0x6a, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2d,
+        0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x73, 0x70, 0x61, 0x63, 0x65, 0x2d, 0x62, 0x65,
+        0x74, 0x77, 0x65, 0x65, 0x6e, 0x3b, 0x67, 0x61, 0x70, 0x3a, 0x31, 0x30, 0x70, 0x78, 0x3b, 0x70,
+        0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x38, 0x70, 0x78, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3b,
+        0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64,
+        0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x29, 0x3b, 0x62,
+        0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x33, 0x70, 0x78, 0x20, 0x73,
+        0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 0x32, 0x35, 0x36, 0x33, 0x65, 0x62, 0x3b, 0x62, 0x6f, 0x72,
+        0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x36, 0x70, 0x78, 0x3b, 0x66,
+        0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x30, 0x2e, 0x38, 0x38, 0x72, 0x65, 0x6d,
+        0x7d, 0x2e, 0x69, 0x6e, 0x66, 0x6f, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x7b, 0x63, 0x6f, 0x6c,
+        0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x6d, 0x75, 0x74, 0x65, 0x64, 0x29, 0x7d,
+        0x2e, 0x69, 0x6e, 0x66, 0x6f, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x7b, 0x66, 0x6f, 0x6e, 0x74,
+        0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x36, 0x30, 0x30, 0x7d, 0x2e, 0x63, 0x6f, 0x6e,
+        0x74, 0x72, 0x6f, 0x6c, 0x73, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x66, 0x6c,
+        0x65, 0x78, 0x3b, 0x66, 0x6c, 0x65, 0x78, 0x2d, 0x77, 0x72, 0x61, 0x70, 0x3a, 0x77, 0x72, 0x61,
+        0x70, 0x3b, 0x67, 0x61, 0x70, 0x3a, 0x38, 0x70, 0x78, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e,
+        0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x31, 0x36, 0x70, 0x78, 0x7d, 0x2e, 0x62, 0x74,
+        0x6e, 0x7b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31, 0x30, 0x70, 0x78, 0x20, 0x31,
+        0x34, 0x70, 0x78, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x31, 0x70, 0x78, 0x20, 0x73,
+        0x6f, 0x6c, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x62, 0x6f, 0x72, 0x64, 0x65,
+        0x72, 0x29, 0x3b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x23, 0x66,
+        0x36, 0x66, 0x38, 0x66, 0x61, 0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28,
+        0x2d, 0x2d, 0x74, 0x65, 0x78, 0x74, 0x29, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72,
+        0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x38, 0x70, 0x78, 0x3b, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72,
+        0x3a, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69,
+        0x7a, 0x65, 0x3a, 0x30, 0x2e, 0x39, 0x72, 0x65, 0x6d, 0x3b, 0x66, 0x6c, 0x65, 0x78, 0x3a, 0x31,
+        0x20, 0x31, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x7d, 0x2e, 0x62, 0x74, 0x6e, 0x3a, 0x68, 0x6f, 0x76,
+        0x65, 0x72, 0x7b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x23, 0x65,
+        0x63, 0x65, 0x66, 0x66, 0x32, 0x7d, 0x2e, 0x62, 0x74, 0x6e, 0x3a, 0x61, 0x63, 0x74, 0x69, 0x76,
+        0x65, 0x7b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x23, 0x65, 0x32,
+        0x65, 0x36, 0x65, 0x61, 0x7d, 0x2e, 0x62, 0x74, 0x6e, 0x2e, 0x70, 0x61, 0x75, 0x73, 0x65, 0x64,
+        0x7b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x23, 0x32, 0x35, 0x36,
+        0x33, 0x65, 0x62, 0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x66, 0x66, 0x66, 0x3b, 0x62,
+        0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x32, 0x35, 0x36,
+        0x33, 0x65, 0x62, 0x7d, 0x2e, 0x62, 0x74, 0x6e, 0x2d, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x7b, 0x66,
+        0x6c, 0x65, 0x78, 0x3a, 0x30, 0x20, 0x30, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3b, 0x70, 0x61, 0x64,
+        0x64, 0x69, 0x6e, 0x67, 0x3a, 0x36, 0x70, 0x78, 0x20, 0x31, 0x32, 0x70, 0x78, 0x3b, 0x66, 0x6f,
+        0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x30, 0x2e, 0x38, 0x32, 0x72, 0x65, 0x6d, 0x7d,
+        0x2e, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x7b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f,
+        0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x31, 0x34, 0x70, 0x78, 0x7d, 0x2e, 0x66, 0x69, 0x65, 0x6c, 0x64,
+        0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x62,
+        0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x30,
+        0x2e, 0x38, 0x38, 0x72, 0x65, 0x6d, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f,
+        0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x38, 0x70, 0x78, 0x7d, 0x2e, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x20,
+        0x69, 0x6e, 0x70, 0x75, 0x74, 0x5b, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x72, 0x61, 0x6e, 0x67,
+        0x65, 0x22, 0x5d, 0x7b, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x31, 0x30, 0x30, 0x25, 0x3b, 0x61,
+        0x63, 0x63, 0x65, 0x6e, 0x74, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x32, 0x35, 0x36,
+        0x33, 0x65, 0x62, 0x7d, 0x2e, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x7b, 0x64, 0x69,
+        0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0x61, 0x6c, 0x69, 0x67, 0x6e,
+        0x2d, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x3a, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x67, 0x61,
+        0x70, 0x3a, 0x38, 0x70, 0x78, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a,
+        0x30, 0x2e, 0x38, 0x38, 0x72, 0x65, 0x6d, 0x3b, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x3a, 0x70,
+        0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x7d, 0x2e, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78,
+        0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x7b, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x2d, 0x63, 0x6f,
+        0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x32, 0x35, 0x36, 0x33, 0x65, 0x62, 0x7d, 0x2e, 0x6c, 0x6f, 0x67,
+        0x2d, 0x68, 0x65, 0x61, 0x64, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x66, 0x6c,
+        0x65, 0x78, 0x3b, 0x6a, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x65,
+        0x6e, 0x74, 0x3a, 0x73, 0x70, 0x61, 0x63, 0x65, 0x2d, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e,
+        0x3b, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x3a, 0x63, 0x65, 0x6e,
+        0x74, 0x65, 0x72, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f,
+        0x6d, 0x3a, 0x31, 0x32, 0x70, 0x78, 0x7d, 0x2e, 0x6c, 0x6f, 0x67, 0x7b, 0x6d, 0x61, 0x78, 0x2d,
+        0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x32, 0x30, 0x30, 0x70, 0x78, 0x3b, 0x6f, 0x76, 0x65,
+        0x72, 0x66, 0x6c, 0x6f, 0x77, 0x2d, 0x79, 0x3a, 0x61, 0x75, 0x74, 0x6f, 0x3b, 0x62, 0x6f, 0x72,
+        0x64, 0x65, 0x72, 0x3a, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x76, 0x61,
+        0x72, 0x28, 0x2d, 0x2d, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x29, 0x3b, 0x62, 0x6f, 0x72, 0x64,
+        0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x38, 0x70, 0x78, 0x3b, 0x70, 0x61,
+        0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31, 0x30, 0x70, 0x78, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d,
+        0x73, 0x69, 0x7a, 0x65, 0x3a, 0x30, 0x2e, 0x38, 0x35, 0x72, 0x65, 0x6d, 0x7d, 0x2e, 0x6c, 0x6f,
+        0x67, 0x2d, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x7b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a,
+        0x34, 0x70, 0x78, 0x20, 0x30, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x62, 0x6f, 0x74,
+        0x74, 0x6f, 0x6d, 0x3a, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 0x66,
+        0x30, 0x66, 0x32, 0x66, 0x34, 0x7d, 0x2e, 0x6c, 0x6f, 0x67, 0x2d, 0x65, 0x6e, 0x74, 0x72, 0x79,
+        0x3a, 0x6c, 0x61, 0x73, 0x74, 0x2d, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x7b, 0x62, 0x6f, 0x72, 0x64,
+        0x65, 0x72, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x6e, 0x6f, 0x6e, 0x65, 0x7d, 0x2e,
+        0x6c, 0x6f, 0x67, 0x2d, 0x74, 0x69, 0x6d, 0x65, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76,
+        0x61, 0x72, 0x28, 0x2d, 0x2d, 0x6d, 0x75, 0x74, 0x65, 0x64, 0x29, 0x3b, 0x6d, 0x61, 0x72, 0x67,
+        0x69, 0x6e, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x36, 0x70, 0x78, 0x7d, 0x40, 0x6d, 0x65,
+        0x64, 0x69, 0x61, 0x20, 0x28, 0x6d, 0x69, 0x6e, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x36,
+        0x30, 0x30, 0x70, 0x78, 0x29, 0x7b, 0x2e, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72,
+        0x7b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x32, 0x34, 0x70, 0x78, 0x7d, 0x2e, 0x68,
+        0x65, 0x61, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x6f, 0x77, 0x7b, 0x66, 0x6c, 0x65, 0x78, 0x2d, 0x64,
+        0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x72, 0x6f, 0x77, 0x3b, 0x6a, 0x75, 0x73,
+        0x74, 0x69, 0x66, 0x79, 0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x73, 0x70, 0x61,
+        0x63, 0x65, 0x2d, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x3b, 0x61, 0x6c, 0x69, 0x67, 0x6e,
+        0x2d, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x3a, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x7d, 0x68, 0x65,
+        0x61, 0x64, 0x65, 0x72, 0x20, 0x68, 0x31, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a,
+        0x65, 0x3a, 0x31, 0x2e, 0x35, 0x72, 0x65, 0x6d, 0x7d, 0x2e, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72,
+        0x73, 0x2d, 0x67, 0x72, 0x69, 0x64, 0x7b, 0x67, 0x72, 0x69, 0x64, 0x2d, 0x74, 0x65, 0x6d, 0x70,
+        0x6c, 0x61, 0x74, 0x65, 0x2d, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x73, 0x3a, 0x72, 0x65, 0x70,
+        0x65, 0x61, 0x74, 0x28, 0x33, 0x2c, 0x31, 0x66, 0x72, 0x29, 0x7d, 0x2e, 0x69, 0x6e, 0x66, 0x6f,
+        0x2d, 0x67, 0x72, 0x69, 0x64, 0x7b, 0x67, 0x72, 0x69, 0x64, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+        0x61, 0x74, 0x65, 0x2d, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x73, 0x3a, 0x72, 0x65, 0x70, 0x65,
+        0x61, 0x74, 0x28, 0x32, 0x2c, 0x31, 0x66, 0x72, 0x29, 0x7d, 0x2e, 0x63, 0x68, 0x61, 0x72, 0x74,
+        0x2d, 0x77, 0x72, 0x61, 0x70, 0x70, 0x65, 0x72, 0x7b, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a,
+        0x32, 0x36, 0x30, 0x70, 0x78, 0x7d, 0x7d, 0x40, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x20, 0x28, 0x6d,
+        0x69, 0x6e, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x39, 0x30, 0x30, 0x70, 0x78, 0x29, 0x7b,
+        0x2e, 0x63, 0x68, 0x61, 0x72, 0x74, 0x73, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a,
+        0x67, 0x72, 0x69, 0x64, 0x3b, 0x67, 0x72, 0x69, 0x64, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+        0x74, 0x65, 0x2d, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x73, 0x3a, 0x31, 0x66, 0x72, 0x20, 0x31,
+        0x66, 0x72, 0x7d, 0x2e, 0x63, 0x68, 0x61, 0x72, 0x74, 0x2d, 0x66, 0x75, 0x6c, 0x6c, 0x7b, 0x67,
+        0x72, 0x69, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x3a, 0x31, 0x20, 0x2f, 0x20, 0x2d,
+        0x31, 0x7d, 0x2e, 0x74, 0x77, 0x6f, 0x2d, 0x63, 0x6f, 0x6c, 0x7b, 0x67, 0x72, 0x69, 0x64, 0x2d,
+        0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x2d, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x73,
+        0x3a, 0x31, 0x66, 0x72, 0x20, 0x31, 0x66, 0x72, 0x7d, 0x7d, 0x2e, 0x61, 0x69, 0x72, 0x2d, 0x73,
+        0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x66,
+        0x6c, 0x65, 0x78, 0x3b, 0x6a, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2d, 0x63, 0x6f, 0x6e, 0x74,
+        0x65, 0x6e, 0x74, 0x3a, 0x73, 0x70, 0x61, 0x63, 0x65, 0x2d, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65,
+        0x6e, 0x3b, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x3a, 0x63, 0x65,
+        0x6e, 0x74, 0x65, 0x72, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70, 0x3a,
+        0x31, 0x34, 0x70, 0x78, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31, 0x32, 0x70,
+        0x78, 0x20, 0x31, 0x34, 0x70, 0x78, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x31, 0x70,
+        0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x62, 0x6f,
+        0x72, 0x64, 0x65, 0x72, 0x29, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x6c, 0x65, 0x66,
+        0x74, 0x3a, 0x34, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28,
+        0x2d, 0x2d, 0x6d, 0x75, 0x74, 0x65, 0x64, 0x29, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d,
+        0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x38, 0x70, 0x78, 0x3b, 0x62, 0x61, 0x63, 0x6b, 0x67,
+        0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x23, 0x66, 0x38, 0x66, 0x61, 0x66, 0x63, 0x7d, 0x2e, 0x61,
+        0x69, 0x72, 0x2d, 0x73, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c,
+        0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x36, 0x30, 0x30,
+        0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x30, 0x2e, 0x39, 0x72, 0x65,
+        0x6d, 0x7d, 0x2e, 0x61, 0x69, 0x72, 0x2d, 0x73, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x2d, 0x76,
+        0x61, 0x6c, 0x75, 0x65, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74,
+        0x3a, 0x37, 0x30, 0x30, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x31,
+        0x2e, 0x30, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72,
+        0x28, 0x2d, 0x2d, 0x6d, 0x75, 0x74, 0x65, 0x64, 0x29, 0x7d, 0x3c, 0x2f, 0x73, 0x74, 0x79, 0x6c,
+        0x65, 0x3e, 0x0a, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x3c, 0x62, 0x6f, 0x64, 0x79,
+        0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f,
+        0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x22, 0x3e, 0x0a, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x65,
+        0x72, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x68,
+        0x65, 0x61, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x6f, 0x77, 0x22, 0x3e, 0x0a, 0x3c, 0x68, 0x31, 0x3e,
+        0xd0, 0x9c, 0xd0, 0xbe, 0xd0, 0xbd, 0xd0, 0xb8, 0xd1, 0x82, 0xd0, 0xbe, 0xd1, 0x80, 0xd0, 0xb8,
+        0xd0, 0xbd, 0xd0, 0xb3, 0x20, 0xd0, 0xba, 0xd0, 0xb0, 0xd1, 0x87, 0xd0, 0xb5, 0xd1, 0x81, 0xd1,
+        0x82, 0xd0, 0xb2, 0xd0, 0xb0, 0x20, 0xd0, 0xb2, 0xd0, 0xbe, 0xd0, 0xb7, 0xd0, 0xb4, 0xd1, 0x83,
+        0xd1, 0x85, 0xd0, 0xb0, 0x3c, 0x2f, 0x68, 0x31, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63,
+        0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x22, 0x20, 0x69, 0x64,
+        0x3d, 0x22, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x22, 0x3e, 0x0a, 0x3c, 0x73, 0x70, 0x61, 0x6e,
+        0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2d, 0x69,
+        0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 0x6f, 0x72, 0x22, 0x3e, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e,
+        0x3e, 0x0a, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73,
+        0x74, 0x61, 0x74, 0x75, 0x73, 0x2d, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0xd0, 0x9f, 0xd0, 0xbe,
+        0xd0, 0xb4, 0xd0, 0xba, 0xd0, 0xbb, 0xd1, 0x8e, 0xd1, 0x87, 0xd0, 0xb5, 0xd0, 0xbd, 0xd0, 0xb8,
+        0xd0, 0xb5, 0xe2, 0x80, 0xa6, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x0a, 0x3c, 0x2f, 0x64,
+        0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x68, 0x65, 0x61,
+        0x64, 0x65, 0x72, 0x3e, 0x0a, 0x3c, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x6c,
+        0x61, 0x73, 0x73, 0x3d, 0x22, 0x70, 0x61, 0x6e, 0x65, 0x6c, 0x22, 0x3e, 0x0a, 0x3c, 0x68, 0x32,
+        0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x70, 0x61, 0x6e, 0x65, 0x6c, 0x2d, 0x74, 0x69,
+        0x74, 0x6c, 0x65, 0x22, 0x3e, 0xd0, 0xa2, 0xd0, 0xb5, 0xd0, 0xba, 0xd1, 0x83, 0xd1, 0x89, 0xd0,
+        0xb8, 0xd0, 0xb5, 0x20, 0xd0, 0xbf, 0xd0, 0xbe, 0xd0, 0xba, 0xd0, 0xb0, 0xd0, 0xb7, 0xd0, 0xb0,
+        0xd0, 0xbd, 0xd0, 0xb8, 0xd1, 0x8f, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76,
+        0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x73, 0x2d,
+        0x67, 0x72, 0x69, 0x64, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73,
+        0x73, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x63, 0x61, 0x72, 0x64, 0x20, 0x63,
+        0x2d, 0x74, 0x65, 0x6d, 0x70, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61,
+        0x73, 0x73, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+        0x3e, 0xd0, 0xa2, 0xd0, 0xb5, 0xd0, 0xbc, 0xd0, 0xbf, 0xd0, 0xb5, 0xd1, 0x80, 0xd0, 0xb0, 0xd1,
+        0x82, 0xd1, 0x83, 0xd1, 0x80, 0xd0, 0xb0, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64,
+        0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72,
+        0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x69, 0x64,
+        0x3d, 0x22, 0x74, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x22, 0x3e, 0x2d,
+        0x2d, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x63, 0x6c,
+        0x61, 0x73, 0x73, 0x3d, 0x22, 0x75, 0x6e, 0x69, 0x74, 0x22, 0x3e, 0xc2, 0xb0, 0x43, 0x3c, 0x2f,
+        0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76,
+        0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x22, 0x20, 0x69, 0x64, 0x3d,
+        0x22, 0x68, 0x65, 0x61, 0x74, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x22, 0x3e, 0x2d, 0x2d, 0x3c, 0x2f,
+        0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76,
+        0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x63,
+        0x61, 0x72, 0x64, 0x20, 0x63, 0x2d, 0x68, 0x75, 0x6d, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76,
+        0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x6e,
+        0x61, 0x6d, 0x65, 0x22, 0x3e, 0xd0, 0x92, 0xd0, 0xbb, 0xd0, 0xb0, 0xd0, 0xb6, 0xd0, 0xbd, 0xd0,
+        0xbe, 0xd1, 0x81, 0xd1, 0x82, 0xd1, 0x8c, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64,
+        0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72,
+        0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x69, 0x64,
+        0x3d, 0x22, 0x68, 0x75, 0x6d, 0x69, 0x64, 0x69, 0x74, 0x79, 0x22, 0x3e, 0x2d, 0x2d, 0x3c, 0x2f,
+        0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73,
+        0x3d, 0x22, 0x75, 0x6e, 0x69, 0x74, 0x22, 0x3e, 0x25, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e,
+        0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73,
+        0x73, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x64, 0x65, 0x77, 0x50,
+        0x6f, 0x69, 0x6e, 0x74, 0x22, 0x3e, 0x2d, 0x2d, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c,
+        0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73,
+        0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x63, 0x61, 0x72, 0x64, 0x20, 0x63, 0x2d,
+        0x70, 0x72, 0x65, 0x73, 0x73, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61,
+        0x73, 0x73, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+        0x3e, 0xd0, 0x94, 0xd0, 0xb0, 0xd0, 0xb2, 0xd0, 0xbb, 0xd0, 0xb5, 0xd0, 0xbd, 0xd0, 0xb8, 0xd0,
+        0xb5, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61,
+        0x73, 0x73, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65,
+        0x22, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x70, 0x72, 0x65, 0x73,
+        0x73, 0x75, 0x72, 0x65, 0x22, 0x3e, 0x2d, 0x2d, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c,
+        0x73, 0x70, 0x61, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x75, 0x6e, 0x69, 0x74,
+        0x22, 0x3e, 0xd0, 0xbc, 0xd0, 0xbc, 0x20, 0xd1, 0x80, 0xd1, 0x82, 0x2e, 0xd1, 0x81, 0xd1, 0x82,
+        0x2e, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c,
+        0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x22, 0x20,
+        0x69, 0x64, 0x3d, 0x22, 0x70, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x53, 0x65, 0x61, 0x22,
+        0x3e, 0x2d, 0x2d, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63,
+        0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x70,
+        0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x54, 0x72, 0x65, 0x6e, 0x64, 0x22, 0x3e, 0x2d, 0x2d,
+        0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64,
+        0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72,
+        0x2d, 0x63, 0x61, 0x72, 0x64, 0x20, 0x63, 0x2d, 0x70, 0x6d, 0x31, 0x22, 0x3e, 0x0a, 0x3c, 0x64,
+        0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72,
+        0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x50, 0x4d, 0x31, 0x2e, 0x30, 0x3c, 0x2f, 0x64, 0x69,
+        0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73,
+        0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x3e, 0x3c, 0x73, 0x70,
+        0x61, 0x6e, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x70, 0x6d, 0x31, 0x5f, 0x30, 0x22, 0x3e, 0x2d, 0x2d,
+        0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x63, 0x6c, 0x61,
+        0x73, 0x73, 0x3d, 0x22, 0x75, 0x6e, 0x69, 0x74, 0x22, 0x3e, 0xd0, 0xbc, 0xd0, 0xba, 0xd0, 0xb3,
+        0x2f, 0xd0, 0xbc, 0xc2, 0xb3, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x2f, 0x64, 0x69,
+        0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x62,
+        0x61, 0x72, 0x22, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+        0x62, 0x61, 0x72, 0x2d, 0x66, 0x69, 0x6c, 0x6c, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x70, 0x6d,
+        0x31, 0x42, 0x61, 0x72, 0x22, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x2f, 0x64, 0x69,
+        0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63,
+        0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x63, 0x61, 0x72,
+        0x64, 0x20, 0x63, 0x2d, 0x70, 0x6d, 0x32, 0x35, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20,
+        0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x6e, 0x61,
+        0x6d, 0x65, 0x22, 0x3e, 0x50, 0x4d, 0x32, 0x2e, 0x35, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a,
+        0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73,
+        0x6f, 0x72, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20,
+        0x69, 0x64, 0x3d, 0x22, 0x70, 0x6d, 0x32, 0x5f, 0x35, 0x22, 0x3e, 0x2d, 0x2d, 0x3c, 0x2f, 0x73,
+        0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+        0x22, 0x75, 0x6e, 0x69, 0x74, 0x22, 0x3e, 0xd0, 0xbc, 0xd0, 0xba, 0xd0, 0xb3, 0x2f, 0xd0, 0xbc,
+        0xc2, 0xb3, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a,
+        0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x62, 0x61, 0x72, 0x22,
+        0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x62, 0x61, 0x72,
+        0x2d, 0x66, 0x69, 0x6c, 0x6c, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x70, 0x6d, 0x32, 0x35, 0x42,
+        0x61, 0x72, 0x22, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e,
+        0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x75, 0x62,
+        0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x70, 0x6d, 0x32, 0x35, 0x51, 0x75, 0x61, 0x6c, 0x69, 0x74,
+        0x79, 0x22, 0x3e, 0x2d, 0x2d, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69,
+        0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73,
+        0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x63, 0x61, 0x72, 0x64, 0x20, 0x63, 0x2d, 0x70, 0x6d, 0x31,
+        0x30, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+        0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x50, 0x4d, 0x31,
+        0x30, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61,
+        0x73, 0x73, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65,
+        0x22, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x70, 0x6d, 0x31, 0x30,
+        0x22, 0x3e, 0x2d, 0x2d, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e,
+        0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x75, 0x6e, 0x69, 0x74, 0x22, 0x3e, 0xd0, 0xbc,
+        0xd0, 0xba, 0xd0, 0xb3, 0x2f, 0xd0, 0xbc, 0xc2, 0xb3, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e,
+        0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73,
+        0x73, 0x3d, 0x22, 0x62, 0x61, 0x72, 0x22, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61,
+        0x73, 0x73, 0x3d, 0x22, 0x62, 0x61, 0x72, 0x2d, 0x66, 0x69, 0x6c, 0x6c, 0x22, 0x20, 0x69, 0x64,
+        0x3d, 0x22, 0x70, 0x6d, 0x31, 0x30, 0x42, 0x61, 0x72, 0x22, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76,
+        0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c,
+        0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
+        0x0a, 0x3c, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+        0x22, 0x70, 0x61, 0x6e, 0x65, 0x6c, 0x22, 0x3e, 0x0a, 0x3c, 0x68, 0x32, 0x20, 0x63, 0x6c, 0x61,
+        0x73, 0x73, 0x3d, 0x22, 0x70, 0x61, 0x6e, 0x65, 0x6c, 0x2d, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x22,
+        0x3e, 0xd0, 0x9a, 0xd0, 0xbe, 0xd0, 0xbd, 0xd1, 0x86, 0xd0, 0xb5, 0xd0, 0xbd, 0xd1, 0x82, 0xd1,
+        0x80, 0xd0, 0xb0, 0xd1, 0x86, 0xd0, 0xb8, 0xd1, 0x8f, 0x20, 0xd0, 0xb3, 0xd0, 0xb0, 0xd0, 0xb7,
+        0xd0, 0xbe, 0xd0, 0xb2, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63,
+        0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x73, 0x2d, 0x67, 0x72,
+        0x69, 0x64, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+        0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x63, 0x61, 0x72, 0x64, 0x20, 0x63, 0x2d, 0x63,
+        0x6f, 0x32, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+        0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x43, 0x4f,
+        0xe2, 0x82, 0x82, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63,
+        0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x76, 0x61, 0x6c,
+        0x75, 0x65, 0x22, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x63, 0x6f,
+        0x32, 0x22, 0x3e, 0x2d, 0x2d, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x73, 0x70, 0x61,
+        0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x75, 0x6e, 0x69, 0x74, 0x22, 0x3e, 0x70,
+        0x70, 0x6d, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a,
+        0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73,
+        0x73, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x63, 0x61, 0x72, 0x64, 0x20, 0x63,
+        0x2d, 0x63, 0x6f, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73,
+        0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x43,
+        0x4f, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61,
+        0x73, 0x73, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65,
+        0x22, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x63, 0x6f, 0x22, 0x3e,
+        0x2d, 0x2d, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x63,
+        0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x75, 0x6e, 0x69, 0x74, 0x22, 0x3e, 0x70, 0x70, 0x6d, 0x3c,
+        0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64,
+        0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+        0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x63, 0x61, 0x72, 0x64, 0x20, 0x63, 0x2d, 0x6c, 0x70,
+        0x67, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+        0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x4c, 0x50, 0x47,
+        0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73,
+        0x73, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22,
+        0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6c, 0x70, 0x67, 0x22, 0x3e,
+        0x2d, 0x2d, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x63,
+        0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x75, 0x6e, 0x69, 0x74, 0x22, 0x3e, 0x70, 0x70, 0x6d, 0x3c,
+        0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64,
+        0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+        0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x63, 0x61, 0x72, 0x64, 0x20, 0x63, 0x2d, 0x6e, 0x68,
+        0x33, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+        0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x4e, 0x48, 0xe2,
+        0x82, 0x83, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c,
+        0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x76, 0x61, 0x6c, 0x75,
+        0x65, 0x22, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6e, 0x68, 0x33,
+        0x22, 0x3e, 0x2d, 0x2d, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e,
+        0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x75, 0x6e, 0x69, 0x74, 0x22, 0x3e, 0x70, 0x70,
+        0x6d, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c,
+        0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73,
+        0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x63, 0x61, 0x72, 0x64, 0x20, 0x63, 0x2d,
+        0x61, 0x71, 0x69, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73,
+        0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x41,
+        0x51, 0x49, 0x20, 0x28, 0x50, 0x4d, 0x32, 0x2e, 0x35, 0x2f, 0x50, 0x4d, 0x31, 0x30, 0x29, 0x3c,
+        0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73,
+        0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x3e,
+        0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x61, 0x71, 0x69, 0x56, 0x61, 0x6c,
+        0x75, 0x65, 0x22, 0x3e, 0x2d, 0x2d, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x73, 0x70,
+        0x61, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x75, 0x6e, 0x69, 0x74, 0x22, 0x3e,
+        0xd0, 0xb8, 0xd0, 0xbd, 0xd0, 0xb4, 0xd0, 0xb5, 0xd0, 0xba, 0xd1, 0x81, 0x3c, 0x2f, 0x73, 0x70,
+        0x61, 0x6e, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63,
+        0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x61,
+        0x71, 0x69, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x3e, 0xe2, 0x80, 0x94, 0x3c, 0x2f, 0x64, 0x69,
+        0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e,
+        0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x61, 0x69, 0x72,
+        0x2d, 0x73, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x61, 0x69,
+        0x72, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x22, 0x3e, 0x0a, 0x3c, 0x73, 0x70, 0x61, 0x6e,
+        0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x61, 0x69, 0x72, 0x2d, 0x73, 0x75, 0x6d, 0x6d,
+        0x61, 0x72, 0x79, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x3e, 0xd0, 0x9e, 0xd0, 0xb1, 0xd1,
+        0x89, 0xd0, 0xb8, 0xd0, 0xb9, 0x20, 0xd1, 0x83, 0xd1, 0x80, 0xd0, 0xbe, 0xd0, 0xb2, 0xd0, 0xb5,
+        0xd0, 0xbd, 0xd1, 0x8c, 0x20, 0xd0, 0xb7, 0xd0, 0xb0, 0xd0, 0xb3, 0xd1, 0x80, 0xd1, 0x8f, 0xd0,
+        0xb7, 0xd0, 0xbd, 0xd0, 0xb5, 0xd0, 0xbd, 0xd0, 0xb8, 0xd1, 0x8f, 0x3c, 0x2f, 0x73, 0x70, 0x61,
+        0x6e, 0x3e, 0x0a, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+        0x61, 0x69, 0x72, 0x2d, 0x73, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x2d, 0x76, 0x61, 0x6c, 0x75,
+        0x65, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x61, 0x69, 0x72, 0x4c, 0x65, 0x76, 0x65, 0x6c, 0x22,
+        0x3e, 0x2d, 0x2d, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76,
+        0x3e, 0x0a, 0x3c, 0x2f, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x73, 0x65,
+        0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x70, 0x61, 0x6e,
+        0x65, 0x6c, 0x20, 0x63, 0x68, 0x61, 0x72, 0x74, 0x73, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76,
+        0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x68, 0x61, 0x72, 0x74, 0x2d, 0x62, 0x6c,
+        0x6f, 0x63, 0x6b, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73,
+        0x3d, 0x22, 0x63, 0x68, 0x61, 0x72, 0x74, 0x2d, 0x68, 0x65, 0x61, 0x64, 0x22, 0x3e, 0x3c, 0x68,
+        0x32, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x70, 0x61, 0x6e, 0x65, 0x6c, 0x2d, 0x74,
+        0x69, 0x74, 0x6c, 0x65, 0x22, 0x3e, 0xd0, 0xa2, 0xd0, 0xb5, 0xd0, 0xbc, 0xd0, 0xbf, 0xd0, 0xb5,
+        0xd1, 0x80, 0xd0, 0xb0, 0xd1, 0x82, 0xd1, 0x83, 0xd1, 0x80, 0xd0, 0xb0, 0x2c, 0x20, 0xd0, 0xb2,
+        0xd0, 0xbb, 0xd0, 0xb0, 0xd0, 0xb6, 0xd0, 0xbd, 0xd0, 0xbe, 0xd1, 0x81, 0xd1, 0x82, 0xd1, 0x8c,
+        0x2c, 0x20, 0xd0, 0xb4, 0xd0, 0xb0, 0xd0, 0xb2, 0xd0, 0xbb, 0xd0, 0xb5, 0xd0, 0xbd, 0xd0, 0xb8,
+        0xd0, 0xb5, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64,
+        0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x68, 0x61, 0x72, 0x74, 0x2d,
+        0x77, 0x72, 0x61, 0x70, 0x70, 0x65, 0x72, 0x22, 0x3e, 0x3c, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x73,
+        0x20, 0x69, 0x64, 0x3d, 0x22, 0x74, 0x65, 0x6d, 0x70, 0x48, 0x75, 0x6d, 0x43, 0x68, 0x61, 0x72,
+        0x74, 0x22, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x36, 0x30, 0x30, 0x22, 0x20, 0x68,
+        0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x32, 0x36, 0x30, 0x22, 0x3e, 0x3c, 0x2f, 0x63, 0x61,
+        0x6e, 0x76, 0x61, 0x73, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69,
+        0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63,
+        0x68, 0x61, 0x72, 0x74, 0x2d, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69,
+        0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x68, 0x61, 0x72, 0x74, 0x2d, 0x68,
+        0x65, 0x61, 0x64, 0x22, 0x3e, 0x3c, 0x68, 0x32, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+        0x70, 0x61, 0x6e, 0x65, 0x6c, 0x2d, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x22, 0x3e, 0xd0, 0x93, 0xd0,
+        0xb0, 0xd0, 0xb7, 0xd1, 0x8b, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e,
+        0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x68, 0x61,
+        0x72, 0x74, 0x2d, 0x77, 0x72, 0x61, 0x70, 0x70, 0x65, 0x72, 0x22, 0x3e, 0x3c, 0x63, 0x61, 0x6e,
+        0x76, 0x61, 0x73, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x67, 0x61, 0x73, 0x43, 0x68, 0x61, 0x72, 0x74,
+        0x22, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x36, 0x30, 0x30, 0x22, 0x20, 0x68, 0x65,
+        0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x32, 0x36, 0x30, 0x22, 0x3e, 0x3c, 0x2f, 0x63, 0x61, 0x6e,
+        0x76, 0x61, 0x73, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76,
+        0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x68,
+        0x61, 0x72, 0x74, 0x2d, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x63, 0x68, 0x61, 0x72, 0x74, 0x2d,
+        0x66, 0x75, 0x6c, 0x6c, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73,
+        0x73, 0x3d, 0x22, 0x63, 0x68, 0x61, 0x72, 0x74, 0x2d, 0x68, 0x65, 0x61, 0x64, 0x22, 0x3e, 0x3c,
+        0x68, 0x32, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x70, 0x61, 0x6e, 0x65, 0x6c, 0x2d,
+        0x74, 0x69, 0x74, 0x6c, 0x65, 0x22, 0x3e, 0xd0, 0x92, 0xd0, 0xb7, 0xd0, 0xb2, 0xd0, 0xb5, 0xd1,
+        0x88, 0xd0, 0xb5, 0xd0, 0xbd, 0xd0, 0xbd, 0xd1, 0x8b, 0xd0, 0xb5, 0x20, 0xd1, 0x87, 0xd0, 0xb0,
+        0xd1, 0x81, 0xd1, 0x82, 0xd0, 0xb8, 0xd1, 0x86, 0xd1, 0x8b, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x3c,
+        0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73,
+        0x3d, 0x22, 0x63, 0x68, 0x61, 0x72, 0x74, 0x2d, 0x77, 0x72, 0x61, 0x70, 0x70, 0x65, 0x72, 0x22,
+        0x3e, 0x3c, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x64, 0x75, 0x73,
+        0x74, 0x43, 0x68, 0x61, 0x72, 0x74, 0x22, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x36,
+        0x30, 0x30, 0x22, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x32, 0x36, 0x30, 0x22,
+        0x3e, 0x3c, 0x2f, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e,
+        0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f,
+        0x6e, 0x3e, 0x0a, 0x3c, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73,
+        0x73, 0x3d, 0x22, 0x70, 0x61, 0x6e, 0x65, 0x6c, 0x20, 0x74, 0x77, 0x6f, 0x2d, 0x63, 0x6f, 0x6c,
+        0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x68, 0x32, 0x20, 0x63, 0x6c, 0x61,
+        0x73, 0x73, 0x3d, 0x22, 0x70, 0x61, 0x6e, 0x65, 0x6c, 0x2d, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x22,
+        0x3e, 0xd0, 0xa1, 0xd0, 0xbe, 0xd1, 0x81, 0xd1, 0x82, 0xd0, 0xbe, 0xd1, 0x8f, 0xd0, 0xbd, 0xd0,
+        0xb8, 0xd0, 0xb5, 0x20, 0xd1, 0x81, 0xd0, 0xb8, 0xd1, 0x81, 0xd1, 0x82, 0xd0, 0xb5, 0xd0, 0xbc,
+        0xd1, 0x8b, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61,
+        0x73, 0x73, 0x3d, 0x22, 0x69, 0x6e, 0x66, 0x6f, 0x2d, 0x67, 0x72, 0x69, 0x64, 0x22, 0x3e, 0x0a,
+        0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x69, 0x6e, 0x66, 0x6f,
+        0x2d, 0x69, 0x74, 0x65, 0x6d, 0x22, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x63, 0x6c, 0x61,
+        0x73, 0x73, 0x3d, 0x22, 0x69, 0x6e, 0x66, 0x6f, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x3e,
+        0xd0, 0x9f, 0xd0, 0xbe, 0xd1, 0x81, 0xd0, 0xbb, 0xd0, 0xb5, 0xd0, 0xb4, 0xd0, 0xbd, 0xd0, 0xb5,
+        0xd0, 0xb5, 0x20, 0xd0, 0xbe, 0xd0, 0xb1, 0xd0, 0xbd, 0xd0, 0xbe, 0xd0, 0xb2, 0xd0, 0xbb, 0xd0,
+        0xb5, 0xd0, 0xbd, 0xd0, 0xb8, 0xd0, 0xb5, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x73,
+        0x70, 0x61, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x69, 0x6e, 0x66, 0x6f, 0x2d,
+        0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6c, 0x61, 0x73, 0x74, 0x55,
+        0x70, 0x64, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x2d, 0x2d, 0x3a, 0x2d, 0x2d, 0x3a, 0x2d, 0x2d, 0x3c,
+        0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69,
+        0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x69, 0x6e, 0x66, 0x6f, 0x2d, 0x69, 0x74,
+        0x65, 0x6d, 0x22, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+        0x22, 0x69, 0x6e, 0x66, 0x6f, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x3e, 0xd0, 0xa1, 0xd0,
+        0xbb, 0xd0, 0xb5, 0xd0, 0xb4, 0xd1, 0x83, 0xd1, 0x8e, 0xd1, 0x89, 0xd0, 0xb5, 0xd0, 0xb5, 0x20,
+        0xd0, 0xbe, 0xd0, 0xb1, 0xd0, 0xbd, 0xd0, 0xbe, 0xd0, 0xb2, 0xd0, 0xbb, 0xd0, 0xb5, 0xd0, 0xbd,
+        0xd0, 0xb8, 0xd0, 0xb5, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e,
+        0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x69, 0x6e, 0x66, 0x6f, 0x2d, 0x76, 0x61, 0x6c,
+        0x75, 0x65, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6e, 0x65, 0x78, 0x74, 0x55, 0x70, 0x64, 0x61,
+        0x74, 0x65, 0x22, 0x3e, 0xe2, 0x80, 0x94, 0x20, 0xd1, 0x81, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e,
+        0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61,
+        0x73, 0x73, 0x3d, 0x22, 0x69, 0x6e, 0x66, 0x6f, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x22, 0x3e, 0x3c,
+        0x73, 0x70, 0x61, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x69, 0x6e, 0x66, 0x6f,
+        0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x3e, 0xd0, 0x94, 0xd0, 0xb0, 0xd1, 0x82, 0xd1, 0x87,
+        0xd0, 0xb8, 0xd0, 0xba, 0x20, 0x44, 0x48, 0x54, 0x32, 0x32, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e,
+        0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x69, 0x6e,
+        0x66, 0x6f, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x64, 0x68,
+        0x74, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x22, 0x3e, 0x2d, 0x2d, 0x3c, 0x2f, 0x73, 0x70, 0x61,
+        0x6e, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c,
+        0x61, 0x73, 0x73, 0x3d, 0x22, 0x69, 0x6e, 0x66, 0x6f, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x22, 0x3e,
+        0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x69, 0x6e, 0x66,
+        0x6f, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x3e, 0xd0, 0x94, 0xd0, 0xb0, 0xd1, 0x82, 0xd1,
+        0x87, 0xd0, 0xb8, 0xd0, 0xba, 0x20, 0x4d, 0x51, 0x2d, 0x31, 0x33, 0x35, 0x3c, 0x2f, 0x73, 0x70,
+        0x61, 0x6e, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+        0x69, 0x6e, 0x66, 0x6f, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22,
+        0x6d, 0x71, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x22, 0x3e, 0x2d, 0x2d, 0x3c, 0x2f, 0x73, 0x70,
+        0x61, 0x6e, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63,
+        0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x69, 0x6e, 0x66, 0x6f, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x22,
+        0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x69, 0x6e,
+        0x66, 0x6f, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x3e, 0xd0, 0x94, 0xd0, 0xb0, 0xd1, 0x82,
+        0xd1, 0x87, 0xd0, 0xb8, 0xd0, 0xba, 0x20, 0x50, 0x4d, 0x53, 0x35, 0x30, 0x30, 0x33, 0x3c, 0x2f,
+        0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73,
+        0x3d, 0x22, 0x69, 0x6e, 0x66, 0x6f, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x20, 0x69, 0x64,
+        0x3d, 0x22, 0x70, 0x6d, 0x73, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x22, 0x3e, 0x2d, 0x2d, 0x3c,
+        0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69,
+        0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x69, 0x6e, 0x66, 0x6f, 0x2d, 0x69, 0x74,
+        0x65, 0x6d, 0x22, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+        0x22, 0x69, 0x6e, 0x66, 0x6f, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x3e, 0xd0, 0x92, 0xd1,
+        0x81, 0xd0, 0xb5, 0xd0, 0xb3, 0xd0, 0xbe, 0x20, 0xd0, 0xbe, 0xd0, 0xb1, 0xd0, 0xbd, 0xd0, 0xbe,
+        0xd0, 0xb2, 0xd0, 0xbb, 0xd0, 0xb5, 0xd0, 0xbd, 0xd0, 0xb8, 0xd0, 0xb9, 0x3c, 0x2f, 0x73, 0x70,
+        0x61, 0x6e, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+        0x69, 0x6e, 0x66, 0x6f, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22,
+        0x74, 0x6f, 0x74, 0x61, 0x6c, 0x55, 0x70, 0x64, 0x61, 0x74, 0x65, 0x73, 0x22, 0x3e, 0x30, 0x3c,
+        0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69,
+        0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x69, 0x6e, 0x66, 0x6f, 0x2d, 0x69, 0x74,
+        0x65, 0x6d, 0x22, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+        0x22, 0x69, 0x6e, 0x66, 0x6f, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x3e, 0xd0, 0x92, 0xd1,
+        0x80, 0xd0, 0xb5, 0xd0, 0xbc, 0xd1, 0x8f, 0x20, 0xd1, 0x80, 0xd0, 0xb0, 0xd0, 0xb1, 0xd0, 0xbe,
+        0xd1, 0x82, 0xd1, 0x8b, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e,
+        0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x69, 0x6e, 0x66, 0x6f, 0x2d, 0x76, 0x61, 0x6c,
+        0x75, 0x65, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x75, 0x70, 0x74, 0x69, 0x6d, 0x65, 0x22, 0x3e,
+        0x30, 0x30, 0x3a, 0x30, 0x30, 0x3a, 0x30, 0x30, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c,
+        0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64,
+        0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x68, 0x32, 0x20, 0x63, 0x6c,
+        0x61, 0x73, 0x73, 0x3d, 0x22, 0x70, 0x61, 0x6e, 0x65, 0x6c, 0x2d, 0x74, 0x69, 0x74, 0x6c, 0x65,
+        0x22, 0x3e, 0xd0, 0xa3, 0xd0, 0xbf, 0xd1, 0x80, 0xd0, 0xb0, 0xd0, 0xb2, 0xd0, 0xbb, 0xd0, 0xb5,
+        0xd0, 0xbd, 0xd0, 0xb8, 0xd0, 0xb5, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76,
+        0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x73,
+        0x22, 0x3e, 0x0a, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x72,
+        0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x42, 0x74, 0x6e, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73,
+        0x3d, 0x22, 0x62, 0x74, 0x6e, 0x22, 0x3e, 0xd0, 0x9e, 0xd0, 0xb1, 0xd0, 0xbd, 0xd0, 0xbe, 0xd0,
+        0xb2, 0xd0, 0xb8, 0xd1, 0x82, 0xd1, 0x8c, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e,
+        0x0a, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x70, 0x61, 0x75,
+        0x73, 0x65, 0x42, 0x74, 0x6e, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x62, 0x74,
+        0x6e, 0x22, 0x3e, 0xd0, 0x9f, 0xd0, 0xb0, 0xd1, 0x83, 0xd0, 0xb7, 0xd0, 0xb0, 0x3c, 0x2f, 0x62,
+        0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x69,
+        0x64, 0x3d, 0x22, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x42, 0x74, 0x6e, 0x22, 0x20, 0x63, 0x6c, 0x61,
+        0x73, 0x73, 0x3d, 0x22, 0x62, 0x74, 0x6e, 0x22, 0x3e, 0xd0, 0x9e, 0xd1, 0x87, 0xd0, 0xb8, 0xd1,
+        0x81, 0xd1, 0x82, 0xd0, 0xb8, 0xd1, 0x82, 0xd1, 0x8c, 0x20, 0xd0, 0xb3, 0xd1, 0x80, 0xd0, 0xb0,
+        0xd1, 0x84, 0xd0, 0xb8, 0xd0, 0xba, 0xd0, 0xb8, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e,
+        0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c,
+        0x61, 0x73, 0x73, 0x3d, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x22, 0x3e, 0x0a, 0x3c, 0x6c, 0x61,
+        0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x49,
+        0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x22, 0x3e, 0xd0, 0x98, 0xd0, 0xbd, 0xd1, 0x82, 0xd0,
+        0xb5, 0xd1, 0x80, 0xd0, 0xb2, 0xd0, 0xb0, 0xd0, 0xbb, 0x20, 0xd0, 0xbe, 0xd0, 0xb1, 0xd0, 0xbd,
+        0xd0, 0xbe, 0xd0, 0xb2, 0xd0, 0xbb, 0xd0, 0xb5, 0xd0, 0xbd, 0xd0, 0xb8, 0xd1, 0x8f, 0x3a, 0x20,
+        0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x76,
+        0x61, 0x6c, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x3e, 0x35, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e,
+        0x3e, 0x20, 0xd1, 0x81, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x3c, 0x69, 0x6e,
+        0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x22,
+        0x20, 0x69, 0x64, 0x3d, 0x22, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x49, 0x6e, 0x74, 0x65, 0x72,
+        0x76, 0x61, 0x6c, 0x22, 0x20, 0x6d, 0x69, 0x6e, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x6d, 0x61, 0x78,
+        0x3d, 0x22, 0x33, 0x30, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x35, 0x22, 0x3e,
+        0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x63,
+        0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22, 0x3e,
+        0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x63, 0x68,
+        0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x61, 0x75, 0x74, 0x6f,
+        0x52, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x22, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64,
+        0x3e, 0x0a, 0xd0, 0x90, 0xd0, 0xb2, 0xd1, 0x82, 0xd0, 0xbe, 0xd0, 0xbc, 0xd0, 0xb0, 0xd1, 0x82,
+        0xd0, 0xb8, 0xd1, 0x87, 0xd0, 0xb5, 0xd1, 0x81, 0xd0, 0xba, 0xd0, 0xbe, 0xd0, 0xb5, 0x20, 0xd0,
+        0xbe, 0xd0, 0xb1, 0xd0, 0xbd, 0xd0, 0xbe, 0xd0, 0xb2, 0xd0, 0xbb, 0xd0, 0xb5, 0xd0, 0xbd, 0xd0,
+        0xb8, 0xd0, 0xb5, 0x0a, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x3c, 0x2f, 0x64,
+        0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c,
+        0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x70,
+        0x61, 0x6e, 0x65, 0x6c, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73,
+        0x73, 0x3d, 0x22, 0x6c, 0x6f, 0x67, 0x2d, 0x68, 0x65, 0x61, 0x64, 0x22, 0x3e, 0x0a, 0x3c, 0x68,
+        0x32, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x70, 0x61, 0x6e, 0x65, 0x6c, 0x2d, 0x74,
+        0x69, 0x74, 0x6c, 0x65, 0x22, 0x3e, 0xd0, 0x96, 0xd1, 0x83, 0xd1, 0x80, 0xd0, 0xbd, 0xd0, 0xb0,
+        0xd0, 0xbb, 0x20, 0xd1, 0x81, 0xd0, 0xbe, 0xd0, 0xb1, 0xd1, 0x8b, 0xd1, 0x82, 0xd0, 0xb8, 0xd0,
+        0xb9, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x0a, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x69,
+        0x64, 0x3d, 0x22, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x4c, 0x6f, 0x67, 0x22, 0x20, 0x63, 0x6c, 0x61,
+        0x73, 0x73, 0x3d, 0x22, 0x62, 0x74, 0x6e, 0x20, 0x62, 0x74, 0x6e, 0x2d, 0x73, 0x6d, 0x61, 0x6c,
+        0x6c, 0x22, 0x3e, 0xd0, 0x9e, 0xd1, 0x87, 0xd0, 0xb8, 0xd1, 0x81, 0xd1, 0x82, 0xd0, 0xb8, 0xd1,
+        0x82, 0xd1, 0x8c, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x2f, 0x64,
+        0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+        0x6c, 0x6f, 0x67, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x6f,
+        0x67, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+        0x6c, 0x6f, 0x67, 0x2d, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x22, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e,
+        0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x6c, 0x6f, 0x67, 0x2d, 0x74, 0x69, 0x6d, 0x65,
+        0x22, 0x3e, 0x5b, 0x2d, 0x2d, 0x3a, 0x2d, 0x2d, 0x3a, 0x2d, 0x2d, 0x5d, 0x3c, 0x2f, 0x73, 0x70,
+        0x61, 0x6e, 0x3e, 0x20, 0xd0, 0xa1, 0xd0, 0xb8, 0xd1, 0x81, 0xd1, 0x82, 0xd0, 0xb5, 0xd0, 0xbc,
+        0xd0, 0xb0, 0x20, 0xd0, 0xb7, 0xd0, 0xb0, 0xd0, 0xbf, 0xd1, 0x83, 0xd1, 0x89, 0xd0, 0xb5, 0xd0,
+        0xbd, 0xd0, 0xb0, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e,
+        0x0a, 0x3c, 0x2f, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69,
+        0x76, 0x3e, 0x0a, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+        0x20, 0x43, 0x48, 0x41, 0x52, 0x54, 0x5f, 0x53, 0x54, 0x45, 0x50, 0x5f, 0x50, 0x58, 0x3d, 0x32,
+        0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x48, 0x49, 0x53, 0x54, 0x4f, 0x52, 0x59, 0x5f, 0x53,
+        0x50, 0x41, 0x4e, 0x5f, 0x53, 0x3d, 0x32, 0x34, 0x2a, 0x33, 0x36, 0x30, 0x30, 0x3b, 0x63, 0x6f,
+        0x6e, 0x73, 0x74, 0x20, 0x52, 0x45, 0x43, 0x4f, 0x52, 0x44, 0x5f, 0x53, 0x49, 0x5a, 0x45, 0x3d,
+        0x31, 0x39, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x46, 0x5f, 0x44, 0x48, 0x54, 0x3d, 0x31,
+        0x2c, 0x46, 0x5f, 0x42, 0x4d, 0x50, 0x3d, 0x32, 0x2c, 0x46, 0x5f, 0x47, 0x41, 0x53, 0x3d, 0x34,
+        0x2c, 0x46, 0x5f, 0x50, 0x4d, 0x53, 0x3d, 0x38, 0x3b, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x20, 0x53,
+        0x65, 0x72, 0x69, 0x65, 0x73, 0x52, 0x69, 0x6e, 0x67, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x72,
+        0x75, 0x63, 0x74, 0x6f, 0x72, 0x28, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x29, 0x7b,
+        0x74, 0x68, 0x69, 0x73, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x3d, 0x6e, 0x65, 0x77, 0x20,
+        0x46, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x32, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x63, 0x61, 0x70,
+        0x61, 0x63, 0x69, 0x74, 0x79, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x61, 0x70, 0x61,
+        0x63, 0x69, 0x74, 0x79, 0x3d, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3b, 0x74, 0x68,
+        0x69, 0x73, 0x2e, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x28, 0x29, 0x3b, 0x7d, 0x0a, 0x63, 0x6c, 0x65,
+        0x61, 0x72, 0x28, 0x29, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x74, 0x61, 0x72, 0x74, 0x3d,
+        0x30, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3d, 0x30, 0x3b,
+        0x74, 0x68, 0x69, 0x73, 0x2e, 0x6d, 0x69, 0x6e, 0x3d, 0x49, 0x6e, 0x66, 0x69, 0x6e, 0x69, 0x74,
+        0x79, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x6d, 0x61, 0x78, 0x3d, 0x2d, 0x49, 0x6e, 0x66, 0x69,
+        0x6e, 0x69, 0x74, 0x79, 0x3b, 0x7d, 0x0a, 0x61, 0x74, 0x28, 0x69, 0x29, 0x7b, 0x72, 0x65, 0x74,
+        0x75, 0x72, 0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x5b,
+        0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x74, 0x61, 0x72, 0x74, 0x2b, 0x69, 0x29, 0x25, 0x74,
+        0x68, 0x69, 0x73, 0x2e, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x5d, 0x3b, 0x7d, 0x0a,
+        0x70, 0x75, 0x73, 0x68, 0x28, 0x76, 0x29, 0x7b, 0x76, 0x3d, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x66,
+        0x72, 0x6f, 0x75, 0x6e, 0x64, 0x28, 0x76, 0x29, 0x3b, 0x6c, 0x65, 0x74, 0x20, 0x65, 0x76, 0x69,
+        0x63, 0x74, 0x65, 0x64, 0x3d, 0x4e, 0x61, 0x4e, 0x3b, 0x69, 0x66, 0x28, 0x74, 0x68, 0x69, 0x73,
+        0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x61, 0x70,
+        0x61, 0x63, 0x69, 0x74, 0x79, 0x29, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x76, 0x61, 0x6c, 0x75,
+        0x65, 0x73, 0x5b, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x74, 0x61, 0x72, 0x74, 0x2b, 0x74,
+        0x68, 0x69, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x2b, 0x2b, 0x29, 0x25, 0x74, 0x68,
+        0x69, 0x73, 0x2e, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x5d, 0x3d, 0x76, 0x3b, 0x7d,
+        0x65, 0x6c, 0x73, 0x65, 0x7b, 0x65, 0x76, 0x69, 0x63, 0x74, 0x65, 0x64, 0x3d, 0x74, 0x68, 0x69,
+        0x73, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x5b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x74,
+        0x61, 0x72, 0x74, 0x5d, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73,
+        0x5b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5d, 0x3d, 0x76, 0x3b, 0x74,
+        0x68, 0x69, 0x73, 0x2e, 0x73, 0x74, 0x61, 0x72, 0x74, 0x3d, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e,
+        0x73, 0x74, 0x61, 0x72, 0x74, 0x2b, 0x31, 0x29, 0x25, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x61,
+        0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3b, 0x7d, 0x0a, 0x69, 0x66, 0x28, 0x65, 0x76, 0x69, 0x63,
+        0x74, 0x65, 0x64, 0x3d, 0x3d, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x6d, 0x69, 0x6e, 0x7c, 0x7c,
+        0x65, 0x76, 0x69, 0x63, 0x74, 0x65, 0x64, 0x3d, 0x3d, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x6d,
+        0x61, 0x78, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x72,
+        0x65, 0x73, 0x63, 0x61, 0x6e, 0x28, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x76, 0x3c, 0x74, 0x68, 0x69,
+        0x73, 0x2e, 0x6d, 0x69, 0x6e, 0x7c, 0x7c, 0x76, 0x3e, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x6d, 0x61,
+        0x78, 0x29, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x6d, 0x69, 0x6e, 0x3d, 0x4d, 0x61, 0x74, 0x68,
+        0x2e, 0x6d, 0x69, 0x6e, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x6d, 0x69, 0x6e, 0x2c, 0x76, 0x29,
+        0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x6d, 0x61, 0x78, 0x3d, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x6d,
+        0x61, 0x78, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x6d, 0x61, 0x78, 0x2c, 0x76, 0x29, 0x3b, 0x72,
+        0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3b, 0x7d, 0x0a, 0x72, 0x65, 0x74,
+        0x75, 0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x7d, 0x0a, 0x72, 0x65, 0x73, 0x63,
+        0x61, 0x6e, 0x28, 0x29, 0x7b, 0x6c, 0x65, 0x74, 0x20, 0x6d, 0x69, 0x6e, 0x3d, 0x49, 0x6e, 0x66,
+        0x69, 0x6e, 0x69, 0x74, 0x79, 0x2c, 0x6d, 0x61, 0x78, 0x3d, 0x2d, 0x49, 0x6e, 0x66, 0x69, 0x6e,
+        0x69, 0x74, 0x79, 0x3b, 0x66, 0x6f, 0x72, 0x28, 0x6c, 0x65, 0x74, 0x20, 0x69, 0x3d, 0x30, 0x3b,
+        0x69, 0x3c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x69, 0x2b,
+        0x2b, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x76, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e,
+        0x61, 0x74, 0x28, 0x69, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x76, 0x3c, 0x6d, 0x69, 0x6e, 0x29, 0x6d,
+        0x69, 0x6e, 0x3d, 0x76, 0x3b, 0x69, 0x66, 0x28, 0x76, 0x3e, 0x6d, 0x61, 0x78, 0x29, 0x6d, 0x61,
+        0x78, 0x3d, 0x76, 0x3b, 0x7d, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x6e,
+        0x67, 0x65, 0x64, 0x3d, 0x6d, 0x69, 0x6e, 0x21, 0x3d, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x6d,
+        0x69, 0x6e, 0x7c, 0x7c, 0x6d, 0x61, 0x78, 0x21, 0x3d, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x6d,
+        0x61, 0x78, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x6d, 0x69, 0x6e, 0x3d, 0x6d, 0x69, 0x6e, 0x3b,
+        0x74, 0x68, 0x69, 0x73, 0x2e, 0x6d, 0x61, 0x78, 0x3d, 0x6d, 0x61, 0x78, 0x3b, 0x72, 0x65, 0x74,
+        0x75, 0x72, 0x6e, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x3b, 0x7d, 0x7d, 0x0a, 0x63,
+        0x6c, 0x61, 0x73, 0x73, 0x20, 0x4c, 0x69, 0x6e, 0x65, 0x43, 0x68, 0x61, 0x72, 0x74, 0x7b, 0x63,
+        0x6f, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6f, 0x72, 0x28, 0x63, 0x61, 0x6e, 0x76, 0x61,
+        0x73, 0x2c, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x29, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63,
+        0x61, 0x6e, 0x76, 0x61, 0x73, 0x3d, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x3b, 0x74, 0x68, 0x69,
+        0x73, 0x2e, 0x63, 0x74, 0x78, 0x3d, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x2e, 0x67, 0x65, 0x74,
+        0x43, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x28, 0x27, 0x32, 0x64, 0x27, 0x29, 0x3b, 0x74, 0x68,
+        0x69, 0x73, 0x2e, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x2e,
+        0x77, 0x69, 0x64, 0x74, 0x68, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x68, 0x65, 0x69, 0x67, 0x68,
+        0x74, 0x3d, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x2e, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3b,
+        0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x3d, 0x73, 0x65, 0x72, 0x69,
+        0x65, 0x73, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79,
+        0x3d, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x28, 0x74, 0x68, 0x69, 0x73,
+        0x2e, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2f, 0x43, 0x48, 0x41, 0x52, 0x54, 0x5f, 0x53, 0x54, 0x45,
+        0x50, 0x5f, 0x50, 0x58, 0x29, 0x2b, 0x31, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x72, 0x69, 0x6e,
+        0x67, 0x73, 0x3d, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x2e, 0x6d, 0x61, 0x70, 0x28, 0x28, 0x29,
+        0x3d, 0x3e, 0x6e, 0x65, 0x77, 0x20, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x52, 0x69, 0x6e, 0x67,
+        0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x29, 0x29,
+        0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x73, 0x3d, 0x73, 0x65, 0x72,
+        0x69, 0x65, 0x73, 0x2e, 0x6d, 0x61, 0x70, 0x28, 0x28, 0x29, 0x3d, 0x3e, 0x28, 0x7b, 0x6c, 0x6f,
+        0x3a, 0x30, 0x2c, 0x68, 0x69, 0x3a, 0x31, 0x7d, 0x29, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e,
+        0x68, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3d, 0x30, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x61,
+        0x64, 0x64, 0x4c, 0x65, 0x67, 0x65, 0x6e, 0x64, 0x28, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e,
+        0x72, 0x65, 0x64, 0x72, 0x61, 0x77, 0x28, 0x29, 0x3b, 0x7d, 0x0a, 0x61, 0x64, 0x64, 0x4c, 0x65,
+        0x67, 0x65, 0x6e, 0x64, 0x28, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x68, 0x65, 0x61,
+        0x64, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x2e, 0x63, 0x6c,
+        0x6f, 0x73, 0x65, 0x73, 0x74, 0x28, 0x27, 0x2e, 0x63, 0x68, 0x61, 0x72, 0x74, 0x2d, 0x62, 0x6c,
+        0x6f, 0x63, 0x6b, 0x27, 0x29, 0x3f, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6c, 0x65,
+        0x63, 0x74, 0x6f, 0x72, 0x28, 0x27, 0x2e, 0x63, 0x68, 0x61, 0x72, 0x74, 0x2d, 0x68, 0x65, 0x61,
+        0x64, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x21, 0x68, 0x65, 0x61, 0x64, 0x29, 0x72, 0x65, 0x74,
+        0x75, 0x72, 0x6e, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6c, 0x65, 0x67, 0x65, 0x6e, 0x64,
+        0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65,
+        0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x27, 0x64, 0x69, 0x76, 0x27, 0x29, 0x3b, 0x6c,
+        0x65, 0x67, 0x65, 0x6e, 0x64, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+        0x27, 0x63, 0x68, 0x61, 0x72, 0x74, 0x2d, 0x6c, 0x65, 0x67, 0x65, 0x6e, 0x64, 0x27, 0x3b, 0x74,
+        0x68, 0x69, 0x73, 0x2e, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61,
+        0x63, 0x68, 0x28, 0x73, 0x3d, 0x3e, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x69, 0x74, 0x65,
+        0x6d, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74,
+        0x65, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x27, 0x73, 0x70, 0x61, 0x6e, 0x27, 0x29,
+        0x3b, 0x69, 0x74, 0x65, 0x6d, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
+        0x74, 0x3d, 0x73, 0x2e, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3b, 0x69, 0x74, 0x65, 0x6d, 0x2e, 0x73,
+        0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d, 0x73, 0x2e, 0x63, 0x6f, 0x6c,
+        0x6f, 0x72, 0x3b, 0x6c, 0x65, 0x67, 0x65, 0x6e, 0x64, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64,
+        0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x69, 0x74, 0x65, 0x6d, 0x29, 0x3b, 0x7d, 0x29, 0x3b, 0x68,
+        0x65, 0x61, 0x64, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x28,
+        0x6c, 0x65, 0x67, 0x65, 0x6e, 0x64, 0x29, 0x3b, 0x7d, 0x0a, 0x67, 0x65, 0x74, 0x20, 0x6c, 0x65,
+        0x6e, 0x67, 0x74, 0x68, 0x28, 0x29, 0x7b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x74, 0x68,
+        0x69, 0x73, 0x2e, 0x72, 0x69, 0x6e, 0x67, 0x73, 0x5b, 0x30, 0x5d, 0x2e, 0x6c, 0x65, 0x6e, 0x67,
+        0x74, 0x68, 0x3b, 0x7d, 0x0a, 0x78, 0x28, 0x69, 0x29, 0x7b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+        0x20, 0x69, 0x2a, 0x43, 0x48, 0x41, 0x52, 0x54, 0x5f, 0x53, 0x54, 0x45, 0x50, 0x5f, 0x50, 0x58,
+        0x3b, 0x7d, 0x0a, 0x79, 0x28, 0x6b, 0x2c, 0x76, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+        0x73, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x73, 0x5b, 0x6b, 0x5d,
+        0x3b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x68, 0x65, 0x69,
+        0x67, 0x68, 0x74, 0x2d, 0x28, 0x76, 0x2d, 0x73, 0x2e, 0x6c, 0x6f, 0x29, 0x2f, 0x28, 0x73, 0x2e,
+        0x68, 0x69, 0x2d, 0x73, 0x2e, 0x6c, 0x6f, 0x29, 0x2a, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x68, 0x65,
+        0x69, 0x67, 0x68, 0x74, 0x3b, 0x7d, 0x0a, 0x66, 0x69, 0x74, 0x28, 0x6b, 0x29, 0x7b, 0x63, 0x6f,
+        0x6e, 0x73, 0x74, 0x20, 0x72, 0x69, 0x6e, 0x67, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x72, 0x69,
+        0x6e, 0x67, 0x73, 0x5b, 0x6b, 0x5d, 0x2c, 0x73, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x63,
+        0x61, 0x6c, 0x65, 0x73, 0x5b, 0x6b, 0x5d, 0x3b, 0x69, 0x66, 0x28, 0x72, 0x69, 0x6e, 0x67, 0x2e,
+        0x6d, 0x69, 0x6e, 0x3e, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x6d, 0x61, 0x78, 0x29, 0x72, 0x65, 0x74,
+        0x75, 0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+        0x72, 0x61, 0x6e, 0x67, 0x65, 0x3d, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x6d, 0x61, 0x78, 0x2d, 0x72,
+        0x69, 0x6e, 0x67, 0x2e, 0x6d, 0x69, 0x6e, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x70, 0x61,
+        0x64, 0x3d, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x2a, 0x30, 0x2e, 0x31, 0x7c, 0x7c, 0x4d, 0x61, 0x74,
+        0x68, 0x2e, 0x61, 0x62, 0x73, 0x28, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x6d, 0x61, 0x78, 0x29, 0x2a,
+        0x30, 0x2e, 0x30, 0x35, 0x7c, 0x7c, 0x31, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x69, 0x6e,
+        0x73, 0x69, 0x64, 0x65, 0x3d, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x6d, 0x69, 0x6e, 0x3e, 0x3d, 0x73,
+        0x2e, 0x6c, 0x6f, 0x26, 0x26, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x6d, 0x61, 0x78, 0x3c, 0x3d, 0x73,
+        0x2e, 0x68, 0x69, 0x3b, 0x69, 0x66, 0x28, 0x69, 0x6e, 0x73, 0x69, 0x64, 0x65, 0x26, 0x26, 0x73,
+        0x2e, 0x68, 0x69, 0x2d, 0x73, 0x2e, 0x6c, 0x6f, 0x3c, 0x3d, 0x32, 0x2a, 0x28, 0x72, 0x61, 0x6e,
+        0x67, 0x65, 0x2b, 0x32, 0x2a, 0x70, 0x61, 0x64, 0x29, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+        0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x73, 0x2e, 0x6c, 0x6f, 0x3d, 0x72, 0x69, 0x6e, 0x67,
+        0x2e, 0x6d, 0x69, 0x6e, 0x2d, 0x70, 0x61, 0x64, 0x3b, 0x73, 0x2e, 0x68, 0x69, 0x3d, 0x72, 0x69,
+        0x6e, 0x67, 0x2e, 0x6d, 0x61, 0x78, 0x2b, 0x70, 0x61, 0x64, 0x3b, 0x72, 0x65, 0x74, 0x75, 0x72,
+        0x6e, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3b, 0x7d, 0x0a, 0x6d, 0x61, 0x72, 0x6b, 0x48, 0x69, 0x73,
+        0x74, 0x6f, 0x72, 0x79, 0x28, 0x29, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x68, 0x69, 0x73, 0x74,
+        0x6f, 0x72, 0x79, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b,
+        0x7d, 0x0a, 0x70, 0x75, 0x73, 0x68, 0x28, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x2c, 0x64, 0x72,
+        0x61, 0x77, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x66,
+        0x75, 0x6c, 0x6c, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3d,
+        0x3d, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3b,
+        0x69, 0x66, 0x28, 0x66, 0x75, 0x6c, 0x6c, 0x26, 0x26, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x68, 0x69,
+        0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x30, 0x29, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x68, 0x69, 0x73,
+        0x74, 0x6f, 0x72, 0x79, 0x2d, 0x2d, 0x3b, 0x6c, 0x65, 0x74, 0x20, 0x72, 0x65, 0x73, 0x63, 0x61,
+        0x6c, 0x65, 0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x65,
+        0x72, 0x69, 0x65, 0x73, 0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x28, 0x73, 0x2c,
+        0x6b, 0x29, 0x3d, 0x3e, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x76, 0x3d, 0x76, 0x61, 0x6c,
+        0x75, 0x65, 0x73, 0x5b, 0x73, 0x2e, 0x6b, 0x65, 0x79, 0x5d, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e,
+        0x72, 0x69, 0x6e, 0x67, 0x73, 0x5b, 0x6b, 0x5d, 0x2e, 0x70, 0x75, 0x73, 0x68, 0x28, 0x76, 0x3d,
+        0x3d, 0x6e, 0x75, 0x6c, 0x6c, 0x3f, 0x4e, 0x61, 0x4e, 0x3a, 0x76, 0x29, 0x3b, 0x69, 0x66, 0x28,
+        0x74, 0x68, 0x69, 0x73, 0x2e, 0x66, 0x69, 0x74, 0x28, 0x6b, 0x29, 0x29, 0x72, 0x65, 0x73, 0x63,
+        0x61, 0x6c, 0x65, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0x7d, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x21,
+        0x64, 0x72, 0x61, 0x77, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x69, 0x66, 0x28, 0x72,
+        0x65, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x7c, 0x7c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x6c, 0x65, 0x6e,
+        0x67, 0x74, 0x68, 0x3c, 0x33, 0x29, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x72, 0x65, 0x64, 0x72,
+        0x61, 0x77, 0x28, 0x29, 0x3b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x7d, 0x0a, 0x63, 0x6f,
+        0x6e, 0x73, 0x74, 0x20, 0x63, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x74, 0x78, 0x3b, 0x69,
+        0x66, 0x28, 0x66, 0x75, 0x6c, 0x6c, 0x29, 0x7b, 0x63, 0x2e, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
+        0x43, 0x6f, 0x6d, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x65, 0x4f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69,
+        0x6f, 0x6e, 0x3d, 0x27, 0x63, 0x6f, 0x70, 0x79, 0x27, 0x3b, 0x63, 0x2e, 0x64, 0x72, 0x61, 0x77,
+        0x49, 0x6d, 0x61, 0x67, 0x65, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x61, 0x6e, 0x76, 0x61,
+        0x73, 0x2c, 0x2d, 0x43, 0x48, 0x41, 0x52, 0x54, 0x5f, 0x53, 0x54, 0x45, 0x50, 0x5f, 0x50, 0x58,
+        0x2c, 0x30, 0x29, 0x3b, 0x63, 0x2e, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x43, 0x6f, 0x6d, 0x70,
+        0x6f, 0x73, 0x69, 0x74, 0x65, 0x4f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x27,
+        0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x2d, 0x6f, 0x76, 0x65, 0x72, 0x27, 0x3b, 0x7d, 0x0a, 0x74,
+        0x68, 0x69, 0x73, 0x2e, 0x64, 0x72, 0x61, 0x77, 0x53, 0x65, 0x67, 0x6d, 0x65, 0x6e, 0x74, 0x28,
+        0x74, 0x68, 0x69, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x2d, 0x32, 0x29, 0x3b, 0x7d,
+        0x0a, 0x64, 0x72, 0x61, 0x77, 0x53, 0x65, 0x67, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x69, 0x29, 0x7b,
+        0x69, 0x66, 0x28, 0x69, 0x2b, 0x31, 0x3d, 0x3d, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x68, 0x69,
+        0x73, 0x74, 0x6f, 0x72, 0x79, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x63, 0x6f, 0x6e,
+        0x73, 0x74, 0x20, 0x63, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x74, 0x78, 0x3b, 0x63, 0x2e,
+        0x6c, 0x69, 0x6e, 0x65, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x32, 0x3b, 0x63, 0x2e, 0x6c, 0x69,
+        0x6e, 0x65, 0x43, 0x61, 0x70, 0x3d, 0x27, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x27, 0x3b, 0x74, 0x68,
+        0x69, 0x73, 0x2e, 0x72, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68,
+        0x28, 0x28, 0x72, 0x69, 0x6e, 0x67, 0x2c, 0x6b, 0x29, 0x3d, 0x3e, 0x7b, 0x63, 0x6f, 0x6e, 0x73,
+        0x74, 0x20, 0x61, 0x3d, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x61, 0x74, 0x28, 0x69, 0x29, 0x2c, 0x62,
+        0x3d, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x61, 0x74, 0x28, 0x69, 0x2b, 0x31, 0x29, 0x3b, 0x69, 0x66,
+        0x28, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x2e, 0x69, 0x73, 0x4e, 0x61, 0x4e, 0x28, 0x61, 0x29,
+        0x7c, 0x7c, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x2e, 0x69, 0x73, 0x4e, 0x61, 0x4e, 0x28, 0x62,
+        0x29, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x63, 0x2e, 0x73, 0x74, 0x72, 0x6f, 0x6b,
+        0x65, 0x53, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x65, 0x72, 0x69,
+        0x65, 0x73, 0x5b, 0x6b, 0x5d, 0x2e, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3b, 0x63, 0x2e, 0x62, 0x65,
+        0x67, 0x69, 0x6e, 0x50, 0x61, 0x74, 0x68, 0x28, 0x29, 0x3b, 0x63, 0x2e, 0x6d, 0x6f, 0x76, 0x65,
+        0x54, 0x6f, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x78, 0x28, 0x69, 0x29, 0x2c, 0x74, 0x68, 0x69,
+        0x73, 0x2e, 0x79, 0x28, 0x6b, 0x2c, 0x61, 0x29, 0x29, 0x3b, 0x63, 0x2e, 0x6c, 0x69, 0x6e, 0x65,
+        0x54, 0x6f, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x78, 0x28, 0x69, 0x2b, 0x31, 0x29, 0x2c, 0x74,
+        0x68, 0x69, 0x73, 0x2e, 0x79, 0x28, 0x6b, 0x2c, 0x62, 0x29, 0x29, 0x3b, 0x63, 0x2e, 0x73, 0x74,
+        0x72, 0x6f, 0x6b, 0x65, 0x28, 0x29, 0x3b, 0x7d, 0x29, 0x3b, 0x7d, 0x0a, 0x72, 0x65, 0x64, 0x72,
+        0x61, 0x77, 0x28, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x3d, 0x74, 0x68, 0x69,
+        0x73, 0x2e, 0x63, 0x74, 0x78, 0x3b, 0x63, 0x2e, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x52, 0x65, 0x63,
+        0x74, 0x28, 0x30, 0x2c, 0x30, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x77, 0x69, 0x64, 0x74, 0x68,
+        0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x29, 0x3b, 0x69, 0x66,
+        0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3c, 0x32, 0x29, 0x7b,
+        0x63, 0x2e, 0x66, 0x6f, 0x6e, 0x74, 0x3d, 0x27, 0x31, 0x34, 0x70, 0x78, 0x20, 0x73, 0x61, 0x6e,
+        0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x27, 0x3b, 0x63, 0x2e, 0x66, 0x69, 0x6c, 0x6c, 0x53,
+        0x74, 0x79, 0x6c, 0x65, 0x3d, 0x27, 0x23, 0x39, 0x61, 0x61, 0x35, 0x62, 0x31, 0x27, 0x3b, 0x63,
+        0x2e, 0x74, 0x65, 0x78, 0x74, 0x41, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x27, 0x63, 0x65, 0x6e, 0x74,
+        0x65, 0x72, 0x27, 0x3b, 0x63, 0x2e, 0x66, 0x69, 0x6c, 0x6c, 0x54, 0x65, 0x78, 0x74, 0x28, 0x27,
+        0xd0, 0x9d, 0xd0, 0xb0, 0xd0, 0xba, 0xd0, 0xbe, 0xd0, 0xbf, 0xd0, 0xbb, 0xd0, 0xb5, 0xd0, 0xbd,
+        0xd0, 0xb8, 0xd0, 0xb5, 0x20, 0xd0, 0xb4, 0xd0, 0xb0, 0xd0, 0xbd, 0xd0, 0xbd, 0xd1, 0x8b, 0xd1,
+        0x85, 0xe2, 0x80, 0xa6, 0x27, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x77, 0x69, 0x64, 0x74, 0x68,
+        0x2f, 0x32, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2f, 0x32,
+        0x29, 0x3b, 0x63, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x41, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x27, 0x6c,
+        0x65, 0x66, 0x74, 0x27, 0x3b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x7d, 0x0a, 0x63, 0x2e,
+        0x6c, 0x69, 0x6e, 0x65, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x32, 0x3b, 0x63, 0x2e, 0x6c, 0x69,
+        0x6e, 0x65, 0x4a, 0x6f, 0x69, 0x6e, 0x3d, 0x27, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x27, 0x3b, 0x74,
+        0x68, 0x69, 0x73, 0x2e, 0x72, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63,
+        0x68, 0x28, 0x28, 0x72, 0x69, 0x6e, 0x67, 0x2c, 0x6b, 0x29, 0x3d, 0x3e, 0x7b, 0x63, 0x2e, 0x73,
+        0x74, 0x72, 0x6f, 0x6b, 0x65, 0x53, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e,
+        0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x5b, 0x6b, 0x5d, 0x2e, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3b,
+        0x63, 0x2e, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x50, 0x61, 0x74, 0x68, 0x28, 0x29, 0x3b, 0x6c, 0x65,
+        0x74, 0x20, 0x67, 0x61, 0x70, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0x66, 0x6f, 0x72, 0x28, 0x6c,
+        0x65, 0x74, 0x20, 0x69, 0x3d, 0x30, 0x3b, 0x69, 0x3c, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x6c, 0x65,
+        0x6e, 0x67, 0x74, 0x68, 0x3b, 0x69, 0x2b, 0x2b, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+        0x76, 0x3d, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x61, 0x74, 0x28, 0x69, 0x29, 0x3b, 0x69, 0x66, 0x28,
+        0x69, 0x3d, 0x3d, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x68, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79,
+        0x29, 0x67, 0x61, 0x70, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0x69, 0x66, 0x28, 0x4e, 0x75, 0x6d,
+        0x62, 0x65, 0x72, 0x2e, 0x69, 0x73, 0x4e, 0x61, 0x4e, 0x28, 0x76, 0x29, 0x29, 0x7b, 0x67, 0x61,
+        0x70, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x3b, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x3b,
+        0x7d, 0x0a, 0x69, 0x66, 0x28, 0x67, 0x61, 0x70, 0x29, 0x63, 0x2e, 0x6d, 0x6f, 0x76, 0x65, 0x54,
+        0x6f, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x78, 0x28, 0x69, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73,
+        0x2e, 0x79, 0x28, 0x6b, 0x2c, 0x76, 0x29, 0x29, 0x3b, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x63, 0x2e,
+        0x6c, 0x69, 0x6e, 0x65, 0x54, 0x6f, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x78, 0x28, 0x69, 0x29,
+        0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x79, 0x28, 0x6b, 0x2c, 0x76, 0x29, 0x29, 0x3b, 0x67, 0x61,
+        0x70, 0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x7d, 0x0a, 0x63, 0x2e, 0x73, 0x74, 0x72, 0x6f,
+        0x6b, 0x65, 0x28, 0x29, 0x3b, 0x7d, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x64, 0x72, 0x61,
+        0x77, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x4d, 0x61, 0x72, 0x6b, 0x28, 0x29, 0x3b, 0x7d,
+        0x0a, 0x64, 0x72, 0x61, 0x77, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x4d, 0x61, 0x72, 0x6b,
+        0x28, 0x29, 0x7b, 0x69, 0x66, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x68, 0x69, 0x73, 0x74, 0x6f,
+        0x72, 0x79, 0x3d, 0x3d, 0x3d, 0x30, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x63, 0x6f,
+        0x6e, 0x73, 0x74, 0x20, 0x63, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x74, 0x78, 0x3b, 0x63,
+        0x6f, 0x6e, 0x73, 0x74, 0x20, 0x78, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x78, 0x28, 0x74, 0x68,
+        0x69, 0x73, 0x2e, 0x68, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x29, 0x2d, 0x43, 0x48, 0x41, 0x52,
+        0x54, 0x5f, 0x53, 0x54, 0x45, 0x50, 0x5f, 0x50, 0x58, 0x2f, 0x32, 0x3b, 0x63, 0x2e, 0x73, 0x61,
+        0x76, 0x65, 0x28, 0x29, 0x3b, 0x63, 0x2e, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x53, 0x74, 0x79,
+        0x6c, 0x65, 0x3d, 0x27, 0x23, 0x39, 0x61, 0x61, 0x35, 0x62, 0x31, 0x27, 0x3b, 0x63, 0x2e, 0x6c,
+        0x69, 0x6e, 0x65, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x31, 0x3b, 0x63, 0x2e, 0x73, 0x65, 0x74,
+        0x4c, 0x69, 0x6e, 0x65, 0x44, 0x61, 0x73, 0x68, 0x28, 0x5b, 0x34, 0x2c, 0x34, 0x5d, 0x29, 0x3b,
+        0x63, 0x2e, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x50, 0x61, 0x74, 0x68, 0x28, 0x29, 0x3b, 0x63, 0x2e,
+        0x6d, 0x6f, 0x76, 0x65, 0x54, 0x6f, 0x28, 0x78, 0x2c, 0x30, 0x29, 0x3b, 0x63, 0x2e, 0x6c, 0x69,
+        0x6e, 0x65, 0x54, 0x6f, 0x28, 0x78, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x68, 0x65, 0x69, 0x67,
+        0x68, 0x74, 0x29, 0x3b, 0x63, 0x2e, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x28, 0x29, 0x3b, 0x63,
+        0x2e, 0x66, 0x6f, 0x6e, 0x74, 0x3d, 0x27, 0x31, 0x31, 0x70, 0x78, 0x20, 0x73, 0x61, 0x6e, 0x73,
+        0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x27, 0x3b, 0x63, 0x2e, 0x66, 0x69, 0x6c, 0x6c, 0x53, 0x74,
+        0x79, 0x6c, 0x65, 0x3d, 0x27, 0x23, 0x39, 0x61, 0x61, 0x35, 0x62, 0x31, 0x27, 0x3b, 0x63, 0x2e,
+        0x74, 0x65, 0x78, 0x74, 0x41, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x27, 0x72, 0x69, 0x67, 0x68, 0x74,
+        0x27, 0x3b, 0x63, 0x2e, 0x66, 0x69, 0x6c, 0x6c, 0x54, 0x65, 0x78, 0x74, 0x28, 0x60, 0xd0, 0xb0,
+        0xd1, 0x80, 0xd1, 0x85, 0xd0, 0xb8, 0xd0, 0xb2, 0x20, 0x24, 0x7b, 0x48, 0x49, 0x53, 0x54, 0x4f,
+        0x52, 0x59, 0x5f, 0x53, 0x50, 0x41, 0x4e, 0x5f, 0x53, 0x20, 0x2f, 0x20, 0x33, 0x36, 0x30, 0x30,
+        0x7d, 0x20, 0xd1, 0x87, 0x60, 0x2c, 0x78, 0x2d, 0x34, 0x2c, 0x31, 0x32, 0x29, 0x3b, 0x63, 0x2e,
+        0x74, 0x65, 0x78, 0x74, 0x41, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x27, 0x6c, 0x65, 0x66, 0x74, 0x27,
+        0x3b, 0x63, 0x2e, 0x66, 0x69, 0x6c, 0x6c, 0x54, 0x65, 0x78, 0x74, 0x28, 0x27, 0xd1, 0x81, 0xd0,
+        0xb5, 0xd0, 0xb9, 0xd1, 0x87, 0xd0, 0xb0, 0xd1, 0x81, 0x27, 0x2c, 0x78, 0x2b, 0x34, 0x2c, 0x31,
+        0x32, 0x29, 0x3b, 0x63, 0x2e, 0x72, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x28, 0x29, 0x3b, 0x7d,
+        0x0a, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x28, 0x29, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x72, 0x69,
+        0x6e, 0x67, 0x73, 0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x72, 0x3d, 0x3e, 0x72,
+        0x2e, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x28, 0x29, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x68,
+        0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3d, 0x30, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x72, 0x65,
+        0x64, 0x72, 0x61, 0x77, 0x28, 0x29, 0x3b, 0x7d, 0x7d, 0x0a, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x20,
+        0x53, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x4d, 0x6f, 0x6e, 0x69, 0x74, 0x6f, 0x72, 0x7b, 0x63, 0x6f,
+        0x6e, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6f, 0x72, 0x28, 0x29, 0x7b, 0x74, 0x68, 0x69, 0x73,
+        0x2e, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x3d,
+        0x6e, 0x75, 0x6c, 0x6c, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x64,
+        0x6f, 0x77, 0x6e, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x3d, 0x6e, 0x75, 0x6c, 0x6c,
+        0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x75, 0x70, 0x74, 0x69, 0x6d, 0x65, 0x49, 0x6e, 0x74, 0x65,
+        0x72, 0x76, 0x61, 0x6c, 0x3d, 0x6e, 0x75, 0x6c, 0x6c, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63,
+        0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x3d, 0x35,
+        0x30, 0x30, 0x30, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x64, 0x6f,
+        0x77, 0x6e, 0x3d, 0x35, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x69, 0x73, 0x50, 0x61, 0x75, 0x73,
+        0x65, 0x64, 0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x75, 0x70,
+        0x64, 0x61, 0x74, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x3d, 0x30, 0x3b, 0x74, 0x68, 0x69, 0x73,
+        0x2e, 0x73, 0x74, 0x61, 0x72, 0x74, 0x54, 0x69, 0x6d, 0x65, 0x3d, 0x44, 0x61, 0x74, 0x65, 0x2e,
+        0x6e, 0x6f, 0x77, 0x28, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x74, 0x65, 0x6d, 0x70, 0x48,
+        0x75, 0x6d, 0x43, 0x68, 0x61, 0x72, 0x74, 0x3d, 0x6e, 0x75, 0x6c, 0x6c, 0x3b, 0x74, 0x68, 0x69,
+        0x73, 0x2e, 0x67, 0x61, 0x73, 0x43, 0x68, 0x61, 0x72, 0x74, 0x3d, 0x6e, 0x75, 0x6c, 0x6c, 0x3b,
+        0x74, 0x68, 0x69, 0x73, 0x2e, 0x64, 0x75, 0x73, 0x74, 0x43, 0x68, 0x61, 0x72, 0x74, 0x3d, 0x6e,
+        0x75, 0x6c, 0x6c, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c,
+        0x69, 0x7a, 0x65, 0x28, 0x29, 0x3b, 0x7d, 0x0a, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69,
+        0x7a, 0x65, 0x28, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74,
+        0x3d, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x65, 0x74, 0x75, 0x70,
+        0x43, 0x68, 0x61, 0x72, 0x74, 0x73, 0x28, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x65,
+        0x74, 0x75, 0x70, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72,
+        0x73, 0x28, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x74, 0x61, 0x72, 0x74, 0x55, 0x70,
+        0x74, 0x69, 0x6d, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x28, 0x29, 0x3b, 0x74, 0x68,
+        0x69, 0x73, 0x2e, 0x6c, 0x6f, 0x61, 0x64, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x28, 0x29,
+        0x2e, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x6c, 0x79, 0x28, 0x28, 0x29, 0x3d, 0x3e, 0x74, 0x68, 0x69,
+        0x73, 0x2e, 0x73, 0x74, 0x61, 0x72, 0x74, 0x50, 0x6f, 0x6c, 0x6c, 0x69, 0x6e, 0x67, 0x28, 0x29,
+        0x29, 0x3b, 0x7d, 0x3b, 0x69, 0x66, 0x28, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e,
+        0x72, 0x65, 0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x3d, 0x3d, 0x3d, 0x27, 0x6c, 0x6f,
+        0x61, 0x64, 0x69, 0x6e, 0x67, 0x27, 0x29, 0x7b, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+        0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65,
+        0x72, 0x28, 0x27, 0x44, 0x4f, 0x4d, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x4c, 0x6f, 0x61,
+        0x64, 0x65, 0x64, 0x27, 0x2c, 0x73, 0x74, 0x61, 0x72, 0x74, 0x29, 0x3b, 0x7d, 0x65, 0x6c, 0x73,
+        0x65, 0x7b, 0x73, 0x74, 0x61, 0x72, 0x74, 0x28, 0x29, 0x3b, 0x7d, 0x7d, 0x0a, 0x73, 0x65, 0x74,
+        0x75, 0x70, 0x43, 0x68, 0x61, 0x72, 0x74, 0x73, 0x28, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+        0x20, 0x74, 0x68, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74,
+        0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x74, 0x65, 0x6d,
+        0x70, 0x48, 0x75, 0x6d, 0x43, 0x68, 0x61, 0x72, 0x74, 0x27, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73,
+        0x74, 0x20, 0x67, 0x61, 0x73, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67,
+        0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x67,
+        0x61, 0x73, 0x43, 0x68, 0x61, 0x72, 0x74, 0x27, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+        0x64, 0x75, 0x73, 0x74, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65,
+        0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x64, 0x75,
+        0x73, 0x74, 0x43, 0x68, 0x61, 0x72, 0x74, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x74, 0x68, 0x29,
+        0x74, 0x68, 0x69, 0x73, 0x2e, 0x74, 0x65, 0x6d, 0x70, 0x48, 0x75, 0x6d, 0x43, 0x68, 0x61, 0x72,
+        0x74, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x6d, 0x61, 0x6b, 0x65, 0x4c, 0x69, 0x6e, 0x65, 0x43,
+        0x68, 0x61, 0x72, 0x74, 0x28, 0x74, 0x68, 0x2c, 0x5b, 0x7b, 0x6b, 0x65, 0x79, 0x3a, 0x27, 0x74,
+        0x65, 0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x27, 0x2c, 0x63, 0x6f, 0x6c, 0x6f,
+        0x72, 0x3a, 0x27, 0x23, 0x64, 0x63, 0x32, 0x36, 0x32, 0x36, 0x27, 0x2c, 0x6c, 0x61, 0x62, 0x65,
+        0x6c, 0x3a, 0x27, 0xd0, 0xa2, 0xd0, 0xb5, 0xd0, 0xbc, 0xd0, 0xbf, 0xd0, 0xb5, 0xd1, 0x80, 0xd0,
+        0xb0, 0xd1, 0x82, 0xd1, 0x83, 0xd1, 0x80, 0xd0, 0xb0, 0x27, 0x7d, 0x2c, 0x7b, 0x6b, 0x65, 0x79,
+        0x3a, 0x27, 0x68, 0x75, 0x6d, 0x69, 0x64, 0x69, 0x74, 0x79, 0x27, 0x2c, 0x63, 0x6f, 0x6c, 0x6f,
+        0x72, 0x3a, 0x27, 0x23, 0x32, 0x35, 0x36, 0x33, 0x65, 0x62, 0x27, 0x2c, 0x6c, 0x61, 0x62, 0x65,
+        0x6c, 0x3a, 0x27, 0xd0, 0x92, 0xd0, 0xbb, 0xd0, 0xb0, 0xd0, 0xb6, 0xd0, 0xbd, 0xd0, 0xbe, 0xd1,
+        0x81, 0xd1, 0x82, 0xd1, 0x8c, 0x27, 0x7d, 0x2c, 0x7b, 0x6b, 0x65, 0x79, 0x3a, 0x27, 0x70, 0x72,
+        0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x27, 0x2c, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x27, 0x23,
+        0x30, 0x32, 0x38, 0x34, 0x63, 0x37, 0x27, 0x2c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3a, 0x27, 0xd0,
+        0x94, 0xd0, 0xb0, 0xd0, 0xb2, 0xd0, 0xbb, 0xd0, 0xb5, 0xd0, 0xbd, 0xd0, 0xb8, 0xd0, 0xb5, 0x27,
+        0x7d, 0x5d, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x67, 0x61, 0x73, 0x29, 0x74, 0x68, 0x69, 0x73, 0x2e,
+        0x67, 0x61, 0x73, 0x43, 0x68, 0x61, 0x72, 0x74, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x6d, 0x61,
+        0x6b, 0x65, 0x4c, 0x69, 0x6e, 0x65, 0x43, 0x68, 0x61, 0x72, 0x74, 0x28, 0x67, 0x61, 0x73, 0x2c,
+        0x5b, 0x7b, 0x6b, 0x65, 0x79, 0x3a, 0x27, 0x63, 0x6f, 0x32, 0x27, 0x2c, 0x63, 0x6f, 0x6c, 0x6f,
+        0x72, 0x3a, 0x27, 0x23, 0x31, 0x36, 0x61, 0x33, 0x34, 0x61, 0x27, 0x2c, 0x6c, 0x61, 0x62, 0x65,
+        0x6c, 0x3a, 0x27, 0x43, 0x4f, 0xe2, 0x82, 0x82, 0x27, 0x7d, 0x2c, 0x7b, 0x6b, 0x65, 0x79, 0x3a,
+        0x27, 0x63, 0x6f, 0x27, 0x2c, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x27, 0x23, 0x64, 0x39, 0x37,
+        0x37, 0x30, 0x36, 0x27, 0x2c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3a, 0x27, 0x43, 0x4f, 0x27, 0x7d,
+        0x2c, 0x7b, 0x6b, 0x65, 0x79, 0x3a, 0x27, 0x6c, 0x70, 0x67, 0x27, 0x2c, 0x63, 0x6f, 0x6c, 0x6f,
+        0x72, 0x3a, 0x27, 0x23, 0x37, 0x63, 0x33, 0x61, 0x65, 0x64, 0x27, 0x2c, 0x6c, 0x61, 0x62, 0x65,
+        0x6c, 0x3a, 0x27, 0x4c, 0x50, 0x47, 0x27, 0x7d, 0x2c, 0x7b, 0x6b, 0x65, 0x79, 0x3a, 0x27, 0x6e,
+        0x68, 0x33, 0x27, 0x2c, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x27, 0x23, 0x30, 0x38, 0x39, 0x31,
+        0x62, 0x32, 0x27, 0x2c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3a, 0x27, 0x4e, 0x48, 0xe2, 0x82, 0x83,
+        0x27, 0x7d, 0x5d, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x64, 0x75, 0x73, 0x74, 0x29, 0x74, 0x68, 0x69,
+        0x73, 0x2e, 0x64, 0x75, 0x73, 0x74, 0x43, 0x68, 0x61, 0x72, 0x74, 0x3d, 0x74, 0x68, 0x69, 0x73,
+        0x2e, 0x6d, 0x61, 0x6b, 0x65, 0x4c, 0x69, 0x6e, 0x65, 0x43, 0x68, 0x61, 0x72, 0x74, 0x28, 0x64,
+        0x75, 0x73, 0x74, 0x2c, 0x5b, 0x7b, 0x6b, 0x65, 0x79, 0x3a, 0x27, 0x70, 0x6d, 0x31, 0x5f, 0x30,
+        0x27, 0x2c, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x27, 0x23, 0x32, 0x35, 0x36, 0x33, 0x65, 0x62,
+        0x27, 0x2c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3a, 0x27, 0x50, 0x4d, 0x31, 0x2e, 0x30, 0x27, 0x7d,
+        0x2c, 0x7b, 0x6b, 0x65, 0x79, 0x3a, 0x27, 0x70, 0x6d, 0x32, 0x5f, 0x35, 0x27, 0x2c, 0x63, 0x6f,
+        0x6c, 0x6f, 0x72, 0x3a, 0x27, 0x23, 0x64, 0x39, 0x37, 0x37, 0x30, 0x36, 0x27, 0x2c, 0x6c, 0x61,
+        0x62, 0x65, 0x6c, 0x3a, 0x27, 0x50, 0x4d, 0x32, 0x2e, 0x35, 0x27, 0x7d, 0x2c, 0x7b, 0x6b, 0x65,
+        0x79, 0x3a, 0x27, 0x70, 0x6d, 0x31, 0x30, 0x27, 0x2c, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x27,
+        0x23, 0x64, 0x63, 0x32, 0x36, 0x32, 0x36, 0x27, 0x2c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3a, 0x27,
+        0x50, 0x4d, 0x31, 0x30, 0x27, 0x7d, 0x5d, 0x29, 0x3b, 0x7d, 0x0a, 0x6d, 0x61, 0x6b, 0x65, 0x4c,
+        0x69, 0x6e, 0x65, 0x43, 0x68, 0x61, 0x72, 0x74, 0x28, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x2c,
+        0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x29, 0x7b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6e,
+        0x65, 0x77, 0x20, 0x4c, 0x69, 0x6e, 0x65, 0x43, 0x68, 0x61, 0x72, 0x74, 0x28, 0x63, 0x61, 0x6e,
+        0x76, 0x61, 0x73, 0x2c, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x29, 0x3b, 0x7d, 0x0a, 0x67, 0x65,
+        0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x74, 0x73, 0x28, 0x29, 0x7b, 0x72, 0x65, 0x74, 0x75, 0x72,
+        0x6e, 0x5b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x74, 0x65, 0x6d, 0x70, 0x48, 0x75, 0x6d, 0x43, 0x68,
+        0x61, 0x72, 0x74, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x67, 0x61, 0x73, 0x43, 0x68, 0x61, 0x72,
+        0x74, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x64, 0x75, 0x73, 0x74, 0x43, 0x68, 0x61, 0x72, 0x74,
+        0x5d, 0x2e, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x28, 0x63, 0x3d, 0x3e, 0x63, 0x29, 0x3b, 0x7d,
+        0x0a, 0x61, 0x64, 0x64, 0x54, 0x6f, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x28, 0x64, 0x61,
+        0x74, 0x61, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6e, 0x75, 0x6d, 0x3d, 0x76, 0x3d,
+        0x3e, 0x28, 0x76, 0x3d, 0x3d, 0x6e, 0x75, 0x6c, 0x6c, 0x7c, 0x7c, 0x76, 0x3d, 0x3d, 0x3d, 0x2d,
+        0x39, 0x39, 0x39, 0x3f, 0x4e, 0x61, 0x4e, 0x3a, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x28, 0x76,
+        0x29, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x3d,
+        0x7b, 0x74, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x3a, 0x6e, 0x75, 0x6d,
+        0x28, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x74, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72,
+        0x65, 0x29, 0x2c, 0x68, 0x75, 0x6d, 0x69, 0x64, 0x69, 0x74, 0x79, 0x3a, 0x6e, 0x75, 0x6d, 0x28,
+        0x64, 0x61, 0x74, 0x61, 0x2e, 0x68, 0x75, 0x6d, 0x69, 0x64, 0x69, 0x74, 0x79, 0x29, 0x2c, 0x70,
+        0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x3a, 0x6e, 0x75, 0x6d, 0x28, 0x64, 0x61, 0x74, 0x61,
+        0x2e, 0x70, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x29, 0x2c, 0x63, 0x6f, 0x32, 0x3a, 0x6e,
+        0x75, 0x6d, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x43, 0x4f, 0x32, 0x29, 0x2c, 0x63, 0x6f, 0x3a,
+        0x6e, 0x75, 0x6d, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x43, 0x4f, 0x29, 0x2c, 0x6c, 0x70, 0x67,
+        0x3a, 0x6e, 0x75, 0x6d, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x4c, 0x50, 0x47, 0x29, 0x2c, 0x6e,
+        0x68, 0x33, 0x3a, 0x6e, 0x75, 0x6d, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x4e, 0x48, 0x33, 0x29,
+        0x2c, 0x70, 0x6d, 0x31, 0x5f, 0x30, 0x3a, 0x6e, 0x75, 0x6d, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2e,
+        0x70, 0x6d, 0x31, 0x5f, 0x30, 0x29, 0x2c, 0x70, 0x6d, 0x32, 0x5f, 0x35, 0x3a, 0x6e, 0x75, 0x6d,
+        0x28, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x70, 0x6d, 0x32, 0x5f, 0x35, 0x29, 0x2c, 0x70, 0x6d, 0x31,
+        0x30, 0x3a, 0x6e, 0x75, 0x6d, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x70, 0x6d, 0x31, 0x30, 0x29,
+        0x7d, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x68, 0x61, 0x72, 0x74, 0x73, 0x2e, 0x66, 0x6f,
+        0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x63, 0x3d, 0x3e, 0x63, 0x2e, 0x70, 0x75, 0x73, 0x68, 0x28,
+        0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x29, 0x29, 0x3b, 0x7d, 0x0a, 0x61, 0x73, 0x79, 0x6e, 0x63,
+        0x20, 0x6c, 0x6f, 0x61, 0x64, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x28, 0x29, 0x7b, 0x63,
+        0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x74, 0x73, 0x3d, 0x74, 0x68, 0x69, 0x73,
+        0x2e, 0x63, 0x68, 0x61, 0x72, 0x74, 0x73, 0x3b, 0x69, 0x66, 0x28, 0x21, 0x63, 0x68, 0x61, 0x72,
+        0x74, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+        0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x4d, 0x61, 0x74, 0x68,
+        0x2e, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x28, 0x44, 0x61, 0x74, 0x65, 0x2e, 0x6e, 0x6f, 0x77, 0x28,
+        0x29, 0x2f, 0x31, 0x30, 0x30, 0x30, 0x29, 0x2d, 0x48, 0x49, 0x53, 0x54, 0x4f, 0x52, 0x59, 0x5f,
+        0x53, 0x50, 0x41, 0x4e, 0x5f, 0x53, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x70, 0x6f, 0x69,
+        0x6e, 0x74, 0x73, 0x3d, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x6d, 0x61, 0x78, 0x28, 0x2e, 0x2e, 0x2e,
+        0x63, 0x68, 0x61, 0x72, 0x74, 0x73, 0x2e, 0x6d, 0x61, 0x70, 0x28, 0x63, 0x3d, 0x3e, 0x63, 0x2e,
+        0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x29, 0x29, 0x3b, 0x74, 0x72, 0x79, 0x7b, 0x63,
+        0x6f, 0x6e, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x3d, 0x61, 0x77,
+        0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x60, 0x2f, 0x68, 0x69, 0x73, 0x74,
+        0x6f, 0x72, 0x79, 0x3f, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x62, 0x69, 0x6e, 0x26, 0x70,
+        0x6f, 0x69, 0x6e, 0x74, 0x73, 0x3d, 0x24, 0x7b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x7d, 0x26,
+        0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x24, 0x7b, 0x66, 0x72, 0x6f, 0x6d, 0x7d, 0x60, 0x29, 0x3b, 0x69,
+        0x66, 0x28, 0x21, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x6f, 0x6b, 0x29, 0x74,
+        0x68, 0x72, 0x6f, 0x77, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x60,
+        0x48, 0x54, 0x54, 0x50, 0x20, 0x24, 0x7b, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e,
+        0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x7d, 0x60, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+        0x76, 0x69, 0x65, 0x77, 0x3d, 0x6e, 0x65, 0x77, 0x20, 0x44, 0x61, 0x74, 0x61, 0x56, 0x69, 0x65,
+        0x77, 0x28, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65,
+        0x2e, 0x61, 0x72, 0x72, 0x61, 0x79, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x29, 0x29, 0x3b,
+        0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3d, 0x4d, 0x61, 0x74, 0x68,
+        0x2e, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x28, 0x76, 0x69, 0x65, 0x77, 0x2e, 0x62, 0x79, 0x74, 0x65,
+        0x4c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x2f, 0x52, 0x45, 0x43, 0x4f, 0x52, 0x44, 0x5f, 0x53, 0x49,
+        0x5a, 0x45, 0x29, 0x3b, 0x66, 0x6f, 0x72, 0x28, 0x6c, 0x65, 0x74, 0x20, 0x69, 0x3d, 0x30, 0x3b,
+        0x69, 0x3c, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3b, 0x69, 0x2b, 0x2b, 0x29, 0x7b, 0x63, 0x6f, 0x6e,
+        0x73, 0x74, 0x20, 0x6f, 0x3d, 0x69, 0x2a, 0x52, 0x45, 0x43, 0x4f, 0x52, 0x44, 0x5f, 0x53, 0x49,
+        0x5a, 0x45, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x3d, 0x76,
+        0x69, 0x65, 0x77, 0x2e, 0x67, 0x65, 0x74, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x28, 0x6f, 0x2b, 0x31,
+        0x38, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x70, 0x31, 0x30, 0x3d, 0x28, 0x6f, 0x6b,
+        0x2c, 0x76, 0x29, 0x3d, 0x3e, 0x28, 0x6f, 0x6b, 0x3f, 0x76, 0x2f, 0x31, 0x30, 0x3a, 0x4e, 0x61,
+        0x4e, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x70, 0x6d, 0x73, 0x3d, 0x66, 0x6c, 0x61,
+        0x67, 0x73, 0x26, 0x46, 0x5f, 0x50, 0x4d, 0x53, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x76,
+        0x61, 0x6c, 0x75, 0x65, 0x73, 0x3d, 0x7b, 0x74, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75,
+        0x72, 0x65, 0x3a, 0x70, 0x31, 0x30, 0x28, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x26, 0x28, 0x46, 0x5f,
+        0x44, 0x48, 0x54, 0x7c, 0x46, 0x5f, 0x42, 0x4d, 0x50, 0x29, 0x2c, 0x76, 0x69, 0x65, 0x77, 0x2e,
+        0x67, 0x65, 0x74, 0x49, 0x6e, 0x74, 0x31, 0x36, 0x28, 0x6f, 0x2b, 0x34, 0x2c, 0x74, 0x72, 0x75,
+        0x65, 0x29, 0x29, 0x2c, 0x68, 0x75, 0x6d, 0x69, 0x64, 0x69, 0x74, 0x79, 0x3a, 0x70, 0x31, 0x30,
+        0x28, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x26, 0x46, 0x5f, 0x44, 0x48, 0x54, 0x2c, 0x76, 0x69, 0x65,
+        0x77, 0x2e, 0x67, 0x65, 0x74, 0x55, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x28, 0x6f, 0x2b, 0x36, 0x2c,
+        0x74, 0x72, 0x75, 0x65, 0x29, 0x29, 0x2c, 0x70, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x3a,
+        0x70, 0x31, 0x30, 0x28, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x26, 0x46, 0x5f, 0x42, 0x4d, 0x50, 0x2c,
+        0x76, 0x69, 0x65, 0x77, 0x2e, 0x67, 0x65, 0x74, 0x55, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x28, 0x6f,
+        0x2b, 0x38, 0x2c, 0x74, 0x72, 0x75, 0x65, 0x29, 0x29, 0x2c, 0x63, 0x6f, 0x32, 0x3a, 0x66, 0x6c,
+        0x61, 0x67, 0x73, 0x26, 0x46, 0x5f, 0x47, 0x41, 0x53, 0x3f, 0x76, 0x69, 0x65, 0x77, 0x2e, 0x67,
+        0x65, 0x74, 0x55, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x28, 0x6f, 0x2b, 0x31, 0x30, 0x2c, 0x74, 0x72,
+        0x75, 0x65, 0x29, 0x3a, 0x4e, 0x61, 0x4e, 0x2c, 0x70, 0x6d, 0x31, 0x5f, 0x30, 0x3a, 0x70, 0x6d,
+        0x73, 0x3f, 0x76, 0x69, 0x65, 0x77, 0x2e, 0x67, 0x65, 0x74, 0x55, 0x69, 0x6e, 0x74, 0x31, 0x36,
+        0x28, 0x6f, 0x2b, 0x31, 0x32, 0x2c, 0x74, 0x72, 0x75, 0x65, 0x29, 0x3a, 0x4e, 0x61, 0x4e, 0x2c,
+        0x70, 0x6d, 0x32, 0x5f, 0x35, 0x3a, 0x70, 0x6d, 0x73, 0x3f, 0x76, 0x69, 0x65, 0x77, 0x2e, 0x67,
+        0x65, 0x74, 0x55, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x28, 0x6f, 0x2b, 0x31, 0x34, 0x2c, 0x74, 0x72,
+        0x75, 0x65, 0x29, 0x3a, 0x4e, 0x61, 0x4e, 0x2c, 0x70, 0x6d, 0x31, 0x30, 0x3a, 0x70, 0x6d, 0x73,
+        0x3f, 0x76, 0x69, 0x65, 0x77, 0x2e, 0x67, 0x65, 0x74, 0x55, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x28,
+        0x6f, 0x2b, 0x31, 0x36, 0x2c, 0x74, 0x72, 0x75, 0x65, 0x29, 0x3a, 0x4e, 0x61, 0x4e, 0x7d, 0x3b,
+        0x63, 0x68, 0x61, 0x72, 0x74, 0x73, 0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x63,
+        0x3d, 0x3e, 0x63, 0x2e, 0x70, 0x75, 0x73, 0x68, 0x28, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x2c,
+        0x66, 0x61, 0x6c, 0x73, 0x65, 0x29, 0x29, 0x3b, 0x7d, 0x0a, 0x69, 0x66, 0x28, 0x63, 0x6f, 0x75,
+        0x6e, 0x74, 0x29, 0x63, 0x68, 0x61, 0x72, 0x74, 0x73, 0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63,
+        0x68, 0x28, 0x63, 0x3d, 0x3e, 0x63, 0x2e, 0x6d, 0x61, 0x72, 0x6b, 0x48, 0x69, 0x73, 0x74, 0x6f,
+        0x72, 0x79, 0x28, 0x29, 0x29, 0x3b, 0x63, 0x68, 0x61, 0x72, 0x74, 0x73, 0x2e, 0x66, 0x6f, 0x72,
+        0x45, 0x61, 0x63, 0x68, 0x28, 0x63, 0x3d, 0x3e, 0x63, 0x2e, 0x72, 0x65, 0x64, 0x72, 0x61, 0x77,
+        0x28, 0x29, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x29, 0x74, 0x68, 0x69,
+        0x73, 0x2e, 0x61, 0x64, 0x64, 0x4c, 0x6f, 0x67, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x28, 0x60, 0xd0,
+        0x98, 0xd1, 0x81, 0xd1, 0x82, 0xd0, 0xbe, 0xd1, 0x80, 0xd0, 0xb8, 0xd1, 0x8f, 0x3a, 0x20, 0x24,
+        0x7b, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x7d, 0x20, 0xd1, 0x82, 0xd0, 0xbe, 0xd1, 0x87, 0xd0, 0xb5,
+        0xd0, 0xba, 0x20, 0xd0, 0xb7, 0xd0, 0xb0, 0x20, 0x24, 0x7b, 0x48, 0x49, 0x53, 0x54, 0x4f, 0x52,
+        0x59, 0x5f, 0x53, 0x50, 0x41, 0x4e, 0x5f, 0x53, 0x20, 0x2f, 0x20, 0x33, 0x36, 0x30, 0x30, 0x7d,
+        0x20, 0xd1, 0x87, 0x60, 0x29, 0x3b, 0x7d, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x65, 0x72, 0x72,
+        0x6f, 0x72, 0x29, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x61, 0x64, 0x64, 0x4c, 0x6f, 0x67, 0x45,
+        0x6e, 0x74, 0x72, 0x79, 0x28, 0x27, 0xd0, 0x98, 0xd1, 0x81, 0xd1, 0x82, 0xd0, 0xbe, 0xd1, 0x80,
+        0xd0, 0xb8, 0xd1, 0x8f, 0x20, 0xd0, 0xbd, 0xd0, 0xb5, 0xd0, 0xb4, 0xd0, 0xbe, 0xd1, 0x81, 0xd1,
+        0x82, 0xd1, 0x83, 0xd0, 0xbf, 0xd0, 0xbd, 0xd0, 0xb0, 0x27, 0x29, 0x3b, 0x7d, 0x7d, 0x0a, 0x73,
+        0x74, 0x61, 0x72, 0x74, 0x50, 0x6f, 0x6c, 0x6c, 0x69, 0x6e, 0x67, 0x28, 0x29, 0x7b, 0x74, 0x68,
+        0x69, 0x73, 0x2e, 0x66, 0x65, 0x74, 0x63, 0x68, 0x44, 0x61, 0x74, 0x61, 0x28, 0x29, 0x3b, 0x69,
+        0x66, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x49, 0x6e, 0x74,
+        0x65, 0x72, 0x76, 0x61, 0x6c, 0x29, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x49, 0x6e, 0x74, 0x65, 0x72,
+        0x76, 0x61, 0x6c, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x49,
+        0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x75, 0x70,
+        0x64, 0x61, 0x74, 0x65, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x3d, 0x73, 0x65, 0x74,
+        0x49, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x28, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x69, 0x66,
+        0x28, 0x21, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x69, 0x73, 0x50, 0x61, 0x75, 0x73, 0x65, 0x64, 0x29,
+        0x74, 0x68, 0x69, 0x73, 0x2e, 0x66, 0x65, 0x74, 0x63, 0x68, 0x44, 0x61, 0x74, 0x61, 0x28, 0x29,
+        0x3b, 0x7d, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x49,
+        0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x74,
+        0x61, 0x72, 0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x64, 0x6f, 0x77, 0x6e, 0x28, 0x29, 0x3b, 0x7d,
+        0x0a, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x50, 0x6f, 0x6c, 0x6c, 0x69, 0x6e, 0x67, 0x49, 0x6e,
+        0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x28, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x73, 0x29, 0x7b,
+        0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x49, 0x6e, 0x74, 0x65,
+        0x72, 0x76, 0x61, 0x6c, 0x3d, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x73, 0x2a, 0x31, 0x30, 0x30,
+        0x30, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x64, 0x6f, 0x77, 0x6e,
+        0x3d, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x73, 0x3b, 0x69, 0x66, 0x28, 0x74, 0x68, 0x69, 0x73,
+        0x2e, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x29,
+        0x63, 0x6c, 0x65, 0x61, 0x72, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x28, 0x74, 0x68,
+        0x69, 0x73, 0x2e, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61,
+        0x6c, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x49, 0x6e,
+        0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x3d, 0x73, 0x65, 0x74, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x76,
+        0x61, 0x6c, 0x28, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x69, 0x66, 0x28, 0x21, 0x74, 0x68, 0x69, 0x73,
+        0x2e, 0x69, 0x73, 0x50, 0x61, 0x75, 0x73, 0x65, 0x64, 0x29, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x66,
+        0x65, 0x74, 0x63, 0x68, 0x44, 0x61, 0x74, 0x61, 0x28, 0x29, 0x3b, 0x7d, 0x2c, 0x74, 0x68, 0x69,
+        0x73, 0x2e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61,
+        0x6c, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x65, 0x74, 0x54, 0x65, 0x78, 0x74, 0x28,
+        0x27, 0x6e, 0x65, 0x78, 0x74, 0x55, 0x70, 0x64, 0x61, 0x74, 0x65, 0x27, 0x2c, 0x60, 0x24, 0x7b,
+        0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x64, 0x6f, 0x77, 0x6e, 0x7d, 0x20,
+        0xd1, 0x81, 0x60, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x61, 0x64, 0x64, 0x4c, 0x6f, 0x67,
+        0x45, 0x6e, 0x74, 0x72, 0x79, 0x28, 0x60, 0xd0, 0x98, 0xd0, 0xbd, 0xd1, 0x82, 0xd0, 0xb5, 0xd1,
+        0x80, 0xd0, 0xb2, 0xd0, 0xb0, 0xd0, 0xbb, 0x20, 0xd0, 0xbe, 0xd0, 0xb1, 0xd0, 0xbd, 0xd0, 0xbe,
+        0xd0, 0xb2, 0xd0, 0xbb, 0xd0, 0xb5, 0xd0, 0xbd, 0xd0, 0xb8, 0xd1, 0x8f, 0x3a, 0x20, 0x24, 0x7b,
+        0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x73, 0x7d, 0x20, 0xd1, 0x81, 0x60, 0x29, 0x3b, 0x7d, 0x0a,
+        0x73, 0x74, 0x61, 0x72, 0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x64, 0x6f, 0x77, 0x6e, 0x28, 0x29,
+        0x7b, 0x69, 0x66, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x64, 0x6f,
+        0x77, 0x6e, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x29, 0x63, 0x6c, 0x65, 0x61, 0x72,
+        0x49, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x6f,
+        0x75, 0x6e, 0x74, 0x64, 0x6f, 0x77, 0x6e, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x29,
+        0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x64, 0x6f, 0x77, 0x6e, 0x49,
+        0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x3d, 0x73, 0x65, 0x74, 0x49, 0x6e, 0x74, 0x65, 0x72,
+        0x76, 0x61, 0x6c, 0x28, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x69, 0x66, 0x28, 0x74, 0x68, 0x69, 0x73,
+        0x2e, 0x69, 0x73, 0x50, 0x61, 0x75, 0x73, 0x65, 0x64, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+        0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x64, 0x6f, 0x77, 0x6e, 0x2d,
+        0x2d, 0x3b, 0x69, 0x66, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x64,
+        0x6f, 0x77, 0x6e, 0x3c, 0x3d, 0x30, 0x29, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x6f, 0x75, 0x6e,
+        0x74, 0x64, 0x6f, 0x77, 0x6e, 0x3d, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x66, 0x6c, 0x6f, 0x6f, 0x72,
+        0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x49, 0x6e, 0x74,
+        0x65, 0x72, 0x76, 0x61, 0x6c, 0x2f, 0x31, 0x30, 0x30, 0x30, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73,
+        0x2e, 0x73, 0x65, 0x74, 0x54, 0x65, 0x78, 0x74, 0x28, 0x27, 0x6e, 0x65, 0x78, 0x74, 0x55, 0x70,
+        0x64, 0x61, 0x74, 0x65, 0x27, 0x2c, 0x60, 0x24, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x6f,
+        0x75, 0x6e, 0x74, 0x64, 0x6f, 0x77, 0x6e, 0x7d, 0x20, 0xd1, 0x81, 0x60, 0x29, 0x3b, 0x7d, 0x2c,
+        0x31, 0x30, 0x30, 0x30, 0x29, 0x3b, 0x7d, 0x0a, 0x73, 0x74, 0x61, 0x72, 0x74, 0x55, 0x70, 0x74,
+        0x69, 0x6d, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x28, 0x29, 0x7b, 0x69, 0x66, 0x28,
+        0x74, 0x68, 0x69, 0x73, 0x2e, 0x75, 0x70, 0x74, 0x69, 0x6d, 0x65, 0x49, 0x6e, 0x74, 0x65, 0x72,
+        0x76, 0x61, 0x6c, 0x29, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61,
+        0x6c, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x75, 0x70, 0x74, 0x69, 0x6d, 0x65, 0x49, 0x6e, 0x74,
+        0x65, 0x72, 0x76, 0x61, 0x6c, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x75, 0x70, 0x74, 0x69,
+        0x6d, 0x65, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x3d, 0x73, 0x65, 0x74, 0x49, 0x6e,
+        0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x28, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x63, 0x6f, 0x6e, 0x73,
+        0x74, 0x20, 0x73, 0x3d, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x28, 0x28,
+        0x44, 0x61, 0x74, 0x65, 0x2e, 0x6e, 0x6f, 0x77, 0x28, 0x29, 0x2d, 0x74, 0x68, 0x69, 0x73, 0x2e,
+        0x73, 0x74, 0x61, 0x72, 0x74, 0x54, 0x69, 0x6d, 0x65, 0x29, 0x2f, 0x31, 0x30, 0x30, 0x30, 0x29,
+        0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x68, 0x68, 0x3d, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67,
+        0x28, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x28, 0x73, 0x2f, 0x33, 0x36,
+        0x30, 0x30, 0x29, 0x29, 0x2e, 0x70, 0x61, 0x64, 0x53, 0x74, 0x61, 0x72, 0x74, 0x28, 0x32, 0x2c,
+        0x27, 0x30, 0x27, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6d, 0x6d, 0x3d, 0x53, 0x74,
+        0x72, 0x69, 0x6e, 0x67, 0x28, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x28,
+        0x28, 0x73, 0x25, 0x33, 0x36, 0x30, 0x30, 0x29, 0x2f, 0x36, 0x30, 0x29, 0x29, 0x2e, 0x70, 0x61,
+        0x64, 0x53, 0x74, 0x61, 0x72, 0x74, 0x28, 0x32, 0x2c, 0x27, 0x30, 0x27, 0x29, 0x3b, 0x63, 0x6f,
+        0x6e, 0x73, 0x74, 0x20, 0x73, 0x73, 0x3d, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x73, 0x25,
+        0x36, 0x30, 0x29, 0x2e, 0x70, 0x61, 0x64, 0x53, 0x74, 0x61, 0x72, 0x74, 0x28, 0x32, 0x2c, 0x27,
+        0x30, 0x27, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x65, 0x74, 0x54, 0x65, 0x78, 0x74,
+        0x28, 0x27, 0x75, 0x70, 0x74, 0x69, 0x6d, 0x65, 0x27, 0x2c, 0x60, 0x24, 0x7b, 0x68, 0x68, 0x7d,
+        0x3a, 0x24, 0x7b, 0x6d, 0x6d, 0x7d, 0x3a, 0x24, 0x7b, 0x73, 0x73, 0x7d, 0x60, 0x29, 0x3b, 0x7d,
+        0x2c, 0x31, 0x30, 0x30, 0x30, 0x29, 0x3b, 0x7d, 0x0a, 0x61, 0x73, 0x79, 0x6e, 0x63, 0x20, 0x66,
+        0x65, 0x74, 0x63, 0x68, 0x44, 0x61, 0x74, 0x61, 0x28, 0x29, 0x7b, 0x74, 0x72, 0x79, 0x7b, 0x63,
+        0x6f, 0x6e, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x3d, 0x61, 0x77,
+        0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2f, 0x67, 0x65, 0x74, 0x27,
+        0x2c, 0x7b, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x3a, 0x7b, 0x27, 0x43, 0x61, 0x63, 0x68,
+        0x65, 0x2d, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x27, 0x3a, 0x27, 0x6e, 0x6f, 0x2d, 0x63,
+        0x61, 0x63, 0x68, 0x65, 0x27, 0x7d, 0x7d, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x21, 0x72, 0x65, 0x73,
+        0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x6f, 0x6b, 0x29, 0x74, 0x68, 0x72, 0x6f, 0x77, 0x20, 0x6e,
+        0x65, 0x77, 0x20, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x60, 0x48, 0x54, 0x54, 0x50, 0x20, 0x24,
+        0x7b, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
+        0x7d, 0x60, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x64, 0x61, 0x74, 0x61, 0x3d, 0x61,
+        0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x6a, 0x73,
+        0x6f, 0x6e, 0x28, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65,
+        0x44, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29, 0x3b, 0x74, 0x68,
+        0x69, 0x73, 0x2e, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x2b, 0x2b,
+        0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x61, 0x64, 0x64, 0x54, 0x6f, 0x48, 0x69, 0x73, 0x74, 0x6f,
+        0x72, 0x79, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x65,
+        0x74, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x53, 0x74, 0x61, 0x74, 0x75,
+        0x73, 0x28, 0x74, 0x72, 0x75, 0x65, 0x2c, 0x27, 0xd0, 0x9f, 0xd0, 0xbe, 0xd0, 0xb4, 0xd0, 0xba,
+        0xd0, 0xbb, 0xd1, 0x8e, 0xd1, 0x87, 0xd0, 0xb5, 0xd0, 0xbd, 0xd0, 0xbe, 0x27, 0x29, 0x3b, 0x74,
+        0x68, 0x69, 0x73, 0x2e, 0x73, 0x65, 0x74, 0x54, 0x65, 0x78, 0x74, 0x28, 0x27, 0x74, 0x6f, 0x74,
+        0x61, 0x6c, 0x55, 0x70, 0x64, 0x61, 0x74, 0x65, 0x73, 0x27, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e,
+        0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x29, 0x3b, 0x7d, 0x63, 0x61,
+        0x74, 0x63, 0x68, 0x28, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x29, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e,
+        0x73, 0x65, 0x74, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x53, 0x74, 0x61,
+        0x74, 0x75, 0x73, 0x28, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x2c, 0x27, 0xd0, 0x9d, 0xd0, 0xb5, 0xd1,
+        0x82, 0x20, 0xd1, 0x81, 0xd0, 0xb2, 0xd1, 0x8f, 0xd0, 0xb7, 0xd0, 0xb8, 0x27, 0x29, 0x3b, 0x7d,
+        0x7d, 0x0a, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x44, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x28,
+        0x64, 0x61, 0x74, 0x61, 0x29, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x75, 0x70, 0x64, 0x61, 0x74,
+        0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x28, 0x27, 0x74, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61, 0x74,
+        0x75, 0x72, 0x65, 0x27, 0x2c, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x74, 0x65, 0x6d, 0x70, 0x65, 0x72,
+        0x61, 0x74, 0x75, 0x72, 0x65, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x75, 0x70, 0x64, 0x61,
+        0x74, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x28, 0x27, 0x68, 0x75, 0x6d, 0x69, 0x64, 0x69, 0x74,
+        0x79, 0x27, 0x2c, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x68, 0x75, 0x6d, 0x69, 0x64, 0x69, 0x74, 0x79,
+        0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x56, 0x61, 0x6c,
+        0x75, 0x65, 0x28, 0x27, 0x70, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x27, 0x2c, 0x64, 0x61,
+        0x74, 0x61, 0x2e, 0x70, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x29, 0x3b, 0x74, 0x68, 0x69,
+        0x73, 0x2e, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x28, 0x27, 0x63,
+        0x6f, 0x32, 0x27, 0x2c, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x43, 0x4f, 0x32, 0x29, 0x3b, 0x74, 0x68,
+        0x69, 0x73, 0x2e, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x28, 0x27,
+        0x63, 0x6f, 0x27, 0x2c, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x43, 0x4f, 0x29, 0x3b, 0x74, 0x68, 0x69,
+        0x73, 0x2e, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x28, 0x27, 0x6c,
+        0x70, 0x67, 0x27, 0x2c, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x4c, 0x50, 0x47, 0x29, 0x3b, 0x74, 0x68,
+        0x69, 0x73, 0x2e, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x28, 0x27,
+        0x6e, 0x68, 0x33, 0x27, 0x2c, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x4e, 0x48, 0x33, 0x29, 0x3b, 0x74,
+        0x68, 0x69, 0x73, 0x2e, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x41, 0x69, 0x72, 0x4c, 0x65, 0x76,
+        0x65, 0x6c, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x75, 0x70,
+        0x64, 0x61, 0x74, 0x65, 0x44, 0x75, 0x73, 0x74, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29, 0x3b, 0x74,
+        0x68, 0x69, 0x73, 0x2e, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x44, 0x65, 0x72, 0x69, 0x76, 0x65,
+        0x64, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x65, 0x74,
+        0x54, 0x65, 0x78, 0x74, 0x28, 0x27, 0x6c, 0x61, 0x73, 0x74, 0x55, 0x70, 0x64, 0x61, 0x74, 0x65,
+        0x27, 0x2c, 0x6e, 0x65, 0x77, 0x20, 0x44, 0x61, 0x74, 0x65, 0x28, 0x29, 0x2e, 0x74, 0x6f, 0x4c,
+        0x6f, 0x63, 0x61, 0x6c, 0x65, 0x54, 0x69, 0x6d, 0x65, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28,
+        0x29, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x53, 0x65,
+        0x6e, 0x73, 0x6f, 0x72, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29,
+        0x3b, 0x7d, 0x0a, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x28, 0x69,
+        0x64, 0x2c, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x65,
+        0x6c, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c,
+        0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x69, 0x64, 0x29, 0x3b, 0x69, 0x66,
+        0x28, 0x21, 0x65, 0x6c, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x69, 0x66, 0x28, 0x76,
+        0x61, 0x6c, 0x75, 0x65, 0x3d, 0x3d, 0x3d, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64,
+        0x7c, 0x7c, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x3d, 0x3d, 0x6e, 0x75, 0x6c, 0x6c, 0x29, 0x7b,
+        0x65, 0x6c, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x27,
+        0x2d, 0x2d, 0x27, 0x3b, 0x7d, 0x65, 0x6c, 0x73, 0x65, 0x7b, 0x65, 0x6c, 0x2e, 0x74, 0x65, 0x78,
+        0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x28,
+        0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x2e, 0x74, 0x6f, 0x46, 0x69, 0x78, 0x65, 0x64, 0x28, 0x32,
+        0x29, 0x3b, 0x7d, 0x7d, 0x0a, 0x73, 0x65, 0x74, 0x54, 0x65, 0x78, 0x74, 0x28, 0x69, 0x64, 0x2c,
+        0x74, 0x65, 0x78, 0x74, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x65, 0x6c, 0x3d, 0x64,
+        0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65,
+        0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x69, 0x64, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x65, 0x6c,
+        0x29, 0x65, 0x6c, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d,
+        0x74, 0x65, 0x78, 0x74, 0x3b, 0x7d, 0x0a, 0x73, 0x65, 0x74, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63,
+        0x74, 0x69, 0x6f, 0x6e, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x63, 0x6f, 0x6e, 0x6e, 0x65,
+        0x63, 0x74, 0x65, 0x64, 0x2c, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x29, 0x7b, 0x63, 0x6f,
+        0x6e, 0x73, 0x74, 0x20, 0x65, 0x6c, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e,
+        0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27,
+        0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x21, 0x65, 0x6c, 0x29,
+        0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x74, 0x65, 0x78,
+        0x74, 0x3d, 0x65, 0x6c, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74,
+        0x6f, 0x72, 0x28, 0x27, 0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2d, 0x74, 0x65, 0x78, 0x74,
+        0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x74, 0x65, 0x78, 0x74, 0x29, 0x74, 0x65, 0x78, 0x74, 0x2e,
+        0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x6d, 0x65, 0x73, 0x73,
+        0x61, 0x67, 0x65, 0x3b, 0x65, 0x6c, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74,
+        0x2e, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x28, 0x27, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74,
+        0x65, 0x64, 0x27, 0x2c, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x29, 0x3b, 0x7d,
+        0x0a, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x53, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x53, 0x74, 0x61,
+        0x74, 0x75, 0x73, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+        0x64, 0x68, 0x74, 0x4f, 0x6b, 0x3d, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x64, 0x68, 0x74, 0x5f, 0x76,
+        0x61, 0x6c, 0x69, 0x64, 0x21, 0x3d, 0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x26, 0x26, 0x64, 0x61,
+        0x74, 0x61, 0x2e, 0x74, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x21, 0x3d,
+        0x3d, 0x2d, 0x39, 0x39, 0x39, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6d, 0x71, 0x4f, 0x6b,
+        0x3d, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x6d, 0x71, 0x5f, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x21, 0x3d,
+        0x3d, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x65, 0x74, 0x53,
+        0x74, 0x61, 0x74, 0x75, 0x73, 0x54, 0x65, 0x78, 0x74, 0x28, 0x27, 0x64, 0x68, 0x74, 0x53, 0x74,
+        0x61, 0x74, 0x75, 0x73, 0x27, 0x2c, 0x64, 0x68, 0x74, 0x4f, 0x6b, 0x29, 0x3b, 0x74, 0x68, 0x69,
+        0x73, 0x2e, 0x73, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x54, 0x65, 0x78, 0x74, 0x28,
+        0x27, 0x6d, 0x71, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x27, 0x2c, 0x6d, 0x71, 0x4f, 0x6b, 0x29,
+        0x3b, 0x7d, 0x0a, 0x73, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x54, 0x65, 0x78, 0x74,
+        0x28, 0x69, 0x64, 0x2c, 0x6f, 0x6b, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x65, 0x6c,
+        0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65,
+        0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x69, 0x64, 0x29, 0x3b, 0x69, 0x66, 0x28,
+        0x21, 0x65, 0x6c, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x65, 0x6c, 0x2e, 0x74, 0x65,
+        0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x6f, 0x6b, 0x3f, 0x27, 0xd0, 0xbd,
+        0xd0, 0xbe, 0xd1, 0x80, 0xd0, 0xbc, 0xd0, 0xb0, 0x27, 0x3a, 0x27, 0xd0, 0xbd, 0xd0, 0xb5, 0xd1,
+        0x82, 0x20, 0xd0, 0xb4, 0xd0, 0xb0, 0xd0, 0xbd, 0xd0, 0xbd, 0xd1, 0x8b, 0xd1, 0x85, 0x27, 0x3b,
+        0x65, 0x6c, 0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d, 0x6f,
+        0x6b, 0x3f, 0x27, 0x23, 0x31, 0x36, 0x61, 0x33, 0x34, 0x61, 0x27, 0x3a, 0x27, 0x23, 0x64, 0x63,
+        0x32, 0x36, 0x32, 0x36, 0x27, 0x3b, 0x7d, 0x0a, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x44, 0x75,
+        0x73, 0x74, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x68,
+        0x61, 0x73, 0x3d, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x70, 0x6d, 0x31, 0x5f, 0x30, 0x21, 0x3d, 0x3d,
+        0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x26, 0x26, 0x64, 0x61, 0x74, 0x61, 0x2e,
+        0x70, 0x6d, 0x31, 0x5f, 0x30, 0x21, 0x3d, 0x3d, 0x6e, 0x75, 0x6c, 0x6c, 0x3b, 0x74, 0x68, 0x69,
+        0x73, 0x2e, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x52, 0x61, 0x77, 0x56, 0x61, 0x6c, 0x75, 0x65,
+        0x28, 0x27, 0x70, 0x6d, 0x31, 0x5f, 0x30, 0x27, 0x2c, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x70, 0x6d,
+        0x31, 0x5f, 0x30, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65,
+        0x52, 0x61, 0x77, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x28, 0x27, 0x70, 0x6d, 0x32, 0x5f, 0x35, 0x27,
+        0x2c, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x70, 0x6d, 0x32, 0x5f, 0x35, 0x29, 0x3b, 0x74, 0x68, 0x69,
+        0x73, 0x2e, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x52, 0x61, 0x77, 0x56, 0x61, 0x6c, 0x75, 0x65,
+        0x28, 0x27, 0x70, 0x6d, 0x31, 0x30, 0x27, 0x2c, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x70, 0x6d, 0x31,
+        0x30, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x74, 0x65, 0x78, 0x74, 0x3d, 0x64, 0x6f,
+        0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+        0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x70, 0x6d, 0x73, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73,
+        0x54, 0x65, 0x78, 0x74, 0x27, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x69, 0x6e, 0x66,
+        0x6f, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c,
+        0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x70, 0x6d, 0x73, 0x53, 0x74,
+        0x61, 0x74, 0x75, 0x73, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x74, 0x65, 0x78, 0x74, 0x29, 0x74,
+        0x65, 0x78, 0x74, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d,
+        0x68, 0x61, 0x73, 0x3f, 0x27, 0xd0, 0xbd, 0xd0, 0xbe, 0xd1, 0x80, 0xd0, 0xbc, 0xd0, 0xb0, 0x27,
+        0x3a, 0x27, 0xd0, 0xbf, 0xd1, 0x80, 0xd0, 0xbe, 0xd0, 0xb3, 0xd1, 0x80, 0xd0, 0xb5, 0xd0, 0xb2,
+        0x27, 0x3b, 0x69, 0x66, 0x28, 0x69, 0x6e, 0x66, 0x6f, 0x29, 0x7b, 0x69, 0x6e, 0x66, 0x6f, 0x2e,
+        0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x68, 0x61, 0x73, 0x3f,
+        0x27, 0xd0, 0xbd, 0xd0, 0xbe, 0xd1, 0x80, 0xd0, 0xbc, 0xd0, 0xb0, 0x27, 0x3a, 0x27, 0xd0, 0xbf,
+        0xd1, 0x80, 0xd0, 0xbe, 0xd0, 0xb3, 0xd1, 0x80, 0xd0, 0xb5, 0xd0, 0xb2, 0x27, 0x3b, 0x69, 0x6e,
+        0x66, 0x6f, 0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d, 0x68,
+        0x61, 0x73, 0x3f, 0x27, 0x23, 0x31, 0x36, 0x61, 0x33, 0x34, 0x61, 0x27, 0x3a, 0x27, 0x23, 0x64,
+        0x39, 0x37, 0x37, 0x30, 0x36, 0x27, 0x3b, 0x7d, 0x0a, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x65,
+        0x74, 0x42, 0x61, 0x72, 0x28, 0x27, 0x70, 0x6d, 0x31, 0x42, 0x61, 0x72, 0x27, 0x2c, 0x64, 0x61,
+        0x74, 0x61, 0x2e, 0x70, 0x6d, 0x31, 0x5f, 0x30, 0x2c, 0x31, 0x30, 0x30, 0x29, 0x3b, 0x74, 0x68,
+        0x69, 0x73, 0x2e, 0x73, 0x65, 0x74, 0x42, 0x61, 0x72, 0x28, 0x27, 0x70, 0x6d, 0x32, 0x35, 0x42,
+        0x61, 0x72, 0x27, 0x2c, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x70, 0x6d, 0x32, 0x5f, 0x35, 0x2c, 0x32,
+        0x35, 0x30, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x65, 0x74, 0x42, 0x61, 0x72, 0x28,
+        0x27, 0x70, 0x6d, 0x31, 0x30, 0x42, 0x61, 0x72, 0x27, 0x2c, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x70,
+        0x6d, 0x31, 0x30, 0x2c, 0x35, 0x30, 0x30, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x71,
+        0x75, 0x61, 0x6c, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74,
+        0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x70, 0x6d, 0x32,
+        0x35, 0x51, 0x75, 0x61, 0x6c, 0x69, 0x74, 0x79, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x71, 0x75,
+        0x61, 0x6c, 0x26, 0x26, 0x68, 0x61, 0x73, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x76,
+        0x3d, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x70, 0x6d, 0x32, 0x5f, 0x35, 0x3b, 0x63, 0x6f, 0x6e, 0x73,
+        0x74, 0x5b, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2c, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5d, 0x3d, 0x0a,
+        0x76, 0x3c, 0x3d, 0x31, 0x32, 0x3f, 0x5b, 0x27, 0xd0, 0xbe, 0xd1, 0x82, 0xd0, 0xbb, 0xd0, 0xb8,
+        0xd1, 0x87, 0xd0, 0xbd, 0xd1, 0x8b, 0xd0, 0xb9, 0x27, 0x2c, 0x27, 0x23, 0x31, 0x36, 0x61, 0x33,
+        0x34, 0x61, 0x27, 0x5d, 0x3a, 0x0a, 0x76, 0x3c, 0x3d, 0x33, 0x35, 0x3f, 0x5b, 0x27, 0xd1, 0x85,
+        0xd0, 0xbe, 0xd1, 0x80, 0xd0, 0xbe, 0xd1, 0x88, 0xd0, 0xb8, 0xd0, 0xb9, 0x27, 0x2c, 0x27, 0x23,
+        0x64, 0x39, 0x37, 0x37, 0x30, 0x36, 0x27, 0x5d, 0x3a, 0x0a, 0x76, 0x3c, 0x3d, 0x35, 0x35, 0x3f,
+        0x5b, 0x27, 0xd1, 0x83, 0xd0, 0xbc, 0xd0, 0xb5, 0xd1, 0x80, 0xd0, 0xb5, 0xd0, 0xbd, 0xd0, 0xbd,
+        0xd1, 0x8b, 0xd0, 0xb9, 0x27, 0x2c, 0x27, 0x23, 0x65, 0x36, 0x37, 0x65, 0x32, 0x32, 0x27, 0x5d,
+        0x3a, 0x0a, 0x76, 0x3c, 0x3d, 0x31, 0x35, 0x30, 0x3f, 0x5b, 0x27, 0xd0, 0xbd, 0xd0, 0xb5, 0xd0,
+        0xb7, 0xd0, 0xb4, 0xd0, 0xbe, 0xd1, 0x80, 0xd0, 0xbe, 0xd0, 0xb2, 0xd1, 0x8b, 0xd0, 0xb9, 0x27,
+        0x2c, 0x27, 0x23, 0x64, 0x63, 0x32, 0x36, 0x32, 0x36, 0x27, 0x5d, 0x3a, 0x0a, 0x5b, 0x27, 0xd0,
+        0xbe, 0xd0, 0xbf, 0xd0, 0xb0, 0xd1, 0x81, 0xd0, 0xbd, 0xd1, 0x8b, 0xd0, 0xb9, 0x27, 0x2c, 0x27,
+        0x23, 0x37, 0x63, 0x33, 0x61, 0x65, 0x64, 0x27, 0x5d, 0x3b, 0x71, 0x75, 0x61, 0x6c, 0x2e, 0x74,
+        0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x6c, 0x61, 0x62, 0x65, 0x6c,
+        0x3b, 0x71, 0x75, 0x61, 0x6c, 0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x6f, 0x6c, 0x6f,
+        0x72, 0x3d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3b, 0x7d, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+        0x61, 0x71, 0x69, 0x45, 0x6c, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67,
+        0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x61,
+        0x71, 0x69, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x27, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+        0x61, 0x71, 0x69, 0x4c, 0x62, 0x6c, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e,
+        0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27,
+        0x61, 0x71, 0x69, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x61, 0x71,
+        0x69, 0x45, 0x6c, 0x26, 0x26, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x61, 0x71, 0x69, 0x21, 0x3d, 0x6e,
+        0x75, 0x6c, 0x6c, 0x29, 0x7b, 0x61, 0x71, 0x69, 0x45, 0x6c, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43,
+        0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x61, 0x71, 0x69, 0x3b,
+        0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5b, 0x6c, 0x62, 0x6c, 0x2c, 0x63, 0x6f, 0x6c, 0x5d, 0x3d, 0x5b,
+        0x5b, 0x27, 0xd1, 0x85, 0xd0, 0xbe, 0xd1, 0x80, 0xd0, 0xbe, 0xd1, 0x88, 0xd0, 0xbe, 0x27, 0x2c,
+        0x27, 0x23, 0x31, 0x36, 0x61, 0x33, 0x34, 0x61, 0x27, 0x5d, 0x2c, 0x5b, 0x27, 0xd1, 0x83, 0xd0,
+        0xbc, 0xd0, 0xb5, 0xd1, 0x80, 0xd0, 0xb5, 0xd0, 0xbd, 0xd0, 0xbd, 0xd0, 0xbe, 0x27, 0x2c, 0x27,
+        0x23, 0x64, 0x39, 0x37, 0x37, 0x30, 0x36, 0x27, 0x5d, 0x2c, 0x5b, 0x27, 0xd1, 0x87, 0xd1, 0x83,
+        0xd0, 0xb2, 0xd1, 0x81, 0xd1, 0x82, 0xd0, 0xb2, 0xd0, 0xb8, 0xd1, 0x82, 0xd0, 0xb5, 0xd0, 0xbb,
+        0xd1, 0x8c, 0xd0, 0xbd, 0xd1, 0x8b, 0xd0, 0xbc, 0x27, 0x2c, 0x27, 0x23, 0x65, 0x36, 0x37, 0x65,
+        0x32, 0x32, 0x27, 0x5d, 0x2c, 0x5b, 0x27, 0xd0, 0xbd, 0xd0, 0xb5, 0xd0, 0xb7, 0xd0, 0xb4, 0xd0,
+        0xbe, 0xd1, 0x80, 0xd0, 0xbe, 0xd0, 0xb2, 0xd1, 0x8b, 0xd0, 0xb9, 0x27, 0x2c, 0x27, 0x23, 0x64,
+        0x63, 0x32, 0x36, 0x32, 0x36, 0x27, 0x5d, 0x2c, 0x5b, 0x27, 0xd0, 0xbe, 0xd1, 0x87, 0xd0, 0xb5,
+        0xd0, 0xbd, 0xd1, 0x8c, 0x20, 0xd0, 0xbd, 0xd0, 0xb5, 0xd0, 0xb7, 0xd0, 0xb4, 0xd0, 0xbe, 0xd1,
+        0x80, 0xd0, 0xbe, 0xd0, 0xb2, 0xd1, 0x8b, 0xd0, 0xb9, 0x27, 0x2c, 0x27, 0x23, 0x39, 0x33, 0x33,
+        0x33, 0x65, 0x61, 0x27, 0x5d, 0x2c, 0x5b, 0x27, 0xd0, 0xbe, 0xd0, 0xbf, 0xd0, 0xb0, 0xd1, 0x81,
+        0xd0, 0xbd, 0xd1, 0x8b, 0xd0, 0xb9, 0x27, 0x2c, 0x27, 0x23, 0x37, 0x63, 0x33, 0x61, 0x65, 0x64,
+        0x27, 0x5d, 0x2c, 0x5d, 0x5b, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x61, 0x71, 0x69, 0x5f, 0x63, 0x61,
+        0x74, 0x65, 0x67, 0x6f, 0x72, 0x79, 0x5d, 0x7c, 0x7c, 0x5b, 0x27, 0x2d, 0x2d, 0x27, 0x2c, 0x27,
+        0x23, 0x36, 0x62, 0x37, 0x32, 0x38, 0x30, 0x27, 0x5d, 0x3b, 0x61, 0x71, 0x69, 0x45, 0x6c, 0x2e,
+        0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d, 0x63, 0x6f, 0x6c, 0x3b,
+        0x69, 0x66, 0x28, 0x61, 0x71, 0x69, 0x4c, 0x62, 0x6c, 0x29, 0x7b, 0x61, 0x71, 0x69, 0x4c, 0x62,
+        0x6c, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x6c, 0x62,
+        0x6c, 0x3b, 0x61, 0x71, 0x69, 0x4c, 0x62, 0x6c, 0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63,
+        0x6f, 0x6c, 0x6f, 0x72, 0x3d, 0x63, 0x6f, 0x6c, 0x3b, 0x7d, 0x7d, 0x7d, 0x0a, 0x75, 0x70, 0x64,
+        0x61, 0x74, 0x65, 0x44, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29,
+        0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x66, 0x6d, 0x74, 0x3d, 0x28, 0x76, 0x2c, 0x75, 0x6e,
+        0x69, 0x74, 0x29, 0x3d, 0x3e, 0x28, 0x76, 0x21, 0x3d, 0x6e, 0x75, 0x6c, 0x6c, 0x3f, 0x60, 0x24,
+        0x7b, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x28, 0x76, 0x29, 0x2e, 0x74, 0x6f, 0x46, 0x69, 0x78,
+        0x65, 0x64, 0x28, 0x31, 0x29, 0x7d, 0x20, 0x24, 0x7b, 0x75, 0x6e, 0x69, 0x74, 0x7d, 0x60, 0x3a,
+        0x27, 0x2d, 0x2d, 0x27, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x65, 0x74, 0x54, 0x65,
+        0x78, 0x74, 0x28, 0x27, 0x68, 0x65, 0x61, 0x74, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x27, 0x2c, 0x60,
+        0xd0, 0xbe, 0xd1, 0x89, 0xd1, 0x83, 0xd1, 0x89, 0xd0, 0xb0, 0xd0, 0xb5, 0xd1, 0x82, 0xd1, 0x81,
+        0xd1, 0x8f, 0x20, 0x24, 0x7b, 0x66, 0x6d, 0x74, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x68, 0x65,
+        0x61, 0x74, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2c, 0x20, 0x27, 0xc2, 0xb0, 0x43, 0x27, 0x29,
+        0x7d, 0x60, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x65, 0x74, 0x54, 0x65, 0x78, 0x74,
+        0x28, 0x27, 0x64, 0x65, 0x77, 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x27, 0x2c, 0x60, 0xd1, 0x82, 0xd0,
+        0xbe, 0xd1, 0x87, 0xd0, 0xba, 0xd0, 0xb0, 0x20, 0xd1, 0x80, 0xd0, 0xbe, 0xd1, 0x81, 0xd1, 0x8b,
+        0x20, 0x24, 0x7b, 0x66, 0x6d, 0x74, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x64, 0x65, 0x77, 0x5f,
+        0x70, 0x6f, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x27, 0xc2, 0xb0, 0x43, 0x27, 0x29, 0x7d, 0x20, 0xc2,
+        0xb7, 0x20, 0x24, 0x7b, 0x66, 0x6d, 0x74, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x61, 0x62, 0x73,
+        0x5f, 0x68, 0x75, 0x6d, 0x69, 0x64, 0x69, 0x74, 0x79, 0x2c, 0x20, 0x27, 0xd0, 0xb3, 0x2f, 0xd0,
+        0xbc, 0xc2, 0xb3, 0x27, 0x29, 0x7d, 0x60, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x65,
+        0x74, 0x54, 0x65, 0x78, 0x74, 0x28, 0x27, 0x70, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x53,
+        0x65, 0x61, 0x27, 0x2c, 0x60, 0xd0, 0xbd, 0xd0, 0xb0, 0x20, 0xd1, 0x83, 0xd1, 0x80, 0xd0, 0xbe,
+        0xd0, 0xb2, 0xd0, 0xbd, 0xd0, 0xb5, 0x20, 0xd0, 0xbc, 0xd0, 0xbe, 0xd1, 0x80, 0xd1, 0x8f, 0x20,
+        0x24, 0x7b, 0x66, 0x6d, 0x74, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x70, 0x72, 0x65, 0x73, 0x73,
+        0x75, 0x72, 0x65, 0x5f, 0x73, 0x65, 0x61, 0x2c, 0x20, 0x27, 0xd0, 0xbc, 0xd0, 0xbc, 0x27, 0x29,
+        0x7d, 0x60, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x70, 0x72, 0x65, 0x73,
+        0x73, 0x75, 0x72, 0x65, 0x5f, 0x74, 0x72, 0x65, 0x6e, 0x64, 0x3d, 0x3d, 0x6e, 0x75, 0x6c, 0x6c,
+        0x29, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x65, 0x74, 0x54, 0x65, 0x78, 0x74, 0x28, 0x27,
+        0x70, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x54, 0x72, 0x65, 0x6e, 0x64, 0x27, 0x2c, 0x27,
+        0xd1, 0x82, 0xd0, 0xb5, 0xd0, 0xbd, 0xd0, 0xb4, 0xd0, 0xb5, 0xd0, 0xbd, 0xd1, 0x86, 0xd0, 0xb8,
+        0xd1, 0x8f, 0x3a, 0x20, 0xd0, 0xbd, 0xd0, 0xb0, 0xd0, 0xba, 0xd0, 0xbe, 0xd0, 0xbf, 0xd0, 0xbb,
+        0xd0, 0xb5, 0xd0, 0xbd, 0xd0, 0xb8, 0xd0, 0xb5, 0x20, 0xd0, 0xb4, 0xd0, 0xb0, 0xd0, 0xbd, 0xd0,
+        0xbd, 0xd1, 0x8b, 0xd1, 0x85, 0x27, 0x29, 0x3b, 0x7d, 0x65, 0x6c, 0x73, 0x65, 0x7b, 0x63, 0x6f,
+        0x6e, 0x73, 0x74, 0x20, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x3d, 0x5b, 0x27, 0xe2, 0x87, 0x8a, 0x27,
+        0x2c, 0x27, 0xe2, 0x86, 0x93, 0x27, 0x2c, 0x27, 0xe2, 0x86, 0x92, 0x27, 0x2c, 0x27, 0xe2, 0x86,
+        0x91, 0x27, 0x2c, 0x27, 0xe2, 0x87, 0x88, 0x27, 0x5d, 0x5b, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x74,
+        0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x79, 0x2b, 0x32, 0x5d, 0x7c, 0x7c, 0x27, 0x27, 0x3b, 0x63,
+        0x6f, 0x6e, 0x73, 0x74, 0x20, 0x64, 0x65, 0x6c, 0x74, 0x61, 0x3d, 0x4e, 0x75, 0x6d, 0x62, 0x65,
+        0x72, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x70, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x5f,
+        0x74, 0x72, 0x65, 0x6e, 0x64, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x69, 0x67,
+        0x6e, 0x3d, 0x64, 0x65, 0x6c, 0x74, 0x61, 0x3e, 0x30, 0x3f, 0x27, 0x2b, 0x27, 0x3a, 0x27, 0x27,
+        0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x65, 0x74, 0x54, 0x65, 0x78, 0x74, 0x28, 0x27, 0x70,
+        0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x54, 0x72, 0x65, 0x6e, 0x64, 0x27, 0x2c, 0x60, 0x24,
+        0x7b, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x7d, 0x20, 0x24, 0x7b, 0x73, 0x69, 0x67, 0x6e, 0x7d, 0x24,
+        0x7b, 0x64, 0x65, 0x6c, 0x74, 0x61, 0x2e, 0x74, 0x6f, 0x46, 0x69, 0x78, 0x65, 0x64, 0x28, 0x31,
+        0x29, 0x7d, 0x20, 0xd0, 0xb3, 0xd0, 0x9f, 0xd0, 0xb0, 0x2f, 0x33, 0xd1, 0x87, 0x20, 0xc2, 0xb7,
+        0x20, 0x24, 0x7b, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x66, 0x6f, 0x72, 0x65, 0x63, 0x61, 0x73, 0x74,
+        0x5f, 0x74, 0x65, 0x78, 0x74, 0x7d, 0x60, 0x29, 0x3b, 0x7d, 0x7d, 0x0a, 0x75, 0x70, 0x64, 0x61,
+        0x74, 0x65, 0x41, 0x69, 0x72, 0x4c, 0x65, 0x76, 0x65, 0x6c, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29,
+        0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x65, 0x6c, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
+        0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49,
+        0x64, 0x28, 0x27, 0x61, 0x69, 0x72, 0x4c, 0x65, 0x76, 0x65, 0x6c, 0x27, 0x29, 0x3b, 0x63, 0x6f,
+        0x6e, 0x73, 0x74, 0x20, 0x62, 0x6f, 0x78, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+        0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28,
+        0x27, 0x61, 0x69, 0x72, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x27, 0x29, 0x3b, 0x69, 0x66,
+        0x28, 0x21, 0x65, 0x6c, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x63, 0x6f, 0x6e, 0x73,
+        0x74, 0x20, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x3d, 0x5b, 0x5b, 0x27, 0xd1, 0x85, 0xd0, 0xbe, 0xd1,
+        0x80, 0xd0, 0xbe, 0xd1, 0x88, 0xd0, 0xbe, 0x27, 0x2c, 0x27, 0x23, 0x31, 0x36, 0x61, 0x33, 0x34,
+        0x61, 0x27, 0x5d, 0x2c, 0x5b, 0x27, 0xd1, 0x83, 0xd0, 0xbc, 0xd0, 0xb5, 0xd1, 0x80, 0xd0, 0xb5,
+        0xd0, 0xbd, 0xd0, 0xbd, 0xd0, 0xbe, 0x27, 0x2c, 0x27, 0x23, 0x64, 0x39, 0x37, 0x37, 0x30, 0x36,
+        0x27, 0x5d, 0x2c, 0x5b, 0x27, 0xd0, 0xbf, 0xd0, 0xbb, 0xd0, 0xbe, 0xd1, 0x85, 0xd0, 0xbe, 0x27,
+        0x2c, 0x27, 0x23, 0x65, 0x61, 0x35, 0x38, 0x30, 0x63, 0x27, 0x5d, 0x2c, 0x5b, 0x27, 0xd0, 0xbe,
+        0xd1, 0x87, 0xd0, 0xb5, 0xd0, 0xbd, 0xd1, 0x8c, 0x20, 0xd0, 0xbf, 0xd0, 0xbb, 0xd0, 0xbe, 0xd1,
+        0x85, 0xd0, 0xbe, 0x27, 0x2c, 0x27, 0x23, 0x64, 0x63, 0x32, 0x36, 0x32, 0x36, 0x27, 0x5d, 0x2c,
+        0x5d, 0x5b, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x61, 0x69, 0x72, 0x5f, 0x6c, 0x65, 0x76, 0x65, 0x6c,
+        0x5d, 0x3b, 0x69, 0x66, 0x28, 0x21, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x29, 0x7b, 0x65, 0x6c, 0x2e,
+        0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x27, 0x2d, 0x2d, 0x27,
+        0x3b, 0x65, 0x6c, 0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d,
+        0x27, 0x23, 0x36, 0x62, 0x37, 0x32, 0x38, 0x30, 0x27, 0x3b, 0x69, 0x66, 0x28, 0x62, 0x6f, 0x78,
+        0x29, 0x62, 0x6f, 0x78, 0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x62, 0x6f, 0x72, 0x64, 0x65,
+        0x72, 0x4c, 0x65, 0x66, 0x74, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x3d, 0x27, 0x23, 0x36, 0x62, 0x37,
+        0x32, 0x38, 0x30, 0x27, 0x3b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x7d, 0x0a, 0x63, 0x6f,
+        0x6e, 0x73, 0x74, 0x5b, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2c, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5d,
+        0x3d, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x3b, 0x65, 0x6c, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f,
+        0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3b, 0x65, 0x6c, 0x2e, 0x73,
+        0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+        0x3b, 0x69, 0x66, 0x28, 0x62, 0x6f, 0x78, 0x29, 0x62, 0x6f, 0x78, 0x2e, 0x73, 0x74, 0x79, 0x6c,
+        0x65, 0x2e, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x4c, 0x65, 0x66, 0x74, 0x43, 0x6f, 0x6c, 0x6f,
+        0x72, 0x3d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3b, 0x7d, 0x0a, 0x73, 0x65, 0x74, 0x42, 0x61, 0x72,
+        0x28, 0x69, 0x64, 0x2c, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2c, 0x6d, 0x61, 0x78, 0x29, 0x7b, 0x63,
+        0x6f, 0x6e, 0x73, 0x74, 0x20, 0x65, 0x6c, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+        0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28,
+        0x69, 0x64, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x21, 0x65, 0x6c, 0x7c, 0x7c, 0x76, 0x61, 0x6c, 0x75,
+        0x65, 0x3d, 0x3d, 0x6e, 0x75, 0x6c, 0x6c, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x63,
+        0x6f, 0x6e, 0x73, 0x74, 0x20, 0x70, 0x63, 0x74, 0x3d, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x6d, 0x69,
+        0x6e, 0x28, 0x31, 0x30, 0x30, 0x2c, 0x28, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2f, 0x6d, 0x61, 0x78,
+        0x29, 0x2a, 0x31, 0x30, 0x30, 0x29, 0x3b, 0x65, 0x6c, 0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e,
+        0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x60, 0x24, 0x7b, 0x70, 0x63, 0x74, 0x7d, 0x25, 0x60, 0x3b,
+        0x65, 0x6c, 0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f,
+        0x75, 0x6e, 0x64, 0x3d, 0x70, 0x63, 0x74, 0x3c, 0x33, 0x30, 0x3f, 0x27, 0x23, 0x31, 0x36, 0x61,
+        0x33, 0x34, 0x61, 0x27, 0x3a, 0x70, 0x63, 0x74, 0x3c, 0x36, 0x30, 0x3f, 0x27, 0x23, 0x64, 0x39,
+        0x37, 0x37, 0x30, 0x36, 0x27, 0x3a, 0x27, 0x23, 0x64, 0x63, 0x32, 0x36, 0x32, 0x36, 0x27, 0x3b,
+        0x7d, 0x0a, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x52, 0x61, 0x77, 0x56, 0x61, 0x6c, 0x75, 0x65,
+        0x28, 0x69, 0x64, 0x2c, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+        0x20, 0x65, 0x6c, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74,
+        0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x69, 0x64, 0x29, 0x3b,
+        0x69, 0x66, 0x28, 0x65, 0x6c, 0x29, 0x65, 0x6c, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e,
+        0x74, 0x65, 0x6e, 0x74, 0x3d, 0x28, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x21, 0x3d, 0x6e, 0x75, 0x6c,
+        0x6c, 0x29, 0x3f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x27, 0x2d, 0x2d, 0x27, 0x3b, 0x7d, 0x0a,
+        0x73, 0x65, 0x74, 0x75, 0x70, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e,
+        0x65, 0x72, 0x73, 0x28, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x72, 0x65, 0x66, 0x72,
+        0x65, 0x73, 0x68, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74,
+        0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x72, 0x65, 0x66,
+        0x72, 0x65, 0x73, 0x68, 0x42, 0x74, 0x6e, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x72, 0x65, 0x66,
+        0x72, 0x65, 0x73, 0x68, 0x29, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x2e, 0x61, 0x64, 0x64,
+        0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x27, 0x63,
+        0x6c, 0x69, 0x63, 0x6b, 0x27, 0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x66,
+        0x65, 0x74, 0x63, 0x68, 0x44, 0x61, 0x74, 0x61, 0x28, 0x29, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73,
+        0x74, 0x20, 0x70, 0x61, 0x75, 0x73, 0x65, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+        0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28,
+        0x27, 0x70, 0x61, 0x75, 0x73, 0x65, 0x42, 0x74, 0x6e, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x70,
+        0x61, 0x75, 0x73, 0x65, 0x29, 0x70, 0x61, 0x75, 0x73, 0x65, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76,
+        0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x27, 0x63, 0x6c, 0x69,
+        0x63, 0x6b, 0x27, 0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x69, 0x73,
+        0x50, 0x61, 0x75, 0x73, 0x65, 0x64, 0x3d, 0x21, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x69, 0x73, 0x50,
+        0x61, 0x75, 0x73, 0x65, 0x64, 0x3b, 0x70, 0x61, 0x75, 0x73, 0x65, 0x2e, 0x74, 0x65, 0x78, 0x74,
+        0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x69, 0x73, 0x50,
+        0x61, 0x75, 0x73, 0x65, 0x64, 0x3f, 0x27, 0xd0, 0x9f, 0xd1, 0x80, 0xd0, 0xbe, 0xd0, 0xb4, 0xd0,
+        0xbe, 0xd0, 0xbb, 0xd0, 0xb6, 0xd0, 0xb8, 0xd1, 0x82, 0xd1, 0x8c, 0x27, 0x3a, 0x27, 0xd0, 0x9f,
+        0xd0, 0xb0, 0xd1, 0x83, 0xd0, 0xb7, 0xd0, 0xb0, 0x27, 0x3b, 0x70, 0x61, 0x75, 0x73, 0x65, 0x2e,
+        0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65,
+        0x28, 0x27, 0x70, 0x61, 0x75, 0x73, 0x65, 0x64, 0x27, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x69,
+        0x73, 0x50, 0x61, 0x75, 0x73, 0x65, 0x64, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x21, 0x74, 0x68, 0x69,
+        0x73, 0x2e, 0x69, 0x73, 0x50, 0x61, 0x75, 0x73, 0x65, 0x64, 0x29, 0x7b, 0x74, 0x68, 0x69, 0x73,
+        0x2e, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x64, 0x6f, 0x77, 0x6e, 0x3d, 0x4d, 0x61, 0x74, 0x68, 0x2e,
+        0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x75, 0x72, 0x72, 0x65,
+        0x6e, 0x74, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x2f, 0x31, 0x30, 0x30, 0x30, 0x29,
+        0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x66, 0x65, 0x74, 0x63, 0x68, 0x44, 0x61, 0x74, 0x61, 0x28,
+        0x29, 0x3b, 0x7d, 0x7d, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x6c, 0x65, 0x61,
+        0x72, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c,
+        0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x63, 0x6c, 0x65, 0x61, 0x72,
+        0x42, 0x74, 0x6e, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x29, 0x63,
+        0x6c, 0x65, 0x61, 0x72, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73,
+        0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x27, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x27, 0x2c, 0x28, 0x29,
+        0x3d, 0x3e, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x68, 0x61, 0x72, 0x74, 0x73, 0x2e, 0x66,
+        0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x63, 0x3d, 0x3e, 0x63, 0x2e, 0x63, 0x6c, 0x65, 0x61,
+        0x72, 0x28, 0x29, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x61, 0x64, 0x64, 0x4c, 0x6f, 0x67,
+        0x45, 0x6e, 0x74, 0x72, 0x79, 0x28, 0x27, 0xd0, 0x93, 0xd1, 0x80, 0xd0, 0xb0, 0xd1, 0x84, 0xd0,
+        0xb8, 0xd0, 0xba, 0xd0, 0xb8, 0x20, 0xd0, 0xbe, 0xd1, 0x87, 0xd0, 0xb8, 0xd1, 0x89, 0xd0, 0xb5,
+        0xd0, 0xbd, 0xd1, 0x8b, 0x27, 0x29, 0x3b, 0x7d, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+        0x73, 0x6c, 0x69, 0x64, 0x65, 0x72, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e,
+        0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27,
+        0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x27, 0x29,
+        0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x6c, 0x69, 0x64, 0x65, 0x72, 0x56, 0x61, 0x6c,
+        0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65,
+        0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x76,
+        0x61, 0x6c, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x73, 0x6c, 0x69,
+        0x64, 0x65, 0x72, 0x26, 0x26, 0x73, 0x6c, 0x69, 0x64, 0x65, 0x72, 0x56, 0x61, 0x6c, 0x29, 0x7b,
+        0x73, 0x6c, 0x69, 0x64, 0x65, 0x72, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c,
+        0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x27, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x27, 0x2c,
+        0x65, 0x3d, 0x3e, 0x73, 0x6c, 0x69, 0x64, 0x65, 0x72, 0x56, 0x61, 0x6c, 0x2e, 0x74, 0x65, 0x78,
+        0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x65, 0x2e, 0x74, 0x61, 0x72, 0x67, 0x65,
+        0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x3b, 0x73, 0x6c, 0x69, 0x64, 0x65, 0x72, 0x2e,
+        0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72,
+        0x28, 0x27, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x27, 0x2c, 0x65, 0x3d, 0x3e, 0x74, 0x68, 0x69,
+        0x73, 0x2e, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x50, 0x6f, 0x6c, 0x6c, 0x69, 0x6e, 0x67, 0x49,
+        0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x28, 0x70, 0x61, 0x72, 0x73, 0x65, 0x49, 0x6e, 0x74,
+        0x28, 0x65, 0x2e, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29,
+        0x29, 0x29, 0x3b, 0x7d, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3d,
+        0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d,
+        0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x61, 0x75, 0x74, 0x6f, 0x52, 0x65, 0x66,
+        0x72, 0x65, 0x73, 0x68, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x61, 0x75, 0x74, 0x6f, 0x29, 0x61,
+        0x75, 0x74, 0x6f, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74,
+        0x65, 0x6e, 0x65, 0x72, 0x28, 0x27, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x27, 0x2c, 0x65, 0x3d,
+        0x3e, 0x7b, 0x69, 0x66, 0x28, 0x21, 0x65, 0x2e, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x2e, 0x63,
+        0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x29, 0x7b, 0x69, 0x66, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e,
+        0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x29, 0x7b,
+        0x63, 0x6c, 0x65, 0x61, 0x72, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x28, 0x74, 0x68,
+        0x69, 0x73, 0x2e, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61,
+        0x6c, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x49, 0x6e,
+        0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x3d, 0x6e, 0x75, 0x6c, 0x6c, 0x3b, 0x7d, 0x0a, 0x69, 0x66,
+        0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x64, 0x6f, 0x77, 0x6e, 0x49,
+        0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x29, 0x7b, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x49, 0x6e,
+        0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x6f, 0x75, 0x6e,
+        0x74, 0x64, 0x6f, 0x77, 0x6e, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x29, 0x3b, 0x74,
+        0x68, 0x69, 0x73, 0x2e, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x64, 0x6f, 0x77, 0x6e, 0x49, 0x6e, 0x74,
+        0x65, 0x72, 0x76, 0x61, 0x6c, 0x3d, 0x6e, 0x75, 0x6c, 0x6c, 0x3b, 0x7d, 0x0a, 0x74, 0x68, 0x69,
+        0x73, 0x2e, 0x73, 0x65, 0x74, 0x54, 0x65, 0x78, 0x74, 0x28, 0x27, 0x6e, 0x65, 0x78, 0x74, 0x55,
+        0x70, 0x64, 0x61, 0x74, 0x65, 0x27, 0x2c, 0x27, 0xd0, 0xb2, 0xd1, 0x8b, 0xd0, 0xba, 0xd0, 0xbb,
+        0x27, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x61, 0x64, 0x64, 0x4c, 0x6f, 0x67, 0x45, 0x6e,
+        0x74, 0x72, 0x79, 0x28, 0x27, 0xd0, 0x90, 0xd0, 0xb2, 0xd1, 0x82, 0xd0, 0xbe, 0xd0, 0xbe, 0xd0,
+        0xb1, 0xd0, 0xbd, 0xd0, 0xbe, 0xd0, 0xb2, 0xd0, 0xbb, 0xd0, 0xb5, 0xd0, 0xbd, 0xd0, 0xb8, 0xd0,
+        0xb5, 0x20, 0xd0, 0xbe, 0xd1, 0x82, 0xd0, 0xba, 0xd0, 0xbb, 0xd1, 0x8e, 0xd1, 0x87, 0xd0, 0xb5,
+        0xd0, 0xbd, 0xd0, 0xbe, 0x27, 0x29, 0x3b, 0x7d, 0x65, 0x6c, 0x73, 0x65, 0x7b, 0x74, 0x68, 0x69,
+        0x73, 0x2e, 0x73, 0x74, 0x61, 0x72, 0x74, 0x50, 0x6f, 0x6c, 0x6c, 0x69, 0x6e, 0x67, 0x28, 0x29,
+        0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x61, 0x64, 0x64, 0x4c, 0x6f, 0x67, 0x45, 0x6e, 0x74, 0x72,
+        0x79, 0x28, 0x27, 0xd0, 0x90, 0xd0, 0xb2, 0xd1, 0x82, 0xd0, 0xbe, 0xd0, 0xbe, 0xd0, 0xb1, 0xd0,
+        0xbd, 0xd0, 0xbe, 0xd0, 0xb2, 0xd0, 0xbb, 0xd0, 0xb5, 0xd0, 0xbd, 0xd0, 0xb8, 0xd0, 0xb5, 0x20,
+        0xd0, 0xb2, 0xd0, 0xba, 0xd0, 0xbb, 0xd1, 0x8e, 0xd1, 0x87, 0xd0, 0xb5, 0xd0, 0xbd, 0xd0, 0xbe,
+        0x27, 0x29, 0x3b, 0x7d, 0x7d, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x6c, 0x65,
+        0x61, 0x72, 0x4c, 0x6f, 0x67, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67,
+        0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x63,
+        0x6c, 0x65, 0x61, 0x72, 0x4c, 0x6f, 0x67, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x63, 0x6c, 0x65,
+        0x61, 0x72, 0x4c, 0x6f, 0x67, 0x29, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x4c, 0x6f, 0x67, 0x2e, 0x61,
+        0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28,
+        0x27, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x27, 0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x63, 0x6f, 0x6e,
+        0x73, 0x74, 0x20, 0x6c, 0x6f, 0x67, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e,
+        0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27,
+        0x65, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x6f, 0x67, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x6c, 0x6f,
+        0x67, 0x29, 0x6c, 0x6f, 0x67, 0x2e, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x48, 0x54, 0x4d, 0x4c, 0x3d,
+        0x60, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x6c, 0x6f, 0x67,
+        0x2d, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x22, 0x3e, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x63, 0x6c,
+        0x61, 0x73, 0x73, 0x3d, 0x22, 0x6c, 0x6f, 0x67, 0x2d, 0x74, 0x69, 0x6d, 0x65, 0x22, 0x3e, 0x5b,
+        0x24, 0x7b, 0x6e, 0x65, 0x77, 0x20, 0x44, 0x61, 0x74, 0x65, 0x28, 0x29, 0x2e, 0x74, 0x6f, 0x4c,
+        0x6f, 0x63, 0x61, 0x6c, 0x65, 0x54, 0x69, 0x6d, 0x65, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28,
+        0x29, 0x7d, 0x5d, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x20, 0xd0, 0x96, 0xd1, 0x83, 0xd1,
+        0x80, 0xd0, 0xbd, 0xd0, 0xb0, 0xd0, 0xbb, 0x20, 0xd0, 0xbe, 0xd1, 0x87, 0xd0, 0xb8, 0xd1, 0x89,
+        0xd0, 0xb5, 0xd0, 0xbd, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x60, 0x3b, 0x7d, 0x29, 0x3b, 0x7d,
+        0x0a, 0x61, 0x64, 0x64, 0x4c, 0x6f, 0x67, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x28, 0x6d, 0x65, 0x73,
+        0x73, 0x61, 0x67, 0x65, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6c, 0x6f, 0x67, 0x3d,
+        0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d,
+        0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x6f,
+        0x67, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x21, 0x6c, 0x6f, 0x67, 0x29, 0x72, 0x65, 0x74, 0x75,
+        0x72, 0x6e, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x3d, 0x64,
+        0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c,
+        0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x27, 0x64, 0x69, 0x76, 0x27, 0x29, 0x3b, 0x65, 0x6e, 0x74,
+        0x72, 0x79, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x27, 0x6c, 0x6f,
+        0x67, 0x2d, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x27, 0x3b, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x2e, 0x69,
+        0x6e, 0x6e, 0x65, 0x72, 0x48, 0x54, 0x4d, 0x4c, 0x3d, 0x60, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20,
+        0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x6c, 0x6f, 0x67, 0x2d, 0x74, 0x69, 0x6d, 0x65, 0x22,
+        0x3e, 0x5b, 0x24, 0x7b, 0x6e, 0x65, 0x77, 0x20, 0x44, 0x61, 0x74, 0x65, 0x28, 0x29, 0x2e, 0x74,
+        0x6f, 0x4c, 0x6f, 0x63, 0x61, 0x6c, 0x65, 0x54, 0x69, 0x6d, 0x65, 0x53, 0x74, 0x72, 0x69, 0x6e,
+        0x67, 0x28, 0x29, 0x7d, 0x5d, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x20, 0x24, 0x7b, 0x6d,
+        0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x7d, 0x60, 0x3b, 0x6c, 0x6f, 0x67, 0x2e, 0x61, 0x70, 0x70,
+        0x65, 0x6e, 0x64, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x29, 0x3b,
+        0x6c, 0x6f, 0x67, 0x2e, 0x73, 0x63, 0x72, 0x6f, 0x6c, 0x6c, 0x54, 0x6f, 0x70, 0x3d, 0x6c, 0x6f,
+        0x67, 0x2e, 0x73, 0x63, 0x72, 0x6f, 0x6c, 0x6c, 0x48, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3b, 0x77,
+        0x68, 0x69, 0x6c, 0x65, 0x28, 0x6c, 0x6f, 0x67, 0x2e, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x72, 0x65,
+        0x6e, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3e, 0x35, 0x30, 0x29, 0x6c, 0x6f, 0x67, 0x2e,
+        0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x6c, 0x6f, 0x67, 0x2e,
+        0x66, 0x69, 0x72, 0x73, 0x74, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x29, 0x3b, 0x7d, 0x7d, 0x0a, 0x77,
+        0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69,
+        0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x27, 0x6c, 0x6f, 0x61, 0x64, 0x27, 0x2c, 0x28, 0x29,
+        0x3d, 0x3e, 0x7b, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72,
+        0x4d, 0x6f, 0x6e, 0x69, 0x74, 0x6f, 0x72, 0x3d, 0x6e, 0x65, 0x77, 0x20, 0x53, 0x65, 0x6e, 0x73,
+        0x6f, 0x72, 0x4d, 0x6f, 0x6e, 0x69, 0x74, 0x6f, 0x72, 0x28, 0x29, 0x3b, 0x7d, 0x29, 0x3b, 0x3c,
+        0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x0a, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e,
+        0x0a, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e,
+};
+
+static const web_asset_variant_t s_page_html[] = {
+        {"br", "\"9a0dead6de03c4c9\"", s_page_html_br, sizeof(s_page_html_br)},
+        {"gzip", "\"f382cdadae817936\"", s_page_html_gzip, sizeof(s_page_html_gzip)},
+        {"identity", "\"4d8902b2831a1e60\"", s_page_html_identity, sizeof(s_page_html_identity)},
+};
+
+const web_asset_t web_assets[] = {
+        {"/", "text/html; charset=utf-8", "no-cache", s_page_html, sizeof(s_page_html) / sizeof(s_page_html[0])},
+};
+
+const size_t web_asset_count = sizeof(web_assets) / sizeof(web_assets[0]);
@@ -1,61 +1,197 @@
 #include "webserver.h"
+#include <errno.h>
+#include <math.h>
+#include <stdarg.h>
 #include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <strings.h>
+#include "config.h"
 #include "esp_err.h"
 #include "esp_http_server.h"
 #include "esp_log.h"
-#include "relay.h"
+#include "esp_random.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include "metrics.h"
+#include "power.h"
+#include "query.h"
+#include "rules.h"
+#include "sample_downsample.h"
+#include "sample_store.h"
 #include "sensor_data.h"
+#include "sensor_stats.h"
+#include "task_profile.h"
+#include "web_assets.h"
 
 static const char* TAG = "WEB";
 
-extern const uint8_t _binary_page_html_gz_start[];
-extern const uint8_t _binary_page_html_gz_end[];
-extern const uint8_t _binary_style_css_gz_start[];
-extern const uint8_t _binary_style_css_gz_end[];
-extern const uint8_t _binary_script_js_gz_start[];
-extern const uint8_t _binary_script_js_gz_end[];
+static QueueHandle_t s_work_queue = NULL;
 
-static esp_err_t root_handler(httpd_req_t* req)
+// q-значение в тысячных: "0.5" -> 500; ошибка — 0
+static int parse_q(const char* p)
 {
-    const uint8_t* data = _binary_page_html_gz_start;
-    size_t size = _binary_page_html_gz_end - _binary_page_html_gz_start;
-    httpd_resp_set_type(req, "text/html; charset=utf-8");
-    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
-    httpd_resp_set_hdr(req, "Connection", "close");
-    httpd_resp_set_hdr(req, "Cache-Control", "no-cache, no-store, must-revalidate");
-    httpd_resp_set_hdr(req, "Pragma", "no-cache");
-    httpd_resp_set_hdr(req, "Expires", "0");
-    httpd_resp_send(req, (const char*)data, size);
-    return ESP_OK;
+    if (*p == '1') {
+        return 1000;
+    }
+    if (*p != '0') {
+        return 0;
+    }
+    int q = 0, scale = 100;
+    if (*++p == '.') {
+        while (*++p >= '0' && *p <= '9' && scale > 0) {
+            q += (*p - '0') * scale;
+            scale /= 10;
+        }
+    }
+    return q;
 }
 
-static esp_err_t css_handler(httpd_req_t* req)
+// q-значение кодировки в Accept-Encoding (0..1000); для не
+// перечисленной — значение "*", а без "*" -1
+static int accept_q(const char* accept, const char* coding)
 {
-    const uint8_t* data = _binary_style_css_gz_start;
-    size_t size = _binary_style_css_gz_end - _binary_style_css_gz_start;
-    httpd_resp_set_type(req, "text/css; charset=utf-8");
-    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
-    httpd_resp_set_hdr(req, "Connection", "close");
-    httpd_resp_send(req, (const char*)data, size);
-    return ESP_OK;
+    int star = -1;
+    const char* p = accept;
+
+    while (*p != '\0') {
+        while (*p == ' ' || *p == ',') {
+            p++;
+        }
+        const char* tok = p;
+        while (*p != '\0' && *p != ',' && *p != ';' && *p != ' ') {
+            p++;
+        }
+        size_t len = p - tok;
+
+        int q = 1000;
+        while (*p != '\0' && *p != ',') {
+            if (*p == ';') {
+                p++;
+                while (*p == ' ') {
+                    p++;
+                }
+                if ((p[0] == 'q' || p[0] == 'Q') && p[1] == '=') {
+                    q = parse_q(p + 2);
+                }
+                continue;
+            }
+            p++;
+        }
+
+        if (len == strlen(coding) && strncasecmp(tok, coding, len) == 0) {
+            return q;
+        }
+        if (len == 1 && *tok == '*') {
+            star = q;
+        }
+    }
+    return star;
 }
 
-static esp_err_t js_handler(httpd_req_t* req)
+// Вариант с наибольшим q, при равенстве — раньше в таблице (сжат
+// лучше). identity допустим, если его не запретили явно, но только
+// когда ничего другого не подошло. Без Accept-Encoding — identity:
+// так отвечают клиенты, не умеющие распаковывать. NULL — 406.
+static const web_asset_variant_t* asset_pick(
+        httpd_req_t* req, const web_asset_t* asset)
 {
-    const uint8_t* data = _binary_script_js_gz_start;
-    size_t size = _binary_script_js_gz_end - _binary_script_js_gz_start;
-    httpd_resp_set_type(req, "application/javascript; charset=utf-8");
-    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
-    httpd_resp_set_hdr(req, "Connection", "close");
-    httpd_resp_send(req, (const char*)data, size);
-    return ESP_OK;
+    char accept[128];
+    esp_err_t err = httpd_req_get_hdr_value_str(
+            req, "Accept-Encoding", accept, sizeof(accept));
+    if (err != ESP_OK && err != ESP_ERR_HTTPD_RESULT_TRUNC) {
+        strcpy(accept, "identity");
+    }
+
+    const web_asset_variant_t* best = NULL;
+    int best_q = 0;
+    for (size_t i = 0; i < asset->variant_count; i++) {
+        const web_asset_variant_t* v = &asset->variants[i];
+        int q = accept_q(accept, v->encoding);
+        if (q < 0) {
+            q = strcmp(v->encoding, "identity") == 0 ? 1 : 0;
+        }
+        if (q > best_q) {
+            best = v;
+            best_q = q;
+        }
+    }
+    return best;
 }
 
-static esp_err_t get_handler(httpd_req_t* req)
+static esp_err_t asset_handler(httpd_req_t* req)
 {
-    float temperature = sensor_data_get_temp_avg();
+    const web_asset_t* asset = (const web_asset_t*)req->user_ctx;
+    const web_asset_variant_t* v = asset_pick(req, asset);
+
+    // Ответ зависит от Accept-Encoding — кэши должны это учитывать
+    httpd_resp_set_hdr(req, "Vary", "Accept-Encoding");
+    if (v == NULL) {
+        httpd_resp_set_status(req, "406 Not Acceptable");
+        return httpd_resp_send(req, NULL, 0);
+    }
+
+    httpd_resp_set_type(req, asset->mime);
+    if (strcmp(v->encoding, "identity") != 0) {
+        httpd_resp_set_hdr(req, "Content-Encoding", v->encoding);
+    }
+    httpd_resp_set_hdr(req, "Cache-Control", asset->cache_control);
+    httpd_resp_set_hdr(req, "ETag", v->etag);
+
+    char inm[40];
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", inm, sizeof(inm))
+                == ESP_OK
+        && strcmp(inm, v->etag) == 0) {
+        httpd_resp_set_status(req, "304 Not Modified");
+        return httpd_resp_send(req, NULL, 0);
+    }
+    return httpd_resp_send(req, (const char*)v->data, v->size);
+}
+
+// Ответ в буфере фиксированного размера: после первого переполнения
+// дописывание прекращается, проверка full — одна в конце
+typedef struct {
+    char* buf;
+    size_t size;
+    size_t len;
+    bool full;
+} resp_buf_t;
+
+static void resp_printf(resp_buf_t* b, const char* fmt, ...)
+{
+    if (b->full) {
+        return;
+    }
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(b->buf + b->len, b->size - b->len, fmt, ap);
+    va_end(ap);
+    if (n < 0 || (size_t)n >= b->size - b->len) {
+        b->full = true;
+        return;
+    }
+    b->len += n;
+}
+
+// "key":x.xx, — null, если значения нет или оно не число (NaN, Inf)
+static void resp_number(resp_buf_t* b, const char* key, float v, bool valid)
+{
+    if (valid && isfinite(v)) {
+        resp_printf(b, "\"%s\":%.2f,", key, v);
+    } else {
+        resp_printf(b, "\"%s\":null,", key);
+    }
+}
+
+// Неизменная часть ответа /get: всё, кроме возраста выборок.
+// Заканчивается запятой; -1 — не поместилась
+static int get_build(char* buf, size_t size)
+{
+    float temperature, temp_confidence;
+    sensor_data_get_temp_fused(&temperature, &temp_confidence);
 
     float t_dht, humidity;
     uint8_t dht_valid;
@@ -69,42 +205,169 @@ static esp_err_t get_handler(httpd_req_t* req)
 
     float co2_ppm, lpg_ppm, co_ppm, nh3_ppm;
     sensor_data_get_mq(&co2_ppm, &lpg_ppm, &co_ppm, &nh3_ppm);
+    bool mq_fresh = sensor_data_is_fresh(SENSOR_MQ);
 
     uint16_t pm1_0, pm2_5, pm10;
     uint8_t pms_valid;
     sensor_data_get_pms5003(&pm1_0, &pm2_5, &pm10, &pms_valid);
 
-    char buf[384];
-    int len;
-    if (pms_valid) {
-        len = snprintf(
-            buf, sizeof(buf),
-            "{\"temperature\":%.2f,\"humidity\":%.2f,\"pressure\":%.2f,"
-            "\"CO2\":%.2f,\"CO\":%.2f,\"NH3\":%.2f,\"LPG\":%.2f,"
-            "\"dht_valid\":%d,\"bmp_valid\":%d,"
-            "\"pm1_0\":%u,\"pm2_5\":%u,\"pm10\":%u}",
-            temperature, humidity, pressure,
-            co2_ppm, co_ppm, nh3_ppm, lpg_ppm,
-            dht_valid ? 1 : 0, bmp_valid ? 1 : 0,
-            pm1_0, pm2_5, pm10);
+    derived_metrics_t derived;
+    sensor_data_get_derived(&derived);
+
+    pressure_trend_t trend;
+    sensor_data_get_trend(&trend);
+
+    resp_buf_t b = {.buf = buf, .size = size};
+    resp_printf(&b, "{");
+    resp_number(&b, "temperature", temperature, true);
+    resp_number(&b, "humidity", humidity, true);
+    resp_number(&b, "pressure", pressure, true);
+    resp_number(&b, "temp_confidence", temp_confidence, true);
+    resp_printf(&b,
+                "\"dht_valid\":%d,\"bmp_valid\":%d,",
+                dht_valid ? 1 : 0,
+                bmp_valid ? 1 : 0);
+
+    resp_number(&b, "CO2", co2_ppm, mq_fresh);
+    resp_number(&b, "CO", co_ppm, mq_fresh);
+    resp_number(&b, "NH3", nh3_ppm, mq_fresh);
+    resp_number(&b, "LPG", lpg_ppm, mq_fresh);
+    if (mq_fresh) {
+        resp_printf(&b, "\"air_level\":%u,", derived.air_level);
     } else {
-        len = snprintf(
-            buf, sizeof(buf),
-            "{\"temperature\":%.2f,\"humidity\":%.2f,\"pressure\":%.2f,"
-            "\"CO2\":%.2f,\"CO\":%.2f,\"NH3\":%.2f,\"LPG\":%.2f,"
-            "\"dht_valid\":%d,\"bmp_valid\":%d,"
-            "\"pm1_0\":null,\"pm2_5\":null,\"pm10\":null}",
-            temperature, humidity, pressure,
-            co2_ppm, co_ppm, nh3_ppm, lpg_ppm,
-            dht_valid ? 1 : 0, bmp_valid ? 1 : 0);
-    }
-
-    ESP_LOGI(TAG, "Отправляем JSON: %s", buf);
+        resp_printf(&b, "\"air_level\":null,");
+    }
+
+    if (pms_valid && derived.aqi != DERIVED_AQI_NONE) {
+        resp_printf(&b,
+                    "\"pm1_0\":%u,\"pm2_5\":%u,\"pm10\":%u,"
+                    "\"aqi\":%d,\"aqi_category\":%u,",
+                    pm1_0,
+                    pm2_5,
+                    pm10,
+                    derived.aqi,
+                    derived.aqi_category);
+    } else {
+        resp_printf(&b,
+                    "\"pm1_0\":null,\"pm2_5\":null,\"pm10\":null,"
+                    "\"aqi\":null,\"aqi_category\":null,");
+    }
+
+    bool humid = dht_valid && derived.humidity_valid;
+    resp_number(&b, "dew_point", derived.dew_point, humid);
+    resp_number(&b, "abs_humidity", derived.abs_humidity, humid);
+    resp_number(&b, "heat_index", derived.heat_index, humid);
+    resp_number(&b,
+                "pressure_sea",
+                derived.sea_level_pressure,
+                bmp_valid && derived.pressure_valid);
+
+    resp_number(&b, "pressure_trend", trend.delta_3h_hpa, trend.valid);
+    if (trend.valid) {
+        resp_printf(&b,
+                    "\"tendency\":%d,\"forecast\":%u,"
+                    "\"forecast_text\":\"%s\",",
+                    trend.tendency,
+                    trend.zambretti,
+                    pressure_trend_forecast_text(trend.zambretti));
+    } else {
+        resp_printf(&b,
+                    "\"tendency\":null,\"forecast\":null,"
+                    "\"forecast_text\":null,");
+    }
+
+    if (!b.full) {
+        int n = sensor_data_format_times(b.buf + b.len, b.size - b.len);
+        b.full = n < 0 || (size_t)n >= b.size - b.len;
+        b.len += b.full ? 0 : (size_t)n;
+    }
+    resp_printf(&b, ",");
+    return b.full ? -1 : (int)b.len;
+}
+
+// Кэш /get: ответ собирается один раз на версию sensor_data и
+// отдаётся всем клиентам до следующей версии. /get не уходит в пул
+// (async = false в s_routes) и выполняется только задачей httpd, по
+// одному запросу, поэтому слот один и без блокировок.
+#define GET_CACHE_SIZE 1152
+
+typedef struct {
+    char body[GET_CACHE_SIZE];
+    int len; // -1 — пусто или не поместилось
+    uint32_t gen;
+    uint8_t fresh;
+    char etag[32];
+} get_cache_t;
+
+static get_cache_t s_get_cache = {.len = -1};
+static uint32_t s_boot_id; // ETag не совпадёт с выданным до перезагрузки
+
+// Ответ для версии gen; пересобирается, только если версия другая
+static const get_cache_t* get_cache_update(uint32_t gen, uint8_t fresh)
+{
+    get_cache_t* c = &s_get_cache;
+    if (c->len >= 0 && c->gen == gen && c->fresh == fresh) {
+        return c;
+    }
+
+    c->len = get_build(c->body, sizeof(c->body));
+    c->gen = gen;
+    c->fresh = fresh;
+    snprintf(
+            c->etag,
+            sizeof(c->etag),
+            "W/\"%08lx-%lx-%x\"",
+            (unsigned long)s_boot_id,
+            (unsigned long)gen,
+            fresh);
+    ESP_LOGD(TAG, "Ответ /get пересобран, версия %lu", (unsigned long)gen);
+    return c;
+}
+
+// Возраст выборок меняется с каждым запросом и дописывается отдельно,
+// поэтому ETag слабый: тело с той же версией равнозначно, но не
+// побайтно то же
+static esp_err_t get_send(httpd_req_t* req, const char* body, int len)
+{
+    char tail[160];
+    int n = sensor_data_format_ages(tail, sizeof(tail) - 1);
+    if (len < 0 || n < 0 || (size_t)n + 1 >= sizeof(tail)) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, NULL);
+        return ESP_FAIL;
+    }
+    tail[n++] = '}';
+
+    if (httpd_resp_send_chunk(req, body, len) != ESP_OK
+        || httpd_resp_send_chunk(req, tail, n) != ESP_OK) {
+        return ESP_FAIL;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+static esp_err_t get_handler(httpd_req_t* req)
+{
+    uint8_t fresh;
+    uint32_t gen = sensor_data_get_generation(&fresh);
+
     httpd_resp_set_type(req, "application/json");
     httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
     httpd_resp_set_hdr(req, "Connection", "close");
-    httpd_resp_send(req, buf, len);
-    return ESP_OK;
+    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+
+    const get_cache_t* c = get_cache_update(gen, fresh);
+    if (c->len < 0) {
+        return get_send(req, c->body, c->len);
+    }
+
+    char inm[sizeof(c->etag)];
+    httpd_resp_set_hdr(req, "ETag", c->etag);
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", inm, sizeof(inm))
+                == ESP_OK
+        && strcmp(inm, c->etag) == 0) {
+        httpd_resp_set_status(req, "304 Not Modified");
+        return httpd_resp_send(req, NULL, 0);
+    }
+    return get_send(req, c->body, c->len);
 }
 
 static esp_err_t relay_handler(httpd_req_t* req)
@@ -113,12 +376,16 @@ static esp_err_t relay_handler(httpd_req_t* req)
     char state[8];
     if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK) {
         if (httpd_query_key_value(query, "state", state, sizeof(state)) == ESP_OK) {
+            // Ручное on/off отключает правила до state=auto
             if (strcmp(state, "on") == 0) {
-                relay_on();
+                rules_set_mode(RULES_MODE_ON);
                 httpd_resp_send(req, "Реле ВКЛЮЧЕНО", HTTPD_RESP_USE_STRLEN);
             } else if (strcmp(state, "off") == 0) {
-                relay_off();
+                rules_set_mode(RULES_MODE_OFF);
                 httpd_resp_send(req, "Реле ВЫКЛЮЧЕНО", HTTPD_RESP_USE_STRLEN);
+            } else if (strcmp(state, "auto") == 0) {
+                rules_set_mode(RULES_MODE_AUTO);
+                httpd_resp_send(req, "Реле по правилам", HTTPD_RESP_USE_STRLEN);
             } else {
                 httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Неверный параметр state");
                 return ESP_FAIL;
@@ -134,11 +401,599 @@ static esp_err_t relay_handler(httpd_req_t* req)
     return ESP_OK;
 }
 
+// Правила реле: без query — список, с query — изменение правила
+// (id=0&metric=pm2_5&on=35&off=25&n=3&m=3&enabled=1) или режима
+static esp_err_t rules_handler(httpd_req_t* req)
+{
+    char buf[640];
+
+    if (httpd_req_get_url_query_str(req, buf, sizeof(buf)) == ESP_OK) {
+        esp_err_t err = rules_apply_query(buf);
+        if (err != ESP_OK) {
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Неверное правило");
+            return ESP_FAIL;
+        }
+    }
+
+    int len = rules_format(buf, sizeof(buf));
+    if (len < 0 || (size_t)len >= sizeof(buf)) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, NULL);
+        return ESP_FAIL;
+    }
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    httpd_resp_set_hdr(req, "Connection", "close");
+    return httpd_resp_send(req, buf, len);
+}
+
+// Настройки периодов: /config?mqtt_period_ms=60000&dht_period_ms=2000
+// меняет и сохраняет, без параметров — только текущие значения
+static esp_err_t config_handler(httpd_req_t* req)
+{
+    char buf[640];
+
+    if (httpd_req_get_url_query_str(req, buf, sizeof(buf)) == ESP_OK) {
+        esp_err_t err = config_apply_query(buf);
+        if (err == ESP_ERR_INVALID_ARG || err == ESP_ERR_NOT_FOUND) {
+            httpd_resp_send_err(
+                    req, HTTPD_400_BAD_REQUEST, "Неверная настройка");
+            return ESP_FAIL;
+        }
+    }
+
+    int len = config_format(buf, sizeof(buf));
+    if (len < 0 || (size_t)len >= sizeof(buf)) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, NULL);
+        return ESP_FAIL;
+    }
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    httpd_resp_set_hdr(req, "Connection", "close");
+    return httpd_resp_send(req, buf, len);
+}
+
+// Статистика по всем метрикам, по кускам на метрику
+static esp_err_t stats_handler(httpd_req_t* req)
+{
+    char buf[768];
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    httpd_resp_set_hdr(req, "Connection", "close");
+
+    for (int m = 0; m < STATS_METRIC_COUNT; m++) {
+        buf[0] = m == 0 ? '{' : ',';
+        int len = sensor_stats_format_metric(m, buf + 1, sizeof(buf) - 1);
+        if (len < 0 || (size_t)len >= sizeof(buf) - 1) {
+            ESP_LOGE(TAG, "Статистика не поместилась в буфер");
+            httpd_resp_send_chunk(req, NULL, 0);
+            return ESP_FAIL;
+        }
+        if (httpd_resp_send_chunk(req, buf, len + 1) != ESP_OK) {
+            return ESP_FAIL;
+        }
+    }
+
+    httpd_resp_send_chunk(req, "}", 1);
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+// Ответ /metrics копится в буфере и уходит кусками по мере заполнения
+typedef struct {
+    httpd_req_t* req;
+    char buf[1024];
+    size_t len;
+    esp_err_t err;
+} metrics_out_t;
+
+static void metrics_flush(metrics_out_t* out)
+{
+    if (out->len > 0 && out->err == ESP_OK) {
+        out->err = httpd_resp_send_chunk(out->req, out->buf, out->len);
+    }
+    out->len = 0;
+}
+
+static void metrics_emit(void* ctx, const char* text, size_t len)
+{
+    metrics_out_t* out = (metrics_out_t*)ctx;
+    if (out->len + len > sizeof(out->buf)) {
+        metrics_flush(out);
+    }
+    memcpy(out->buf + out->len, text, len);
+    out->len += len;
+}
+
+// Таблица маршрутов объявлена ниже
+static int route_count(void);
+static bool route_timer_get(
+        int index, const char** name, const metrics_timer_t** timer);
+
+static esp_err_t metrics_handler(httpd_req_t* req)
+{
+    metrics_out_t out = {.req = req};
+
+    httpd_resp_set_type(req, "text/plain; version=0.0.4");
+    httpd_resp_set_hdr(req, "Connection", "close");
+
+    metrics_write(metrics_emit, &out);
+    metrics_write_timers(
+            metrics_emit,
+            &out,
+            "http_request",
+            "HTTP request handling time",
+            "uri",
+            route_timer_get,
+            route_count());
+    metrics_flush(&out);
+
+    if (out.err != ESP_OK) {
+        return ESP_FAIL;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+// Загрузка CPU и запас стека задач за окно с прошлого снимка
+static esp_err_t tasks_handler(httpd_req_t* req)
+{
+    static task_profile_t profile; // запросы httpd обрабатываются по одному
+    char buf[160];
+
+    esp_err_t err = task_profile_sample(&profile);
+    if (err == ESP_ERR_NOT_SUPPORTED) {
+        httpd_resp_send_err(
+                req,
+                HTTPD_501_METHOD_NOT_IMPLEMENTED,
+                "Run-time stats FreeRTOS выключены");
+        return ESP_FAIL;
+    }
+    if (err != ESP_OK) {
+        httpd_resp_send_err(
+                req,
+                HTTPD_500_INTERNAL_SERVER_ERROR,
+                "Задач больше TASK_PROFILE_MAX_TASKS");
+        return ESP_FAIL;
+    }
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Connection", "close");
+
+    resp_buf_t b = {.buf = buf, .size = sizeof(buf)};
+    resp_printf(&b,
+                "{\"window_ms\":%lu,\"idle\":[",
+                (unsigned long)profile.window_ms);
+    for (int c = 0; c < portNUM_PROCESSORS; c++) {
+        float idle = profile.idle_pct[c];
+        if (isfinite(idle)) {
+            resp_printf(&b, "%s%.2f", c ? "," : "", idle);
+        } else {
+            resp_printf(&b, "%snull", c ? "," : "");
+        }
+    }
+    resp_printf(&b, "],\"tasks\":[");
+    if (b.full) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, NULL);
+        return ESP_FAIL;
+    }
+    if (httpd_resp_send_chunk(req, buf, b.len) != ESP_OK) {
+        return ESP_FAIL;
+    }
+
+    for (size_t i = 0; i < profile.count; i++) {
+        buf[0] = i == 0 ? ' ' : ',';
+        int len = task_profile_format_task(
+                &profile.tasks[i], buf + 1, sizeof(buf) - 1);
+        if (len < 0 || (size_t)len >= sizeof(buf) - 1
+            || httpd_resp_send_chunk(req, buf, len + 1) != ESP_OK) {
+            httpd_resp_send_chunk(req, NULL, 0);
+            return ESP_FAIL;
+        }
+    }
+
+    httpd_resp_send_chunk(req, "]}", 2);
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+#define EXPORT_CHUNK 1024
+#define EXPORT_BATCH 16       // записей за одно чтение флеша
+#define EXPORT_ROW_MAX 64     // строка CSV с запасом
+#define EXPORT_YIELD_CHUNKS 4 // кусков между паузами на тик
+
+#define HISTORY_POINTS 300 // по умолчанию: ширина графика / 2 px
+#define HISTORY_POINTS_MAX 2000
+
+// Параметр-число из query; нет параметра — остаётся значение по
+// умолчанию. Только десятичные цифры: strtoul молча принял бы знак,
+// пробелы и переполнение
+static bool query_u32(const char* query, const char* key, uint32_t* out)
+{
+    char val[12];
+    esp_err_t err = query_value(query, key, val, sizeof(val));
+    if (err == ESP_ERR_NOT_FOUND) {
+        return true;
+    }
+    if (err != ESP_OK || val[0] < '0' || val[0] > '9') {
+        return false;
+    }
+    char* end;
+    errno = 0;
+    unsigned long v = strtoul(val, &end, 10);
+    if (*end != '\0' || errno == ERANGE || v > UINT32_MAX) {
+        return false;
+    }
+    *out = (uint32_t)v;
+    return true;
+}
+
+// Поток записей в ответ: CSV или sample_record_t подряд, кусками.
+// httpd читает заголовки по указателю при первой отправке, поэтому
+// их значения живут здесь, а не на стеке export_begin.
+typedef struct {
+    httpd_req_t* req;
+    bool bin;
+    size_t len;
+    unsigned chunks;
+    char disposition[48];
+    char chunk[EXPORT_CHUNK];
+} export_out_t;
+
+// Разбор format= и заголовки ответа; false — ответ уже отправлен
+static bool export_begin(
+        httpd_req_t* req,
+        const char* format,
+        const char* name,
+        export_out_t* out)
+{
+    out->req = req;
+    out->bin = strcmp(format, "bin") == 0;
+    out->len = 0;
+    out->chunks = 0;
+    if (!out->bin && strcmp(format, "csv") != 0) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Неверный формат");
+        return false;
+    }
+    if (!sample_store_ready()) {
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        httpd_resp_send(req, "Архив недоступен", HTTPD_RESP_USE_STRLEN);
+        return false;
+    }
+
+    snprintf(
+            out->disposition,
+            sizeof(out->disposition),
+            "attachment; filename=\"%s.%s\"",
+            name,
+            out->bin ? "bin" : "csv");
+    httpd_resp_set_type(
+            req,
+            out->bin ? "application/octet-stream" : "text/csv; charset=utf-8");
+    httpd_resp_set_hdr(req, "Content-Disposition", out->disposition);
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    httpd_resp_set_hdr(req, "Connection", "close");
+
+    if (!out->bin) {
+        out->len = strlen(SAMPLE_CSV_HEADER);
+        memcpy(out->chunk, SAMPLE_CSV_HEADER, out->len);
+    }
+    return true;
+}
+
+static esp_err_t export_put(export_out_t* out, const sample_record_t* r)
+{
+    if (out->len + EXPORT_ROW_MAX > sizeof(out->chunk)) {
+        if (httpd_resp_send_chunk(out->req, out->chunk, out->len) != ESP_OK) {
+            return ESP_FAIL;
+        }
+        out->len = 0;
+        if (++out->chunks % EXPORT_YIELD_CHUNKS == 0) {
+            vTaskDelay(1);
+        }
+    }
+    if (out->bin) {
+        memcpy(out->chunk + out->len, r, sizeof(*r));
+        out->len += sizeof(*r);
+    } else {
+        out->len += sample_encode_csv(
+                r, out->chunk + out->len, sizeof(out->chunk) - out->len);
+    }
+    return ESP_OK;
+}
+
+static esp_err_t export_end(export_out_t* out)
+{
+    if (out->len > 0
+        && httpd_resp_send_chunk(out->req, out->chunk, out->len) != ESP_OK) {
+        return ESP_FAIL;
+    }
+    return httpd_resp_send_chunk(out->req, NULL, 0);
+}
+
+// Выгрузка архива: /export?from=&to=&format=csv|bin&step=
+// from и to — UNIX-время включительно, step — не чаще записи в step с.
+// bin — записи sample_record_t подряд (19 байт, little-endian).
+// Память не зависит от диапазона: записи читаются порциями и уходят
+// кусками, а каждые несколько кусков задача отдаёт тик остальным.
+static esp_err_t export_handler(httpd_req_t* req)
+{
+    char query[96];
+    char format[8] = "csv";
+    uint32_t from = 0, to = UINT32_MAX, step = 0;
+
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK) {
+        httpd_query_key_value(query, "format", format, sizeof(format));
+        if (!query_u32(query, "from", &from) || !query_u32(query, "to", &to)
+            || !query_u32(query, "step", &step)) {
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Неверное число");
+            return ESP_FAIL;
+        }
+    }
+    if (from > to) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Неверный запрос");
+        return ESP_FAIL;
+    }
+
+    export_out_t out;
+    if (!export_begin(req, format, "history", &out)) {
+        return ESP_OK;
+    }
+
+    sample_record_t recs[EXPORT_BATCH];
+    sample_store_iter_t it;
+    sample_store_seek(&it, from);
+    uint32_t next = from;
+    size_t n;
+
+    while ((n = sample_store_read(&it, recs, EXPORT_BATCH)) > 0) {
+        for (size_t i = 0; i < n; i++) {
+            const sample_record_t* r = &recs[i];
+            if (r->time_s > to) {
+                return export_end(&out);
+            }
+            if (r->time_s < next) {
+                continue;
+            }
+            if (step > 0) {
+                next = r->time_s + step;
+            }
+            if (export_put(&out, r) != ESP_OK) {
+                return ESP_FAIL;
+            }
+        }
+    }
+    return export_end(&out);
+}
+
+static size_t history_read(void* ctx, sample_record_t* out, size_t max)
+{
+    return sample_store_read((sample_store_iter_t*)ctx, out, max);
+}
+
+static bool history_emit(void* ctx, const sample_record_t* r)
+{
+    return export_put((export_out_t*)ctx, r) == ESP_OK;
+}
+
+// Прореженный архив для графиков:
+// /history?from=&to=&points=&mode=mean|minmax|lttb&field=&format=
+// Диапазон по умолчанию — весь архив, points — число корзин по времени
+// (см. sample_downsample.h), field — имя столбца CSV для minmax и lttb.
+// Формат как у /export, по умолчанию bin: 300 точек — меньше 6 КБ
+// при любой длине диапазона, месяц архива в CSV — около 12 КБ.
+// Память постоянная; lttb читает архив дважды со сдвигом на корзину.
+static esp_err_t history_handler(httpd_req_t* req)
+{
+    char query[128];
+    char format[8] = "bin";
+    char mode[8] = "mean";
+    char field[16] = "temperature";
+    sample_store_info_t info;
+    sample_store_get_info(&info);
+    sample_ds_config_t cfg = {
+            .from_s = info.oldest_s,
+            .to_s = info.newest_s,
+            .points = HISTORY_POINTS,
+    };
+
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK) {
+        httpd_query_key_value(query, "format", format, sizeof(format));
+        httpd_query_key_value(query, "mode", mode, sizeof(mode));
+        httpd_query_key_value(query, "field", field, sizeof(field));
+        if (!query_u32(query, "from", &cfg.from_s)
+            || !query_u32(query, "to", &cfg.to_s)
+            || !query_u32(query, "points", &cfg.points)) {
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Неверное число");
+            return ESP_FAIL;
+        }
+    }
+    if (cfg.from_s > cfg.to_s || cfg.points == 0
+        || cfg.points > HISTORY_POINTS_MAX
+        || !sample_ds_mode_parse(mode, &cfg.mode)
+        || !sample_field_parse(field, &cfg.field)) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Неверный запрос");
+        return ESP_FAIL;
+    }
+
+    export_out_t out;
+    if (!export_begin(req, format, "history", &out)) {
+        return ESP_OK;
+    }
+
+    // Корзины только по той части диапазона, где есть записи
+    if (info.count > 0) {
+        if (cfg.from_s < info.oldest_s) {
+            cfg.from_s = info.oldest_s;
+        }
+        if (cfg.to_s > info.newest_s) {
+            cfg.to_s = info.newest_s;
+        }
+    }
+
+    sample_store_iter_t it, lead;
+    sample_store_seek(&it, cfg.from_s);
+    lead = it;
+    cfg.read = history_read;
+    cfg.src = &it;
+    cfg.lead = &lead;
+    cfg.emit = history_emit;
+    cfg.emit_ctx = &out;
+    if (!sample_downsample(&cfg)) {
+        return ESP_FAIL;
+    }
+    return export_end(&out);
+}
+
+typedef struct {
+    const char* uri;
+    httpd_method_t method;
+    esp_err_t (*handler)(httpd_req_t* req);
+    bool async; // долгий ответ: выполняется в пуле рабочих задач
+} web_route_t;
+
+static const web_route_t s_routes[] = {
+        {"/relay", HTTP_GET, relay_handler, false},
+        {"/get", HTTP_GET, get_handler, false},
+        {"/stats", HTTP_GET, stats_handler, true},
+        {"/rules", HTTP_GET, rules_handler, false},
+        {"/config", HTTP_GET, config_handler, false},
+        {"/metrics", HTTP_GET, metrics_handler, true},
+        {"/debug/tasks", HTTP_GET, tasks_handler, false},
+        {"/export", HTTP_GET, export_handler, true},
+        {"/history", HTTP_GET, history_handler, true},
+};
+
+#define ROUTE_COUNT (sizeof(s_routes) / sizeof(s_routes[0]))
+
+static metrics_timer_t s_route_timers[ROUTE_COUNT];
+static metrics_timer_t s_asset_timer; // все встроенные файлы вместе
+
+// Маршруты и последней строкой встроенные файлы
+static int route_count(void)
+{
+    return ROUTE_COUNT + 1;
+}
+
+static bool route_timer_get(
+        int index, const char** name, const metrics_timer_t** timer)
+{
+    if ((size_t)index == ROUTE_COUNT) {
+        *name = "static";
+        *timer = &s_asset_timer;
+        return true;
+    }
+    if (index < 0 || (size_t)index >= ROUTE_COUNT) {
+        return false;
+    }
+    *name = s_routes[index].uri;
+    *timer = &s_route_timers[index];
+    return true;
+}
+
+// На время запроса система не уходит в light sleep
+static esp_err_t route_run(httpd_req_t* req, const web_route_t* route)
+{
+    power_lock_acquire(POWER_LOCK_HTTP);
+    int64_t start_us = esp_timer_get_time();
+    esp_err_t err = route->handler(req);
+    metrics_timer_record(
+            &s_route_timers[route - s_routes],
+            (uint32_t)(esp_timer_get_time() - start_us),
+            err == ESP_OK);
+    power_lock_release(POWER_LOCK_HTTP);
+    return err;
+}
+
+// Долгие ответы уходят в пул, чтобы не задерживать /get и файлы
+// на единственной задаче httpd; запрос живёт как асинхронная копия
+static void web_worker_task(void* arg)
+{
+    httpd_req_t* req;
+
+    while (1) {
+        if (xQueueReceive(s_work_queue, &req, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        route_run(req, (const web_route_t*)req->user_ctx);
+        httpd_req_async_handler_complete(req);
+    }
+}
+
+static esp_err_t web_send_busy(httpd_req_t* req)
+{
+    metrics_inc(METRIC_HTTP_BUSY);
+    httpd_resp_set_status(req, "503 Service Unavailable");
+    httpd_resp_set_hdr(req, "Retry-After", WEB_RETRY_AFTER_S);
+    httpd_resp_set_hdr(req, "Connection", "close");
+    return httpd_resp_send(req, "Сервер занят", HTTPD_RESP_USE_STRLEN);
+}
+
+// Все маршруты вызываются через эту обёртку
+static esp_err_t pm_handler(httpd_req_t* req)
+{
+    const web_route_t* route = (const web_route_t*)req->user_ctx;
+    if (!route->async || s_work_queue == NULL) {
+        return route_run(req, route);
+    }
+
+    // В очередь ставит только задача httpd, проверка места не гонится
+    if (uxQueueSpacesAvailable(s_work_queue) == 0) {
+        return web_send_busy(req);
+    }
+    httpd_req_t* copy = NULL;
+    if (httpd_req_async_handler_begin(req, &copy) != ESP_OK) {
+        return web_send_busy(req);
+    }
+    if (xQueueSend(s_work_queue, &copy, 0) != pdTRUE) {
+        httpd_req_async_handler_complete(copy);
+        return web_send_busy(req);
+    }
+    return ESP_OK;
+}
+
+static void web_workers_start(void)
+{
+    s_work_queue = xQueueCreate(WEB_WORK_QUEUE_LEN, sizeof(httpd_req_t*));
+    if (s_work_queue == NULL) {
+        ESP_LOGW(TAG, "Нет памяти под очередь, долгие запросы в httpd");
+        return;
+    }
+    for (int i = 0; i < WEB_WORKERS; i++) {
+        if (xTaskCreate(
+                    web_worker_task,
+                    "web_worker",
+                    WEB_WORKER_STACK,
+                    NULL,
+                    WEB_WORKER_PRIO,
+                    NULL)
+            != pdPASS) {
+            ESP_LOGW(TAG, "Рабочая задача %d не создана", i);
+        }
+    }
+}
+
+static esp_err_t asset_pm_handler(httpd_req_t* req)
+{
+    power_lock_acquire(POWER_LOCK_HTTP);
+    int64_t start_us = esp_timer_get_time();
+    esp_err_t err = asset_handler(req);
+    metrics_timer_record(
+            &s_asset_timer,
+            (uint32_t)(esp_timer_get_time() - start_us),
+            err == ESP_OK);
+    power_lock_release(POWER_LOCK_HTTP);
+    return err;
+}
+
 void start_webserver(void)
 {
+    s_boot_id = esp_random();
+
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
     config.max_open_sockets = 13;
     config.lru_purge_enable = true;
+    config.max_uri_handlers = ROUTE_COUNT + web_asset_count;
+    config.stack_size = 6144; // ответы собираются в буферах на стеке
+
+    web_workers_start();
 
     httpd_handle_t server = NULL;
     if (httpd_start(&server, &config) != ESP_OK) {
@@ -146,16 +1001,26 @@ void start_webserver(void)
         return;
     }
 
-    httpd_uri_t root = {.uri = "/", .method = HTTP_GET, .handler = root_handler, .user_ctx = NULL};
-    httpd_register_uri_handler(server, &root);
-    httpd_uri_t css = {.uri = "/style.css", .method = HTTP_GET, .handler = css_handler, .user_ctx = NULL};
-    httpd_register_uri_handler(server, &css);
-    httpd_uri_t js = {.uri = "/script.js", .method = HTTP_GET, .handler = js_handler, .user_ctx = NULL};
-    httpd_register_uri_handler(server, &js);
-    httpd_uri_t set = {.uri = "/relay", .method = HTTP_GET, .handler = relay_handler, .user_ctx = NULL};
-    httpd_register_uri_handler(server, &set);
-    httpd_uri_t get = {.uri = "/get", .method = HTTP_GET, .handler = get_handler, .user_ctx = NULL};
-    httpd_register_uri_handler(server, &get);
+    for (size_t i = 0; i < ROUTE_COUNT; i++) {
+        httpd_uri_t uri = {
+                .uri = s_routes[i].uri,
+                .method = s_routes[i].method,
+                .handler = pm_handler,
+                .user_ctx = (void*)&s_routes[i],
+        };
+        httpd_register_uri_handler(server, &uri);
+    }
+
+    // Таблицу встроенных файлов генерирует gzip_assets.py
+    for (size_t i = 0; i < web_asset_count; i++) {
+        httpd_uri_t uri = {
+                .uri = web_assets[i].uri,
+                .method = HTTP_GET,
+                .handler = asset_pm_handler,
+                .user_ctx = (void*)&web_assets[i],
+        };
+        httpd_register_uri_handler(server, &uri);
+    }
 
     ESP_LOGI(TAG, "HTTP server started");
 }
\ No newline at end of file
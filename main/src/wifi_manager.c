@@ -0,0 +1,356 @@
+#include "wifi_manager.h"
+#include "esp_event.h"
+#include "esp_log.h"
+#include "esp_netif.h"
+#include "esp_random.h"
+#include "esp_timer.h"
+#include "esp_wifi.h"
+#include "freertos/event_groups.h"
+#include "nvs.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char* TAG = "WIFI";
+
+#define WIFI_NVS_KEY "ap"
+
+// Точка доступа последнего подключения. SSID хранится, чтобы после
+// смены сети в прошивке не идти на старый BSSID.
+typedef struct {
+    char ssid[33];
+    uint8_t bssid[6];
+    uint8_t channel;
+} wifi_ap_cache_t;
+
+static EventGroupHandle_t s_events;
+static esp_timer_handle_t s_retry_timer;
+static wifi_config_t s_sta_config;
+static wifi_ap_cache_t s_cache; // сохранённая в NVS
+static bool s_cache_valid = false;
+static wifi_ap_cache_t s_assoc; // текущая ассоциация
+static bool s_pinned = false;   // STA привязана к BSSID и каналу кэша
+static bool s_stopping = false;
+static uint32_t s_attempt = 0; // попыток с последнего IP
+static int64_t s_lost_us = 0;  // начало обрыва
+static portMUX_TYPE s_timing_mux = portMUX_INITIALIZER_UNLOCKED;
+static wifi_manager_timing_t s_timing;
+
+static bool cache_load(const char* ssid, wifi_ap_cache_t* out)
+{
+    nvs_handle_t nvs;
+    if (nvs_open(WIFI_NVS_NAMESPACE, NVS_READONLY, &nvs) != ESP_OK) {
+        return false;
+    }
+    size_t len = sizeof(*out);
+    esp_err_t err = nvs_get_blob(nvs, WIFI_NVS_KEY, out, &len);
+    nvs_close(nvs);
+    if (err != ESP_OK || len != sizeof(*out)) {
+        return false;
+    }
+    out->ssid[sizeof(out->ssid) - 1] = '\0';
+    return out->channel >= 1 && out->channel <= 14
+        && strcmp(out->ssid, ssid) == 0;
+}
+
+static void cache_save(const wifi_ap_cache_t* ap)
+{
+    nvs_handle_t nvs;
+    esp_err_t err = nvs_open(WIFI_NVS_NAMESPACE, NVS_READWRITE, &nvs);
+    if (err == ESP_OK) {
+        err = nvs_set_blob(nvs, WIFI_NVS_KEY, ap, sizeof(*ap));
+        if (err == ESP_OK) {
+            err = nvs_commit(nvs);
+        }
+        nvs_close(nvs);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGW(
+                TAG,
+                "Не удалось сохранить точку доступа: %s",
+                esp_err_to_name(err));
+    }
+}
+
+static void sta_pin(bool pin)
+{
+    s_pinned = pin && s_cache_valid;
+    s_sta_config.sta.bssid_set = s_pinned;
+    s_sta_config.sta.channel = s_pinned ? s_cache.channel : 0;
+    memcpy(s_sta_config.sta.bssid,
+           s_cache.bssid,
+           sizeof(s_sta_config.sta.bssid));
+    esp_wifi_set_config(WIFI_IF_STA, &s_sta_config);
+}
+
+// Задержка n-го повтора: MIN·2^(n-1) до MAX, из них половина случайна
+static uint32_t retry_delay_ms(uint32_t n)
+{
+    uint32_t delay = WIFI_RETRY_MAX_MS;
+    if (n - 1 < 16 && (WIFI_RETRY_MIN_MS << (n - 1)) < WIFI_RETRY_MAX_MS) {
+        delay = WIFI_RETRY_MIN_MS << (n - 1);
+    }
+    return delay / 2 + esp_random() % (delay / 2 + 1);
+}
+
+static void retry_cb(void* arg)
+{
+    if (!s_stopping) {
+        esp_wifi_connect();
+    }
+}
+
+static void on_disconnected(const wifi_event_sta_disconnected_t* e)
+{
+    xEventGroupClearBits(s_events, WIFI_CONNECTED_BIT);
+    if (s_stopping) {
+        return;
+    }
+    if (s_lost_us == 0) {
+        s_lost_us = esp_timer_get_time();
+    }
+
+    uint32_t n = s_attempt++;
+    if (n == 0) {
+        // Первый повтор после обрыва — сразу и к той же точке
+        ESP_LOGW(TAG, "Отключён, причина: %d. Повтор...", e->reason);
+        sta_pin(true);
+        esp_wifi_connect();
+    } else if (n == 1 && s_pinned) {
+        ESP_LOGW(
+                TAG,
+                "Точка доступа из кэша недоступна (причина %d), "
+                "сканирование",
+                e->reason);
+        sta_pin(false);
+        esp_wifi_connect();
+    } else {
+        uint32_t delay = retry_delay_ms(n);
+        ESP_LOGW(
+                TAG,
+                "Отключён, причина: %d. Повтор %lu через %lu мс",
+                e->reason,
+                (unsigned long)n,
+                (unsigned long)delay);
+        esp_timer_start_once(s_retry_timer, (uint64_t)delay * 1000);
+    }
+}
+
+static void on_connected(const wifi_event_sta_connected_t* e)
+{
+    size_t len = e->ssid_len < sizeof(e->ssid) ? e->ssid_len
+                                                : sizeof(e->ssid);
+    memset(&s_assoc, 0, sizeof(s_assoc));
+    memcpy(s_assoc.ssid, e->ssid, len);
+    memcpy(s_assoc.bssid, e->bssid, sizeof(s_assoc.bssid));
+    s_assoc.channel = e->channel;
+
+    portENTER_CRITICAL(&s_timing_mux);
+    if (s_timing.assoc_us == 0) {
+        s_timing.assoc_us = esp_timer_get_time();
+    }
+    portEXIT_CRITICAL(&s_timing_mux);
+}
+
+static void on_got_ip(const ip_event_got_ip_t* e)
+{
+    int64_t now = esp_timer_get_time();
+    ESP_LOGI(
+            TAG,
+            "Подключено к роутеру, IP: " IPSTR ", канал %u",
+            IP2STR(&e->ip_info.ip),
+            s_assoc.channel);
+
+    portENTER_CRITICAL(&s_timing_mux);
+    bool first = s_timing.ip_us == 0;
+    if (first) {
+        s_timing.ip_us = now;
+        s_timing.cached = s_pinned;
+    }
+    wifi_manager_timing_t t = s_timing;
+    portEXIT_CRITICAL(&s_timing_mux);
+
+    if (first) {
+        ESP_LOGI(
+                TAG,
+                "От старта до IP %lld мс: запуск WiFi %lld, ассоциация "
+                "%lld, DHCP %lld (%s)",
+                (long long)(t.ip_us / 1000),
+                (long long)(t.start_us / 1000),
+                (long long)(t.assoc_us - t.start_us) / 1000,
+                (long long)(t.ip_us - t.assoc_us) / 1000,
+                t.cached ? "по кэшу" : "сканирование");
+    } else if (s_lost_us != 0) {
+        ESP_LOGI(
+                TAG,
+                "Связь восстановлена за %lld мс, попыток %lu",
+                (long long)(now - s_lost_us) / 1000,
+                (unsigned long)s_attempt);
+    }
+    s_attempt = 0;
+    s_lost_us = 0;
+
+    // Flash пишется только при смене точки доступа или канала
+    if (!s_cache_valid || memcmp(&s_cache, &s_assoc, sizeof(s_cache)) != 0) {
+        s_cache = s_assoc;
+        s_cache_valid = true;
+        cache_save(&s_cache);
+    }
+
+    xEventGroupSetBits(s_events, WIFI_CONNECTED_BIT);
+}
+
+static void
+wifi_event_handler(void* arg, esp_event_base_t base, int32_t id, void* data)
+{
+    if (base == WIFI_EVENT && id == WIFI_EVENT_STA_START) {
+        s_attempt = 1;
+        esp_wifi_connect();
+    } else if (base == WIFI_EVENT && id == WIFI_EVENT_STA_CONNECTED) {
+        on_connected((wifi_event_sta_connected_t*)data);
+    } else if (base == WIFI_EVENT && id == WIFI_EVENT_STA_DISCONNECTED) {
+        on_disconnected((wifi_event_sta_disconnected_t*)data);
+    } else if (base == WIFI_EVENT && id == WIFI_EVENT_AP_STACONNECTED) {
+        wifi_event_ap_staconnected_t* e = (wifi_event_ap_staconnected_t*)data;
+        ESP_LOGI(
+                TAG,
+                "К локальной точке доступа подключился клиент "
+                "%02x:%02x:%02x:%02x:%02x:%02x",
+                e->mac[0],
+                e->mac[1],
+                e->mac[2],
+                e->mac[3],
+                e->mac[4],
+                e->mac[5]);
+    } else if (base == IP_EVENT && id == IP_EVENT_STA_GOT_IP) {
+        on_got_ip((ip_event_got_ip_t*)data);
+    }
+}
+
+void wifi_manager_start(const wifi_manager_config_t* cfg)
+{
+    s_events = xEventGroupCreate();
+    s_stopping = false;
+
+    const esp_timer_create_args_t timer_args = {
+            .callback = retry_cb,
+            .name = "wifi_retry",
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&timer_args, &s_retry_timer));
+
+    esp_netif_create_default_wifi_sta();
+    if (cfg->ap_ssid != NULL) {
+        esp_netif_create_default_wifi_ap();
+    }
+
+    wifi_init_config_t init = WIFI_INIT_CONFIG_DEFAULT();
+    ESP_ERROR_CHECK(esp_wifi_init(&init));
+
+    ESP_ERROR_CHECK(esp_event_handler_register(
+            WIFI_EVENT, ESP_EVENT_ANY_ID, &wifi_event_handler, NULL));
+    ESP_ERROR_CHECK(esp_event_handler_register(
+            IP_EVENT, IP_EVENT_STA_GOT_IP, &wifi_event_handler, NULL));
+
+    memset(&s_sta_config, 0, sizeof(s_sta_config));
+    snprintf((char*)s_sta_config.sta.ssid,
+            sizeof(s_sta_config.sta.ssid),
+            "%s",
+            cfg->sta_ssid);
+    snprintf((char*)s_sta_config.sta.password,
+            sizeof(s_sta_config.sta.password),
+            "%s",
+            cfg->sta_password);
+    s_cache_valid = cache_load(cfg->sta_ssid, &s_cache);
+
+    if (cfg->ap_ssid != NULL) {
+        wifi_config_t ap_config = {
+                .ap =
+                        {
+                                .channel = cfg->ap_channel,
+                                .max_connection = cfg->ap_max_conn,
+                                .authmode = WIFI_AUTH_WPA2_PSK,
+                        },
+        };
+        snprintf((char*)ap_config.ap.ssid,
+                sizeof(ap_config.ap.ssid),
+                "%s",
+                cfg->ap_ssid);
+        ap_config.ap.ssid_len = strlen((char*)ap_config.ap.ssid);
+        snprintf((char*)ap_config.ap.password,
+                sizeof(ap_config.ap.password),
+                "%s",
+                cfg->ap_password);
+        if (strlen(cfg->ap_password) == 0) {
+            ap_config.ap.authmode = WIFI_AUTH_OPEN;
+        }
+        ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_APSTA));
+        ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_AP, &ap_config));
+    } else {
+        ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_STA));
+    }
+    sta_pin(true);
+
+    portENTER_CRITICAL(&s_timing_mux);
+    s_timing.start_us = esp_timer_get_time();
+    portEXIT_CRITICAL(&s_timing_mux);
+    ESP_ERROR_CHECK(esp_wifi_start());
+
+    // Modem sleep: радио просыпается к DTIM-маякам роутера. Пока
+    // к точке доступа подключены клиенты, драйвер его не включает.
+    if (cfg->power_save) {
+        esp_err_t err = esp_wifi_set_ps(WIFI_PS_MIN_MODEM);
+        if (err != ESP_OK) {
+            ESP_LOGW(TAG, "Modem sleep недоступен: %s", esp_err_to_name(err));
+        }
+    }
+
+    if (cfg->ap_ssid != NULL) {
+        ESP_LOGI(
+                TAG,
+                "Локальная точка доступа \"%s\" запущена (http://192.168.4.1)",
+                cfg->ap_ssid);
+    }
+    if (s_pinned) {
+        ESP_LOGI(
+                TAG,
+                "Подключение к \"%s\" по кэшу: "
+                "%02x:%02x:%02x:%02x:%02x:%02x, канал %u",
+                cfg->sta_ssid,
+                s_cache.bssid[0],
+                s_cache.bssid[1],
+                s_cache.bssid[2],
+                s_cache.bssid[3],
+                s_cache.bssid[4],
+                s_cache.bssid[5],
+                s_cache.channel);
+    } else {
+        ESP_LOGI(
+                TAG,
+                "Идёт подключение к домашней сети \"%s\"...",
+                cfg->sta_ssid);
+    }
+}
+
+void wifi_manager_stop(void)
+{
+    s_stopping = true;
+    esp_timer_stop(s_retry_timer);
+    esp_wifi_disconnect();
+    esp_wifi_stop();
+}
+
+bool wifi_manager_wait_connected(TickType_t timeout)
+{
+    if (s_events == NULL) {
+        return false;
+    }
+    EventBits_t bits = xEventGroupWaitBits(
+            s_events, WIFI_CONNECTED_BIT, pdFALSE, pdTRUE, timeout);
+    return (bits & WIFI_CONNECTED_BIT) != 0;
+}
+
+void wifi_manager_get_timing(wifi_manager_timing_t* out)
+{
+    portENTER_CRITICAL(&s_timing_mux);
+    *out = s_timing;
+    portEXIT_CRITICAL(&s_timing_mux);
+}
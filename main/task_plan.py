@@ -0,0 +1,159 @@
+import argparse
+import json
+import re
+import urllib.request
+from pathlib import Path
+
+# Запас к реально использованному стеку и шаг округления
+STACK_MARGIN = 1.3
+STACK_EXTRA = 512
+STACK_STEP = 256
+STACK_MIN = 2048
+
+# Задачи, которые нельзя переносить между ядрами
+FIXED_CORES = {
+    # Критическая секция чтения DHT22 (см. sensor_sched.c)
+    "sensor_worker": 1,
+}
+
+CREATE_RE = re.compile(
+    r"xTaskCreate(PinnedToCore)?\s*\(\s*(\w+)\s*,\s*\"([^\"]+)\"\s*,"
+    r"\s*([^,]+?)\s*,\s*[^,]+,\s*([^,]+?)\s*,\s*[^,)]+\s*(?:,\s*([^)]+?))?\s*\)",
+    re.S,
+)
+DEFINE_RE = re.compile(r"^\s*#define\s+(\w+)\s+([^\s/]+)", re.M)
+
+
+def load_profile(source: str) -> dict:
+    if source.startswith("http://") or source.startswith("https://"):
+        with urllib.request.urlopen(source, timeout=10) as resp:
+            return json.load(resp)
+    return json.loads(Path(source).read_text(encoding="utf-8"))
+
+
+def scan_sources(src_dir: Path) -> dict:
+    """Имя задачи -> (размер стека, ядро) из вызовов xTaskCreate*."""
+    files = list(src_dir.rglob("*.c")) + list(src_dir.rglob("*.h"))
+    defines = {}
+    for f in files:
+        for name, value in DEFINE_RE.findall(f.read_text(encoding="utf-8")):
+            defines[name] = value
+
+    def resolve(expr: str):
+        expr = expr.strip()
+        for _ in range(5):
+            if expr in defines:
+                expr = defines[expr]
+        try:
+            return int(eval(expr, {}, {}))
+        except Exception:
+            return None
+
+    tasks = {}
+    for f in files:
+        text = f.read_text(encoding="utf-8")
+        for pinned, _fn, name, stack, _prio, core in CREATE_RE.findall(text):
+            core_val = resolve(core) if pinned and core else None
+            if core_val is not None and core_val > 1:
+                core_val = None  # tskNO_AFFINITY
+            tasks[name] = {
+                "stack": resolve(stack),
+                "core": core_val,
+                "file": f.name,
+            }
+    return tasks
+
+
+def recommend_stack(configured: int, free: int) -> int:
+    used = configured - free
+    size = int(used * STACK_MARGIN) + STACK_EXTRA
+    size = (size + STACK_STEP - 1) // STACK_STEP * STACK_STEP
+    return max(size, STACK_MIN)
+
+
+def plan_cores(profile: dict, app: dict) -> tuple[dict, list]:
+    """Жадно раскладывает задачи приложения по ядрам по загрузке.
+
+    Возвращает план {задача: ядро} и итоговую загрузку ядер, %.
+    """
+    cores = len(profile["idle"])
+    load = [0.0] * cores
+    movable = []
+
+    # Системные задачи и закреплённые остаются на своих ядрах
+    for t in profile["tasks"]:
+        name = t["name"]
+        if name.startswith("IDLE"):
+            continue
+        if name in app and name not in FIXED_CORES:
+            movable.append(t)
+        elif t["core"] >= 0:
+            core = FIXED_CORES.get(name, t["core"])
+            load[core] += t["cpu"] * cores
+
+    plan = dict(FIXED_CORES)
+    # Одноимённые задачи (пул tunnel_worker) считаются вместе
+    by_name = {}
+    for t in movable:
+        by_name[t["name"]] = by_name.get(t["name"], 0.0) + t["cpu"] * cores
+    for name, cpu in sorted(by_name.items(), key=lambda kv: -kv[1]):
+        core = min(range(cores), key=lambda c: load[c])
+        load[core] += cpu
+        plan[name] = core
+    return plan, load
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Размеры стеков и раскладка задач по ядрам "
+        "по выводу /debug/tasks"
+    )
+    parser.add_argument(
+        "profile", help="URL /debug/tasks или файл с сохранённым JSON"
+    )
+    parser.add_argument(
+        "--src",
+        default=str(Path(__file__).parent),
+        help="каталог исходников прошивки (по умолчанию main/)",
+    )
+    args = parser.parse_args()
+
+    profile = load_profile(args.profile)
+    app = scan_sources(Path(args.src))
+
+    print(f"Окно замера: {profile['window_ms']} мс")
+    for core, idle in enumerate(profile["idle"]):
+        print(f"  ядро {core}: простой {idle:.1f}%")
+
+    print("\nСтеки задач приложения:")
+    print(f"  {'задача':<16}{'сейчас':>8}{'занято':>8}{'надо':>8}  файл")
+    seen = set()
+    for t in sorted(profile["tasks"], key=lambda t: t["name"]):
+        name = t["name"]
+        info = app.get(name)
+        if info is None or info["stack"] is None or name in seen:
+            continue
+        seen.add(name)
+        # У пула одноимённых задач берём худший запас
+        free = min(x["stack_free"] for x in profile["tasks"]
+                   if x["name"] == name)
+        rec = recommend_stack(info["stack"], free)
+        mark = "  <-- мало" if rec > info["stack"] else ""
+        print(
+            f"  {name:<16}{info['stack']:>8}{info['stack'] - free:>8}"
+            f"{rec:>8}  {info['file']}{mark}"
+        )
+
+    plan, load = plan_cores(profile, app)
+    print("\nРаскладка по ядрам:")
+    for name in sorted(plan):
+        current = app.get(name, {}).get("core")
+        current = "любое" if current is None else current
+        fixed = " (закреплена)" if name in FIXED_CORES else ""
+        print(f"  {name:<16} сейчас {current!s:>6} -> ядро {plan[name]}{fixed}")
+    for core, value in enumerate(load):
+        print(f"  ожидаемая загрузка ядра {core}: {value:.1f}%")
+
+
+if __name__ == "__main__":
+    main()